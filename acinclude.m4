@@ -3,6 +3,11 @@ AC_DEFUN([AX_LIBSIGSCAN_CHECK_LOCAL],
   [dnl Check for internationalization functions in libsigscan/libsigscan_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
 
+  dnl Check for memory mapped file functions in libsigscan/libsigscan_mapped_file.c
+  AC_CHECK_HEADERS([errno.h fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+  AC_CHECK_FUNCS([madvise mmap munmap sysconf])
+
   dnl Check if library should be build with verbose output
   AX_COMMON_CHECK_ENABLE_VERBOSE_OUTPUT
 
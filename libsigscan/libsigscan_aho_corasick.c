@@ -0,0 +1,708 @@
+/*
+ * Aho-Corasick automaton functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_aho_corasick.h"
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcnotify.h"
+#include "libsigscan_signature.h"
+
+/* Creates an Aho-Corasick automaton
+ * Make sure the value aho_corasick is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_aho_corasick_initialize(
+     libsigscan_aho_corasick_t **aho_corasick,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_aho_corasick_initialize";
+
+	if( aho_corasick == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Aho-Corasick automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( *aho_corasick != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Aho-Corasick automaton value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*aho_corasick = memory_allocate_structure(
+	                 libsigscan_aho_corasick_t );
+
+	if( *aho_corasick == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Aho-Corasick automaton.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *aho_corasick,
+	     0,
+	     sizeof( libsigscan_aho_corasick_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Aho-Corasick automaton.",
+		 function );
+
+		memory_free(
+		 *aho_corasick );
+
+		*aho_corasick = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *aho_corasick != NULL )
+	{
+		memory_free(
+		 *aho_corasick );
+
+		*aho_corasick = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an Aho-Corasick automaton
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_aho_corasick_free(
+     libsigscan_aho_corasick_t **aho_corasick,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_aho_corasick_free";
+
+	if( aho_corasick == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Aho-Corasick automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( *aho_corasick != NULL )
+	{
+		/* The output signatures are referenced and freed elsewhere
+		 */
+		if( ( *aho_corasick )->output_signatures != NULL )
+		{
+			memory_free(
+			 ( *aho_corasick )->output_signatures );
+		}
+		if( ( ( ( *aho_corasick )->data_flags & LIBSIGSCAN_SCAN_DATA_FLAG_REFERENCED ) == 0 )
+		 && ( ( *aho_corasick )->transitions_table != NULL ) )
+		{
+			memory_free(
+			 ( *aho_corasick )->transitions_table );
+		}
+		memory_free(
+		 *aho_corasick );
+
+		*aho_corasick = NULL;
+	}
+	return( 1 );
+}
+
+/* Builds the Aho-Corasick automaton
+ * Only signatures without an offset (unbound signatures) are added to the automaton
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_aho_corasick_build(
+     libsigscan_aho_corasick_t *aho_corasick,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	static char *function                 = "libsigscan_aho_corasick_build";
+	uint32_t *failure_states              = NULL;
+	uint32_t *states_queue                = NULL;
+	size_t maximum_number_of_states       = 1;
+	size_t pattern_index                  = 0;
+	uint32_t failure_state                = 0;
+	uint32_t next_state                   = 0;
+	uint32_t queue_end_index              = 0;
+	uint32_t queue_start_index            = 0;
+	uint32_t state                        = 0;
+	uint16_t byte_value                   = 0;
+	int pass                              = 0;
+
+	if( aho_corasick == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Aho-Corasick automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( aho_corasick->transitions_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Aho-Corasick automaton - transitions table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first pass determines the maximum number of states
+	 * the second pass adds the patterns to the automaton
+	 */
+	for( pass = 0;
+	     pass < 2;
+	     pass++ )
+	{
+		if( libcdata_list_get_first_element(
+		     signatures_list,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first list element.",
+			 function );
+
+			goto on_error;
+		}
+		while( list_element != NULL )
+		{
+			if( libcdata_list_element_get_value(
+			     list_element,
+			     (intptr_t **) &signature,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve signature.",
+				 function );
+
+				goto on_error;
+			}
+			if( signature == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing signature.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET )
+			{
+				if( pass == 0 )
+				{
+					if( signature->pattern_size > ( (size_t) UINT32_MAX - maximum_number_of_states ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+						 "%s: invalid maximum number of states value exceeds maximum.",
+						 function );
+
+						goto on_error;
+					}
+					maximum_number_of_states += signature->pattern_size;
+				}
+				else
+				{
+					/* Add the pattern to the trie, state 0 is the root state
+					 * hence a next state value of 0 indicates there is no transition
+					 */
+					state = 0;
+
+					for( pattern_index = 0;
+					     pattern_index < signature->pattern_size;
+					     pattern_index++ )
+					{
+						byte_value = signature->pattern[ pattern_index ];
+						next_state = aho_corasick->transitions_table[ ( state * 256 ) + byte_value ];
+
+						if( next_state == 0 )
+						{
+							next_state = aho_corasick->number_of_states;
+
+							aho_corasick->transitions_table[ ( state * 256 ) + byte_value ] = next_state;
+
+							aho_corasick->number_of_states += 1;
+						}
+						state = next_state;
+					}
+					/* If multiple signatures have the same pattern the first one is used
+					 */
+					if( aho_corasick->output_signatures[ state ] == NULL )
+					{
+						aho_corasick->output_signatures[ state ] = signature;
+					}
+					if( signature->pattern_size > aho_corasick->largest_pattern_size )
+					{
+						aho_corasick->largest_pattern_size = signature->pattern_size;
+					}
+					aho_corasick->number_of_signatures += 1;
+				}
+			}
+			if( libcdata_list_element_get_next_element(
+			     list_element,
+			     &list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next list element.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( pass == 0 )
+		{
+			if( maximum_number_of_states > ( (size_t) SSIZE_MAX / ( 256 * sizeof( uint32_t ) ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid maximum number of states value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			aho_corasick->transitions_table = (uint32_t *) memory_allocate(
+			                                                sizeof( uint32_t ) * 256 * maximum_number_of_states );
+
+			if( aho_corasick->transitions_table == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create transitions table.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_set(
+			     aho_corasick->transitions_table,
+			     0,
+			     sizeof( uint32_t ) * 256 * maximum_number_of_states ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear transitions table.",
+				 function );
+
+				goto on_error;
+			}
+			aho_corasick->output_signatures = (libsigscan_signature_t **) memory_allocate(
+			                                                               sizeof( libsigscan_signature_t * ) * maximum_number_of_states );
+
+			if( aho_corasick->output_signatures == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create output signatures.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_set(
+			     aho_corasick->output_signatures,
+			     0,
+			     sizeof( libsigscan_signature_t * ) * maximum_number_of_states ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear output signatures.",
+				 function );
+
+				goto on_error;
+			}
+			aho_corasick->number_of_states = 1;
+		}
+	}
+	/* Determine the failure states in breadth-first order and complete
+	 * the transitions table so that scanning needs a single lookup per byte
+	 */
+	failure_states = (uint32_t *) memory_allocate(
+	                               sizeof( uint32_t ) * aho_corasick->number_of_states );
+
+	if( failure_states == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create failure states.",
+		 function );
+
+		goto on_error;
+	}
+	states_queue = (uint32_t *) memory_allocate(
+	                             sizeof( uint32_t ) * aho_corasick->number_of_states );
+
+	if( states_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create states queue.",
+		 function );
+
+		goto on_error;
+	}
+	failure_states[ 0 ] = 0;
+
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		next_state = aho_corasick->transitions_table[ byte_value ];
+
+		if( next_state != 0 )
+		{
+			failure_states[ next_state ] = 0;
+
+			states_queue[ queue_end_index++ ] = next_state;
+		}
+	}
+	while( queue_start_index < queue_end_index )
+	{
+		state         = states_queue[ queue_start_index++ ];
+		failure_state = failure_states[ state ];
+
+		/* The output signature of the failure state has the largest pattern
+		 * of the signatures that are a proper suffix of the current state
+		 */
+		if( aho_corasick->output_signatures[ state ] == NULL )
+		{
+			aho_corasick->output_signatures[ state ] = aho_corasick->output_signatures[ failure_state ];
+		}
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			next_state = aho_corasick->transitions_table[ ( state * 256 ) + byte_value ];
+
+			if( next_state != 0 )
+			{
+				failure_states[ next_state ] = aho_corasick->transitions_table[ ( failure_state * 256 ) + byte_value ];
+
+				states_queue[ queue_end_index++ ] = next_state;
+			}
+			else
+			{
+				aho_corasick->transitions_table[ ( state * 256 ) + byte_value ] = aho_corasick->transitions_table[ ( failure_state * 256 ) + byte_value ];
+			}
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of signatures: %d, number of states: %" PRIu32 ", largest pattern size: %" PRIzd "\n",
+		 function,
+		 aho_corasick->number_of_signatures,
+		 aho_corasick->number_of_states,
+		 aho_corasick->largest_pattern_size );
+	}
+#endif
+	memory_free(
+	 states_queue );
+
+	memory_free(
+	 failure_states );
+
+	return( 1 );
+
+on_error:
+	if( states_queue != NULL )
+	{
+		memory_free(
+		 states_queue );
+	}
+	if( failure_states != NULL )
+	{
+		memory_free(
+		 failure_states );
+	}
+	if( aho_corasick->output_signatures != NULL )
+	{
+		memory_free(
+		 aho_corasick->output_signatures );
+
+		aho_corasick->output_signatures = NULL;
+	}
+	if( aho_corasick->transitions_table != NULL )
+	{
+		memory_free(
+		 aho_corasick->transitions_table );
+
+		aho_corasick->transitions_table = NULL;
+	}
+	aho_corasick->number_of_signatures = 0;
+	aho_corasick->largest_pattern_size = 0;
+	aho_corasick->number_of_states     = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the number of signatures
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_aho_corasick_get_number_of_signatures(
+     libsigscan_aho_corasick_t *aho_corasick,
+     int *number_of_signatures,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_aho_corasick_get_number_of_signatures";
+
+	if( aho_corasick == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Aho-Corasick automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_signatures == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of signatures.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_signatures = aho_corasick->number_of_signatures;
+
+	return( 1 );
+}
+
+/* Scans the buffer for the first matching signature
+ * The match must start at or after the buffer offset and before the scan end offset
+ * If multiple signatures start at the same offset the one with the largest pattern is returned
+ * The data after the scan end offset is only used to match the patterns
+ * Returns 1 if a signature matches, 0 if not or -1 on error
+ */
+int libsigscan_aho_corasick_scan_buffer(
+     libsigscan_aho_corasick_t *aho_corasick,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t scan_end_offset,
+     size_t *match_offset,
+     libsigscan_signature_t **signature,
+     libcerror_error_t **error )
+{
+	libsigscan_signature_t *matched_signature = NULL;
+	libsigscan_signature_t *output_signature  = NULL;
+	static char *function                     = "libsigscan_aho_corasick_scan_buffer";
+	size_t matched_offset                     = 0;
+	size_t output_offset                      = 0;
+	size_t stop_offset                        = 0;
+	uint32_t state                            = 0;
+
+	if( aho_corasick == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Aho-Corasick automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( aho_corasick->transitions_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid Aho-Corasick automaton - missing transitions table.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_end_offset > buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( match_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid match offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_offset >= scan_end_offset )
+	 || ( aho_corasick->largest_pattern_size == 0 ) )
+	{
+		return( 0 );
+	}
+	/* A match that starts before the scan end offset ends before the stop offset
+	 */
+	stop_offset = scan_end_offset + aho_corasick->largest_pattern_size - 1;
+
+	if( stop_offset > buffer_size )
+	{
+		stop_offset = buffer_size;
+	}
+	while( buffer_offset < stop_offset )
+	{
+		state = aho_corasick->transitions_table[ ( state * 256 ) + buffer[ buffer_offset ] ];
+
+		buffer_offset++;
+
+		output_signature = aho_corasick->output_signatures[ state ];
+
+		if( output_signature != NULL )
+		{
+			output_offset = buffer_offset - output_signature->pattern_size;
+
+			if( ( output_offset < scan_end_offset )
+			 && ( ( matched_signature == NULL )
+			  ||  ( output_offset < matched_offset )
+			  ||  ( ( output_offset == matched_offset )
+			   &&   ( output_signature->pattern_size > matched_signature->pattern_size ) ) ) )
+			{
+				matched_signature = output_signature;
+				matched_offset    = output_offset;
+
+				/* A match that starts at or before the matched offset ends before the stop offset
+				 */
+				stop_offset = matched_offset + aho_corasick->largest_pattern_size;
+
+				if( stop_offset > buffer_size )
+				{
+					stop_offset = buffer_size;
+				}
+			}
+		}
+	}
+	if( matched_signature == NULL )
+	{
+		return( 0 );
+	}
+	*match_offset = matched_offset;
+	*signature    = matched_signature;
+
+	return( 1 );
+}
+
@@ -0,0 +1,101 @@
+/*
+ * Aho-Corasick automaton functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_AHO_CORASICK_H )
+#define _LIBSIGSCAN_AHO_CORASICK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_signature.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_aho_corasick libsigscan_aho_corasick_t;
+
+struct libsigscan_aho_corasick
+{
+	/* The number of signatures
+	 */
+	int number_of_signatures;
+
+	/* The largest pattern size
+	 */
+	size_t largest_pattern_size;
+
+	/* The number of states
+	 */
+	uint32_t number_of_states;
+
+	/* The transitions table
+	 * contains 256 next state values per state
+	 */
+	uint32_t *transitions_table;
+
+	/* The output signatures
+	 * contains the signature with the largest pattern that ends in a state per state
+	 */
+	libsigscan_signature_t **output_signatures;
+
+	/* The data flags
+	 * the transitions table is not freed if referenced
+	 */
+	uint8_t data_flags;
+};
+
+int libsigscan_aho_corasick_initialize(
+     libsigscan_aho_corasick_t **aho_corasick,
+     libcerror_error_t **error );
+
+int libsigscan_aho_corasick_free(
+     libsigscan_aho_corasick_t **aho_corasick,
+     libcerror_error_t **error );
+
+int libsigscan_aho_corasick_build(
+     libsigscan_aho_corasick_t *aho_corasick,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error );
+
+int libsigscan_aho_corasick_get_number_of_signatures(
+     libsigscan_aho_corasick_t *aho_corasick,
+     int *number_of_signatures,
+     libcerror_error_t **error );
+
+int libsigscan_aho_corasick_scan_buffer(
+     libsigscan_aho_corasick_t *aho_corasick,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t scan_end_offset,
+     size_t *match_offset,
+     libsigscan_signature_t **signature,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_AHO_CORASICK_H ) */
+
@@ -0,0 +1,1578 @@
+/*
+ * Batch functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libsigscan_batch.h"
+#include "libsigscan_batch_entry.h"
+#include "libsigscan_definitions.h"
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcnotify.h"
+#include "libsigscan_libcthreads.h"
+#include "libsigscan_scan_result.h"
+#include "libsigscan_scan_result_arena.h"
+#include "libsigscan_scan_state.h"
+#include "libsigscan_scanner.h"
+
+/* Creates a batch
+ * Make sure the value batch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_initialize(
+     libsigscan_batch_t **batch,
+     libsigscan_scanner_t *scanner,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_batch_t *internal_batch = NULL;
+	static char *function                       = "libsigscan_batch_initialize";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = memory_allocate_structure(
+	                  libsigscan_internal_batch_t );
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_batch,
+	     0,
+	     sizeof( libsigscan_internal_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch.",
+		 function );
+
+		memory_free(
+		 internal_batch );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_batch->entries_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_batch->scan_states_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan states array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_batch->scan_states_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan states mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_batch->scanner           = scanner;
+	internal_batch->number_of_workers = LIBSIGSCAN_DEFAULT_NUMBER_OF_BATCH_WORKERS;
+
+	*batch = (libsigscan_batch_t *) internal_batch;
+
+	return( 1 );
+
+on_error:
+	if( internal_batch != NULL )
+	{
+		if( internal_batch->scan_states_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_batch->scan_states_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_batch->entries_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_batch->entries_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_batch );
+	}
+	return( -1 );
+}
+
+/* Frees a batch
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_free(
+     libsigscan_batch_t **batch,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_batch_t *internal_batch = NULL;
+	static char *function                       = "libsigscan_batch_free";
+	int result                                  = 1;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch != NULL )
+	{
+		internal_batch = (libsigscan_internal_batch_t *) *batch;
+		*batch         = NULL;
+
+		/* The scanner is a reference and freed elsewhere
+		 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( internal_batch->scan_states_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan states mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libcdata_array_free(
+		     &( internal_batch->scan_states_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_scan_state_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan states array.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( internal_batch->entries_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_batch_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entries array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_batch );
+	}
+	return( result );
+}
+
+/* Sets the number of workers
+ * Without multi-threading support the entries are scanned by the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_set_number_of_workers(
+     libsigscan_batch_t *batch,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_batch_t *internal_batch = NULL;
+	static char *function                       = "libsigscan_batch_set_number_of_workers";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libsigscan_internal_batch_t *) batch;
+
+	if( ( number_of_workers <= 0 )
+	 || ( number_of_workers > LIBSIGSCAN_MAXIMUM_NUMBER_OF_BATCH_WORKERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch->number_of_workers = number_of_workers;
+
+	return( 1 );
+}
+
+/* Appends a file to be scanned
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_append_file(
+     libsigscan_batch_t *batch,
+     const char *filename,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libsigscan_batch_entry_t *batch_entry = NULL;
+	static char *function                 = "libsigscan_batch_append_file";
+	size_t filename_length                = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libsigscan_batch_entry_initialize(
+	     &batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_batch_entry_set_filename(
+	     batch_entry,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_internal_batch_append_entry(
+	     (libsigscan_internal_batch_t *) batch,
+	     batch_entry,
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( batch_entry != NULL )
+	{
+		libsigscan_batch_entry_free(
+		 &batch_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Appends a file to be scanned
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_append_file_wide(
+     libsigscan_batch_t *batch,
+     const wchar_t *filename,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libsigscan_batch_entry_t *batch_entry = NULL;
+	static char *function                 = "libsigscan_batch_append_file_wide";
+	size_t filename_length                = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libsigscan_batch_entry_initialize(
+	     &batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_batch_entry_set_filename_wide(
+	     batch_entry,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_internal_batch_append_entry(
+	     (libsigscan_internal_batch_t *) batch,
+	     batch_entry,
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( batch_entry != NULL )
+	{
+		libsigscan_batch_entry_free(
+		 &batch_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Appends a file IO handle to be scanned
+ * The file IO handle is referenced and must remain valid while the batch is scanned,
+ * every entry requires its own file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_append_file_io_handle(
+     libsigscan_batch_t *batch,
+     libbfio_handle_t *file_io_handle,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libsigscan_batch_entry_t *batch_entry = NULL;
+	static char *function                 = "libsigscan_batch_append_file_io_handle";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_batch_entry_initialize(
+	     &batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	batch_entry->file_io_handle = file_io_handle;
+
+	if( libsigscan_internal_batch_append_entry(
+	     (libsigscan_internal_batch_t *) batch,
+	     batch_entry,
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( batch_entry != NULL )
+	{
+		libsigscan_batch_entry_free(
+		 &batch_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends an entry
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_batch_append_entry(
+     libsigscan_internal_batch_t *internal_batch,
+     libsigscan_batch_entry_t *batch_entry,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_batch_append_entry";
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_append_entry(
+	     internal_batch->entries_array,
+	     entry_index,
+	     (intptr_t *) batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append entry to array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Grabs an available scan state
+ * The scan state is created if no previously used scan state is available
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_batch_grab_scan_state(
+     libsigscan_internal_batch_t *internal_batch,
+     libsigscan_scan_state_t **scan_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_batch_grab_scan_state";
+	int scan_state_index  = 0;
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_batch->scan_states_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab scan states mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_batch->number_of_available_scan_states <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch - missing available scan states.",
+		 function );
+
+		goto on_error;
+	}
+	scan_state_index = internal_batch->number_of_available_scan_states - 1;
+
+	if( libcdata_array_get_entry_by_index(
+	     internal_batch->scan_states_array,
+	     scan_state_index,
+	     (intptr_t **) scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan state: %d.",
+		 function,
+		 scan_state_index );
+
+		goto on_error;
+	}
+	if( libcdata_array_set_entry_by_index(
+	     internal_batch->scan_states_array,
+	     scan_state_index,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state: %d.",
+		 function,
+		 scan_state_index );
+
+		goto on_error;
+	}
+	internal_batch->number_of_available_scan_states -= 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_batch->scan_states_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release scan states mutex.",
+		 function );
+
+		goto on_error_released;
+	}
+#endif
+	if( *scan_state == NULL )
+	{
+		if( libsigscan_scan_state_initialize(
+		     scan_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan state.",
+			 function );
+
+			goto on_error_released;
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 internal_batch->scan_states_mutex,
+	 NULL );
+#endif
+	*scan_state = NULL;
+
+	return( -1 );
+
+on_error_released:
+	/* The scan state is returned, a NULL scan state is recreated on a next grab
+	 */
+	libsigscan_internal_batch_release_scan_state(
+	 internal_batch,
+	 *scan_state,
+	 NULL );
+
+	*scan_state = NULL;
+
+	return( -1 );
+}
+
+/* Releases a scan state so it can be reused
+ * A NULL scan state indicates the scan state was discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_batch_release_scan_state(
+     libsigscan_internal_batch_t *internal_batch,
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_batch_release_scan_state";
+	int result            = 1;
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_batch->scan_states_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab scan states mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_set_entry_by_index(
+	     internal_batch->scan_states_array,
+	     internal_batch->number_of_available_scan_states,
+	     (intptr_t *) scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state: %d.",
+		 function,
+		 internal_batch->number_of_available_scan_states );
+
+		result = -1;
+	}
+	else
+	{
+		internal_batch->number_of_available_scan_states += 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_batch->scan_states_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release scan states mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	return( result );
+}
+
+/* Scans an entry using a recycled scan state
+ * A failure to scan the entry is stored in the scan status of the entry
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_batch_scan_entry(
+     libsigscan_internal_batch_t *internal_batch,
+     libsigscan_batch_entry_t *batch_entry,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *scan_error                     = NULL;
+	libsigscan_scan_result_arena_t *scan_result_arena = NULL;
+	libsigscan_scan_state_t *scan_state               = NULL;
+	static char *function                             = "libsigscan_internal_batch_scan_entry";
+	int result                                        = 0;
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_internal_batch_grab_scan_state(
+	     internal_batch,
+	     &scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab scan state.",
+		 function );
+
+		goto on_error;
+	}
+	if( batch_entry->file_io_handle != NULL )
+	{
+		result = libsigscan_scanner_scan_file_io_handle(
+		          internal_batch->scanner,
+		          scan_state,
+		          batch_entry->file_io_handle,
+		          &scan_error );
+	}
+	else if( batch_entry->filename != NULL )
+	{
+		result = libsigscan_scanner_scan_file(
+		          internal_batch->scanner,
+		          scan_state,
+		          batch_entry->filename,
+		          &scan_error );
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	else if( batch_entry->filename_wide != NULL )
+	{
+		result = libsigscan_scanner_scan_file_wide(
+		          internal_batch->scanner,
+		          scan_state,
+		          batch_entry->filename_wide,
+		          &scan_error );
+	}
+#endif
+	else
+	{
+		libcerror_error_set(
+		 &scan_error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch entry - missing file.",
+		 function );
+
+		result = -1;
+	}
+	if( result == 1 )
+	{
+		result = libsigscan_scan_state_take_results(
+		          scan_state,
+		          &scan_result_arena,
+		          &scan_error );
+	}
+	if( result == 1 )
+	{
+		result = libsigscan_batch_entry_set_scan_results(
+		          batch_entry,
+		          &scan_result_arena,
+		          &scan_error );
+	}
+	if( result != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to scan batch entry.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 scan_error );
+		}
+#endif
+		libcerror_error_free(
+		 &scan_error );
+
+		/* The scan state of a failed scan is discarded since it can be left started
+		 */
+		if( scan_result_arena != NULL )
+		{
+			libsigscan_scan_result_arena_free(
+			 &scan_result_arena,
+			 NULL );
+		}
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+
+		batch_entry->scan_status = -1;
+	}
+	else
+	{
+		batch_entry->scan_status = 1;
+	}
+	if( libsigscan_internal_batch_release_scan_state(
+	     internal_batch,
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release scan state.",
+		 function );
+
+		scan_state = NULL;
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	batch_entry->scan_status = -1;
+
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function of the thread pool that scans an entry
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_batch_scan_entry_callback(
+     libsigscan_batch_entry_t *batch_entry,
+     libsigscan_internal_batch_t *internal_batch )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libsigscan_internal_batch_scan_entry_callback";
+
+	if( libsigscan_internal_batch_scan_entry(
+	     internal_batch,
+	     batch_entry,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan batch entry.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Scans the entries that were not scanned before
+ * The scanner is compiled and the entries are divided over a pool of worker
+ * threads that share the scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_scan(
+     libsigscan_batch_t *batch,
+     libcerror_error_t **error )
+{
+	libsigscan_batch_entry_t *batch_entry       = NULL;
+	libsigscan_internal_batch_t *internal_batch = NULL;
+	static char *function                       = "libsigscan_batch_scan";
+	int entry_index                             = 0;
+	int number_of_entries                       = 0;
+	int number_of_scan_states                   = 0;
+	int number_of_workers                       = 0;
+	int scan_state_index                        = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool      = NULL;
+#endif
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libsigscan_internal_batch_t *) batch;
+
+	/* The scanner is compiled before the workers are started
+	 * so that the workers only read the shared scanner
+	 */
+	if( libsigscan_internal_scanner_compile(
+	     (libsigscan_internal_scanner_t *) internal_batch->scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to compile scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_batch->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	number_of_workers = internal_batch->number_of_workers;
+
+	if( number_of_workers > number_of_entries )
+	{
+		number_of_workers = number_of_entries;
+	}
+#else
+	number_of_workers = 1;
+#endif
+	/* Every worker uses at most one scan state at a time
+	 */
+	if( libcdata_array_get_number_of_entries(
+	     internal_batch->scan_states_array,
+	     &number_of_scan_states,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of scan states.",
+		 function );
+
+		goto on_error;
+	}
+	while( number_of_scan_states < number_of_workers )
+	{
+		if( libcdata_array_append_entry(
+		     internal_batch->scan_states_array,
+		     &scan_state_index,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append scan state to array.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_scan_states++;
+	}
+	internal_batch->number_of_available_scan_states = number_of_scan_states;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_workers > 1 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_workers,
+		     number_of_workers * LIBSIGSCAN_BATCH_NUMBER_OF_QUEUED_ENTRIES_PER_WORKER,
+		     (int (*)(intptr_t *, void *)) &libsigscan_internal_batch_scan_entry_callback,
+		     (void *) internal_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_batch->entries_array,
+		     entry_index,
+		     (intptr_t **) &batch_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( batch_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( batch_entry->scan_status != 0 )
+		{
+			continue;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) batch_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push entry: %d onto thread pool.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			continue;
+		}
+#endif
+		if( libsigscan_internal_batch_scan_entry(
+		     internal_batch,
+		     batch_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_get_number_of_entries(
+     libsigscan_batch_t *batch,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_batch_t *internal_batch = NULL;
+	static char *function                       = "libsigscan_batch_get_number_of_entries";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libsigscan_internal_batch_t *) batch;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_batch->entries_array,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the scan status of a specific entry
+ * The scan status is 0 if the entry was not scanned, 1 if scanned or -1 if the scan failed
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_get_scan_status(
+     libsigscan_batch_t *batch,
+     int entry_index,
+     int *scan_status,
+     libcerror_error_t **error )
+{
+	libsigscan_batch_entry_t *batch_entry       = NULL;
+	libsigscan_internal_batch_t *internal_batch = NULL;
+	static char *function                       = "libsigscan_batch_get_scan_status";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libsigscan_internal_batch_t *) batch;
+
+	if( scan_status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan status.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_batch->entries_array,
+	     entry_index,
+	     (intptr_t **) &batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	*scan_status = batch_entry->scan_status;
+
+	return( 1 );
+}
+
+/* Retrieves the number of scan results of a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_get_number_of_results(
+     libsigscan_batch_t *batch,
+     int entry_index,
+     int *number_of_results,
+     libcerror_error_t **error )
+{
+	libsigscan_batch_entry_t *batch_entry       = NULL;
+	libsigscan_internal_batch_t *internal_batch = NULL;
+	static char *function                       = "libsigscan_batch_get_number_of_results";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libsigscan_internal_batch_t *) batch;
+
+	if( number_of_results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of results.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_batch->entries_array,
+	     entry_index,
+	     (intptr_t **) &batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( batch_entry->scan_result_arena == NULL )
+	{
+		*number_of_results = 0;
+
+		return( 1 );
+	}
+	if( libsigscan_scan_result_arena_get_number_of_scan_results(
+	     batch_entry->scan_result_arena,
+	     number_of_results,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of scan results.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific scan result of a specific entry
+ * The scan result is owned by the batch
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_get_result(
+     libsigscan_batch_t *batch,
+     int entry_index,
+     int result_index,
+     libsigscan_scan_result_t **scan_result,
+     libcerror_error_t **error )
+{
+	libsigscan_batch_entry_t *batch_entry       = NULL;
+	libsigscan_internal_batch_t *internal_batch = NULL;
+	static char *function                       = "libsigscan_batch_get_result";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libsigscan_internal_batch_t *) batch;
+
+	if( libcdata_array_get_entry_by_index(
+	     internal_batch->entries_array,
+	     entry_index,
+	     (intptr_t **) &batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_result_arena_get_scan_result_by_index(
+	     batch_entry->scan_result_arena,
+	     result_index,
+	     (libsigscan_internal_scan_result_t **) scan_result,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan result: %d.",
+		 function,
+		 result_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
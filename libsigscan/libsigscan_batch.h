@@ -0,0 +1,185 @@
+/*
+ * Batch functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_INTERNAL_BATCH_H )
+#define _LIBSIGSCAN_INTERNAL_BATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_batch_entry.h"
+#include "libsigscan_extern.h"
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcthreads.h"
+#include "libsigscan_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_internal_batch libsigscan_internal_batch_t;
+
+struct libsigscan_internal_batch
+{
+	/* The scanner
+	 * a reference that is shared by all the workers
+	 */
+	libsigscan_scanner_t *scanner;
+
+	/* The entries array
+	 */
+	libcdata_array_t *entries_array;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The scan states array
+	 * the scan states are recycled between the entries, a scan state
+	 * that is in use by a worker is removed from the array
+	 */
+	libcdata_array_t *scan_states_array;
+
+	/* The number of scan states that are available
+	 * the available scan states are stored at the start of the scan states array
+	 * and a NULL entry represents a scan state that still needs to be created
+	 */
+	int number_of_available_scan_states;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the available scan states
+	 */
+	libcthreads_mutex_t *scan_states_mutex;
+#endif
+};
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_batch_initialize(
+     libsigscan_batch_t **batch,
+     libsigscan_scanner_t *scanner,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_batch_free(
+     libsigscan_batch_t **batch,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_batch_set_number_of_workers(
+     libsigscan_batch_t *batch,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_batch_append_file(
+     libsigscan_batch_t *batch,
+     const char *filename,
+     int *entry_index,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_batch_append_file_wide(
+     libsigscan_batch_t *batch,
+     const wchar_t *filename,
+     int *entry_index,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_batch_append_file_io_handle(
+     libsigscan_batch_t *batch,
+     libbfio_handle_t *file_io_handle,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libsigscan_internal_batch_append_entry(
+     libsigscan_internal_batch_t *internal_batch,
+     libsigscan_batch_entry_t *batch_entry,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libsigscan_internal_batch_grab_scan_state(
+     libsigscan_internal_batch_t *internal_batch,
+     libsigscan_scan_state_t **scan_state,
+     libcerror_error_t **error );
+
+int libsigscan_internal_batch_release_scan_state(
+     libsigscan_internal_batch_t *internal_batch,
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error );
+
+int libsigscan_internal_batch_scan_entry(
+     libsigscan_internal_batch_t *internal_batch,
+     libsigscan_batch_entry_t *batch_entry,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libsigscan_internal_batch_scan_entry_callback(
+     libsigscan_batch_entry_t *batch_entry,
+     libsigscan_internal_batch_t *internal_batch );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_batch_scan(
+     libsigscan_batch_t *batch,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_batch_get_number_of_entries(
+     libsigscan_batch_t *batch,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_batch_get_scan_status(
+     libsigscan_batch_t *batch,
+     int entry_index,
+     int *scan_status,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_batch_get_number_of_results(
+     libsigscan_batch_t *batch,
+     int entry_index,
+     int *number_of_results,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_batch_get_result(
+     libsigscan_batch_t *batch,
+     int entry_index,
+     int result_index,
+     libsigscan_scan_result_t **scan_result,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_INTERNAL_BATCH_H ) */
+
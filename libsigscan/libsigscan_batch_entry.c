@@ -0,0 +1,420 @@
+/*
+ * Batch entry functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libsigscan_batch_entry.h"
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_scan_result.h"
+#include "libsigscan_scan_result_arena.h"
+
+/* Creates a batch entry
+ * Make sure the value batch_entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_entry_initialize(
+     libsigscan_batch_entry_t **batch_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_batch_entry_initialize";
+
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*batch_entry = memory_allocate_structure(
+	                libsigscan_batch_entry_t );
+
+	if( *batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *batch_entry,
+	     0,
+	     sizeof( libsigscan_batch_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *batch_entry != NULL )
+	{
+		memory_free(
+		 *batch_entry );
+
+		*batch_entry = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a batch entry
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_entry_free(
+     libsigscan_batch_entry_t **batch_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_batch_entry_free";
+	int result            = 1;
+
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_entry != NULL )
+	{
+		/* The file_io_handle is a reference and freed elsewhere
+		 */
+		if( ( *batch_entry )->filename != NULL )
+		{
+			memory_free(
+			 ( *batch_entry )->filename );
+		}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+		if( ( *batch_entry )->filename_wide != NULL )
+		{
+			memory_free(
+			 ( *batch_entry )->filename_wide );
+		}
+#endif
+		if( ( *batch_entry )->scan_result_arena != NULL )
+		{
+			if( libsigscan_scan_result_arena_free(
+			     &( ( *batch_entry )->scan_result_arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free scan result arena.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *batch_entry );
+
+		*batch_entry = NULL;
+	}
+	return( result );
+}
+
+/* Sets the filename
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_entry_set_filename(
+     libsigscan_batch_entry_t *batch_entry,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_batch_entry_set_filename";
+
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_entry->filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch entry - filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length >= (size_t) ( SSIZE_MAX / sizeof( char ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	batch_entry->filename = narrow_string_allocate(
+	                         filename_length + 1 );
+
+	if( batch_entry->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     batch_entry->filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	batch_entry->filename[ filename_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( batch_entry->filename != NULL )
+	{
+		memory_free(
+		 batch_entry->filename );
+
+		batch_entry->filename = NULL;
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the filename
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_entry_set_filename_wide(
+     libsigscan_batch_entry_t *batch_entry,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_batch_entry_set_filename_wide";
+
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_entry->filename_wide != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch entry - filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length >= (size_t) ( SSIZE_MAX / sizeof( wchar_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	batch_entry->filename_wide = wide_string_allocate(
+	                              filename_length + 1 );
+
+	if( batch_entry->filename_wide == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( wide_string_copy(
+	     batch_entry->filename_wide,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	batch_entry->filename_wide[ filename_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( batch_entry->filename_wide != NULL )
+	{
+		memory_free(
+		 batch_entry->filename_wide );
+
+		batch_entry->filename_wide = NULL;
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Sets the scan results
+ * The batch entry takes over the scan result arena and frees it
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_batch_entry_set_scan_results(
+     libsigscan_batch_entry_t *batch_entry,
+     libsigscan_scan_result_arena_t **scan_result_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_batch_entry_set_scan_results";
+
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_entry->scan_result_arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch entry - scan result arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_result_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result arena.",
+		 function );
+
+		return( -1 );
+	}
+	batch_entry->scan_result_arena = *scan_result_arena;
+	*scan_result_arena             = NULL;
+
+	return( 1 );
+}
+
@@ -0,0 +1,100 @@
+/*
+ * Batch entry functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_BATCH_ENTRY_H )
+#define _LIBSIGSCAN_BATCH_ENTRY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_scan_result_arena.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_batch_entry libsigscan_batch_entry_t;
+
+struct libsigscan_batch_entry
+{
+	/* The filename
+	 */
+	char *filename;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	/* The wide filename
+	 */
+	wchar_t *filename_wide;
+#endif
+
+	/* The file IO handle
+	 * a reference that is not freed with the batch entry
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The scan result arena
+	 */
+	libsigscan_scan_result_arena_t *scan_result_arena;
+
+	/* The scan status
+	 * 0 if not scanned, 1 if scanned or -1 if the scan failed
+	 */
+	int scan_status;
+};
+
+int libsigscan_batch_entry_initialize(
+     libsigscan_batch_entry_t **batch_entry,
+     libcerror_error_t **error );
+
+int libsigscan_batch_entry_free(
+     libsigscan_batch_entry_t **batch_entry,
+     libcerror_error_t **error );
+
+int libsigscan_batch_entry_set_filename(
+     libsigscan_batch_entry_t *batch_entry,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libsigscan_batch_entry_set_filename_wide(
+     libsigscan_batch_entry_t *batch_entry,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libsigscan_batch_entry_set_scan_results(
+     libsigscan_batch_entry_t *batch_entry,
+     libsigscan_scan_result_arena_t **scan_result_arena,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_BATCH_ENTRY_H ) */
+
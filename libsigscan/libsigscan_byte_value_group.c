@@ -24,6 +24,7 @@
 #include <types.h>
 
 #include "libsigscan_byte_value_group.h"
+#include "libsigscan_definitions.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_signature.h"
@@ -160,6 +161,11 @@ int libsigscan_byte_value_group_free(
 
 			result = -1;
 		}
+		if( ( *byte_value_group )->signature_groups_table != NULL )
+		{
+			memory_free(
+			 ( *byte_value_group )->signature_groups_table );
+		}
 		memory_free(
 		 *byte_value_group );
 
@@ -283,6 +289,16 @@ int libsigscan_byte_value_group_get_signature_group(
 
 		return( -1 );
 	}
+	if( byte_value_group->signature_groups_table != NULL )
+	{
+		*signature_group = byte_value_group->signature_groups_table[ byte_value ];
+
+		if( *signature_group == NULL )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
 	if( libcdata_list_get_first_element(
 	     byte_value_group->signature_groups_list,
 	     &list_element,
@@ -433,6 +449,23 @@ int libsigscan_byte_value_group_insert_signature(
 
 			return( -1 );
 		}
+		if( byte_value_group->signature_groups_table != NULL )
+		{
+			byte_value_group->signature_groups_table[ byte_value ] = signature_group;
+		}
+		else if( libsigscan_byte_value_group_create_signature_groups_table(
+		          byte_value_group,
+		          error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create signature groups table.",
+			 function );
+
+			return( -1 );
+		}
 	}
 	if( libsigscan_signature_group_append_signature(
 	     signature_group,
@@ -451,6 +484,161 @@ int libsigscan_byte_value_group_insert_signature(
 	return( 1 );
 }
 
+/* Creates the signature groups table if the signature groups list contains
+ * enough signature groups to make a lookup by list element costly
+ * Returns 1 if successful, 0 if not created or -1 on error
+ */
+int libsigscan_byte_value_group_create_signature_groups_table(
+     libsigscan_byte_value_group_t *byte_value_group,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element         = NULL;
+	libsigscan_signature_group_t *signature_group = NULL;
+	static char *function                         = "libsigscan_byte_value_group_create_signature_groups_table";
+	size_t table_size                             = 0;
+	int number_of_signature_groups                = 0;
+
+	if( byte_value_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value group.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_value_group->signature_groups_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid byte value group - signature groups table already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_number_of_elements(
+	     byte_value_group->signature_groups_list,
+	     &number_of_signature_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of signature groups.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_signature_groups < LIBSIGSCAN_BYTE_VALUE_GROUP_TABLE_MINIMUM_NUMBER_OF_SIGNATURE_GROUPS )
+	{
+		return( 0 );
+	}
+	table_size = sizeof( libsigscan_signature_group_t * ) * 256;
+
+	byte_value_group->signature_groups_table = (libsigscan_signature_group_t **) memory_allocate(
+	                                                                             table_size );
+
+	if( byte_value_group->signature_groups_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create signature groups table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     byte_value_group->signature_groups_table,
+	     0,
+	     table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear signature groups table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_list_get_first_element(
+	     byte_value_group->signature_groups_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first list element.",
+		 function );
+
+		goto on_error;
+	}
+	while( list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &signature_group,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature group.",
+			 function );
+
+			goto on_error;
+		}
+		if( signature_group == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature group.",
+			 function );
+
+			goto on_error;
+		}
+		byte_value_group->signature_groups_table[ signature_group->byte_value ] = signature_group;
+
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next list element.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( byte_value_group->signature_groups_table != NULL )
+	{
+		memory_free(
+		 byte_value_group->signature_groups_table );
+
+		byte_value_group->signature_groups_table = NULL;
+	}
+	return( -1 );
+}
+
 /* Retrieves the number of signature groups
  * Returns 1 if successful or -1 on error
  */
@@ -45,6 +45,12 @@ struct libsigscan_byte_value_group
 	/* The signature groups list sorted by byte value
 	 */
 	libcdata_list_t *signature_groups_list;
+
+	/* The signature groups per byte value
+	 * contains references to the signature groups in the list and is
+	 * only allocated when the list contains a larger number of groups
+	 */
+	libsigscan_signature_group_t **signature_groups_table;
 };
 
 int libsigscan_byte_value_group_initialize(
@@ -78,6 +84,10 @@ int libsigscan_byte_value_group_insert_signature(
      libsigscan_signature_t *signature,
      libcerror_error_t **error );
 
+int libsigscan_byte_value_group_create_signature_groups_table(
+     libsigscan_byte_value_group_t *byte_value_group,
+     libcerror_error_t **error );
+
 int libsigscan_byte_value_group_get_number_of_signature_groups(
      libsigscan_byte_value_group_t *byte_value_group,
      int *number_of_signature_groups,
@@ -0,0 +1,484 @@
+/*
+ * Byte value profile functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_byte_value_profile.h"
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcerror.h"
+
+/* Creates a byte value profile
+ * Make sure the value byte_value_profile is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_byte_value_profile_initialize(
+     libsigscan_byte_value_profile_t **byte_value_profile,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_byte_value_profile_initialize";
+
+	if( byte_value_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( *byte_value_profile != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid byte value profile value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*byte_value_profile = memory_allocate_structure(
+	                       libsigscan_byte_value_profile_t );
+
+	if( *byte_value_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create byte value profile.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *byte_value_profile,
+	     0,
+	     sizeof( libsigscan_byte_value_profile_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear byte value profile.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *byte_value_profile != NULL )
+	{
+		memory_free(
+		 *byte_value_profile );
+
+		*byte_value_profile = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a byte value profile
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_byte_value_profile_free(
+     libsigscan_byte_value_profile_t **byte_value_profile,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_byte_value_profile_free";
+
+	if( byte_value_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( *byte_value_profile != NULL )
+	{
+		memory_free(
+		 *byte_value_profile );
+
+		*byte_value_profile = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones a byte value profile
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_byte_value_profile_clone(
+     libsigscan_byte_value_profile_t **destination_byte_value_profile,
+     libsigscan_byte_value_profile_t *source_byte_value_profile,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_byte_value_profile_clone";
+
+	if( destination_byte_value_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination byte value profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_byte_value_profile != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination byte value profile value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_byte_value_profile == NULL )
+	{
+		*destination_byte_value_profile = NULL;
+
+		return( 1 );
+	}
+	*destination_byte_value_profile = memory_allocate_structure(
+	                                   libsigscan_byte_value_profile_t );
+
+	if( *destination_byte_value_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination byte value profile.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     *destination_byte_value_profile,
+	     source_byte_value_profile,
+	     sizeof( libsigscan_byte_value_profile_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte value profile.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_byte_value_profile != NULL )
+	{
+		memory_free(
+		 *destination_byte_value_profile );
+
+		*destination_byte_value_profile = NULL;
+	}
+	return( -1 );
+}
+
+/* Adds the byte values of the data to the byte value profile
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_byte_value_profile_add_data(
+     libsigscan_byte_value_profile_t *byte_value_profile,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_byte_value_profile_add_data";
+	size_t data_offset    = 0;
+
+	if( byte_value_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_value_profile->number_of_bytes > ( (uint64_t) UINT64_MAX - data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		byte_value_profile->byte_value_counts[ data[ data_offset ] ] += 1;
+	}
+	byte_value_profile->number_of_bytes += data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of occurrences per byte value
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_byte_value_profile_get_byte_value_counts(
+     libsigscan_byte_value_profile_t *byte_value_profile,
+     uint64_t *byte_value_counts,
+     int number_of_byte_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_byte_value_profile_get_byte_value_counts";
+
+	if( byte_value_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_value_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_byte_values != 256 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of byte values.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     byte_value_counts,
+	     byte_value_profile->byte_value_counts,
+	     sizeof( uint64_t ) * 256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte value counts.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the number of occurrences per byte value
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_byte_value_profile_set_byte_value_counts(
+     libsigscan_byte_value_profile_t *byte_value_profile,
+     const uint64_t *byte_value_counts,
+     int number_of_byte_values,
+     libcerror_error_t **error )
+{
+	static char *function    = "libsigscan_byte_value_profile_set_byte_value_counts";
+	uint64_t number_of_bytes = 0;
+	uint16_t byte_value      = 0;
+
+	if( byte_value_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_value_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_byte_values != 256 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of byte values.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		if( number_of_bytes > ( (uint64_t) UINT64_MAX - byte_value_counts[ byte_value ] ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid byte value counts - number of bytes value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_bytes += byte_value_counts[ byte_value ];
+	}
+	if( memory_copy(
+	     byte_value_profile->byte_value_counts,
+	     byte_value_counts,
+	     sizeof( uint64_t ) * 256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte value counts.",
+		 function );
+
+		return( -1 );
+	}
+	byte_value_profile->number_of_bytes = number_of_bytes;
+
+	return( 1 );
+}
+
+/* Retrieves the frequency of a byte value
+ * The frequency is the fraction of the profiled bytes that have the byte value,
+ * scaled to LIBSIGSCAN_BYTE_VALUE_PROFILE_FREQUENCY_SCALE
+ * Returns 1 if successful, 0 if the profile contains no data or -1 on error
+ */
+int libsigscan_byte_value_profile_get_frequency(
+     libsigscan_byte_value_profile_t *byte_value_profile,
+     uint8_t byte_value,
+     int *frequency,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_byte_value_profile_get_frequency";
+	uint64_t divisor      = 0;
+
+	if( byte_value_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( frequency == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequency.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_value_profile->number_of_bytes == 0 )
+	{
+		return( 0 );
+	}
+	/* Prevent the multiplication from overflowing for very large profiles
+	 */
+	if( byte_value_profile->number_of_bytes <= ( (uint64_t) UINT64_MAX / LIBSIGSCAN_BYTE_VALUE_PROFILE_FREQUENCY_SCALE ) )
+	{
+		*frequency = (int) ( ( byte_value_profile->byte_value_counts[ byte_value ] * LIBSIGSCAN_BYTE_VALUE_PROFILE_FREQUENCY_SCALE )
+		                   / byte_value_profile->number_of_bytes );
+	}
+	else
+	{
+		divisor = byte_value_profile->number_of_bytes / LIBSIGSCAN_BYTE_VALUE_PROFILE_FREQUENCY_SCALE;
+
+		if( ( byte_value_profile->byte_value_counts[ byte_value ] / divisor ) >= LIBSIGSCAN_BYTE_VALUE_PROFILE_FREQUENCY_SCALE )
+		{
+			*frequency = LIBSIGSCAN_BYTE_VALUE_PROFILE_FREQUENCY_SCALE;
+		}
+		else
+		{
+			*frequency = (int) ( byte_value_profile->byte_value_counts[ byte_value ] / divisor );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,89 @@
+/*
+ * Byte value profile functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_BYTE_VALUE_PROFILE_H )
+#define _LIBSIGSCAN_BYTE_VALUE_PROFILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_byte_value_profile libsigscan_byte_value_profile_t;
+
+struct libsigscan_byte_value_profile
+{
+	/* The number of occurrences per byte value
+	 */
+	uint64_t byte_value_counts[ 256 ];
+
+	/* The number of bytes
+	 */
+	uint64_t number_of_bytes;
+};
+
+int libsigscan_byte_value_profile_initialize(
+     libsigscan_byte_value_profile_t **byte_value_profile,
+     libcerror_error_t **error );
+
+int libsigscan_byte_value_profile_free(
+     libsigscan_byte_value_profile_t **byte_value_profile,
+     libcerror_error_t **error );
+
+int libsigscan_byte_value_profile_clone(
+     libsigscan_byte_value_profile_t **destination_byte_value_profile,
+     libsigscan_byte_value_profile_t *source_byte_value_profile,
+     libcerror_error_t **error );
+
+int libsigscan_byte_value_profile_add_data(
+     libsigscan_byte_value_profile_t *byte_value_profile,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libsigscan_byte_value_profile_get_byte_value_counts(
+     libsigscan_byte_value_profile_t *byte_value_profile,
+     uint64_t *byte_value_counts,
+     int number_of_byte_values,
+     libcerror_error_t **error );
+
+int libsigscan_byte_value_profile_set_byte_value_counts(
+     libsigscan_byte_value_profile_t *byte_value_profile,
+     const uint64_t *byte_value_counts,
+     int number_of_byte_values,
+     libcerror_error_t **error );
+
+int libsigscan_byte_value_profile_get_frequency(
+     libsigscan_byte_value_profile_t *byte_value_profile,
+     uint8_t byte_value,
+     int *frequency,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_BYTE_VALUE_PROFILE_H ) */
+
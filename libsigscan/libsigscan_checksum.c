@@ -0,0 +1,105 @@
+/*
+ * Checksum functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_checksum.h"
+#include "libsigscan_libcerror.h"
+
+/* Calculates the Adler-32 of the buffer
+ * Use an initial value of 1 to start a new checksum
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_checksum_calculate_adler32(
+     uint32_t *checksum,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_checksum_calculate_adler32";
+	size_t buffer_offset  = 0;
+	size_t block_size     = 0;
+	uint32_t lower_word   = 0;
+	uint32_t upper_word   = 0;
+
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	lower_word = initial_value & 0xffff;
+	upper_word = ( initial_value >> 16 ) & 0xffff;
+
+	while( buffer_offset < size )
+	{
+		/* The sums can be calculated for 5552 bytes before they overflow 32-bit
+		 */
+		block_size = size - buffer_offset;
+
+		if( block_size > 5552 )
+		{
+			block_size = 5552;
+		}
+		block_size += buffer_offset;
+
+		while( buffer_offset < block_size )
+		{
+			lower_word += buffer[ buffer_offset++ ];
+			upper_word += lower_word;
+		}
+		lower_word %= 0xfff1;
+		upper_word %= 0xfff1;
+	}
+	*checksum = ( upper_word << 16 ) | lower_word;
+
+	return( 1 );
+}
+
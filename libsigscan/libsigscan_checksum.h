@@ -1,5 +1,5 @@
 /*
- * The signatures list functions
+ * Checksum functions
  *
  * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
  *
@@ -19,28 +19,28 @@
  * along with this software.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#if !defined( _LIBSIGSCAN_SIGNATURES_LIST_H )
-#define _LIBSIGSCAN_SIGNATURES_LIST_H
+#if !defined( _LIBSIGSCAN_CHECKSUM_H )
+#define _LIBSIGSCAN_CHECKSUM_H
 
 #include <common.h>
 #include <types.h>
 
-#include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
-#include "libsigscan_signature.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
-int libsigscan_signatures_list_remove_signature(
-     libcdata_list_t *signatures_list,
-     libsigscan_signature_t *signature,
+int libsigscan_checksum_calculate_adler32(
+     uint32_t *checksum,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
 }
 #endif
 
-#endif /* !defined( _LIBSIGSCAN_SIGNATURES_LIST_H ) */
+#endif /* !defined( _LIBSIGSCAN_CHECKSUM_H ) */
 
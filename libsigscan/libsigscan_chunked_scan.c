@@ -0,0 +1,1861 @@
+/*
+ * Chunked scan functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_chunked_scan.h"
+#include "libsigscan_definitions.h"
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcnotify.h"
+#include "libsigscan_libcthreads.h"
+#include "libsigscan_scan_chunk.h"
+#include "libsigscan_scan_result.h"
+#include "libsigscan_scan_result_arena.h"
+#include "libsigscan_scan_state.h"
+#include "libsigscan_scanner.h"
+#include "libsigscan_skip_table.h"
+
+/* Creates a chunked scan
+ * Make sure the value chunked_scan is referencing, is set to NULL
+ * The data is divided into chunks so that every worker can take multiple chunks
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_chunked_scan_initialize(
+     libsigscan_chunked_scan_t **chunked_scan,
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     size64_t data_size,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	libsigscan_scan_chunk_t *scan_chunk                   = NULL;
+	static char *function                                 = "libsigscan_chunked_scan_initialize";
+	size64_t chunk_size                                   = 0;
+	size64_t range_end                                    = 0;
+	size64_t range_start                                  = 0;
+	size_t largest_pattern_size                           = 0;
+	int entry_index                                       = 0;
+	int number_of_chunks                                  = 0;
+
+	if( chunked_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunked scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunked_scan != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunked scan value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	/* The chunks are scanned with the scan trees of the started scan state
+	 * since the scanner can publish a next generation of scan trees during the scan
+	 */
+	if( ( internal_scan_state->scan_tree == NULL )
+	 || ( internal_scan_state->scan_tree->arena == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan state - missing unbound scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers < 1 )
+	 || ( number_of_workers > LIBSIGSCAN_MAXIMUM_NUMBER_OF_SCAN_WORKERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_skip_table_get_largest_pattern_size(
+	     internal_scan_state->scan_tree->skip_table,
+	     &largest_pattern_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve largest pattern size.",
+		 function );
+
+		return( -1 );
+	}
+	*chunked_scan = memory_allocate_structure(
+	                 libsigscan_chunked_scan_t );
+
+	if( *chunked_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunked scan.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunked_scan,
+	     0,
+	     sizeof( libsigscan_chunked_scan_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunked scan.",
+		 function );
+
+		memory_free(
+		 *chunked_scan );
+
+		*chunked_scan = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *chunked_scan )->chunks_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunks array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_list_initialize(
+	     &( ( *chunked_scan )->bounded_scan_results_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bounded scan results list.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunked_scan )->internal_scanner = internal_scanner;
+	( *chunked_scan )->header_scan_tree = internal_scan_state->header_scan_tree;
+	( *chunked_scan )->footer_scan_tree = internal_scan_state->footer_scan_tree;
+	( *chunked_scan )->scan_tree        = internal_scan_state->scan_tree;
+	( *chunked_scan )->file_io_handle   = file_io_handle;
+	( *chunked_scan )->data_size        = data_size;
+
+	if( largest_pattern_size > 1 )
+	{
+		( *chunked_scan )->overlap_size = largest_pattern_size - 1;
+	}
+	/* The chunks are at least the size of the scan buffer and at most
+	 * the maximum scan chunk size
+	 */
+	number_of_chunks = number_of_workers * LIBSIGSCAN_NUMBER_OF_SCAN_CHUNKS_PER_WORKER;
+
+	chunk_size = data_size / number_of_chunks;
+
+	if( ( data_size % number_of_chunks ) != 0 )
+	{
+		chunk_size += 1;
+	}
+	if( chunk_size < (size64_t) internal_scanner->buffer_size )
+	{
+		chunk_size = (size64_t) internal_scanner->buffer_size;
+	}
+	if( chunk_size > (size64_t) LIBSIGSCAN_MAXIMUM_SCAN_CHUNK_SIZE )
+	{
+		chunk_size = (size64_t) LIBSIGSCAN_MAXIMUM_SCAN_CHUNK_SIZE;
+	}
+	while( range_start < data_size )
+	{
+		range_end = range_start + chunk_size;
+
+		if( range_end > data_size )
+		{
+			range_end = data_size;
+		}
+		if( libsigscan_scan_chunk_initialize(
+		     &scan_chunk,
+		     (off64_t) range_start,
+		     (off64_t) range_end,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan chunk.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     ( *chunked_scan )->chunks_array,
+		     &entry_index,
+		     (intptr_t *) scan_chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append scan chunk to array.",
+			 function );
+
+			goto on_error;
+		}
+		scan_chunk = NULL;
+
+		range_start = range_end;
+	}
+	return( 1 );
+
+on_error:
+	if( scan_chunk != NULL )
+	{
+		libsigscan_scan_chunk_free(
+		 &scan_chunk,
+		 NULL );
+	}
+	if( *chunked_scan != NULL )
+	{
+		libsigscan_chunked_scan_free(
+		 chunked_scan,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a chunked scan
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_chunked_scan_free(
+     libsigscan_chunked_scan_t **chunked_scan,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_chunked_scan_free";
+	int result            = 1;
+
+	if( chunked_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunked scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunked_scan != NULL )
+	{
+		/* The internal_scanner and file_io_handle are references and freed elsewhere
+		 */
+		if( ( *chunked_scan )->chunks_array != NULL )
+		{
+			if( libcdata_array_free(
+			     &( ( *chunked_scan )->chunks_array ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_scan_chunk_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunks array.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The scan results in the bounded scan results list are references
+		 * into the bounded scan result arena
+		 */
+		if( ( *chunked_scan )->bounded_scan_results_list != NULL )
+		{
+			if( libcdata_list_free(
+			     &( ( *chunked_scan )->bounded_scan_results_list ),
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free bounded scan results list.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *chunked_scan )->bounded_scan_result_arena != NULL )
+		{
+			if( libsigscan_scan_result_arena_free(
+			     &( ( *chunked_scan )->bounded_scan_result_arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free bounded scan result arena.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *chunked_scan );
+
+		*chunked_scan = NULL;
+	}
+	return( result );
+}
+
+/* Reads and scans a range of the data
+ * The buffer is scanned in place and must not be smaller than the scan state requires
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_chunked_scan_scan_range(
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     uint64_t range_start,
+     uint64_t range_end,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_chunked_scan_scan_range";
+	uint64_t read_offset  = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_start > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range start value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_set_data_offset(
+	     scan_state,
+	     (off64_t) range_start,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data offset.",
+		 function );
+
+		return( -1 );
+	}
+	read_offset = range_start;
+
+	while( read_offset < range_end )
+	{
+		read_size = buffer_size;
+
+		if( (uint64_t) read_size > ( range_end - read_offset ) )
+		{
+			read_size = (size_t) ( range_end - read_offset );
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              buffer,
+		              read_size,
+		              (off64_t) read_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+			 function,
+			 read_offset,
+			 read_offset );
+
+			return( -1 );
+		}
+		result = libsigscan_scan_state_scan_buffer(
+		          scan_state,
+		          buffer,
+		          read_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		read_offset += read_size;
+	}
+	return( 1 );
+}
+
+/* Scans a chunk for unbound signatures using a separate scan state
+ * The scan starts at the scan offset and continues into the next chunk up to
+ * the overlap size to match signatures that start at the end of the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_chunked_scan_scan_chunk(
+     libsigscan_chunked_scan_t *chunked_scan,
+     libsigscan_scan_chunk_t *scan_chunk,
+     libbfio_handle_t *file_io_handle,
+     off64_t scan_offset,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_result_arena_t *scan_result_arena = NULL;
+	libsigscan_scan_state_t *scan_state               = NULL;
+	uint8_t *buffer                                   = NULL;
+	static char *function                             = "libsigscan_chunked_scan_scan_chunk";
+	uint64_t scan_end                                 = 0;
+	size_t buffer_size                                = 0;
+
+	if( chunked_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunked scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_offset < scan_chunk->range_start )
+	 || ( scan_offset >= scan_chunk->range_end ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	scan_end = (uint64_t) scan_chunk->range_end + chunked_scan->overlap_size;
+
+	if( scan_end > chunked_scan->data_size )
+	{
+		scan_end = chunked_scan->data_size;
+	}
+	buffer_size = chunked_scan->internal_scanner->buffer_size;
+
+	if( (uint64_t) buffer_size > ( scan_end - (uint64_t) scan_offset ) )
+	{
+		buffer_size = (size_t) ( scan_end - (uint64_t) scan_offset );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_initialize(
+	     &scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan state.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_set_data_size(
+	     scan_state,
+	     chunked_scan->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_set_flags(
+	     scan_state,
+	     LIBSIGSCAN_SCAN_STATE_FLAG_SCAN_IN_PLACE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state flags.",
+		 function );
+
+		goto on_error;
+	}
+	/* The signatures with an offset are scanned separately
+	 */
+	if( libsigscan_scan_state_start(
+	     scan_state,
+	     NULL,
+	     NULL,
+	     chunked_scan->scan_tree,
+	     chunked_scan->internal_scanner->buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start scan state.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_chunked_scan_scan_range(
+	     scan_state,
+	     file_io_handle,
+	     buffer,
+	     buffer_size,
+	     (uint64_t) scan_offset,
+	     scan_end,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan range: %" PRIi64 " - %" PRIu64 ".",
+		 function,
+		 scan_offset,
+		 scan_end );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_stop(
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop scan state.",
+		 function );
+
+		goto on_error;
+	}
+	scan_chunk->number_of_scan_tree_walks       += ( (libsigscan_internal_scan_state_t *) scan_state )->number_of_scan_tree_walks;
+	scan_chunk->number_of_scan_tree_node_visits += ( (libsigscan_internal_scan_state_t *) scan_state )->number_of_scan_tree_node_visits;
+
+	if( libsigscan_scan_state_take_results(
+	     scan_state,
+	     &scan_result_arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to take scan results.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_chunk_set_scan_results(
+	     scan_chunk,
+	     &scan_result_arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan results.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_free(
+	     &scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scan state.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 buffer );
+
+	scan_chunk->scan_status = 1;
+
+	return( 1 );
+
+on_error:
+	if( scan_result_arena != NULL )
+	{
+		libsigscan_scan_result_arena_free(
+		 &scan_result_arena,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	scan_chunk->scan_status = -1;
+
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function of the thread pool that scans a chunk
+ * The chunk is read using a clone of the file IO handle
+ * A failure to scan the chunk is stored in the scan status of the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_chunked_scan_scan_chunk_callback(
+     libsigscan_scan_chunk_t *scan_chunk,
+     libsigscan_chunked_scan_t *chunked_scan )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	static char *function            = "libsigscan_chunked_scan_scan_chunk_callback";
+
+	if( scan_chunk == NULL )
+	{
+		return( -1 );
+	}
+	if( chunked_scan == NULL )
+	{
+		scan_chunk->scan_status = -1;
+
+		return( -1 );
+	}
+	if( libbfio_handle_clone(
+	     &file_io_handle,
+	     chunked_scan->file_io_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clone file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_ACCESS_FLAG_READ,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_chunked_scan_scan_chunk(
+	     chunked_scan,
+	     scan_chunk,
+	     file_io_handle,
+	     scan_chunk->range_start,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     &error ) != 0 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	scan_chunk->scan_status = -1;
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Scans the header and footer ranges for signatures with an offset
+ * The scan results are stored in the bounded scan results list sorted by offset
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_chunked_scan_scan_bounded_ranges(
+     libsigscan_chunked_scan_t *chunked_scan,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state            = NULL;
+	uint8_t *buffer                                = NULL;
+	static char *function                          = "libsigscan_chunked_scan_scan_bounded_ranges";
+	uint64_t footer_range_end                      = 0;
+	uint64_t footer_range_size                     = 0;
+	uint64_t footer_range_start                    = 0;
+	uint64_t header_range_end                      = 0;
+	uint64_t header_range_size                     = 0;
+	uint64_t header_range_start                    = 0;
+	size_t buffer_size                             = 0;
+	int has_footer_range                           = 0;
+	int has_header_range                           = 0;
+	int number_of_results                          = 0;
+	int result_index                               = 0;
+
+	if( chunked_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunked scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_initialize(
+	     &scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan state.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_set_data_size(
+	     scan_state,
+	     chunked_scan->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_set_flags(
+	     scan_state,
+	     LIBSIGSCAN_SCAN_STATE_FLAG_SCAN_IN_PLACE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state flags.",
+		 function );
+
+		goto on_error;
+	}
+	/* The unbound signatures are scanned by the chunks
+	 */
+	if( libsigscan_scan_state_start(
+	     scan_state,
+	     chunked_scan->header_scan_tree,
+	     chunked_scan->footer_scan_tree,
+	     NULL,
+	     chunked_scan->internal_scanner->buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start scan state.",
+		 function );
+
+		goto on_error;
+	}
+	has_header_range = libsigscan_scan_state_get_header_range(
+	                    scan_state,
+	                    &header_range_start,
+	                    &header_range_end,
+	                    &header_range_size,
+	                    error );
+
+	if( has_header_range == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve header range.",
+		 function );
+
+		goto on_error;
+	}
+	has_footer_range = libsigscan_scan_state_get_footer_range(
+	                    scan_state,
+	                    &footer_range_start,
+	                    &footer_range_end,
+	                    &footer_range_size,
+	                    error );
+
+	if( has_footer_range == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve footer range.",
+		 function );
+
+		goto on_error;
+	}
+	/* Overlapping header and footer ranges are scanned as a single range
+	 */
+	if( ( has_header_range != 0 )
+	 && ( has_footer_range != 0 )
+	 && ( footer_range_start <= header_range_end ) )
+	{
+		if( footer_range_end > header_range_end )
+		{
+			header_range_end = footer_range_end;
+		}
+		has_footer_range = 0;
+	}
+	if( header_range_end > chunked_scan->data_size )
+	{
+		header_range_end = chunked_scan->data_size;
+	}
+	if( footer_range_end > chunked_scan->data_size )
+	{
+		footer_range_end = chunked_scan->data_size;
+	}
+	if( ( has_header_range != 0 )
+	 && ( header_range_end > header_range_start ) )
+	{
+		buffer_size = (size_t) ( header_range_end - header_range_start );
+	}
+	if( ( has_footer_range != 0 )
+	 && ( footer_range_end > footer_range_start )
+	 && ( ( footer_range_end - footer_range_start ) > (uint64_t) buffer_size ) )
+	{
+		buffer_size = (size_t) ( footer_range_end - footer_range_start );
+	}
+	if( buffer_size > chunked_scan->internal_scanner->buffer_size )
+	{
+		buffer_size = chunked_scan->internal_scanner->buffer_size;
+	}
+	if( buffer_size > 0 )
+	{
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * buffer_size );
+
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( has_header_range != 0 )
+		 && ( header_range_end > header_range_start ) )
+		{
+			if( libsigscan_chunked_scan_scan_range(
+			     scan_state,
+			     chunked_scan->file_io_handle,
+			     buffer,
+			     buffer_size,
+			     header_range_start,
+			     header_range_end,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan header range.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( has_footer_range != 0 )
+		 && ( footer_range_end > footer_range_start ) )
+		{
+			if( libsigscan_chunked_scan_scan_range(
+			     scan_state,
+			     chunked_scan->file_io_handle,
+			     buffer,
+			     buffer_size,
+			     footer_range_start,
+			     footer_range_end,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan footer range.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 buffer );
+
+		buffer = NULL;
+	}
+	if( libsigscan_scan_state_stop(
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop scan state.",
+		 function );
+
+		goto on_error;
+	}
+	/* The bounded scan result arena contains the scan results that are referenced
+	 * by the bounded scan results list
+	 */
+	if( libsigscan_scan_state_take_results(
+	     scan_state,
+	     &( chunked_scan->bounded_scan_result_arena ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to take scan results.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_result_arena_get_number_of_scan_results(
+	     chunked_scan->bounded_scan_result_arena,
+	     &number_of_results,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of scan results.",
+		 function );
+
+		goto on_error;
+	}
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		if( libsigscan_scan_result_arena_get_scan_result_by_index(
+		     chunked_scan->bounded_scan_result_arena,
+		     result_index,
+		     &scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan result: %d.",
+			 function,
+			 result_index );
+
+			goto on_error;
+		}
+		if( libcdata_list_insert_value(
+		     chunked_scan->bounded_scan_results_list,
+		     (intptr_t *) scan_result,
+		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsigscan_internal_scan_result_compare,
+		     LIBCDATA_INSERT_FLAG_NON_UNIQUE_ENTRIES,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert scan result: %d into list.",
+			 function,
+			 result_index );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_scan_state_free(
+	     &scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scan state.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a scan result of a chunk or a bounded range to the scan state
+ * The scan state applies the match callback and the early termination options
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_chunked_scan_append_scan_result(
+     libsigscan_scan_state_t *scan_state,
+     libsigscan_internal_scan_result_t *scan_result,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_chunked_scan_append_scan_result";
+
+	if( scan_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result.",
+		 function );
+
+		return( -1 );
+	}
+	/* The offset of the scan result is already relative to the start of the data
+	 */
+	if( libsigscan_internal_scan_state_append_signature_scan_result(
+	     (libsigscan_internal_scan_state_t *) scan_state,
+	     scan_result->signature,
+	     LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	     scan_result->offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append scan result.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Merges the scan results of the chunks and the bounded ranges into the scan state in offset order
+ *
+ * A match of an unbound signature excludes the data it matched from further matches.
+ * When the last match of a chunk extends into the next chunk, the matches of the next
+ * chunk that start before the end of that match are discarded. If one of the discarded
+ * matches extends beyond the end of that match, the next chunk is rescanned from the
+ * end of that match since its scan is no longer aligned with a continuous scan.
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_chunked_scan_merge_results(
+     libsigscan_chunked_scan_t *chunked_scan,
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element                 = NULL;
+	libsigscan_internal_scan_result_t *bounded_scan_result = NULL;
+	libsigscan_internal_scan_result_t *scan_result         = NULL;
+	libsigscan_internal_scan_state_t *internal_scan_state  = NULL;
+	libsigscan_scan_chunk_t *scan_chunk                    = NULL;
+	static char *function                                  = "libsigscan_chunked_scan_merge_results";
+	off64_t next_offset                                    = 0;
+	int chunk_index                                        = 0;
+	int is_aligned                                         = 0;
+	int number_of_chunks                                   = 0;
+	int number_of_results                                  = 0;
+	int result_index                                       = 0;
+
+	if( chunked_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunked scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( libcdata_list_get_first_element(
+	     chunked_scan->bounded_scan_results_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first bounded scan result list element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     chunked_scan->chunks_array,
+	     &number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     chunked_scan->chunks_array,
+		     chunk_index,
+		     (intptr_t **) &scan_chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan chunk: %d.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		if( scan_chunk == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing scan chunk: %d.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		if( scan_chunk->scan_status != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan chunk: %d.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		if( next_offset >= scan_chunk->range_end )
+		{
+			/* The chunk is part of a match of the previous chunk
+			 */
+			internal_scan_state->number_of_scan_tree_walks       += scan_chunk->number_of_scan_tree_walks;
+			internal_scan_state->number_of_scan_tree_node_visits += scan_chunk->number_of_scan_tree_node_visits;
+
+			continue;
+		}
+		if( libsigscan_scan_result_arena_get_number_of_scan_results(
+		     scan_chunk->scan_result_arena,
+		     &number_of_results,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of scan results of chunk: %d.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		is_aligned = 1;
+
+		for( result_index = 0;
+		     result_index < number_of_results;
+		     result_index++ )
+		{
+			if( libsigscan_scan_result_arena_get_scan_result_by_index(
+			     scan_chunk->scan_result_arena,
+			     result_index,
+			     (libsigscan_internal_scan_result_t **) &scan_result,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve scan result: %d of chunk: %d.",
+				 function,
+				 result_index,
+				 chunk_index );
+
+				return( -1 );
+			}
+			if( scan_result->offset >= next_offset )
+			{
+				break;
+			}
+			if( ( scan_result->offset + (off64_t) scan_result->signature->pattern_size ) > next_offset )
+			{
+				is_aligned = 0;
+
+				break;
+			}
+		}
+		if( is_aligned == 0 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: rescanning chunk: %d from offset: %" PRIi64 ".\n",
+				 function,
+				 chunk_index,
+				 next_offset );
+			}
+#endif
+			if( libsigscan_chunked_scan_scan_chunk(
+			     chunked_scan,
+			     scan_chunk,
+			     chunked_scan->file_io_handle,
+			     next_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to rescan chunk: %d.",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+			if( libsigscan_scan_result_arena_get_number_of_scan_results(
+			     scan_chunk->scan_result_arena,
+			     &number_of_results,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of scan results of chunk: %d.",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+		}
+		internal_scan_state->number_of_scan_tree_walks       += scan_chunk->number_of_scan_tree_walks;
+		internal_scan_state->number_of_scan_tree_node_visits += scan_chunk->number_of_scan_tree_node_visits;
+
+		for( result_index = 0;
+		     result_index < number_of_results;
+		     result_index++ )
+		{
+			if( libsigscan_scan_result_arena_get_scan_result_by_index(
+			     scan_chunk->scan_result_arena,
+			     result_index,
+			     (libsigscan_internal_scan_result_t **) &scan_result,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve scan result: %d of chunk: %d.",
+				 function,
+				 result_index,
+				 chunk_index );
+
+				return( -1 );
+			}
+			if( scan_result->offset < next_offset )
+			{
+				continue;
+			}
+			/* Matches that start in the overlap belong to the next chunk
+			 */
+			if( scan_result->offset >= scan_chunk->range_end )
+			{
+				break;
+			}
+			while( list_element != NULL )
+			{
+				if( libcdata_list_element_get_value(
+				     list_element,
+				     (intptr_t **) &bounded_scan_result,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve bounded scan result from list element.",
+					 function );
+
+					return( -1 );
+				}
+				if( bounded_scan_result->offset > scan_result->offset )
+				{
+					break;
+				}
+				if( libsigscan_chunked_scan_append_scan_result(
+				     scan_state,
+				     bounded_scan_result,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append bounded scan result.",
+					 function );
+
+					return( -1 );
+				}
+				if( libcdata_list_element_get_next_element(
+				     list_element,
+				     &list_element,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve next bounded scan result list element.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( libsigscan_chunked_scan_append_scan_result(
+			     scan_state,
+			     scan_result,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append scan result: %d of chunk: %d.",
+				 function,
+				 result_index,
+				 chunk_index );
+
+				return( -1 );
+			}
+			next_offset = scan_result->offset + (off64_t) scan_result->signature->pattern_size;
+		}
+		/* The matches after the scan was stopped are ignored
+		 */
+		if( internal_scan_state->stop_scan != 0 )
+		{
+			return( 1 );
+		}
+	}
+	while( list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &bounded_scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bounded scan result from list element.",
+			 function );
+
+			return( -1 );
+		}
+		if( libsigscan_chunked_scan_append_scan_result(
+		     scan_state,
+		     bounded_scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append bounded scan result.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next bounded scan result list element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Scans the chunks and the bounded ranges and merges the scan results into the scan state
+ * The chunks are divided over a pool of worker threads, the bounded ranges are
+ * scanned while the workers scan the chunks
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_chunked_scan_scan(
+     libsigscan_chunked_scan_t *chunked_scan,
+     libsigscan_scan_state_t *scan_state,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_chunk_t *scan_chunk    = NULL;
+	static char *function                  = "libsigscan_chunked_scan_scan";
+	int chunk_index                        = 0;
+	int number_of_chunks                   = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+#endif
+
+	if( chunked_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunked scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     chunked_scan->chunks_array,
+	     &number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunks.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_workers > number_of_chunks )
+	{
+		number_of_workers = number_of_chunks;
+	}
+	if( number_of_workers > 1 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_workers,
+		     number_of_workers * LIBSIGSCAN_NUMBER_OF_SCAN_CHUNKS_PER_WORKER,
+		     (int (*)(intptr_t *, void *)) &libsigscan_chunked_scan_scan_chunk_callback,
+		     (void *) chunked_scan,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     chunked_scan->chunks_array,
+		     chunk_index,
+		     (intptr_t **) &scan_chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( scan_chunk == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing scan chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) scan_chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push scan chunk: %d onto thread pool.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			continue;
+		}
+#endif
+		if( libsigscan_chunked_scan_scan_chunk(
+		     chunked_scan,
+		     scan_chunk,
+		     chunked_scan->file_io_handle,
+		     scan_chunk->range_start,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_chunked_scan_scan_bounded_ranges(
+	     chunked_scan,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan bounded ranges.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( libsigscan_chunked_scan_merge_results(
+	     chunked_scan,
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to merge scan results.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,158 @@
+/*
+ * Chunked scan functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_CHUNKED_SCAN_H )
+#define _LIBSIGSCAN_CHUNKED_SCAN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_scan_chunk.h"
+#include "libsigscan_scan_result.h"
+#include "libsigscan_scan_result_arena.h"
+#include "libsigscan_scan_tree.h"
+#include "libsigscan_scanner.h"
+#include "libsigscan_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_chunked_scan libsigscan_chunked_scan_t;
+
+struct libsigscan_chunked_scan
+{
+	/* The scanner
+	 * a reference that is shared by all the workers
+	 */
+	libsigscan_internal_scanner_t *internal_scanner;
+
+	/* The header (offset relative from start) scan tree
+	 * a reference to the scan tree of the scan state that started the scan
+	 */
+	libsigscan_scan_tree_t *header_scan_tree;
+
+	/* The footer (offset relative from start) scan tree
+	 * a reference to the scan tree of the scan state that started the scan
+	 */
+	libsigscan_scan_tree_t *footer_scan_tree;
+
+	/* The (unbounded) scan tree
+	 * a reference to the scan tree of the scan state that started the scan
+	 */
+	libsigscan_scan_tree_t *scan_tree;
+
+	/* The file IO handle
+	 * a reference, the workers read the chunks using a clone of the file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The overlap size
+	 * the number of bytes after the end of a chunk that are needed to match
+	 * an unbound signature that starts at the end of the chunk
+	 */
+	size_t overlap_size;
+
+	/* The chunks array
+	 */
+	libcdata_array_t *chunks_array;
+
+	/* The bounded scan results list
+	 * contains the scan results of the signatures with an offset sorted by offset
+	 */
+	libcdata_list_t *bounded_scan_results_list;
+
+	/* The bounded scan result arena
+	 * contains the scan results that are referenced by the bounded scan results list
+	 */
+	libsigscan_scan_result_arena_t *bounded_scan_result_arena;
+};
+
+int libsigscan_chunked_scan_initialize(
+     libsigscan_chunked_scan_t **chunked_scan,
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     size64_t data_size,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+int libsigscan_chunked_scan_free(
+     libsigscan_chunked_scan_t **chunked_scan,
+     libcerror_error_t **error );
+
+int libsigscan_chunked_scan_scan_range(
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     uint64_t range_start,
+     uint64_t range_end,
+     libcerror_error_t **error );
+
+int libsigscan_chunked_scan_scan_chunk(
+     libsigscan_chunked_scan_t *chunked_scan,
+     libsigscan_scan_chunk_t *scan_chunk,
+     libbfio_handle_t *file_io_handle,
+     off64_t scan_offset,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libsigscan_chunked_scan_scan_chunk_callback(
+     libsigscan_scan_chunk_t *scan_chunk,
+     libsigscan_chunked_scan_t *chunked_scan );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int libsigscan_chunked_scan_scan_bounded_ranges(
+     libsigscan_chunked_scan_t *chunked_scan,
+     libcerror_error_t **error );
+
+int libsigscan_chunked_scan_append_scan_result(
+     libsigscan_scan_state_t *scan_state,
+     libsigscan_internal_scan_result_t *scan_result,
+     libcerror_error_t **error );
+
+int libsigscan_chunked_scan_merge_results(
+     libsigscan_chunked_scan_t *chunked_scan,
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error );
+
+int libsigscan_chunked_scan_scan(
+     libsigscan_chunked_scan_t *chunked_scan,
+     libsigscan_scan_state_t *scan_state,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_CHUNKED_SCAN_H ) */
+
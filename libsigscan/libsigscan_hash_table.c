@@ -0,0 +1,497 @@
+/*
+ * Hash table functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_hash_table.h"
+#include "libsigscan_libcerror.h"
+
+/* Determines the first slot of a key
+ * The upper 32-bits of a multiplicative (Fibonacci) hash are used since its lower bits
+ * distribute poorly for keys that differ in their upper bits only
+ */
+#define libsigscan_hash_table_get_slot_index( key, number_of_slots ) \
+	(int) ( (uint32_t) ( ( (uint64_t) ( key ) * 0x9e3779b97f4a7c15ULL ) >> 32 ) & (uint32_t) ( ( number_of_slots ) - 1 ) )
+
+/* Creates a hash table
+ * Make sure the value hash_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_hash_table_initialize(
+     libsigscan_hash_table_t **hash_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_hash_table_initialize";
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*hash_table = memory_allocate_structure(
+	               libsigscan_hash_table_t );
+
+	if( *hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *hash_table,
+	     0,
+	     sizeof( libsigscan_hash_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		memory_free(
+		 *hash_table );
+
+		*hash_table = NULL;
+
+		return( -1 );
+	}
+	if( libsigscan_hash_table_resize(
+	     *hash_table,
+	     LIBSIGSCAN_HASH_TABLE_INITIAL_NUMBER_OF_SLOTS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize hash table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *hash_table != NULL )
+	{
+		memory_free(
+		 *hash_table );
+
+		*hash_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a hash table
+ * The values are references and freed elsewhere
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_hash_table_free(
+     libsigscan_hash_table_t **hash_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_hash_table_free";
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_table != NULL )
+	{
+		if( ( *hash_table )->values != NULL )
+		{
+			memory_free(
+			 ( *hash_table )->values );
+		}
+		if( ( *hash_table )->keys != NULL )
+		{
+			memory_free(
+			 ( *hash_table )->keys );
+		}
+		memory_free(
+		 *hash_table );
+
+		*hash_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes a hash table
+ * The number of slots must be a power of 2 and larger than twice the number of values
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_hash_table_resize(
+     libsigscan_hash_table_t *hash_table,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	intptr_t **values     = NULL;
+	off64_t *keys         = NULL;
+	static char *function = "libsigscan_hash_table_resize";
+	int previous_slot     = 0;
+	int slot_index        = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_slots <= 0 )
+	 || ( number_of_slots > LIBSIGSCAN_HASH_TABLE_MAXIMUM_NUMBER_OF_SLOTS )
+	 || ( ( number_of_slots & ( number_of_slots - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_table->number_of_values > ( number_of_slots / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of slots value too small.",
+		 function );
+
+		return( -1 );
+	}
+	keys = (off64_t *) memory_allocate(
+	                    sizeof( off64_t ) * number_of_slots );
+
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create keys.",
+		 function );
+
+		goto on_error;
+	}
+	values = (intptr_t **) memory_allocate(
+	                        sizeof( intptr_t * ) * number_of_slots );
+
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     values,
+	     0,
+	     sizeof( intptr_t * ) * number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear values.",
+		 function );
+
+		goto on_error;
+	}
+	/* Move the values of the previous slots into the new slots
+	 */
+	for( previous_slot = 0;
+	     previous_slot < hash_table->number_of_slots;
+	     previous_slot++ )
+	{
+		if( hash_table->values[ previous_slot ] == NULL )
+		{
+			continue;
+		}
+		slot_index = libsigscan_hash_table_get_slot_index(
+		              hash_table->keys[ previous_slot ],
+		              number_of_slots );
+
+		while( values[ slot_index ] != NULL )
+		{
+			slot_index = ( slot_index + 1 ) & ( number_of_slots - 1 );
+		}
+		keys[ slot_index ]   = hash_table->keys[ previous_slot ];
+		values[ slot_index ] = hash_table->values[ previous_slot ];
+	}
+	if( hash_table->values != NULL )
+	{
+		memory_free(
+		 hash_table->values );
+	}
+	if( hash_table->keys != NULL )
+	{
+		memory_free(
+		 hash_table->keys );
+	}
+	hash_table->keys            = keys;
+	hash_table->values          = values;
+	hash_table->number_of_slots = number_of_slots;
+
+	return( 1 );
+
+on_error:
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
+	if( keys != NULL )
+	{
+		memory_free(
+		 keys );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of values
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_hash_table_get_number_of_values(
+     libsigscan_hash_table_t *hash_table,
+     int *number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_hash_table_get_number_of_values";
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_values = hash_table->number_of_values;
+
+	return( 1 );
+}
+
+/* Retrieves the value of a specific key
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libsigscan_hash_table_get_value(
+     libsigscan_hash_table_t *hash_table,
+     off64_t key,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_hash_table_get_value";
+	int slot_index        = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	slot_index = libsigscan_hash_table_get_slot_index(
+	              key,
+	              hash_table->number_of_slots );
+
+	/* The hash table is never more than half full hence there always is an unused slot
+	 */
+	while( hash_table->values[ slot_index ] != NULL )
+	{
+		if( hash_table->keys[ slot_index ] == key )
+		{
+			*value = hash_table->values[ slot_index ];
+
+			return( 1 );
+		}
+		slot_index = ( slot_index + 1 ) & ( hash_table->number_of_slots - 1 );
+	}
+	*value = NULL;
+
+	return( 0 );
+}
+
+/* Sets the value of a specific key
+ * A previous value of the key is replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_hash_table_set_value(
+     libsigscan_hash_table_t *hash_table,
+     off64_t key,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_hash_table_set_value";
+	int slot_index        = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	slot_index = libsigscan_hash_table_get_slot_index(
+	              key,
+	              hash_table->number_of_slots );
+
+	while( hash_table->values[ slot_index ] != NULL )
+	{
+		if( hash_table->keys[ slot_index ] == key )
+		{
+			hash_table->values[ slot_index ] = value;
+
+			return( 1 );
+		}
+		slot_index = ( slot_index + 1 ) & ( hash_table->number_of_slots - 1 );
+	}
+	if( ( hash_table->number_of_values + 1 ) > ( hash_table->number_of_slots / 2 ) )
+	{
+		if( hash_table->number_of_slots >= LIBSIGSCAN_HASH_TABLE_MAXIMUM_NUMBER_OF_SLOTS )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of values value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( libsigscan_hash_table_resize(
+		     hash_table,
+		     hash_table->number_of_slots * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize hash table.",
+			 function );
+
+			return( -1 );
+		}
+		slot_index = libsigscan_hash_table_get_slot_index(
+		              key,
+		              hash_table->number_of_slots );
+
+		while( hash_table->values[ slot_index ] != NULL )
+		{
+			slot_index = ( slot_index + 1 ) & ( hash_table->number_of_slots - 1 );
+		}
+	}
+	hash_table->keys[ slot_index ]   = key;
+	hash_table->values[ slot_index ] = value;
+
+	hash_table->number_of_values += 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,91 @@
+/*
+ * Hash table functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_HASH_TABLE_H )
+#define _LIBSIGSCAN_HASH_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_hash_table libsigscan_hash_table_t;
+
+struct libsigscan_hash_table
+{
+	/* The keys per slot
+	 */
+	off64_t *keys;
+
+	/* The values per slot
+	 * the values are references and a slot without a value is unused
+	 */
+	intptr_t **values;
+
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+	/* The number of values
+	 */
+	int number_of_values;
+};
+
+int libsigscan_hash_table_initialize(
+     libsigscan_hash_table_t **hash_table,
+     libcerror_error_t **error );
+
+int libsigscan_hash_table_free(
+     libsigscan_hash_table_t **hash_table,
+     libcerror_error_t **error );
+
+int libsigscan_hash_table_resize(
+     libsigscan_hash_table_t *hash_table,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libsigscan_hash_table_get_number_of_values(
+     libsigscan_hash_table_t *hash_table,
+     int *number_of_values,
+     libcerror_error_t **error );
+
+int libsigscan_hash_table_get_value(
+     libsigscan_hash_table_t *hash_table,
+     off64_t key,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+int libsigscan_hash_table_set_value(
+     libsigscan_hash_table_t *hash_table,
+     off64_t key,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_HASH_TABLE_H ) */
+
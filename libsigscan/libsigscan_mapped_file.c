@@ -0,0 +1,651 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcnotify.h"
+#include "libsigscan_mapped_file.h"
+
+#if defined( HAVE_LIBSIGSCAN_MAPPED_FILE )
+
+/* Creates a mapped file
+ * Make sure the value mapped_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_mapped_file_initialize(
+     libsigscan_mapped_file_t **mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_mapped_file_initialize";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*mapped_file = memory_allocate_structure(
+	                libsigscan_mapped_file_t );
+
+	if( *mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *mapped_file,
+	     0,
+	     sizeof( libsigscan_mapped_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear mapped file.",
+		 function );
+
+		memory_free(
+		 *mapped_file );
+
+		*mapped_file = NULL;
+
+		return( -1 );
+	}
+	( *mapped_file )->file_descriptor = -1;
+
+	return( 1 );
+
+on_error:
+	if( *mapped_file != NULL )
+	{
+		memory_free(
+		 *mapped_file );
+
+		*mapped_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a mapped file
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_mapped_file_free(
+     libsigscan_mapped_file_t **mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_mapped_file_free";
+	int result            = 1;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file != NULL )
+	{
+		if( ( *mapped_file )->file_descriptor != -1 )
+		{
+			if( libsigscan_mapped_file_close(
+			     *mapped_file,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close mapped file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *mapped_file );
+
+		*mapped_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens a mapped file
+ * Returns 1 if successful, 0 if the file cannot be memory mapped or -1 on error
+ */
+int libsigscan_mapped_file_open(
+     libsigscan_mapped_file_t *mapped_file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	static char *function = "libsigscan_mapped_file_open";
+	long page_size        = 4096;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	mapped_file->file_descriptor = open(
+	                                filename,
+	                                O_RDONLY );
+
+	if( mapped_file->file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	if( fstat(
+	     mapped_file->file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only regular files are memory mapped, other types of files,
+	 * such as devices and pipes, are read using a file IO handle
+	 */
+	if( !S_ISREG( file_statistics.st_mode ) )
+	{
+		close(
+		 mapped_file->file_descriptor );
+
+		mapped_file->file_descriptor = -1;
+
+		return( 0 );
+	}
+#if defined( HAVE_SYSCONF ) && defined( _SC_PAGESIZE )
+	page_size = sysconf(
+	             _SC_PAGESIZE );
+
+	if( page_size <= 0 )
+	{
+		page_size = 4096;
+	}
+#endif
+	mapped_file->file_size           = (size64_t) file_statistics.st_size;
+	mapped_file->page_size           = (size_t) page_size;
+	mapped_file->maximum_window_size = LIBSIGSCAN_MAPPED_FILE_MAXIMUM_WINDOW_SIZE;
+
+	if( mapped_file->maximum_window_size < mapped_file->page_size )
+	{
+		mapped_file->maximum_window_size = mapped_file->page_size;
+	}
+	mapped_file->maximum_window_size -= mapped_file->maximum_window_size % mapped_file->page_size;
+
+	return( 1 );
+
+on_error:
+	close(
+	 mapped_file->file_descriptor );
+
+	mapped_file->file_descriptor = -1;
+
+	return( -1 );
+}
+
+/* Closes a mapped file
+ * Returns 0 if successful or -1 on error
+ */
+int libsigscan_mapped_file_close(
+     libsigscan_mapped_file_t *mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_mapped_file_close";
+	int result            = 0;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mapped file - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_mapped_file_unmap_window(
+	     mapped_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to unmap window.",
+		 function );
+
+		result = -1;
+	}
+	if( close(
+	     mapped_file->file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+	mapped_file->file_descriptor = -1;
+	mapped_file->file_size       = 0;
+
+	return( result );
+}
+
+/* Unmaps the window of a mapped file
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_mapped_file_unmap_window(
+     libsigscan_mapped_file_t *mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_mapped_file_unmap_window";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file->window_data != NULL )
+	{
+		if( munmap(
+		     mapped_file->window_data,
+		     mapped_file->window_data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 errno,
+			 "%s: unable to unmap window data.",
+			 function );
+
+			return( -1 );
+		}
+		mapped_file->window_data      = NULL;
+		mapped_file->window_data_size = 0;
+		mapped_file->window_offset    = 0;
+	}
+	return( 1 );
+}
+
+/* Retrieves the file size
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_mapped_file_get_size(
+     libsigscan_mapped_file_t *mapped_file,
+     size64_t *file_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_mapped_file_get_size";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mapped file - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file size.",
+		 function );
+
+		return( -1 );
+	}
+	*file_size = mapped_file->file_size;
+
+	return( 1 );
+}
+
+/* Retrieves the data at a specific offset
+ * The data references the page cache and remains valid until the next call
+ * to this function or until the file is closed
+ * The data size is the part of the requested size that is mapped contiguously,
+ * which is smaller than the requested size if the data spans multiple windows
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_mapped_file_get_data(
+     libsigscan_mapped_file_t *mapped_file,
+     off64_t offset,
+     size64_t size,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	void *window_data         = NULL;
+	static char *function     = "libsigscan_mapped_file_get_data";
+	size64_t window_data_size = 0;
+	off64_t window_end_offset = 0;
+	off64_t window_offset     = 0;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mapped file - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= mapped_file->file_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > ( mapped_file->file_size - (size64_t) offset ) )
+	{
+		size = mapped_file->file_size - (size64_t) offset;
+	}
+	window_end_offset = mapped_file->window_offset + (off64_t) mapped_file->window_data_size;
+
+	/* Map a new window if the current window does not contain the requested data
+	 * or contains only part of it while a larger window can be mapped
+	 */
+	if( ( mapped_file->window_data == NULL )
+	 || ( offset < mapped_file->window_offset )
+	 || ( offset >= window_end_offset )
+	 || ( ( ( offset + (off64_t) size ) > window_end_offset )
+	  &&  ( mapped_file->window_data_size < mapped_file->maximum_window_size ) ) )
+	{
+		if( libsigscan_mapped_file_unmap_window(
+		     mapped_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to unmap window.",
+			 function );
+
+			return( -1 );
+		}
+		window_offset    = offset - ( offset % (off64_t) mapped_file->page_size );
+		window_data_size = (size64_t) ( offset - window_offset ) + size;
+
+		if( ( window_data_size % mapped_file->page_size ) != 0 )
+		{
+			window_data_size += mapped_file->page_size - ( window_data_size % mapped_file->page_size );
+		}
+		if( window_data_size > mapped_file->maximum_window_size )
+		{
+			window_data_size = mapped_file->maximum_window_size;
+		}
+		if( window_data_size > ( mapped_file->file_size - (size64_t) window_offset ) )
+		{
+			window_data_size = mapped_file->file_size - (size64_t) window_offset;
+		}
+		window_data = mmap(
+		               NULL,
+		               (size_t) window_data_size,
+		               PROT_READ,
+		               MAP_SHARED,
+		               mapped_file->file_descriptor,
+		               (off_t) window_offset );
+
+		if( window_data == MAP_FAILED )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to map window at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 window_offset,
+			 window_offset );
+
+			return( -1 );
+		}
+#if defined( HAVE_MADVISE )
+		/* The window is scanned front to back, hint the kernel to read ahead
+		 * and to drop the pages once they have been scanned. The hints are
+		 * not required hence failures are ignored.
+		 */
+		madvise(
+		 window_data,
+		 (size_t) window_data_size,
+		 MADV_SEQUENTIAL );
+
+		madvise(
+		 window_data,
+		 (size_t) window_data_size,
+		 MADV_WILLNEED );
+#endif
+		mapped_file->window_data      = (uint8_t *) window_data;
+		mapped_file->window_data_size = (size_t) window_data_size;
+		mapped_file->window_offset    = window_offset;
+
+		window_end_offset = window_offset + (off64_t) window_data_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mapped window: %" PRIi64 " - %" PRIi64 ".\n",
+			 function,
+			 window_offset,
+			 window_end_offset );
+		}
+#endif
+	}
+	if( ( offset + (off64_t) size ) > window_end_offset )
+	{
+		size = (size64_t) ( window_end_offset - offset );
+	}
+	*data      = &( mapped_file->window_data[ offset - mapped_file->window_offset ] );
+	*data_size = (size_t) size;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBSIGSCAN_MAPPED_FILE ) */
+
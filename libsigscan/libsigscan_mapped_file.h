@@ -0,0 +1,118 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBSIGSCAN_MAPPED_FILE_H )
+#define _LIBSIGSCAN_MAPPED_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libcerror.h"
+
+#if defined( HAVE_SYS_MMAN_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && !defined( WINAPI )
+#define HAVE_LIBSIGSCAN_MAPPED_FILE
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBSIGSCAN_MAPPED_FILE )
+
+typedef struct libsigscan_mapped_file libsigscan_mapped_file_t;
+
+struct libsigscan_mapped_file
+{
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The page size
+	 */
+	size_t page_size;
+
+	/* The maximum window size
+	 * the window size is a multiple of the page size
+	 */
+	size_t maximum_window_size;
+
+	/* The window data
+	 * contains the mapped part of the file
+	 */
+	uint8_t *window_data;
+
+	/* The window data size
+	 */
+	size_t window_data_size;
+
+	/* The window offset
+	 * the offset of the window data relative to the start of the file
+	 */
+	off64_t window_offset;
+};
+
+int libsigscan_mapped_file_initialize(
+     libsigscan_mapped_file_t **mapped_file,
+     libcerror_error_t **error );
+
+int libsigscan_mapped_file_free(
+     libsigscan_mapped_file_t **mapped_file,
+     libcerror_error_t **error );
+
+int libsigscan_mapped_file_open(
+     libsigscan_mapped_file_t *mapped_file,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libsigscan_mapped_file_close(
+     libsigscan_mapped_file_t *mapped_file,
+     libcerror_error_t **error );
+
+int libsigscan_mapped_file_unmap_window(
+     libsigscan_mapped_file_t *mapped_file,
+     libcerror_error_t **error );
+
+int libsigscan_mapped_file_get_size(
+     libsigscan_mapped_file_t *mapped_file,
+     size64_t *file_size,
+     libcerror_error_t **error );
+
+int libsigscan_mapped_file_get_data(
+     libsigscan_mapped_file_t *mapped_file,
+     off64_t offset,
+     size64_t size,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBSIGSCAN_MAPPED_FILE ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_MAPPED_FILE_H ) */
+
@@ -293,3 +293,110 @@ on_error:
 	return( -1 );
 }
 
+/* Removes a pattern offset
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libsigscan_offsets_list_remove_offset(
+     libcdata_list_t *offsets_list,
+     off64_t pattern_offset,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element = NULL;
+	off64_t *offset_value                 = NULL;
+	static char *function                 = "libsigscan_offsets_list_remove_offset";
+
+	if( libcdata_list_get_first_element(
+	     offsets_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first list element.",
+		 function );
+
+		return( -1 );
+	}
+	while( list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &offset_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset value.",
+			 function );
+
+			return( -1 );
+		}
+		if( offset_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing offset value.",
+			 function );
+
+			return( -1 );
+		}
+		if( *offset_value == pattern_offset )
+		{
+			if( libcdata_list_remove_element(
+			     offsets_list,
+			     list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove list element.",
+				 function );
+
+				return( -1 );
+			}
+			if( libcdata_list_element_free(
+			     &list_element,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free list element.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+		else if( *offset_value > pattern_offset )
+		{
+			break;
+		}
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next list element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 0 );
+}
+
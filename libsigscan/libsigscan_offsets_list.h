@@ -56,6 +56,11 @@ int libsigscan_offsets_list_insert_offset(
      off64_t pattern_offset,
      libcerror_error_t **error );
 
+int libsigscan_offsets_list_remove_offset(
+     libcdata_list_t *offsets_list,
+     off64_t pattern_offset,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
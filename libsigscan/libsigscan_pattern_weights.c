@@ -23,6 +23,8 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libsigscan_hash_table.h"
+#include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_libcnotify.h"
 #include "libsigscan_offset_group.h"
@@ -94,28 +96,56 @@ int libsigscan_pattern_weights_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_list_initialize(
-	     &( ( *pattern_weights )->offset_groups_list ),
+	if( libcdata_array_initialize(
+	     &( ( *pattern_weights )->offset_groups_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create offset groups array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_hash_table_initialize(
+	     &( ( *pattern_weights )->offset_groups_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create offset groups table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *pattern_weights )->weight_groups_array ),
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create offset groups list.",
+		 "%s: unable to create weight groups array.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_list_initialize(
-	     &( ( *pattern_weights )->weight_groups_list ),
+	if( libsigscan_hash_table_initialize(
+	     &( ( *pattern_weights )->weight_groups_table ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create weight groups list.",
+		 "%s: unable to create weight groups table.",
 		 function );
 
 		goto on_error;
@@ -125,10 +155,23 @@ int libsigscan_pattern_weights_initialize(
 on_error:
 	if( *pattern_weights != NULL )
 	{
-		if( ( *pattern_weights )->offset_groups_list != NULL )
+		if( ( *pattern_weights )->weight_groups_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *pattern_weights )->weight_groups_array ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *pattern_weights )->offset_groups_table != NULL )
 		{
-			libcdata_list_free(
-			 &( ( *pattern_weights )->offset_groups_list ),
+			libsigscan_hash_table_free(
+			 &( ( *pattern_weights )->offset_groups_table ),
+			 NULL );
+		}
+		if( ( *pattern_weights )->offset_groups_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *pattern_weights )->offset_groups_array ),
 			 NULL,
 			 NULL );
 		}
@@ -163,8 +206,21 @@ int libsigscan_pattern_weights_free(
 	}
 	if( *pattern_weights != NULL )
 	{
-		if( libcdata_list_free(
-		     &( ( *pattern_weights )->offset_groups_list ),
+		if( libsigscan_hash_table_free(
+		     &( ( *pattern_weights )->offset_groups_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free offset groups table.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( ( *pattern_weights )->offset_groups_array ),
 		     (int (*)(intptr_t **,libcerror_error_t **)) &libsigscan_offset_group_free,
 		     error ) != 1 )
 		{
@@ -172,13 +228,26 @@ int libsigscan_pattern_weights_free(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free offset groups list.",
+			 "%s: unable to free offset groups array.",
 			 function );
 
 			result = -1;
 		}
-		if( libcdata_list_free(
-		     &( ( *pattern_weights )->weight_groups_list ),
+		if( libsigscan_hash_table_free(
+		     &( ( *pattern_weights )->weight_groups_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free weight groups table.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( ( *pattern_weights )->weight_groups_array ),
 		     (int (*)(intptr_t **,libcerror_error_t **)) &libsigscan_weight_group_free,
 		     error ) != 1 )
 		{
@@ -186,7 +255,7 @@ int libsigscan_pattern_weights_free(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free weight groups list.",
+			 "%s: unable to free weight groups array.",
 			 function );
 
 			result = -1;
@@ -317,9 +386,8 @@ int libsigscan_pattern_weights_get_largest_weight(
      int *largest_weight,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element   = NULL;
-	libsigscan_offset_group_t *offset_group = NULL;
-	static char *function                   = "libsigscan_pattern_weights_get_largest_weight";
+	static char *function       = "libsigscan_pattern_weights_get_largest_weight";
+	int number_of_offset_groups = 0;
 
 	if( pattern_weights == NULL )
 	{
@@ -332,52 +400,37 @@ int libsigscan_pattern_weights_get_largest_weight(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_last_element(
-	     pattern_weights->offset_groups_list,
-	     &list_element,
-	     error ) != 1 )
+	if( largest_weight == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve last offset groups list element.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid largest weight.",
 		 function );
 
 		return( -1 );
 	}
-	if( list_element == NULL )
-	{
-		return( 0 );
-	}
-	if( libcdata_list_element_get_value(
-	     list_element,
-	     (intptr_t **) &offset_group,
+	if( libcdata_array_get_number_of_entries(
+	     pattern_weights->offset_groups_array,
+	     &number_of_offset_groups,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve last offset group.",
+		 "%s: unable to retrieve number of offset groups.",
 		 function );
 
 		return( -1 );
 	}
-	if( libsigscan_offset_group_get_weight(
-	     offset_group,
-	     largest_weight,
-	     error ) != 1 )
+	if( number_of_offset_groups == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve last offset group weight.",
-		 function );
-
-		return( -1 );
+		return( 0 );
 	}
+	*largest_weight = pattern_weights->largest_weight;
+
 	return( 1 );
 }
 
@@ -390,9 +443,8 @@ int libsigscan_pattern_weights_get_offset_group(
      libsigscan_offset_group_t **offset_group,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element = NULL;
-	static char *function                 = "libsigscan_pattern_weights_get_offset_group";
-	int result                            = 0;
+	static char *function = "libsigscan_pattern_weights_get_offset_group";
+	int result            = 0;
 
 	if( pattern_weights == NULL )
 	{
@@ -416,76 +468,23 @@ int libsigscan_pattern_weights_get_offset_group(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     pattern_weights->offset_groups_list,
-	     &list_element,
-	     error ) != 1 )
+	result = libsigscan_hash_table_get_value(
+	          pattern_weights->offset_groups_table,
+	          (off64_t) weight,
+	          (intptr_t **) offset_group,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element.",
+		 "%s: unable to retrieve offset group from table.",
 		 function );
 
 		return( -1 );
 	}
-	while( list_element != NULL )
-	{
-		if( libcdata_list_element_get_value(
-		     list_element,
-		     (intptr_t **) offset_group,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve offset group.",
-			 function );
-
-			return( -1 );
-		}
-		if( *offset_group == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing offset group.",
-			 function );
-
-			return( -1 );
-		}
-		if( ( *offset_group )->weight == weight )
-		{
-			result = 1;
-
-			break;
-		}
-		if( ( *offset_group )->weight > weight )
-		{
-			break;
-		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( result == 0 )
-	{
-		*offset_group = NULL;
-	}
 	return( result );
 }
 
@@ -500,6 +499,8 @@ int libsigscan_pattern_weights_insert_offset(
 {
 	libsigscan_offset_group_t *offset_group = NULL;
 	static char *function                   = "libsigscan_pattern_weights_insert_offset";
+	int entry_index                         = 0;
+	int number_of_offset_groups             = 0;
 	int result                              = 0;
 
 	if( pattern_weights == NULL )
@@ -556,18 +557,35 @@ int libsigscan_pattern_weights_insert_offset(
 
 			return( -1 );
 		}
-		if( libcdata_list_insert_value(
-		     pattern_weights->offset_groups_list,
+		if( libcdata_array_get_number_of_entries(
+		     pattern_weights->offset_groups_array,
+		     &number_of_offset_groups,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of offset groups.",
+			 function );
+
+			libsigscan_offset_group_free(
+			 &offset_group,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libcdata_array_append_entry(
+		     pattern_weights->offset_groups_array,
+		     &entry_index,
 		     (intptr_t *) offset_group,
-		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsigscan_offset_group_compare,
-		     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to insert offset group for weight: %d into offset groups list.",
+			 "%s: unable to append offset group for weight: %d to offset groups array.",
 			 function,
 			 weight );
 
@@ -577,6 +595,29 @@ int libsigscan_pattern_weights_insert_offset(
 
 			return( -1 );
 		}
+		/* The offset groups array takes over management of the offset group
+		 */
+		if( libsigscan_hash_table_set_value(
+		     pattern_weights->offset_groups_table,
+		     (off64_t) weight,
+		     (intptr_t *) offset_group,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set offset group for weight: %d in offset groups table.",
+			 function,
+			 weight );
+
+			return( -1 );
+		}
+		if( ( number_of_offset_groups == 0 )
+		 || ( weight > pattern_weights->largest_weight ) )
+		{
+			pattern_weights->largest_weight = weight;
+		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -615,9 +656,8 @@ int libsigscan_pattern_weights_get_weight_group(
      libsigscan_weight_group_t **weight_group,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element = NULL;
-	static char *function                 = "libsigscan_pattern_weights_get_weight_group";
-	int result                            = 0;
+	static char *function = "libsigscan_pattern_weights_get_weight_group";
+	int result            = 0;
 
 	if( pattern_weights == NULL )
 	{
@@ -641,76 +681,23 @@ int libsigscan_pattern_weights_get_weight_group(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     pattern_weights->weight_groups_list,
-	     &list_element,
-	     error ) != 1 )
+	result = libsigscan_hash_table_get_value(
+	          pattern_weights->weight_groups_table,
+	          pattern_offset,
+	          (intptr_t **) weight_group,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element.",
+		 "%s: unable to retrieve weight group from table.",
 		 function );
 
 		return( -1 );
 	}
-	while( list_element != NULL )
-	{
-		if( libcdata_list_element_get_value(
-		     list_element,
-		     (intptr_t **) weight_group,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve weight group.",
-			 function );
-
-			return( -1 );
-		}
-		if( *weight_group == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing weight group.",
-			 function );
-
-			return( -1 );
-		}
-		if( ( *weight_group )->pattern_offset == pattern_offset )
-		{
-			result = 1;
-
-			break;
-		}
-		if( ( *weight_group )->pattern_offset > pattern_offset )
-		{
-			break;
-		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( result == 0 )
-	{
-		*weight_group = NULL;
-	}
 	return( result );
 }
 
@@ -725,6 +712,7 @@ int libsigscan_pattern_weights_insert_add_weight(
 {
 	libsigscan_weight_group_t *weight_group = NULL;
 	static char *function                   = "libsigscan_pattern_weights_insert_add_weight";
+	int entry_index                         = 0;
 	int result                              = 0;
 
 	if( pattern_weights == NULL )
@@ -781,18 +769,17 @@ int libsigscan_pattern_weights_insert_add_weight(
 
 			return( -1 );
 		}
-		if( libcdata_list_insert_value(
-		     pattern_weights->weight_groups_list,
+		if( libcdata_array_append_entry(
+		     pattern_weights->weight_groups_array,
+		     &entry_index,
 		     (intptr_t *) weight_group,
-		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsigscan_weight_group_compare,
-		     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to insert weight group for pattern offset: %" PRIi64 " into weight groups list.",
+			 "%s: unable to append weight group for pattern offset: %" PRIi64 " to weight groups array.",
 			 function,
 			 pattern_offset );
 
@@ -802,6 +789,24 @@ int libsigscan_pattern_weights_insert_add_weight(
 
 			return( -1 );
 		}
+		/* The weight groups array takes over management of the weight group
+		 */
+		if( libsigscan_hash_table_set_value(
+		     pattern_weights->weight_groups_table,
+		     pattern_offset,
+		     (intptr_t *) weight_group,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set weight group for pattern offset: %" PRIi64 " in weight groups table.",
+			 function,
+			 pattern_offset );
+
+			return( -1 );
+		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -842,6 +847,7 @@ int libsigscan_pattern_weights_insert_set_weight(
 {
 	libsigscan_weight_group_t *weight_group = NULL;
 	static char *function                   = "libsigscan_pattern_weights_insert_set_weight";
+	int entry_index                         = 0;
 	int result                              = 0;
 
 	if( pattern_weights == NULL )
@@ -888,19 +894,19 @@ int libsigscan_pattern_weights_insert_set_weight(
 
 			return( -1 );
 		}
-		if( libcdata_list_insert_value(
-		     pattern_weights->weight_groups_list,
+		if( libcdata_array_append_entry(
+		     pattern_weights->weight_groups_array,
+		     &entry_index,
 		     (intptr_t *) weight_group,
-		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsigscan_weight_group_compare,
-		     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to insert weight into weight groups list.",
-			 function );
+			 "%s: unable to append weight group for pattern offset: %" PRIi64 " to weight groups array.",
+			 function,
+			 pattern_offset );
 
 			libsigscan_weight_group_free(
 			 &weight_group,
@@ -908,6 +914,24 @@ int libsigscan_pattern_weights_insert_set_weight(
 
 			return( -1 );
 		}
+		/* The weight groups array takes over management of the weight group
+		 */
+		if( libsigscan_hash_table_set_value(
+		     pattern_weights->weight_groups_table,
+		     pattern_offset,
+		     (intptr_t *) weight_group,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set weight group for pattern offset: %" PRIi64 " in weight groups table.",
+			 function,
+			 pattern_offset );
+
+			return( -1 );
+		}
 	}
 	if( libsigscan_weight_group_set_weight(
 	     weight_group,
@@ -27,6 +27,7 @@
 
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
+#include "libsigscan_hash_table.h"
 #include "libsigscan_offset_group.h"
 #include "libsigscan_weight_group.h"
 
@@ -38,13 +39,27 @@ typedef struct libsigscan_pattern_weights libsigscan_pattern_weights_t;
 
 struct libsigscan_pattern_weights
 {
-	/* The offsets (per weight) groups list
+	/* The offsets (per weight) groups array
 	 */
-	libcdata_list_t *offset_groups_list;
+	libcdata_array_t *offset_groups_array;
 
-	/* The weight (per offset) groups list
+	/* The offsets groups per weight
+	 * contains references to the offset groups in the array
 	 */
-	libcdata_list_t *weight_groups_list;
+	libsigscan_hash_table_t *offset_groups_table;
+
+	/* The weight (per offset) groups array
+	 */
+	libcdata_array_t *weight_groups_array;
+
+	/* The weight groups per offset
+	 * contains references to the weight groups in the array
+	 */
+	libsigscan_hash_table_t *weight_groups_table;
+
+	/* The largest weight of the offset groups
+	 */
+	int largest_weight;
 };
 
 int libsigscan_pattern_weights_initialize(
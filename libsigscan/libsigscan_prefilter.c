@@ -0,0 +1,773 @@
+/*
+ * Byte value prefilter functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_byte_value_profile.h"
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcnotify.h"
+#include "libsigscan_prefilter.h"
+#include "libsigscan_scan_tree.h"
+#include "libsigscan_signature.h"
+
+#if defined( HAVE_LIBSIGSCAN_PREFILTER_AVX2 )
+#include <immintrin.h>
+#elif defined( HAVE_LIBSIGSCAN_PREFILTER_SSE2 )
+#include <emmintrin.h>
+#endif
+
+/* Creates a prefilter
+ * Make sure the value prefilter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_prefilter_initialize(
+     libsigscan_prefilter_t **prefilter,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_prefilter_initialize";
+
+	if( prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *prefilter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid prefilter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*prefilter = memory_allocate_structure(
+	              libsigscan_prefilter_t );
+
+	if( *prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create prefilter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *prefilter,
+	     0,
+	     sizeof( libsigscan_prefilter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear prefilter.",
+		 function );
+
+		memory_free(
+		 *prefilter );
+
+		*prefilter = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *prefilter != NULL )
+	{
+		memory_free(
+		 *prefilter );
+
+		*prefilter = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a prefilter
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_prefilter_free(
+     libsigscan_prefilter_t **prefilter,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_prefilter_free";
+
+	if( prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *prefilter != NULL )
+	{
+		memory_free(
+		 *prefilter );
+
+		*prefilter = NULL;
+	}
+	return( 1 );
+}
+
+/* Builds the prefilter from the signatures
+ * The pattern offset is chosen, within the smallest pattern, where the byte values
+ * of the patterns are the least common according to the byte value profile or,
+ * if no byte value profile is provided, libsigscan_common_byte_values
+ * Returns 1 if successful, 0 if no suitable pattern offset was found or -1 on error
+ */
+int libsigscan_prefilter_build(
+     libsigscan_prefilter_t *prefilter,
+     libcdata_array_t *signatures_array,
+     libsigscan_byte_value_profile_t *byte_value_profile,
+     libcerror_error_t **error )
+{
+	uint8_t byte_values_table[ 256 ];
+
+	libsigscan_signature_t *signature = NULL;
+	static char *function             = "libsigscan_prefilter_build";
+	size_t pattern_offset             = 0;
+	size_t smallest_pattern_size      = 0;
+	uint16_t byte_value               = 0;
+	int byte_value_frequency          = 0;
+	int number_of_byte_values         = 0;
+	int number_of_signatures          = 0;
+	int score                         = 0;
+	int signature_index               = 0;
+	int smallest_score                = -1;
+
+	if( prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefilter->number_of_byte_values != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid prefilter - byte values already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     signatures_array,
+	     &number_of_signatures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of signatures.",
+		 function );
+
+		return( -1 );
+	}
+	for( signature_index = 0;
+	     signature_index < number_of_signatures;
+	     signature_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     signatures_array,
+		     signature_index,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( smallest_pattern_size == 0 )
+		 || ( signature->pattern_size < smallest_pattern_size ) )
+		{
+			smallest_pattern_size = signature->pattern_size;
+		}
+	}
+	/* Every pattern offset within the smallest pattern is part of every pattern
+	 */
+	for( pattern_offset = 0;
+	     pattern_offset < smallest_pattern_size;
+	     pattern_offset++ )
+	{
+		if( memory_set(
+		     byte_values_table,
+		     0,
+		     256 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear byte values table.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_byte_values = 0;
+		score                 = 0;
+
+		for( signature_index = 0;
+		     signature_index < number_of_signatures;
+		     signature_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     signatures_array,
+			     signature_index,
+			     (intptr_t **) &signature,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve signature.",
+				 function );
+
+				return( -1 );
+			}
+			byte_value = signature->pattern[ pattern_offset ];
+
+			if( byte_values_table[ byte_value ] == 0 )
+			{
+				byte_values_table[ byte_value ] = 1;
+
+				number_of_byte_values++;
+
+				/* Frequent byte values are more likely to produce false candidates
+				 */
+				if( byte_value_profile != NULL )
+				{
+					if( libsigscan_byte_value_profile_get_frequency(
+					     byte_value_profile,
+					     (uint8_t) byte_value,
+					     &byte_value_frequency,
+					     error ) == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve byte value: 0x%02" PRIx16 " frequency.",
+						 function,
+						 byte_value );
+
+						return( -1 );
+					}
+					score += byte_value_frequency;
+				}
+				else if( libsigscan_common_byte_values[ byte_value ] != 0 )
+				{
+					score += 4;
+				}
+				else
+				{
+					score += 1;
+				}
+			}
+			if( number_of_byte_values > LIBSIGSCAN_PREFILTER_MAXIMUM_NUMBER_OF_BYTE_VALUES )
+			{
+				break;
+			}
+		}
+		if( number_of_byte_values > LIBSIGSCAN_PREFILTER_MAXIMUM_NUMBER_OF_BYTE_VALUES )
+		{
+			continue;
+		}
+		if( ( smallest_score == -1 )
+		 || ( score < smallest_score ) )
+		{
+			if( memory_copy(
+			     prefilter->byte_values_table,
+			     byte_values_table,
+			     256 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy byte values table.",
+				 function );
+
+				return( -1 );
+			}
+			prefilter->pattern_offset        = pattern_offset;
+			prefilter->number_of_byte_values = number_of_byte_values;
+
+			smallest_score = score;
+		}
+	}
+	if( smallest_score == -1 )
+	{
+		return( 0 );
+	}
+	number_of_byte_values = 0;
+
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		if( prefilter->byte_values_table[ byte_value ] != 0 )
+		{
+			prefilter->byte_values[ number_of_byte_values++ ] = (uint8_t) byte_value;
+		}
+	}
+	if( libsigscan_prefilter_select_instruction_set(
+	     prefilter,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to select instruction set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: pattern offset: %" PRIzd ", number of byte values: %d, instruction set: %d\n",
+		 function,
+		 prefilter->pattern_offset,
+		 prefilter->number_of_byte_values,
+		 prefilter->instruction_set );
+	}
+#endif
+	return( 1 );
+}
+
+/* Selects the instruction set used to scan
+ * The instruction set is determined by the capabilities of the CPU at run-time
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_prefilter_select_instruction_set(
+     libsigscan_prefilter_t *prefilter,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_prefilter_select_instruction_set";
+
+	if( prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	prefilter->instruction_set = LIBSIGSCAN_PREFILTER_INSTRUCTION_SET_SCALAR;
+
+#if defined( HAVE_LIBSIGSCAN_PREFILTER_SSE2 )
+	prefilter->instruction_set = LIBSIGSCAN_PREFILTER_INSTRUCTION_SET_SSE2;
+#endif
+#if defined( HAVE_LIBSIGSCAN_PREFILTER_AVX2 )
+	__builtin_cpu_init();
+
+	if( __builtin_cpu_supports( "avx2" ) )
+	{
+		prefilter->instruction_set = LIBSIGSCAN_PREFILTER_INSTRUCTION_SET_AVX2;
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the instruction set used to scan
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_prefilter_get_instruction_set(
+     libsigscan_prefilter_t *prefilter,
+     int *instruction_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_prefilter_get_instruction_set";
+
+	if( prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( instruction_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction set.",
+		 function );
+
+		return( -1 );
+	}
+	*instruction_set = prefilter->instruction_set;
+
+	return( 1 );
+}
+
+/* Finds the first byte value of the prefilter in the buffer
+ * Returns the offset of the byte value or the end offset if not found
+ */
+size_t libsigscan_prefilter_find_byte_value(
+        libsigscan_prefilter_t *prefilter,
+        const uint8_t *buffer,
+        size_t buffer_offset,
+        size_t end_offset )
+{
+	while( buffer_offset < end_offset )
+	{
+		if( prefilter->byte_values_table[ buffer[ buffer_offset ] ] != 0 )
+		{
+			break;
+		}
+		buffer_offset++;
+	}
+	return( buffer_offset );
+}
+
+#if defined( HAVE_LIBSIGSCAN_PREFILTER_SSE2 )
+
+/* Finds the first byte value of the prefilter in the buffer using SSE2
+ * Returns the offset of the byte value or the end offset if not found
+ */
+size_t libsigscan_prefilter_find_byte_value_sse2(
+        libsigscan_prefilter_t *prefilter,
+        const uint8_t *buffer,
+        size_t buffer_offset,
+        size_t end_offset )
+{
+	__m128i byte_values[ LIBSIGSCAN_PREFILTER_MAXIMUM_NUMBER_OF_BYTE_VALUES ];
+
+	__m128i compare_result = _mm_setzero_si128();
+	__m128i data           = _mm_setzero_si128();
+	int byte_value_index   = 0;
+	int mask               = 0;
+
+	for( byte_value_index = 0;
+	     byte_value_index < prefilter->number_of_byte_values;
+	     byte_value_index++ )
+	{
+		byte_values[ byte_value_index ] = _mm_set1_epi8(
+		                                   (char) prefilter->byte_values[ byte_value_index ] );
+	}
+	while( ( end_offset - buffer_offset ) >= 16 )
+	{
+		data = _mm_loadu_si128(
+		        (const __m128i *) &( buffer[ buffer_offset ] ) );
+
+		compare_result = _mm_cmpeq_epi8(
+		                  data,
+		                  byte_values[ 0 ] );
+
+		for( byte_value_index = 1;
+		     byte_value_index < prefilter->number_of_byte_values;
+		     byte_value_index++ )
+		{
+			compare_result = _mm_or_si128(
+			                  compare_result,
+			                  _mm_cmpeq_epi8(
+			                   data,
+			                   byte_values[ byte_value_index ] ) );
+		}
+		mask = _mm_movemask_epi8(
+		        compare_result );
+
+		if( mask != 0 )
+		{
+			while( ( mask & 1 ) == 0 )
+			{
+				mask >>= 1;
+
+				buffer_offset++;
+			}
+			return( buffer_offset );
+		}
+		buffer_offset += 16;
+	}
+	return( libsigscan_prefilter_find_byte_value(
+	         prefilter,
+	         buffer,
+	         buffer_offset,
+	         end_offset ) );
+}
+
+#endif /* defined( HAVE_LIBSIGSCAN_PREFILTER_SSE2 ) */
+
+#if defined( HAVE_LIBSIGSCAN_PREFILTER_AVX2 )
+
+/* Finds the first byte value of the prefilter in the buffer using AVX2
+ * Returns the offset of the byte value or the end offset if not found
+ */
+__attribute__((target("avx2")))
+size_t libsigscan_prefilter_find_byte_value_avx2(
+        libsigscan_prefilter_t *prefilter,
+        const uint8_t *buffer,
+        size_t buffer_offset,
+        size_t end_offset )
+{
+	__m256i byte_values[ LIBSIGSCAN_PREFILTER_MAXIMUM_NUMBER_OF_BYTE_VALUES ];
+
+	__m256i compare_result = _mm256_setzero_si256();
+	__m256i data           = _mm256_setzero_si256();
+	uint32_t mask          = 0;
+	int byte_value_index   = 0;
+
+	for( byte_value_index = 0;
+	     byte_value_index < prefilter->number_of_byte_values;
+	     byte_value_index++ )
+	{
+		byte_values[ byte_value_index ] = _mm256_set1_epi8(
+		                                   (char) prefilter->byte_values[ byte_value_index ] );
+	}
+	while( ( end_offset - buffer_offset ) >= 32 )
+	{
+		data = _mm256_loadu_si256(
+		        (const __m256i *) &( buffer[ buffer_offset ] ) );
+
+		compare_result = _mm256_cmpeq_epi8(
+		                  data,
+		                  byte_values[ 0 ] );
+
+		for( byte_value_index = 1;
+		     byte_value_index < prefilter->number_of_byte_values;
+		     byte_value_index++ )
+		{
+			compare_result = _mm256_or_si256(
+			                  compare_result,
+			                  _mm256_cmpeq_epi8(
+			                   data,
+			                   byte_values[ byte_value_index ] ) );
+		}
+		mask = (uint32_t) _mm256_movemask_epi8(
+		                   compare_result );
+
+		if( mask != 0 )
+		{
+			while( ( mask & 1 ) == 0 )
+			{
+				mask >>= 1;
+
+				buffer_offset++;
+			}
+			return( buffer_offset );
+		}
+		buffer_offset += 32;
+	}
+	return( libsigscan_prefilter_find_byte_value(
+	         prefilter,
+	         buffer,
+	         buffer_offset,
+	         end_offset ) );
+}
+
+#endif /* defined( HAVE_LIBSIGSCAN_PREFILTER_AVX2 ) */
+
+/* Scans the buffer for the first candidate offset
+ * A candidate offset is an offset where a pattern could start, that is where
+ * the byte at the prefilter pattern offset is one of the prefilter byte values
+ * The candidate offset must be at or after the buffer offset and before the scan end offset
+ * Returns 1 if a candidate offset was found, 0 if not or -1 on error
+ */
+int libsigscan_prefilter_scan_buffer(
+     libsigscan_prefilter_t *prefilter,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t scan_end_offset,
+     size_t *candidate_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_prefilter_scan_buffer";
+	size_t end_offset     = 0;
+	size_t scan_offset    = 0;
+
+	if( prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefilter->number_of_byte_values == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid prefilter - missing byte values.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_end_offset > buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( candidate_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid candidate offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* A pattern that starts at or after the end offset cannot fit in the buffer
+	 */
+	if( prefilter->pattern_offset >= buffer_size )
+	{
+		return( 0 );
+	}
+	end_offset = buffer_size - prefilter->pattern_offset;
+
+	if( end_offset > scan_end_offset )
+	{
+		end_offset = scan_end_offset;
+	}
+	if( buffer_offset >= end_offset )
+	{
+		return( 0 );
+	}
+	scan_offset = buffer_offset + prefilter->pattern_offset;
+	end_offset += prefilter->pattern_offset;
+
+	switch( prefilter->instruction_set )
+	{
+#if defined( HAVE_LIBSIGSCAN_PREFILTER_AVX2 )
+		case LIBSIGSCAN_PREFILTER_INSTRUCTION_SET_AVX2:
+			scan_offset = libsigscan_prefilter_find_byte_value_avx2(
+			               prefilter,
+			               buffer,
+			               scan_offset,
+			               end_offset );
+			break;
+#endif
+#if defined( HAVE_LIBSIGSCAN_PREFILTER_SSE2 )
+		case LIBSIGSCAN_PREFILTER_INSTRUCTION_SET_SSE2:
+			scan_offset = libsigscan_prefilter_find_byte_value_sse2(
+			               prefilter,
+			               buffer,
+			               scan_offset,
+			               end_offset );
+			break;
+#endif
+		default:
+			scan_offset = libsigscan_prefilter_find_byte_value(
+			               prefilter,
+			               buffer,
+			               scan_offset,
+			               end_offset );
+			break;
+	}
+	if( scan_offset >= end_offset )
+	{
+		return( 0 );
+	}
+	*candidate_offset = scan_offset - prefilter->pattern_offset;
+
+	return( 1 );
+}
+
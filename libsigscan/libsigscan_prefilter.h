@@ -0,0 +1,140 @@
+/*
+ * Byte value prefilter functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_PREFILTER_H )
+#define _LIBSIGSCAN_PREFILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_byte_value_profile.h"
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+
+#if defined( __GNUC__ ) && defined( __SSE2__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define HAVE_LIBSIGSCAN_PREFILTER_SSE2
+
+/* AVX2 support is determined at run-time
+ */
+#if ( __GNUC__ >= 5 ) || defined( __clang__ )
+#define HAVE_LIBSIGSCAN_PREFILTER_AVX2
+#endif
+
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) ) )
+#define HAVE_LIBSIGSCAN_PREFILTER_SSE2
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_prefilter libsigscan_prefilter_t;
+
+struct libsigscan_prefilter
+{
+	/* The pattern offset
+	 * the offset of the byte values relative to the start of the patterns
+	 */
+	size_t pattern_offset;
+
+	/* The number of byte values
+	 */
+	int number_of_byte_values;
+
+	/* The byte values
+	 */
+	uint8_t byte_values[ LIBSIGSCAN_PREFILTER_MAXIMUM_NUMBER_OF_BYTE_VALUES ];
+
+	/* The byte values table
+	 * contains a non-zero value for every byte value that is part of the prefilter
+	 */
+	uint8_t byte_values_table[ 256 ];
+
+	/* The instruction set used to scan
+	 */
+	int instruction_set;
+};
+
+int libsigscan_prefilter_initialize(
+     libsigscan_prefilter_t **prefilter,
+     libcerror_error_t **error );
+
+int libsigscan_prefilter_free(
+     libsigscan_prefilter_t **prefilter,
+     libcerror_error_t **error );
+
+int libsigscan_prefilter_build(
+     libsigscan_prefilter_t *prefilter,
+     libcdata_array_t *signatures_array,
+     libsigscan_byte_value_profile_t *byte_value_profile,
+     libcerror_error_t **error );
+
+int libsigscan_prefilter_select_instruction_set(
+     libsigscan_prefilter_t *prefilter,
+     libcerror_error_t **error );
+
+int libsigscan_prefilter_get_instruction_set(
+     libsigscan_prefilter_t *prefilter,
+     int *instruction_set,
+     libcerror_error_t **error );
+
+size_t libsigscan_prefilter_find_byte_value(
+        libsigscan_prefilter_t *prefilter,
+        const uint8_t *buffer,
+        size_t buffer_offset,
+        size_t end_offset );
+
+#if defined( HAVE_LIBSIGSCAN_PREFILTER_SSE2 )
+
+size_t libsigscan_prefilter_find_byte_value_sse2(
+        libsigscan_prefilter_t *prefilter,
+        const uint8_t *buffer,
+        size_t buffer_offset,
+        size_t end_offset );
+
+#endif /* defined( HAVE_LIBSIGSCAN_PREFILTER_SSE2 ) */
+
+#if defined( HAVE_LIBSIGSCAN_PREFILTER_AVX2 )
+
+size_t libsigscan_prefilter_find_byte_value_avx2(
+        libsigscan_prefilter_t *prefilter,
+        const uint8_t *buffer,
+        size_t buffer_offset,
+        size_t end_offset );
+
+#endif /* defined( HAVE_LIBSIGSCAN_PREFILTER_AVX2 ) */
+
+int libsigscan_prefilter_scan_buffer(
+     libsigscan_prefilter_t *prefilter,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t scan_end_offset,
+     size_t *candidate_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_PREFILTER_H ) */
+
@@ -0,0 +1,536 @@
+/*
+ * Read request functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcnotify.h"
+#include "libsigscan_libcthreads.h"
+#include "libsigscan_read_request.h"
+
+/* Creates a read request
+ * Make sure the value read_request is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_read_request_initialize(
+     libsigscan_read_request_t **read_request,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_read_request_initialize";
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_request != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read request value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*read_request = memory_allocate_structure(
+	                 libsigscan_read_request_t );
+
+	if( *read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read request.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_request,
+	     0,
+	     sizeof( libsigscan_read_request_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read request.",
+		 function );
+
+		memory_free(
+		 *read_request );
+
+		*read_request = NULL;
+
+		return( -1 );
+	}
+	( *read_request )->buffer = (uint8_t *) memory_allocate(
+	                                         sizeof( uint8_t ) * buffer_size );
+
+	if( ( *read_request )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *read_request )->buffer_size = buffer_size;
+
+	return( 1 );
+
+on_error:
+	if( *read_request != NULL )
+	{
+		memory_free(
+		 *read_request );
+
+		*read_request = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read request
+ * A submitted read request is waited for before it is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_read_request_free(
+     libsigscan_read_request_t **read_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_read_request_free";
+	int result            = 1;
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_request != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *read_request )->thread != NULL )
+		{
+			if( libcthreads_thread_join(
+			     &( ( *read_request )->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join read thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_request )->thread_error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *read_request )->thread_error ) );
+		}
+		if( ( *read_request )->file_io_handle != NULL )
+		{
+			libbfio_handle_close(
+			 ( *read_request )->file_io_handle,
+			 NULL );
+
+			if( libbfio_handle_free(
+			     &( ( *read_request )->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 ( *read_request )->buffer );
+
+		memory_free(
+		 *read_request );
+
+		*read_request = NULL;
+	}
+	return( result );
+}
+
+/* Submits a read request
+ * If multi-threading support is available the data is read on a separate thread
+ * using a clone of the file IO handle, otherwise the data is read when waiting
+ * for the read request. The data is read using a positional read.
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_read_request_submit(
+     libsigscan_read_request_t *read_request,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     size_t read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_read_request_submit";
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int result            = 0;
+#endif
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_request->is_submitted != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read request - already submitted.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_size == 0 )
+	 || ( read_size > read_request->buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_request->offset     = offset;
+	read_request->read_size  = read_size;
+	read_request->read_count = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read is done using a separate file IO handle so that it does
+	 * not need to wait for reads of the submitted file IO handle
+	 */
+	if( libbfio_handle_clone(
+	     &( read_request->file_io_handle ),
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clone file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbfio_handle_is_open(
+	          read_request->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     read_request->file_io_handle,
+		     LIBBFIO_ACCESS_FLAG_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_thread_create(
+	     &( read_request->thread ),
+	     NULL,
+	     (int (*)(void *)) &libsigscan_read_request_read_thread_function,
+	     (void *) read_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read thread.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	read_request->file_io_handle = file_io_handle;
+#endif
+	read_request->is_submitted = 1;
+
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( read_request->file_io_handle != NULL )
+	{
+		libbfio_handle_close(
+		 read_request->file_io_handle,
+		 NULL );
+		libbfio_handle_free(
+		 &( read_request->file_io_handle ),
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Reads the data of a read request on a separate thread
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_read_request_read_thread_function(
+     libsigscan_read_request_t *read_request )
+{
+	static char *function = "libsigscan_read_request_read_thread_function";
+
+	if( read_request == NULL )
+	{
+		return( -1 );
+	}
+	read_request->read_count = libbfio_handle_read_buffer_at_offset(
+	                            read_request->file_io_handle,
+	                            read_request->buffer,
+	                            read_request->read_size,
+	                            read_request->offset,
+	                            &( read_request->thread_error ) );
+
+	if( read_request->read_count != (ssize_t) read_request->read_size )
+	{
+		libcerror_error_set(
+		 &( read_request->thread_error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 read_request->offset,
+		 read_request->offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Waits for a submitted read request to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_read_request_wait(
+     libsigscan_read_request_t *read_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_read_request_wait";
+	int result            = 1;
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_request->is_submitted == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid read request - not submitted.",
+		 function );
+
+		return( -1 );
+	}
+	read_request->is_submitted = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_thread_join(
+	     &( read_request->thread ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join read thread.",
+		 function );
+
+		result = -1;
+	}
+	if( read_request->thread_error != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 read_request->thread_error );
+		}
+#endif
+		libcerror_error_free(
+		 &( read_request->thread_error ) );
+	}
+	if( libbfio_handle_close(
+	     read_request->file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_handle_free(
+	     &( read_request->file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		result = -1;
+	}
+#else
+	read_request->read_count = libbfio_handle_read_buffer_at_offset(
+	                            read_request->file_io_handle,
+	                            read_request->buffer,
+	                            read_request->read_size,
+	                            read_request->offset,
+	                            error );
+
+	read_request->file_io_handle = NULL;
+#endif
+	if( ( result == 1 )
+	 && ( read_request->read_count != (ssize_t) read_request->read_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 read_request->offset,
+		 read_request->offset );
+
+		result = -1;
+	}
+	return( result );
+}
+
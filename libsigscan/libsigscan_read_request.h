@@ -0,0 +1,113 @@
+/*
+ * Read request functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBSIGSCAN_READ_REQUEST_H )
+#define _LIBSIGSCAN_READ_REQUEST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_read_request libsigscan_read_request_t;
+
+struct libsigscan_read_request
+{
+	/* The file IO handle
+	 * a clone of the submitted file IO handle if the read is done on a separate thread
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The read size
+	 */
+	size_t read_size;
+
+	/* The read count
+	 */
+	ssize_t read_count;
+
+	/* Value to indicate the request was submitted
+	 */
+	uint8_t is_submitted;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread that reads the data
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The error of the read on the thread
+	 */
+	libcerror_error_t *thread_error;
+#endif
+};
+
+int libsigscan_read_request_initialize(
+     libsigscan_read_request_t **read_request,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libsigscan_read_request_free(
+     libsigscan_read_request_t **read_request,
+     libcerror_error_t **error );
+
+int libsigscan_read_request_submit(
+     libsigscan_read_request_t *read_request,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     size_t read_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libsigscan_read_request_read_thread_function(
+     libsigscan_read_request_t *read_request );
+
+#endif
+
+int libsigscan_read_request_wait(
+     libsigscan_read_request_t *read_request,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_READ_REQUEST_H ) */
+
@@ -0,0 +1,234 @@
+/*
+ * Scan chunk functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_scan_chunk.h"
+#include "libsigscan_scan_result.h"
+#include "libsigscan_scan_result_arena.h"
+
+/* Creates a scan chunk
+ * Make sure the value scan_chunk is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_chunk_initialize(
+     libsigscan_scan_chunk_t **scan_chunk,
+     off64_t range_start,
+     off64_t range_end,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_chunk_initialize";
+
+	if( scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_chunk != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan chunk value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_start < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid range start value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_end <= range_start )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range end value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_chunk = memory_allocate_structure(
+	               libsigscan_scan_chunk_t );
+
+	if( *scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_chunk,
+	     0,
+	     sizeof( libsigscan_scan_chunk_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan chunk.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_chunk )->range_start = range_start;
+	( *scan_chunk )->range_end   = range_end;
+
+	return( 1 );
+
+on_error:
+	if( *scan_chunk != NULL )
+	{
+		memory_free(
+		 *scan_chunk );
+
+		*scan_chunk = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scan chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_chunk_free(
+     libsigscan_scan_chunk_t **scan_chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_chunk_free";
+	int result            = 1;
+
+	if( scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_chunk != NULL )
+	{
+		if( ( *scan_chunk )->scan_result_arena != NULL )
+		{
+			if( libsigscan_scan_result_arena_free(
+			     &( ( *scan_chunk )->scan_result_arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free scan result arena.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *scan_chunk );
+
+		*scan_chunk = NULL;
+	}
+	return( result );
+}
+
+/* Sets the scan results
+ * The scan chunk takes over the scan result arena, the scan results
+ * of a previous scan of the chunk are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_chunk_set_scan_results(
+     libsigscan_scan_chunk_t *scan_chunk,
+     libsigscan_scan_result_arena_t **scan_result_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_chunk_set_scan_results";
+
+	if( scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_result_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_chunk->scan_result_arena != NULL )
+	{
+		if( libsigscan_scan_result_arena_free(
+		     &( scan_chunk->scan_result_arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan result arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	scan_chunk->scan_result_arena = *scan_result_arena;
+	*scan_result_arena            = NULL;
+
+	return( 1 );
+}
+
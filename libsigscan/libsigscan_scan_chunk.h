@@ -0,0 +1,87 @@
+/*
+ * Scan chunk functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_SCAN_CHUNK_H )
+#define _LIBSIGSCAN_SCAN_CHUNK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_scan_result_arena.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_scan_chunk libsigscan_scan_chunk_t;
+
+struct libsigscan_scan_chunk
+{
+	/* The range start
+	 */
+	off64_t range_start;
+
+	/* The range end
+	 * matches that start at or after the range end belong to the next chunk
+	 */
+	off64_t range_end;
+
+	/* The scan result arena
+	 */
+	libsigscan_scan_result_arena_t *scan_result_arena;
+
+	/* The number of scan tree walks
+	 */
+	uint64_t number_of_scan_tree_walks;
+
+	/* The number of scan tree node visits
+	 */
+	uint64_t number_of_scan_tree_node_visits;
+
+	/* The scan status
+	 * 0 if not scanned, 1 if scanned or -1 if the scan failed
+	 */
+	int scan_status;
+};
+
+int libsigscan_scan_chunk_initialize(
+     libsigscan_scan_chunk_t **scan_chunk,
+     off64_t range_start,
+     off64_t range_end,
+     libcerror_error_t **error );
+
+int libsigscan_scan_chunk_free(
+     libsigscan_scan_chunk_t **scan_chunk,
+     libcerror_error_t **error );
+
+int libsigscan_scan_chunk_set_scan_results(
+     libsigscan_scan_chunk_t *scan_chunk,
+     libsigscan_scan_result_arena_t **scan_result_arena,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_SCAN_CHUNK_H ) */
+
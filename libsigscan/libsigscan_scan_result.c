@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_scan_result.h"
 #include "libsigscan_types.h"
@@ -190,6 +191,49 @@ int libsigscan_internal_scan_result_free(
 	return( 1 );
 }
 
+/* Compares two scan results by their offset
+ * Returns return LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libsigscan_internal_scan_result_compare(
+     libsigscan_internal_scan_result_t *first_scan_result,
+     libsigscan_internal_scan_result_t *second_scan_result,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scan_result_compare";
+
+	if( first_scan_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first scan result.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_scan_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second scan result.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_scan_result->offset < second_scan_result->offset )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_scan_result->offset > second_scan_result->offset )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
 /* Retrieves the size of the identifier
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -276,3 +320,96 @@ int libsigscan_scan_result_get_identifier(
 	return( 1 );
 }
 
+/* Retrieves the offset
+ * The offset is relative to the start of the data that was scanned
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_result_get_offset(
+     libsigscan_scan_result_t *scan_result,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_result_t *internal_scan_result = NULL;
+	static char *function                                   = "libsigscan_scan_result_get_offset";
+
+	if( scan_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_result = (libsigscan_internal_scan_result_t *) scan_result;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_scan_result->offset;
+
+	return( 1 );
+}
+
+/* Retrieves the signature index
+ * The signature index is the index of the signature in the scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_result_get_signature_index(
+     libsigscan_scan_result_t *scan_result,
+     int *signature_index,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_result_t *internal_scan_result = NULL;
+	static char *function                                   = "libsigscan_scan_result_get_signature_index";
+
+	if( scan_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_result = (libsigscan_internal_scan_result_t *) scan_result;
+
+	if( internal_scan_result->signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan result - missing signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature index.",
+		 function );
+
+		return( -1 );
+	}
+	*signature_index = internal_scan_result->signature->signature_index;
+
+	return( 1 );
+}
+
@@ -63,6 +63,11 @@ int libsigscan_internal_scan_result_free(
      libsigscan_internal_scan_result_t **internal_scan_result,
      libcerror_error_t **error );
 
+int libsigscan_internal_scan_result_compare(
+     libsigscan_internal_scan_result_t *first_scan_result,
+     libsigscan_internal_scan_result_t *second_scan_result,
+     libcerror_error_t **error );
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scan_result_get_identifier_size(
      libsigscan_scan_result_t *scan_result,
@@ -76,6 +81,18 @@ int libsigscan_scan_result_get_identifier(
      size_t identifier_size,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_result_get_offset(
+     libsigscan_scan_result_t *scan_result,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_result_get_signature_index(
+     libsigscan_scan_result_t *scan_result,
+     int *signature_index,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
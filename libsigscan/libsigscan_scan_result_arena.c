@@ -0,0 +1,488 @@
+/*
+ * Scan result arena functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_scan_result.h"
+#include "libsigscan_scan_result_arena.h"
+#include "libsigscan_signature.h"
+
+/* Creates a scan result arena
+ * Make sure the value scan_result_arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_result_arena_initialize(
+     libsigscan_scan_result_arena_t **scan_result_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_result_arena_initialize";
+
+	if( scan_result_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_result_arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan result arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_result_arena = memory_allocate_structure(
+	                      libsigscan_scan_result_arena_t );
+
+	if( *scan_result_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan result arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_result_arena,
+	     0,
+	     sizeof( libsigscan_scan_result_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan result arena.",
+		 function );
+
+		memory_free(
+		 *scan_result_arena );
+
+		*scan_result_arena = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *scan_result_arena != NULL )
+	{
+		memory_free(
+		 *scan_result_arena );
+
+		*scan_result_arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scan result arena
+ * The signatures of the scan results are references and freed elsewhere
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_result_arena_free(
+     libsigscan_scan_result_arena_t **scan_result_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_result_arena_free";
+	int segment_number    = 0;
+
+	if( scan_result_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_result_arena != NULL )
+	{
+		for( segment_number = 0;
+		     segment_number < ( *scan_result_arena )->number_of_segments;
+		     segment_number++ )
+		{
+			memory_free(
+			 ( *scan_result_arena )->segments[ segment_number ] );
+		}
+		memory_free(
+		 *scan_result_arena );
+
+		*scan_result_arena = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties a scan result arena
+ * The segments are retained to be reused by the scan results that are appended next
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_result_arena_empty(
+     libsigscan_scan_result_arena_t *scan_result_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_result_arena_empty";
+
+	if( scan_result_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result arena.",
+		 function );
+
+		return( -1 );
+	}
+	scan_result_arena->number_of_scan_results = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the number of scan results
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_result_arena_get_number_of_scan_results(
+     libsigscan_scan_result_arena_t *scan_result_arena,
+     int *number_of_scan_results,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_result_arena_get_number_of_scan_results";
+
+	if( scan_result_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_scan_results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of scan results.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_scan_results = scan_result_arena->number_of_scan_results;
+
+	return( 1 );
+}
+
+/* Retrieves a specific scan result
+ * The scan result is a reference into the scan result arena and is valid
+ * until the scan result arena is emptied or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_result_arena_get_scan_result_by_index(
+     libsigscan_scan_result_arena_t *scan_result_arena,
+     int scan_result_index,
+     libsigscan_internal_scan_result_t **scan_result,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_result_arena_get_scan_result_by_index";
+	int segment_number    = 0;
+	int segment_size      = LIBSIGSCAN_SCAN_RESULT_ARENA_SEGMENT_SIZE;
+
+	if( scan_result_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_result_index < 0 )
+	 || ( scan_result_index >= scan_result_arena->number_of_scan_results ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan result index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result.",
+		 function );
+
+		return( -1 );
+	}
+	/* Segment N starts at scan result index: segment size * ( 2^N - 1 )
+	 */
+	while( scan_result_index >= segment_size )
+	{
+		scan_result_index -= segment_size;
+		segment_size      *= 2;
+
+		segment_number++;
+	}
+	*scan_result = &( ( scan_result_arena->segments[ segment_number ] )[ scan_result_index ] );
+
+	return( 1 );
+}
+
+/* Appends a scan result
+ * A new segment is allocated when the allocated segments are full, where
+ * the size of the new segment is twice that of the previous segment
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_result_arena_append_scan_result(
+     libsigscan_scan_result_arena_t *scan_result_arena,
+     off64_t offset,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_result_t *scan_result = NULL;
+	static char *function                          = "libsigscan_scan_result_arena_append_scan_result";
+	int scan_result_index                          = 0;
+	int segment_size                               = 0;
+
+	if( scan_result_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid offset value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_result_arena->number_of_scan_results >= scan_result_arena->number_of_allocated_scan_results )
+	{
+		if( scan_result_arena->number_of_segments >= LIBSIGSCAN_SCAN_RESULT_ARENA_MAXIMUM_NUMBER_OF_SEGMENTS )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid scan result arena - number of segments value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		segment_size = LIBSIGSCAN_SCAN_RESULT_ARENA_SEGMENT_SIZE << scan_result_arena->number_of_segments;
+
+		scan_result_arena->segments[ scan_result_arena->number_of_segments ] = (libsigscan_internal_scan_result_t *) memory_allocate(
+		                                                                                                              sizeof( libsigscan_internal_scan_result_t ) * segment_size );
+
+		if( scan_result_arena->segments[ scan_result_arena->number_of_segments ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create segment.",
+			 function );
+
+			return( -1 );
+		}
+		scan_result_arena->number_of_segments               += 1;
+		scan_result_arena->number_of_allocated_scan_results += segment_size;
+	}
+	scan_result_index = scan_result_arena->number_of_scan_results;
+
+	scan_result_arena->number_of_scan_results += 1;
+
+	if( libsigscan_scan_result_arena_get_scan_result_by_index(
+	     scan_result_arena,
+	     scan_result_index,
+	     &scan_result,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan result: %d.",
+		 function,
+		 scan_result_index );
+
+		scan_result_arena->number_of_scan_results -= 1;
+
+		return( -1 );
+	}
+	scan_result->offset    = offset;
+	scan_result->signature = signature;
+
+	return( 1 );
+}
+
+/* Copies the signature indexes and offsets of consecutive scan results
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_result_arena_copy_scan_results(
+     libsigscan_scan_result_arena_t *scan_result_arena,
+     int first_scan_result_index,
+     int number_of_scan_results,
+     int *signature_indexes,
+     off64_t *offsets,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_result_t *segment = NULL;
+	static char *function                      = "libsigscan_scan_result_arena_copy_scan_results";
+	int scan_result_index                      = 0;
+	int segment_number                         = 0;
+	int segment_scan_result_index              = 0;
+	int segment_size                           = LIBSIGSCAN_SCAN_RESULT_ARENA_SEGMENT_SIZE;
+
+	if( scan_result_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_scan_result_index < 0 )
+	 || ( first_scan_result_index > scan_result_arena->number_of_scan_results ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first scan result index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_scan_results < 0 )
+	 || ( number_of_scan_results > ( scan_result_arena->number_of_scan_results - first_scan_result_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of scan results value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	segment_scan_result_index = first_scan_result_index;
+
+	while( segment_scan_result_index >= segment_size )
+	{
+		segment_scan_result_index -= segment_size;
+		segment_size              *= 2;
+
+		segment_number++;
+	}
+	for( scan_result_index = 0;
+	     scan_result_index < number_of_scan_results;
+	     scan_result_index++ )
+	{
+		if( segment_scan_result_index >= segment_size )
+		{
+			segment_scan_result_index = 0;
+			segment_size             *= 2;
+
+			segment_number++;
+		}
+		segment = scan_result_arena->segments[ segment_number ];
+
+		signature_indexes[ scan_result_index ] = segment[ segment_scan_result_index ].signature->signature_index;
+		offsets[ scan_result_index ]           = segment[ segment_scan_result_index ].offset;
+
+		segment_scan_result_index++;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,103 @@
+/*
+ * Scan result arena functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_SCAN_RESULT_ARENA_H )
+#define _LIBSIGSCAN_SCAN_RESULT_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_scan_result.h"
+#include "libsigscan_signature.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_scan_result_arena libsigscan_scan_result_arena_t;
+
+struct libsigscan_scan_result_arena
+{
+	/* The segments
+	 * the scan results are stored in segments that are never reallocated
+	 * so that references to scan results remain valid when scan results are appended,
+	 * segment N contains LIBSIGSCAN_SCAN_RESULT_ARENA_SEGMENT_SIZE << N scan results
+	 */
+	libsigscan_internal_scan_result_t *segments[ LIBSIGSCAN_SCAN_RESULT_ARENA_MAXIMUM_NUMBER_OF_SEGMENTS ];
+
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The number of scan results
+	 */
+	int number_of_scan_results;
+
+	/* The number of allocated scan results
+	 */
+	int number_of_allocated_scan_results;
+};
+
+int libsigscan_scan_result_arena_initialize(
+     libsigscan_scan_result_arena_t **scan_result_arena,
+     libcerror_error_t **error );
+
+int libsigscan_scan_result_arena_free(
+     libsigscan_scan_result_arena_t **scan_result_arena,
+     libcerror_error_t **error );
+
+int libsigscan_scan_result_arena_empty(
+     libsigscan_scan_result_arena_t *scan_result_arena,
+     libcerror_error_t **error );
+
+int libsigscan_scan_result_arena_get_number_of_scan_results(
+     libsigscan_scan_result_arena_t *scan_result_arena,
+     int *number_of_scan_results,
+     libcerror_error_t **error );
+
+int libsigscan_scan_result_arena_get_scan_result_by_index(
+     libsigscan_scan_result_arena_t *scan_result_arena,
+     int scan_result_index,
+     libsigscan_internal_scan_result_t **scan_result,
+     libcerror_error_t **error );
+
+int libsigscan_scan_result_arena_append_scan_result(
+     libsigscan_scan_result_arena_t *scan_result_arena,
+     off64_t offset,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error );
+
+int libsigscan_scan_result_arena_copy_scan_results(
+     libsigscan_scan_result_arena_t *scan_result_arena,
+     int first_scan_result_index,
+     int number_of_scan_results,
+     int *signature_indexes,
+     off64_t *offsets,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_SCAN_RESULT_ARENA_H ) */
+
@@ -23,13 +23,19 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libsigscan_aho_corasick.h"
 #include "libsigscan_definitions.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_libcnotify.h"
+#include "libsigscan_prefilter.h"
 #include "libsigscan_scan_result.h"
+#include "libsigscan_scan_result_arena.h"
 #include "libsigscan_scan_state.h"
 #include "libsigscan_scan_tree.h"
+#include "libsigscan_scan_tree_arena.h"
+#include "libsigscan_scan_tree_generation.h"
 #include "libsigscan_scan_tree_node.h"
+#include "libsigscan_skip_table.h"
 #include "libsigscan_types.h"
 
 /* Creates scan state
@@ -96,21 +102,21 @@ int libsigscan_scan_state_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_array_initialize(
-	     &( internal_scan_state->scan_results_array ),
-	     0,
+	if( libsigscan_scan_result_arena_initialize(
+	     &( internal_scan_state->scan_result_arena ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create scan results array.",
+		 "%s: unable to create scan result arena.",
 		 function );
 
 		goto on_error;
 	}
-	internal_scan_state->state = LIBSIGSCAN_SCAN_STATE_INITIALIZED;
+	internal_scan_state->state             = LIBSIGSCAN_SCAN_STATE_INITIALIZED;
+	internal_scan_state->number_of_workers = LIBSIGSCAN_DEFAULT_NUMBER_OF_SCAN_WORKERS;
 
 	*scan_state = (libsigscan_scan_state_t *) internal_scan_state;
 
@@ -159,26 +165,150 @@ int libsigscan_scan_state_free(
 			memory_free(
 			 internal_scan_state->buffer );
 		}
-		if( libcdata_array_free(
-		     &( internal_scan_state->scan_results_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_internal_scan_result_free,
+		if( internal_scan_state->overlap_buffer != NULL )
+		{
+			memory_free(
+			 internal_scan_state->overlap_buffer );
+		}
+		if( internal_scan_state->header_range_buffer != NULL )
+		{
+			memory_free(
+			 internal_scan_state->header_range_buffer );
+		}
+		if( internal_scan_state->block_overlap_buffer != NULL )
+		{
+			memory_free(
+			 internal_scan_state->block_overlap_buffer );
+		}
+		if( internal_scan_state->footer_range_buffer != NULL )
+		{
+			memory_free(
+			 internal_scan_state->footer_range_buffer );
+		}
+		if( libsigscan_scan_result_arena_free(
+		     &( internal_scan_state->scan_result_arena ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free scan results array.",
+			 "%s: unable to free scan result arena.",
 			 function );
 
 			result = -1;
 		}
+		if( internal_scan_state->generation != NULL )
+		{
+			if( libsigscan_scan_tree_generation_release(
+			     &( internal_scan_state->generation ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release scan tree generation.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_scan_state );
 	}
 	return( result );
 }
 
+/* Resets scan state
+ * The scan results are removed and the data offset is rewound so that the scan state
+ * can be reused for a next scan, the allocated buffers and the storage of the scan results
+ * are retained to prevent reallocating them for every scan
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_reset(
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_reset";
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( internal_scan_state->state == LIBSIGSCAN_SCAN_STATE_STARTED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan state - unsupported state.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_result_arena_empty(
+	     internal_scan_state->scan_result_arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty scan result arena.",
+		 function );
+
+		return( -1 );
+	}
+	/* The scan trees are no longer needed once the scan results are removed
+	 */
+	if( internal_scan_state->generation != NULL )
+	{
+		if( libsigscan_scan_tree_generation_release(
+		     &( internal_scan_state->generation ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release scan tree generation.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_scan_state->data_offset                = 0;
+	internal_scan_state->unbound_data_offset        = 0;
+	internal_scan_state->buffer_data_size           = 0;
+	internal_scan_state->overlap_buffer_data_offset = 0;
+	internal_scan_state->overlap_buffer_data_size   = 0;
+
+	internal_scan_state->header_range_buffer_data_size   = 0;
+	internal_scan_state->footer_range_buffer_data_size   = 0;
+	internal_scan_state->stop_scan                       = 0;
+	internal_scan_state->stop_data_offset                = 0;
+	internal_scan_state->number_of_matches               = 0;
+	internal_scan_state->number_of_scan_tree_walks       = 0;
+	internal_scan_state->number_of_scan_tree_node_visits = 0;
+	internal_scan_state->number_of_skipped_reads         = 0;
+
+	internal_scan_state->block_overlap_buffer_data_offset = 0;
+	internal_scan_state->block_overlap_buffer_data_size   = 0;
+
+	return( 1 );
+}
+
 /* Sets the data offset
  * Returns 1 if successful or -1 on error
  */
@@ -259,16 +389,16 @@ int libsigscan_scan_state_set_data_size(
 	return( 1 );
 }
 
-/* Retrieves the buffer size
+/* Retrieves the flags
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scan_state_get_buffer_size(
+int libsigscan_scan_state_get_flags(
      libsigscan_scan_state_t *scan_state,
-     size_t *buffer_size,
+     uint8_t *flags,
      libcerror_error_t **error )
 {
 	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
-	static char *function                                 = "libsigscan_scan_state_get_buffer_size";
+	static char *function                                 = "libsigscan_scan_state_get_flags";
 
 	if( scan_state == NULL )
 	{
@@ -283,34 +413,33 @@ int libsigscan_scan_state_get_buffer_size(
 	}
 	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
 
-	if( buffer_size == NULL )
+	if( flags == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid scan state.",
+		 "%s: invalid flags.",
 		 function );
 
 		return( -1 );
 	}
-	*buffer_size = internal_scan_state->buffer_size;
+	*flags = internal_scan_state->flags;
 
 	return( 1 );
 }
 
-/* Retrieves the header range
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Sets the flags
+ * The flags cannot be changed while the scan state is started
+ * Returns 1 if successful or -1 on error
  */
-int libsigscan_scan_state_get_header_range(
+int libsigscan_scan_state_set_flags(
      libsigscan_scan_state_t *scan_state,
-     uint64_t *header_range_start,
-     uint64_t *header_range_end,
-     uint64_t *header_range_size,
+     uint8_t flags,
      libcerror_error_t **error )
 {
 	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
-	static char *function                                 = "libsigscan_scan_state_get_header_range";
+	static char *function                                 = "libsigscan_scan_state_set_flags";
 
 	if( scan_state == NULL )
 	{
@@ -325,62 +454,96 @@ int libsigscan_scan_state_get_header_range(
 	}
 	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
 
-	if( header_range_start == NULL )
+	if( internal_scan_state->state == LIBSIGSCAN_SCAN_STATE_STARTED )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid header range start.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan state - unsupported state.",
 		 function );
 
 		return( -1 );
 	}
-	if( header_range_end == NULL )
+	if( ( flags & ~( LIBSIGSCAN_SCAN_STATE_FLAG_SCAN_IN_PLACE | LIBSIGSCAN_SCAN_STATE_FLAG_STOP_ON_SIGNATURE_MATCH ) ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid header range end.",
-		 function );
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
 
 		return( -1 );
 	}
-	if( header_range_size == NULL )
+	internal_scan_state->flags = flags;
+
+	return( 1 );
+}
+
+/* Sets the match callback function
+ * The match callback function is called for every match with the identifier of the signature
+ * and the offset of the match. When set the matches are not stored as scan results
+ * The match callback function should return 1 to continue the scan, 0 to stop the scan or -1 on error
+ * Set the match callback function to NULL to store the matches as scan results
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_set_match_callback(
+     libsigscan_scan_state_t *scan_state,
+     int (*match_callback)(
+            const char *identifier,
+            size_t identifier_size,
+            off64_t offset,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_set_match_callback";
+
+	if( scan_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid header range size.",
+		 "%s: invalid scan state.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_scan_state->header_range_size == 0 )
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( internal_scan_state->state == LIBSIGSCAN_SCAN_STATE_STARTED )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan state - unsupported state.",
+		 function );
+
+		return( -1 );
 	}
-	*header_range_start = internal_scan_state->header_range_start;
-	*header_range_end   = internal_scan_state->header_range_end;
-	*header_range_size  = internal_scan_state->header_range_size;
+	internal_scan_state->match_callback           = match_callback;
+	internal_scan_state->match_callback_user_data = user_data;
 
 	return( 1 );
 }
 
-/* Retrieves the footer range
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Sets the maximum number of results
+ * The scan stops when the number of matches reaches the maximum, use 0 for no maximum
+ * The maximum cannot be changed while the scan state is started
+ * Returns 1 if successful or -1 on error
  */
-int libsigscan_scan_state_get_footer_range(
+int libsigscan_scan_state_set_maximum_number_of_results(
      libsigscan_scan_state_t *scan_state,
-     uint64_t *footer_range_start,
-     uint64_t *footer_range_end,
-     uint64_t *footer_range_size,
+     int maximum_number_of_results,
      libcerror_error_t **error )
 {
 	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
-	static char *function                                 = "libsigscan_scan_state_get_footer_range";
+	static char *function                                 = "libsigscan_scan_state_set_maximum_number_of_results";
 
 	if( scan_state == NULL )
 	{
@@ -395,66 +558,86 @@ int libsigscan_scan_state_get_footer_range(
 	}
 	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
 
-	if( footer_range_start == NULL )
+	if( internal_scan_state->state == LIBSIGSCAN_SCAN_STATE_STARTED )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid footer range start.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan state - unsupported state.",
 		 function );
 
 		return( -1 );
 	}
-	if( footer_range_end == NULL )
+	if( maximum_number_of_results < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid footer range end.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of results value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( footer_range_size == NULL )
+	internal_scan_state->maximum_number_of_results = maximum_number_of_results;
+
+	return( 1 );
+}
+
+/* Retrieves the number of workers
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_get_number_of_workers(
+     libsigscan_scan_state_t *scan_state,
+     int *number_of_workers,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_get_number_of_workers";
+
+	if( scan_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid footer range size.",
+		 "%s: invalid scan state.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_scan_state->footer_range_size == 0 )
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( number_of_workers == NULL )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of workers.",
+		 function );
+
+		return( -1 );
 	}
-	*footer_range_start = internal_scan_state->footer_range_start;
-	*footer_range_end   = internal_scan_state->footer_range_end;
-	*footer_range_size  = internal_scan_state->footer_range_size;
+	*number_of_workers = internal_scan_state->number_of_workers;
 
 	return( 1 );
 }
 
-/* Starts the scan state
+/* Sets the number of workers
+ * When more than 1 worker is set a file with unbound signatures is divided
+ * into chunks that are scanned in parallel, the results are merged in offset order
+ * The number of workers cannot be changed while the scan state is started
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scan_state_start(
+int libsigscan_scan_state_set_number_of_workers(
      libsigscan_scan_state_t *scan_state,
-     libsigscan_scan_tree_t *header_scan_tree,
-     libsigscan_scan_tree_t *footer_scan_tree,
-     libsigscan_scan_tree_t *scan_tree,
-     size_t scan_buffer_size,
+     int number_of_workers,
      libcerror_error_t **error )
 {
 	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
-	static char *function                                 = "libsigscan_scan_state_start";
-	uint64_t range_size                                   = 0;
-	uint64_t range_start                                  = 0;
-	int result                                            = 0;
+	static char *function                                 = "libsigscan_scan_state_set_number_of_workers";
 
 	if( scan_state == NULL )
 	{
@@ -469,8 +652,7 @@ int libsigscan_scan_state_start(
 	}
 	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
 
-	if( ( internal_scan_state->state != LIBSIGSCAN_SCAN_STATE_INITIALIZED )
-	 && ( internal_scan_state->state != LIBSIGSCAN_SCAN_STATE_STOPPED ) )
+	if( internal_scan_state->state == LIBSIGSCAN_SCAN_STATE_STARTED )
 	{
 		libcerror_error_set(
 		 error,
@@ -481,145 +663,92 @@ int libsigscan_scan_state_start(
 
 		return( -1 );
 	}
-	if( internal_scan_state->buffer != NULL )
+	if( ( number_of_workers < 1 )
+	 || ( number_of_workers > LIBSIGSCAN_MAXIMUM_NUMBER_OF_SCAN_WORKERS ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid scan state - buffer value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( scan_buffer_size > (size_t) SSIZE_MAX )
+	internal_scan_state->number_of_workers = number_of_workers;
+
+	return( 1 );
+}
+
+/* Retrieves the block alignment
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_get_block_alignment(
+     libsigscan_scan_state_t *scan_state,
+     size64_t *block_size,
+     off64_t *block_offset,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_get_block_alignment";
+
+	if( scan_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid scan buffer size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
 		 function );
 
 		return( -1 );
 	}
-	internal_scan_state->buffer = (uint8_t *) memory_allocate(
-	                                           sizeof( uint8_t ) * scan_buffer_size );
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
 
-	if( internal_scan_state->buffer == NULL )
+	if( block_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create scan buffer.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block size.",
 		 function );
 
 		return( -1 );
 	}
-	if( header_scan_tree != NULL )
+	if( block_offset == NULL )
 	{
-		result = libsigscan_scan_tree_get_spanning_range(
-		          header_scan_tree,
-		          &range_start,
-		          &range_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block offset.",
+		 function );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve header pattern spanning range.",
-			 function );
+		return( -1 );
+	}
+	*block_size   = internal_scan_state->block_size;
+	*block_offset = internal_scan_state->block_offset;
 
-			return( -1 );
-		}
-		else if( result != 0 )
-		{
-			/* The header range should always start with 0 since the header scan tree is relative to offset 0
-			 */
-			internal_scan_state->header_range_start = 0;
-			internal_scan_state->header_range_end   = range_start + range_size;
-			internal_scan_state->header_range_size  = range_start + range_size;
+	return( 1 );
+}
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: header signature range: %" PRIi64 " - %" PRIi64 ".\n",
-				 function,
-				 internal_scan_state->header_range_start,
-				 internal_scan_state->header_range_end );
-			}
-#endif
-		}
-		internal_scan_state->active_header_node = header_scan_tree->root_node;
-	}
-	if( footer_scan_tree != NULL )
-	{
-		result = libsigscan_scan_tree_get_spanning_range(
-		          footer_scan_tree,
-		          &range_start,
-		          &range_size,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve footer pattern spanning range.",
-			 function );
-
-			return( -1 );
-		}
-		else if( ( result != 0 )
-		      && ( range_start < internal_scan_state->data_size ) )
-		{
-			internal_scan_state->footer_range_start = internal_scan_state->data_size - range_start;
-			internal_scan_state->footer_range_end   = internal_scan_state->footer_range_start + range_size;
-			internal_scan_state->footer_range_size  = range_size;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: footer signature range: %" PRIi64 " - %" PRIi64 ".\n",
-				 function,
-				 internal_scan_state->footer_range_start,
-				 internal_scan_state->footer_range_end );
-			}
-#endif
-		}
-		internal_scan_state->active_footer_node = footer_scan_tree->root_node;
-	}
-	if( scan_tree != NULL )
-	{
-		internal_scan_state->active_node = scan_tree->root_node;
-	}
-	internal_scan_state->data_offset       = 0;
-	internal_scan_state->state             = LIBSIGSCAN_SCAN_STATE_STARTED;
-	internal_scan_state->header_scan_tree  = header_scan_tree;
-	internal_scan_state->footer_scan_tree  = footer_scan_tree;
-	internal_scan_state->scan_tree         = scan_tree;
-	internal_scan_state->buffer_size       = scan_buffer_size;
-	internal_scan_state->buffer_data_size  = 0;
-
-	return( 1 );
-}
-
-/* Stops the scan state
+/* Sets the block alignment
+ * When a block size is set the header signatures (offset relative from start) are matched
+ * at every block boundary: block offset + ( N * block size ) instead of only at the start
+ * of the data, the results are reported at the offset of the block boundary + pattern offset
+ * A block size of 0 represents the header signatures are only matched at the start of the data
+ * The block alignment cannot be changed while the scan state is started
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scan_state_stop(
+int libsigscan_scan_state_set_block_alignment(
      libsigscan_scan_state_t *scan_state,
+     size64_t block_size,
+     off64_t block_offset,
      libcerror_error_t **error )
 {
 	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
-	static char *function                                 = "libsigscan_scan_state_stop";
+	static char *function                                 = "libsigscan_scan_state_set_block_alignment";
 
 	if( scan_state == NULL )
 	{
@@ -634,7 +763,7 @@ int libsigscan_scan_state_stop(
 	}
 	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
 
-	if( internal_scan_state->state != LIBSIGSCAN_SCAN_STATE_STARTED )
+	if( internal_scan_state->state == LIBSIGSCAN_SCAN_STATE_STARTED )
 	{
 		libcerror_error_set(
 		 error,
@@ -645,55 +774,44 @@ int libsigscan_scan_state_stop(
 
 		return( -1 );
 	}
-	if( internal_scan_state->buffer_data_size > 0 )
+	if( block_size > (size64_t) INT64_MAX )
 	{
-		if( libsigscan_internal_scan_state_scan_buffer(
-		     internal_scan_state,
-		     internal_scan_state->buffer,
-		     internal_scan_state->buffer_data_size,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to scan buffer.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid block size value exceeds maximum.",
+		 function );
 
-			return( -1 );
-		}
-		internal_scan_state->data_offset     += internal_scan_state->buffer_data_size;
-		internal_scan_state->buffer_data_size = 0;
+		return( -1 );
 	}
-	if( internal_scan_state->buffer != NULL )
+	if( block_offset < 0 )
 	{
-		memory_free(
-		 internal_scan_state->buffer );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block offset value out of bounds.",
+		 function );
 
-		internal_scan_state->buffer = NULL;
+		return( -1 );
 	}
-	internal_scan_state->buffer_size        = 0;
-	internal_scan_state->state              = LIBSIGSCAN_SCAN_STATE_STOPPED;
-	internal_scan_state->header_scan_tree   = NULL;
-	internal_scan_state->active_header_node = NULL;
-	internal_scan_state->footer_scan_tree   = NULL;
-	internal_scan_state->active_footer_node = NULL;
-	internal_scan_state->scan_tree          = NULL;
-	internal_scan_state->active_node        = NULL;
+	internal_scan_state->block_size   = block_size;
+	internal_scan_state->block_offset = block_offset;
 
 	return( 1 );
 }
 
-/* Flushes the scan state
+/* Retrieves the buffer size
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scan_state_flush(
+int libsigscan_scan_state_get_buffer_size(
      libsigscan_scan_state_t *scan_state,
+     size_t *buffer_size,
      libcerror_error_t **error )
 {
 	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
-	static char *function                                 = "libsigscan_scan_state_flush";
+	static char *function                                 = "libsigscan_scan_state_get_buffer_size";
 
 	if( scan_state == NULL )
 	{
@@ -708,346 +826,307 @@ int libsigscan_scan_state_flush(
 	}
 	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
 
-	if( internal_scan_state->state != LIBSIGSCAN_SCAN_STATE_STARTED )
+	if( buffer_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid scan state - unsupported state.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_scan_state->buffer_data_size > 0 )
-	{
-		if( libsigscan_internal_scan_state_scan_buffer(
-		     internal_scan_state,
-		     internal_scan_state->buffer,
-		     internal_scan_state->buffer_data_size,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to scan buffer.",
-			 function );
+	*buffer_size = internal_scan_state->buffer_size;
 
-			return( -1 );
-		}
-		internal_scan_state->data_offset     += internal_scan_state->buffer_data_size;
-		internal_scan_state->buffer_data_size = 0;
-	}
 	return( 1 );
 }
 
-/* Scans the buffer using a specific scan tree and updates the scan state
- * Returns 1 if successful, 0 if data size has been reached or -1 on error
+/* Retrieves the header range
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
-     libsigscan_internal_scan_state_t *internal_scan_state,
-     libsigscan_scan_tree_t *scan_tree,
-     libsigscan_scan_tree_node_t **active_node,
-     off64_t data_offset,
-     size64_t data_size,
-     const uint8_t *buffer,
-     size_t buffer_size,
-     size_t buffer_offset,
+int libsigscan_scan_state_get_header_range(
+     libsigscan_scan_state_t *scan_state,
+     uint64_t *header_range_start,
+     uint64_t *header_range_end,
+     uint64_t *header_range_size,
      libcerror_error_t **error )
 {
-	libsigscan_scan_object_t *scan_object = NULL;
-	libsigscan_scan_result_t *scan_result = NULL;
-	libsigscan_signature_t *signature     = NULL;
-	static char *function                 = "libsigscan_internal_scan_state_scan_buffer_by_scan_tree";
-	size_t buffer_end_offset              = 0;
-	size_t skip_value                     = 0;
-	size_t smallest_pattern_size          = 0;
-	uint8_t scan_object_type              = 0;
-	int entry_index                       = 0;
-	int result                            = 0;
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_get_header_range";
 
-	if( internal_scan_state == NULL )
+	if( scan_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal scan state.",
+		 "%s: invalid scan state.",
 		 function );
 
 		return( -1 );
 	}
-	if( scan_tree == NULL )
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( header_range_start == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid scan tree.",
+		 "%s: invalid header range start.",
 		 function );
 
 		return( -1 );
 	}
-	if( active_node == NULL )
+	if( header_range_end == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid active scan tree node.",
+		 "%s: invalid header range end.",
 		 function );
 
 		return( -1 );
 	}
-	if( data_offset < 0 )
+	if( header_range_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid data offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header range size.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer == NULL )
+	if( internal_scan_state->header_range_size == 0 )
+	{
+		return( 0 );
+	}
+	if( internal_scan_state->block_size > 0 )
+	{
+		/* The header signatures are matched at every block boundary
+		 * hence the range contains all the blocks
+		 */
+		if( (size64_t) internal_scan_state->block_offset >= internal_scan_state->data_size )
+		{
+			return( 0 );
+		}
+		*header_range_start = (uint64_t) internal_scan_state->block_offset;
+		*header_range_end   = (uint64_t) internal_scan_state->data_size;
+		*header_range_size  = *header_range_end - *header_range_start;
+	}
+	else
+	{
+		*header_range_start = internal_scan_state->header_range_start;
+		*header_range_end   = internal_scan_state->header_range_end;
+		*header_range_size  = internal_scan_state->header_range_size;
+	}
+
+	return( 1 );
+}
+
+/* Retrieves the footer range
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libsigscan_scan_state_get_footer_range(
+     libsigscan_scan_state_t *scan_state,
+     uint64_t *footer_range_start,
+     uint64_t *footer_range_end,
+     uint64_t *footer_range_size,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_get_footer_range";
+
+	if( scan_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid scan state.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( buffer_size == 0 )
-	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( footer_range_start == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid buffer size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid footer range start.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer_offset >= buffer_size )
+	if( footer_range_end == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid buffer offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid footer range end.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( data_size == 0 )
-	 || ( (size64_t) data_offset >= data_size ) )
+	if( footer_range_size == NULL )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid footer range size.",
+		 function );
+
+		return( -1 );
 	}
-	while( buffer_offset < buffer_size )
+	if( internal_scan_state->footer_range_size == 0 )
 	{
-		result = libsigscan_scan_tree_node_scan_buffer(
-		          *active_node,
-		          scan_tree->pattern_offsets_mode,
-		          data_offset,
-		          data_size,
-		          buffer,
-		          buffer_size,
-		          buffer_offset,
-		          &scan_object,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to scan buffer.",
-			 function );
+		return( 0 );
+	}
+	*footer_range_start = internal_scan_state->footer_range_start;
+	*footer_range_end   = internal_scan_state->footer_range_end;
+	*footer_range_size  = internal_scan_state->footer_range_size;
 
-			goto on_error;
-		}
-		else if( result != 0 )
-		{
-			if( libsigscan_scan_object_get_type(
-			     scan_object,
-			     &scan_object_type,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve scan object type.",
-				 function );
+	return( 1 );
+}
 
-				goto on_error;
-			}
-			if( scan_object_type != LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported scan object type.",
-				 function );
+/* Sets the scan tree generation that is used by the scan
+ * The scan state holds a reference to the generation, which replaces the reference
+ * to the generation of a previous scan without scan results
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_set_generation(
+     libsigscan_scan_state_t *scan_state,
+     libsigscan_scan_tree_generation_t *generation,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_set_generation";
+	int number_of_scan_results                            = 0;
 
-				goto on_error;
-			}
-			if( libsigscan_scan_object_get_value(
-			     scan_object,
-			     (intptr_t **) &signature,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve scan object value.",
-				 function );
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
 
-				goto on_error;
-			}
-			if( signature == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing signature.",
-				 function );
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
 
-				goto on_error;
-			}
-			if( libsigscan_scan_result_initialize(
-			     &scan_result,
-			     data_offset,
-			     signature,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create scan result.",
-				 function );
+	if( internal_scan_state->state == LIBSIGSCAN_SCAN_STATE_STARTED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan state - unsupported state.",
+		 function );
 
-				goto on_error;
-			}
-			if( libcdata_array_append_entry(
-			     internal_scan_state->scan_results_array,
-			     &entry_index,
-			     (intptr_t *) scan_result,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append scan result.",
-				 function );
+		return( -1 );
+	}
+	if( internal_scan_state->generation == generation )
+	{
+		return( 1 );
+	}
+	if( internal_scan_state->generation != NULL )
+	{
+		if( libsigscan_scan_result_arena_get_number_of_scan_results(
+		     internal_scan_state->scan_result_arena,
+		     &number_of_scan_results,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of scan results.",
+			 function );
 
-				goto on_error;
-			}
-			scan_result = NULL;
-			skip_value  = signature->pattern_size;
+			return( -1 );
 		}
-		if( result == 0 )
+		/* The scan results of a previous scan can reference signatures that were retired
+		 * since a generation keeps all the next generations available the previous
+		 * generation is retained until the scan results are removed
+		 */
+		if( number_of_scan_results > 0 )
 		{
-			if( libsigscan_skip_table_get_smallest_pattern_size(
-			     scan_tree->skip_table,
-			     &smallest_pattern_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve smallest pattern size.",
-				 function );
-
-				goto on_error;
-			}
-			if( smallest_pattern_size > buffer_size )
-			{
-				smallest_pattern_size = buffer_size;
-			}
-			buffer_end_offset = buffer_offset + smallest_pattern_size - 1;
+			return( 1 );
+		}
+	}
+	if( generation != NULL )
+	{
+		if( libsigscan_scan_tree_generation_grab(
+		     generation,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab scan tree generation.",
+			 function );
 
-			if( buffer_end_offset >= buffer_size )
-			{
-				buffer_end_offset = buffer_size - 1;
-			}
-			skip_value = 0;
+			return( -1 );
+		}
+	}
+	if( internal_scan_state->generation != NULL )
+	{
+		if( libsigscan_scan_tree_generation_release(
+		     &( internal_scan_state->generation ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release scan tree generation.",
+			 function );
 
-			do
+			if( generation != NULL )
 			{
-				if( libsigscan_skip_table_get_skip_value(
-				     scan_tree->skip_table,
-				     buffer[ buffer_end_offset ],
-				     &skip_value,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve skip value.",
-					 function );
-
-					goto on_error;
-				}
-				buffer_end_offset -= 1;
+				libsigscan_scan_tree_generation_release(
+				 &generation,
+				 NULL );
 			}
-			while( ( buffer_end_offset > buffer_offset )
-			    && ( skip_value == 0 ) );
-		}
-		if( scan_tree->pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
-		{
-			break;
+			return( -1 );
 		}
-		*active_node = scan_tree->root_node;
-
-		buffer_offset += skip_value;
-		data_offset   += skip_value;
 	}
-	return( 1 );
+	internal_scan_state->generation = generation;
 
-on_error:
-	if( scan_result != NULL )
-	{
-		libsigscan_internal_scan_result_free(
-		 (libsigscan_internal_scan_result_t **) &scan_result,
-		 NULL );
-	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Scans the buffer and updates the scan state
- * Returns 1 if successful, 0 if data size has been reached or -1 on error
+/* Starts the scan state
+ * Returns 1 if successful or -1 on error
  */
-int libsigscan_internal_scan_state_scan_buffer(
-     libsigscan_internal_scan_state_t *internal_scan_state,
-     const uint8_t *buffer,
-     size_t buffer_size,
-     size_t buffer_offset,
+int libsigscan_scan_state_start(
+     libsigscan_scan_state_t *scan_state,
+     libsigscan_scan_tree_t *header_scan_tree,
+     libsigscan_scan_tree_t *footer_scan_tree,
+     libsigscan_scan_tree_t *scan_tree,
+     size_t scan_buffer_size,
      libcerror_error_t **error )
 {
-	static char *function      = "libsigscan_internal_scan_state_scan_buffer";
-	off64_t range_end_offset   = 0;
-	off64_t range_start_offset = 0;
-	size_t range_offset        = 0;
-	size_t range_size          = 0;
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_start";
+	uint64_t range_size                                   = 0;
+	uint64_t range_start                                  = 0;
+	size_t largest_pattern_size                           = 0;
+	int result                                            = 0;
 
-	if( internal_scan_state == NULL )
+	if( scan_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1058,194 +1137,2531 @@ int libsigscan_internal_scan_state_scan_buffer(
 
 		return( -1 );
 	}
-	if( internal_scan_state->data_offset < 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid scan state - data offset value out of bounds.",
-		 function );
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
 
-		return( -1 );
-	}
-	if( ( buffer_size == 0 )
-	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	if( ( internal_scan_state->state != LIBSIGSCAN_SCAN_STATE_INITIALIZED )
+	 && ( internal_scan_state->state != LIBSIGSCAN_SCAN_STATE_STOPPED ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid buffer size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan state - unsupported state.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer_offset >= buffer_size )
+	if( scan_buffer_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid buffer offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid scan buffer size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_scan_state->data_size == 0 )
-	 || ( (size64_t) internal_scan_state->data_offset >= internal_scan_state->data_size ) )
-	{
-		return( 0 );
-	}
-	if( internal_scan_state->header_range_size > 0 )
+	/* When scanning in place the caller buffers are scanned directly
+	 * and the scan buffer is not used
+	 */
+	if( ( internal_scan_state->flags & LIBSIGSCAN_SCAN_STATE_FLAG_SCAN_IN_PLACE ) == 0 )
 	{
-		range_start_offset = internal_scan_state->data_offset;
-		range_end_offset   = internal_scan_state->data_offset + buffer_size;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		/* The scan buffer of a previous scan is reused if it is large enough
+		 */
+		if( ( internal_scan_state->buffer != NULL )
+		 && ( internal_scan_state->allocated_buffer_size < scan_buffer_size ) )
 		{
-			libcnotify_printf(
-			 "%s: header range: %" PRIi64 " - %" PRIi64 ".\n",
-			 function,
-			 internal_scan_state->header_range_start,
-			 internal_scan_state->header_range_end );
+			memory_free(
+			 internal_scan_state->buffer );
+
+			internal_scan_state->buffer                = NULL;
+			internal_scan_state->allocated_buffer_size = 0;
 		}
-#endif
-		if( ( ( range_start_offset >= (off64_t) internal_scan_state->header_range_start )
-		  && ( range_start_offset < (off64_t) internal_scan_state->header_range_end ) )
-		 ||  ( ( range_end_offset >= (off64_t) internal_scan_state->header_range_start )
-		  && ( range_end_offset < (off64_t) internal_scan_state->header_range_end ) ) )
+		if( internal_scan_state->buffer == NULL )
 		{
-			range_offset = buffer_offset;
-			range_size   = buffer_size;
+			internal_scan_state->buffer = (uint8_t *) memory_allocate(
+			                                           sizeof( uint8_t ) * scan_buffer_size );
 
-			if( range_start_offset < (off64_t) internal_scan_state->header_range_start )
-			{
-				range_offset       = (size_t) ( internal_scan_state->header_range_start - range_start_offset );
-				range_start_offset = (off64_t) internal_scan_state->header_range_start;
-			}
-			if( range_end_offset > (off64_t) internal_scan_state->header_range_end )
-			{
-				range_size      -= (size_t) ( range_end_offset - internal_scan_state->header_range_end );
-				range_end_offset = (off64_t) internal_scan_state->header_range_end;
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: scan range: %" PRIi64 " - %" PRIi64 ".\n",
-				 function,
-				 range_start_offset,
-				 range_end_offset );
-			}
-#endif
-			if( libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
-			     internal_scan_state,
-			     internal_scan_state->header_scan_tree,
-			     &( internal_scan_state->active_header_node ),
-			     range_start_offset,
-			     internal_scan_state->data_size,
-			     buffer,
-			     range_size,
-			     range_offset,
-			     error ) != 1 )
+			if( internal_scan_state->buffer == NULL )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to scan buffer by header scan tree.",
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create scan buffer.",
 				 function );
 
 				return( -1 );
 			}
+			internal_scan_state->allocated_buffer_size = scan_buffer_size;
 		}
 	}
-	if( internal_scan_state->footer_range_size > 0 )
+	/* The ranges depend on the data size and are determined for every scan
+	 */
+	internal_scan_state->header_range_start = 0;
+	internal_scan_state->header_range_end   = 0;
+	internal_scan_state->header_range_size  = 0;
+	internal_scan_state->footer_range_start = 0;
+	internal_scan_state->footer_range_end   = 0;
+	internal_scan_state->footer_range_size  = 0;
+
+	if( header_scan_tree != NULL )
 	{
-		range_start_offset = internal_scan_state->data_offset;
-		range_end_offset   = internal_scan_state->data_offset + buffer_size;
+		result = libsigscan_scan_tree_get_spanning_range(
+		          header_scan_tree,
+		          &range_start,
+		          &range_size,
+		          error );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( result == -1 )
 		{
-			libcnotify_printf(
-			 "%s: footer range: %" PRIi64 " - %" PRIi64 ".\n",
-			 function,
-			 internal_scan_state->footer_range_start,
-			 internal_scan_state->footer_range_end );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve header pattern spanning range.",
+			 function );
+
+			goto on_error;
 		}
-#endif
-		if( ( ( range_start_offset >= (off64_t) internal_scan_state->footer_range_start )
-		  && ( range_start_offset < (off64_t) internal_scan_state->footer_range_end ) )
-		 ||  ( ( range_end_offset >= (off64_t) internal_scan_state->footer_range_start )
-		  && ( range_end_offset < (off64_t) internal_scan_state->footer_range_end ) ) )
+		else if( result != 0 )
 		{
-			range_offset = buffer_offset;
-			range_size   = buffer_size;
+			/* The header range should always start with 0 since the header scan tree is relative to offset 0
+			 */
+			internal_scan_state->header_range_start = 0;
+			internal_scan_state->header_range_end   = range_start + range_size;
+			internal_scan_state->header_range_size  = range_start + range_size;
 
-			if( range_start_offset < (off64_t) internal_scan_state->footer_range_start )
-			{
-				range_offset       = (size_t) ( internal_scan_state->footer_range_start - range_start_offset );
-				range_start_offset = (off64_t) internal_scan_state->footer_range_start;
-			}
-			if( range_end_offset > (off64_t) internal_scan_state->footer_range_end )
-			{
-				range_size      -= (size_t) ( range_end_offset - internal_scan_state->footer_range_end );
-				range_end_offset = (off64_t) internal_scan_state->footer_range_end;
-			}
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
 				libcnotify_printf(
-				 "%s: scan range: %" PRIi64 " - %" PRIi64 ".\n",
+				 "%s: header signature range: %" PRIi64 " - %" PRIi64 ".\n",
 				 function,
-				 range_start_offset,
-				 range_end_offset );
+				 internal_scan_state->header_range_start,
+				 internal_scan_state->header_range_end );
 			}
 #endif
-			if( libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
-			     internal_scan_state,
-			     internal_scan_state->footer_scan_tree,
-			     &( internal_scan_state->active_footer_node ),
-			     range_start_offset,
-			     internal_scan_state->data_size,
-			     buffer,
-			     range_size,
-			     range_offset,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to scan buffer by footer scan tree.",
-				 function );
-
-				return( -1 );
-			}
 		}
+		internal_scan_state->active_header_node = header_scan_tree->root_node;
 	}
-/* TODO handle unbound */
-	return( 1 );
+	/* The block overlap buffer needs to be able to contain the remainder of the previous buffers
+	 * and the start of the next buffer, which both are at most the header range end - 1
+	 */
+	if( ( internal_scan_state->block_size > 0 )
+	 && ( internal_scan_state->header_range_end > 1 ) )
+	{
+		if( internal_scan_state->header_range_end > (uint64_t) ( SSIZE_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid header range end value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		internal_scan_state->block_overlap_size = (size_t) ( internal_scan_state->header_range_end - 1 );
+
+		/* The block overlap buffer of a previous scan is reused if it is large enough
+		 */
+		if( ( internal_scan_state->block_overlap_buffer != NULL )
+		 && ( internal_scan_state->allocated_block_overlap_buffer_size < ( 2 * internal_scan_state->block_overlap_size ) ) )
+		{
+			memory_free(
+			 internal_scan_state->block_overlap_buffer );
+
+			internal_scan_state->block_overlap_buffer                = NULL;
+			internal_scan_state->allocated_block_overlap_buffer_size = 0;
+		}
+		if( internal_scan_state->block_overlap_buffer == NULL )
+		{
+			internal_scan_state->block_overlap_buffer = (uint8_t *) memory_allocate(
+			                                                         sizeof( uint8_t ) * 2 * internal_scan_state->block_overlap_size );
+
+			if( internal_scan_state->block_overlap_buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create block overlap buffer.",
+				 function );
+
+				goto on_error;
+			}
+			internal_scan_state->allocated_block_overlap_buffer_size = 2 * internal_scan_state->block_overlap_size;
+		}
+	}
+	if( footer_scan_tree != NULL )
+	{
+		result = libsigscan_scan_tree_get_spanning_range(
+		          footer_scan_tree,
+		          &range_start,
+		          &range_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve footer pattern spanning range.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result != 0 )
+		      && ( range_start < internal_scan_state->data_size ) )
+		{
+			internal_scan_state->footer_range_start = internal_scan_state->data_size - range_start;
+			internal_scan_state->footer_range_end   = internal_scan_state->footer_range_start + range_size;
+			internal_scan_state->footer_range_size  = range_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: footer signature range: %" PRIi64 " - %" PRIi64 ".\n",
+				 function,
+				 internal_scan_state->footer_range_start,
+				 internal_scan_state->footer_range_end );
+			}
+#endif
+		}
+		internal_scan_state->active_footer_node = footer_scan_tree->root_node;
+	}
+	if( ( scan_tree != NULL )
+	 && ( scan_tree->arena != NULL ) )
+	{
+		if( libsigscan_skip_table_get_largest_pattern_size(
+		     scan_tree->skip_table,
+		     &largest_pattern_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve largest pattern size.",
+			 function );
+
+			goto on_error;
+		}
+		/* The overlap buffer needs to be able to contain the remainder of the previous buffer
+		 * and the start of the next buffer, which both are at most the largest pattern size - 1
+		 */
+		if( largest_pattern_size > 1 )
+		{
+			internal_scan_state->overlap_buffer_size = 2 * ( largest_pattern_size - 1 );
+
+			/* The overlap buffer of a previous scan is reused if it is large enough
+			 */
+			if( ( internal_scan_state->overlap_buffer != NULL )
+			 && ( internal_scan_state->allocated_overlap_buffer_size < internal_scan_state->overlap_buffer_size ) )
+			{
+				memory_free(
+				 internal_scan_state->overlap_buffer );
+
+				internal_scan_state->overlap_buffer                = NULL;
+				internal_scan_state->allocated_overlap_buffer_size = 0;
+			}
+			if( internal_scan_state->overlap_buffer == NULL )
+			{
+				internal_scan_state->overlap_buffer = (uint8_t *) memory_allocate(
+				                                                   sizeof( uint8_t ) * internal_scan_state->overlap_buffer_size );
+
+				if( internal_scan_state->overlap_buffer == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create overlap buffer.",
+					 function );
+
+					goto on_error;
+				}
+				internal_scan_state->allocated_overlap_buffer_size = internal_scan_state->overlap_buffer_size;
+			}
+		}
+		internal_scan_state->active_node = scan_tree->root_node;
+	}
+	internal_scan_state->data_offset                = 0;
+	internal_scan_state->state                      = LIBSIGSCAN_SCAN_STATE_STARTED;
+	internal_scan_state->header_scan_tree           = header_scan_tree;
+	internal_scan_state->footer_scan_tree           = footer_scan_tree;
+	internal_scan_state->scan_tree                  = scan_tree;
+	internal_scan_state->unbound_data_offset        = 0;
+	internal_scan_state->buffer_size                = scan_buffer_size;
+	internal_scan_state->buffer_data_size           = 0;
+	internal_scan_state->overlap_buffer_data_offset = 0;
+	internal_scan_state->overlap_buffer_data_size   = 0;
+
+	internal_scan_state->header_range_buffer_data_size   = 0;
+	internal_scan_state->footer_range_buffer_data_size   = 0;
+	internal_scan_state->stop_scan                       = 0;
+	internal_scan_state->stop_data_offset                = 0;
+	internal_scan_state->number_of_matches               = 0;
+	internal_scan_state->number_of_scan_tree_walks       = 0;
+	internal_scan_state->number_of_scan_tree_node_visits = 0;
+	internal_scan_state->number_of_skipped_reads         = 0;
+
+	internal_scan_state->block_overlap_buffer_data_offset = 0;
+	internal_scan_state->block_overlap_buffer_data_size   = 0;
+
+	return( 1 );
+
+on_error:
+	if( internal_scan_state->buffer != NULL )
+	{
+		memory_free(
+		 internal_scan_state->buffer );
+
+		internal_scan_state->buffer                = NULL;
+		internal_scan_state->allocated_buffer_size = 0;
+	}
+	if( internal_scan_state->block_overlap_buffer != NULL )
+	{
+		memory_free(
+		 internal_scan_state->block_overlap_buffer );
+
+		internal_scan_state->block_overlap_buffer                = NULL;
+		internal_scan_state->allocated_block_overlap_buffer_size = 0;
+	}
+	internal_scan_state->block_overlap_size  = 0;
+	internal_scan_state->overlap_buffer_size = 0;
+
+	return( -1 );
+}
+
+/* Stops the scan state
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_stop(
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_stop";
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( internal_scan_state->state != LIBSIGSCAN_SCAN_STATE_STARTED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan state - unsupported state.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->buffer_data_size > 0 )
+	{
+		if( libsigscan_internal_scan_state_scan_buffer(
+		     internal_scan_state,
+		     internal_scan_state->buffer,
+		     internal_scan_state->buffer_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_scan_state->data_offset     += internal_scan_state->buffer_data_size;
+		internal_scan_state->buffer_data_size = 0;
+	}
+	if( internal_scan_state->overlap_buffer_data_size > 0 )
+	{
+		if( libsigscan_internal_scan_state_flush_overlap_buffer(
+		     internal_scan_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to flush overlap buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The scan, overlap, block overlap and range buffers are retained to be reused by the next scan
+	 */
+	internal_scan_state->block_overlap_size  = 0;
+	internal_scan_state->buffer_size         = 0;
+	internal_scan_state->overlap_buffer_size = 0;
+
+	/* A part of a range that is retained when the scan is stopped cannot be matched
+	 */
+	internal_scan_state->header_range_buffer_data_size = 0;
+	internal_scan_state->footer_range_buffer_data_size = 0;
+
+	internal_scan_state->state               = LIBSIGSCAN_SCAN_STATE_STOPPED;
+	internal_scan_state->header_scan_tree    = NULL;
+	internal_scan_state->active_header_node  = NULL;
+	internal_scan_state->footer_scan_tree    = NULL;
+	internal_scan_state->active_footer_node  = NULL;
+	internal_scan_state->scan_tree           = NULL;
+	internal_scan_state->active_node         = NULL;
+
+	return( 1 );
+}
+
+/* Flushes the scan state
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_flush(
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_flush";
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( internal_scan_state->state != LIBSIGSCAN_SCAN_STATE_STARTED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan state - unsupported state.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->buffer_data_size > 0 )
+	{
+		if( libsigscan_internal_scan_state_scan_buffer(
+		     internal_scan_state,
+		     internal_scan_state->buffer,
+		     internal_scan_state->buffer_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_scan_state->data_offset     += internal_scan_state->buffer_data_size;
+		internal_scan_state->buffer_data_size = 0;
+	}
+	return( 1 );
+}
+
+/* Appends a scan result for a matching signature
+ * If a match callback function is set the match is passed to the callback function instead
+ * The data offset is the offset of the scan position and is used as the offset of unbound signatures
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_append_signature_scan_result(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_signature_t *signature,
+     int pattern_offsets_mode,
+     off64_t data_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scan_state_append_signature_scan_result";
+	off64_t result_offset = 0;
+	int result            = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+	{
+		result_offset = signature->pattern_offset;
+	}
+	else if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	{
+		result_offset = (off64_t) internal_scan_state->data_size - signature->pattern_offset;
+	}
+	else
+	{
+		result_offset = data_offset;
+	}
+	/* Matches found after the scan was stopped are ignored
+	 */
+	if( internal_scan_state->stop_scan != 0 )
+	{
+		return( 1 );
+	}
+	internal_scan_state->number_of_matches += 1;
+
+	if( ( ( internal_scan_state->maximum_number_of_results > 0 )
+	  &&  ( internal_scan_state->number_of_matches >= internal_scan_state->maximum_number_of_results ) )
+	 || ( ( ( internal_scan_state->flags & LIBSIGSCAN_SCAN_STATE_FLAG_STOP_ON_SIGNATURE_MATCH ) != 0 )
+	  &&  ( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAG_STOP_ON_MATCH ) != 0 ) ) )
+	{
+		internal_scan_state->stop_scan        = 1;
+		internal_scan_state->stop_data_offset = result_offset + (off64_t) signature->pattern_size;
+	}
+	if( internal_scan_state->match_callback != NULL )
+	{
+		result = internal_scan_state->match_callback(
+		          signature->identifier,
+		          signature->identifier_size,
+		          result_offset,
+		          internal_scan_state->match_callback_user_data );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: match callback failed.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      && ( internal_scan_state->stop_scan == 0 ) )
+		{
+			internal_scan_state->stop_scan        = 1;
+			internal_scan_state->stop_data_offset = result_offset + (off64_t) signature->pattern_size;
+		}
+		return( 1 );
+	}
+	if( libsigscan_scan_result_arena_append_scan_result(
+	     internal_scan_state->scan_result_arena,
+	     result_offset,
+	     signature,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append scan result.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Scans the buffer using a specific scan tree and updates the scan state
+ * Returns 1 if successful, 0 if data size has been reached or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
+     libsigscan_scan_tree_node_t **active_node,
+     off64_t data_offset,
+     size64_t data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libcerror_error_t **error )
+{
+	libsigscan_signature_t *signature = NULL;
+	static char *function             = "libsigscan_internal_scan_state_scan_buffer_by_scan_tree";
+	int number_of_visited_nodes       = 0;
+	int result                        = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( active_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid active scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset >= buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( (size64_t) data_offset >= data_size ) )
+	{
+		return( 0 );
+	}
+	/* Unbound signatures are scanned by libsigscan_internal_scan_state_scan_buffer_by_unbound_scan_tree
+	 */
+	if( scan_tree->pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported scan tree pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state->number_of_scan_tree_walks += 1;
+
+	result = libsigscan_scan_tree_arena_scan_buffer(
+	          scan_tree->arena,
+	          scan_tree->pattern_offsets_mode,
+	          data_offset,
+	          data_size,
+	          buffer,
+	          buffer_size,
+	          buffer_offset,
+	          &signature,
+	          &number_of_visited_nodes,
+	          error );
+
+	internal_scan_state->number_of_scan_tree_node_visits += number_of_visited_nodes;
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to scan buffer.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libsigscan_internal_scan_state_append_signature_scan_result(
+		     internal_scan_state,
+		     signature,
+		     scan_tree->pattern_offsets_mode,
+		     data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append scan result.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Scans the buffer using the unbound scan tree and updates the scan state
+ * The buffer data offset is the offset of the first byte in the buffer
+ * Every position from the unbound data offset up to the scan end offset is scanned,
+ * the data after the scan end offset is only used to match the patterns
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_buffer_by_unbound_scan_tree(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     off64_t buffer_data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t scan_end_offset,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_tree_t *scan_tree = NULL;
+	libsigscan_signature_t *signature = NULL;
+	static char *function             = "libsigscan_internal_scan_state_scan_buffer_by_unbound_scan_tree";
+	size_t buffer_offset              = 0;
+	size_t match_offset               = 0;
+	size_t skip_value                 = 0;
+	size_t smallest_pattern_size      = 0;
+	int number_of_visited_nodes       = 0;
+	int result                        = 0;
+	int skip_table_type               = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal scan state - missing scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	scan_tree = internal_scan_state->scan_tree;
+
+	if( buffer_data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_end_offset > buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->unbound_data_offset < buffer_data_offset )
+	{
+		internal_scan_state->unbound_data_offset = buffer_data_offset;
+	}
+	if( ( internal_scan_state->unbound_data_offset - buffer_data_offset ) >= (off64_t) scan_end_offset )
+	{
+		return( 1 );
+	}
+	buffer_offset = (size_t) ( internal_scan_state->unbound_data_offset - buffer_data_offset );
+
+	if( scan_tree->aho_corasick != NULL )
+	{
+		/* Only the data up to the data size can be part of a match
+		 */
+		if( (size64_t) ( buffer_data_offset + buffer_size ) > internal_scan_state->data_size )
+		{
+			buffer_size = (size_t) ( internal_scan_state->data_size - buffer_data_offset );
+		}
+		if( scan_end_offset > buffer_size )
+		{
+			scan_end_offset = buffer_size;
+		}
+		while( buffer_offset < scan_end_offset )
+		{
+			internal_scan_state->number_of_scan_tree_walks += 1;
+
+			result = libsigscan_aho_corasick_scan_buffer(
+			          scan_tree->aho_corasick,
+			          buffer,
+			          buffer_size,
+			          buffer_offset,
+			          scan_end_offset,
+			          &match_offset,
+			          &signature,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to scan buffer at offset: %" PRIzd " with Aho-Corasick automaton.",
+				 function,
+				 buffer_offset );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				buffer_offset = scan_end_offset;
+
+				break;
+			}
+			if( libsigscan_internal_scan_state_append_signature_scan_result(
+			     internal_scan_state,
+			     signature,
+			     LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+			     buffer_data_offset + match_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append scan result.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset = match_offset + signature->pattern_size;
+
+			if( internal_scan_state->stop_scan != 0 )
+			{
+				break;
+			}
+		}
+		internal_scan_state->unbound_data_offset = buffer_data_offset + buffer_offset;
+
+		return( 1 );
+	}
+	if( libsigscan_skip_table_get_smallest_pattern_size(
+	     scan_tree->skip_table,
+	     &smallest_pattern_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve smallest pattern size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_skip_table_get_table_type(
+	     scan_tree->skip_table,
+	     &skip_table_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve skip table type.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < scan_end_offset )
+	{
+		if( scan_tree->prefilter != NULL )
+		{
+			/* Skip the offsets where none of the patterns can start
+			 */
+			result = libsigscan_prefilter_scan_buffer(
+			          scan_tree->prefilter,
+			          buffer,
+			          buffer_size,
+			          buffer_offset,
+			          scan_end_offset,
+			          &buffer_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to scan buffer at offset: %" PRIzd " with prefilter.",
+				 function,
+				 buffer_offset );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				buffer_offset = scan_end_offset;
+
+				break;
+			}
+		}
+		if( (size64_t) ( buffer_data_offset + buffer_offset ) >= internal_scan_state->data_size )
+		{
+			break;
+		}
+		if( ( skip_table_type == LIBSIGSCAN_SKIP_TABLE_TYPE_BLOCK )
+		 && ( ( buffer_offset + smallest_pattern_size ) <= buffer_size ) )
+		{
+			/* Determine the Wu-Manber skip value using the block that ends
+			 * the smallest pattern at the current position
+			 */
+			if( libsigscan_skip_table_get_block_skip_value(
+			     scan_tree->skip_table,
+			     buffer,
+			     buffer_size,
+			     buffer_offset,
+			     &skip_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve block skip value.",
+				 function );
+
+				return( -1 );
+			}
+			if( skip_value != 0 )
+			{
+				buffer_offset += skip_value;
+
+				continue;
+			}
+		}
+		internal_scan_state->number_of_scan_tree_walks += 1;
+
+		result = libsigscan_scan_tree_arena_scan_buffer(
+		          scan_tree->arena,
+		          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+		          buffer_data_offset + buffer_offset,
+		          internal_scan_state->data_size,
+		          buffer,
+		          buffer_size,
+		          buffer_offset,
+		          &signature,
+		          &number_of_visited_nodes,
+		          error );
+
+		internal_scan_state->number_of_scan_tree_node_visits += number_of_visited_nodes;
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan buffer at offset: %" PRIzd ".",
+			 function,
+			 buffer_offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libsigscan_internal_scan_state_append_signature_scan_result(
+			     internal_scan_state,
+			     signature,
+			     LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+			     buffer_data_offset + buffer_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append scan result.",
+				 function );
+
+				return( -1 );
+			}
+			skip_value = signature->pattern_size;
+
+			if( internal_scan_state->stop_scan != 0 )
+			{
+				buffer_offset += skip_value;
+
+				break;
+			}
+		}
+		else if( ( skip_table_type == LIBSIGSCAN_SKIP_TABLE_TYPE_BYTE_VALUE )
+		      && ( ( buffer_offset + smallest_pattern_size ) <= buffer_size ) )
+		{
+			/* Determine the Boyer–Moore–Horspool skip value using the last byte
+			 * that is part of the smallest pattern at the current position
+			 */
+			if( libsigscan_skip_table_get_skip_value(
+			     scan_tree->skip_table,
+			     buffer[ buffer_offset + smallest_pattern_size - 1 ],
+			     &skip_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve skip value.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			skip_value = 1;
+		}
+		buffer_offset += skip_value;
+	}
+	internal_scan_state->unbound_data_offset = buffer_data_offset + buffer_offset;
+
+	return( 1 );
+}
+
+/* Scans the buffer for unbound signatures and updates the scan state
+ * The data in the buffer at the buffer offset is at the scan state data offset
+ * Signatures that straddle the end of the buffer are matched using the overlap buffer
+ * once the next buffer is scanned
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_unbound_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libcerror_error_t **error )
+{
+	static char *function     = "libsigscan_internal_scan_state_scan_unbound_buffer";
+	off64_t buffer_data_offset = 0;
+	size_t copy_size           = 0;
+	size_t overlap_offset      = 0;
+	size_t overlap_size        = 0;
+	size_t read_size           = 0;
+	size_t scan_end_offset     = 0;
+	size_t window_size         = 0;
+	int is_last_buffer         = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset >= buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_size    = buffer_size - buffer_offset;
+	overlap_size = internal_scan_state->overlap_buffer_size / 2;
+
+	if( (size64_t) ( internal_scan_state->data_offset + read_size ) >= internal_scan_state->data_size )
+	{
+		is_last_buffer = 1;
+	}
+	/* If the buffer does not follow the overlap buffer the overlapping data is discarded
+	 */
+	if( ( internal_scan_state->overlap_buffer_data_size > 0 )
+	 && ( ( internal_scan_state->overlap_buffer_data_offset + (off64_t) internal_scan_state->overlap_buffer_data_size ) != internal_scan_state->data_offset ) )
+	{
+		internal_scan_state->overlap_buffer_data_size = 0;
+	}
+	if( internal_scan_state->overlap_buffer_data_size == 0 )
+	{
+		internal_scan_state->overlap_buffer_data_offset = internal_scan_state->data_offset;
+		internal_scan_state->unbound_data_offset        = internal_scan_state->data_offset;
+	}
+	if( ( internal_scan_state->overlap_buffer_data_size > 0 )
+	 || ( read_size <= overlap_size ) )
+	{
+		/* Scan the positions in the overlap buffer using the start of the buffer
+		 */
+		copy_size = read_size;
+
+		if( copy_size > overlap_size )
+		{
+			copy_size = overlap_size;
+		}
+		if( copy_size > 0 )
+		{
+			if( memory_copy(
+			     &( internal_scan_state->overlap_buffer[ internal_scan_state->overlap_buffer_data_size ] ),
+			     &( buffer[ buffer_offset ] ),
+			     copy_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy buffer to overlap buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		window_size = internal_scan_state->overlap_buffer_data_size + copy_size;
+
+		if( read_size > overlap_size )
+		{
+			/* The remaining positions are scanned in the buffer
+			 */
+			scan_end_offset = internal_scan_state->overlap_buffer_data_size;
+		}
+		else if( is_last_buffer != 0 )
+		{
+			scan_end_offset = window_size;
+		}
+		else if( window_size > overlap_size )
+		{
+			scan_end_offset = window_size - overlap_size;
+		}
+		else
+		{
+			scan_end_offset = 0;
+		}
+		if( scan_end_offset > 0 )
+		{
+			if( libsigscan_internal_scan_state_scan_buffer_by_unbound_scan_tree(
+			     internal_scan_state,
+			     internal_scan_state->overlap_buffer_data_offset,
+			     internal_scan_state->overlap_buffer,
+			     window_size,
+			     scan_end_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan overlap buffer by unbound scan tree.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( read_size <= overlap_size )
+		{
+			/* The buffer is fully contained in the overlap buffer
+			 * retain the positions that have not been scanned
+			 */
+			window_size -= scan_end_offset;
+
+			if( scan_end_offset > 0 )
+			{
+				/* The source and destination can overlap, hence the data is moved forward byte by byte
+				 */
+				for( overlap_offset = 0;
+				     overlap_offset < window_size;
+				     overlap_offset++ )
+				{
+					internal_scan_state->overlap_buffer[ overlap_offset ] = internal_scan_state->overlap_buffer[ scan_end_offset + overlap_offset ];
+				}
+			}
+			internal_scan_state->overlap_buffer_data_offset += scan_end_offset;
+			internal_scan_state->overlap_buffer_data_size    = window_size;
+
+			return( 1 );
+		}
+		internal_scan_state->overlap_buffer_data_size = 0;
+	}
+	/* Scan the positions in the buffer that have sufficient data to match the largest pattern
+	 */
+	buffer_data_offset = internal_scan_state->data_offset - (off64_t) buffer_offset;
+
+	if( is_last_buffer != 0 )
+	{
+		scan_end_offset = buffer_size;
+	}
+	else
+	{
+		scan_end_offset = buffer_size - overlap_size;
+	}
+	if( libsigscan_internal_scan_state_scan_buffer_by_unbound_scan_tree(
+	     internal_scan_state,
+	     buffer_data_offset,
+	     buffer,
+	     buffer_size,
+	     scan_end_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan buffer by unbound scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( is_last_buffer == 0 )
+	 && ( overlap_size > 0 ) )
+	{
+		if( memory_copy(
+		     internal_scan_state->overlap_buffer,
+		     &( buffer[ scan_end_offset ] ),
+		     overlap_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer to overlap buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_scan_state->overlap_buffer_data_offset = buffer_data_offset + (off64_t) scan_end_offset;
+		internal_scan_state->overlap_buffer_data_size   = overlap_size;
+	}
+	return( 1 );
+}
+
+/* Flushes the overlap buffer
+ * Scans the remaining positions in the overlap buffer when no more data is available
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_flush_overlap_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scan_state_flush_overlap_buffer";
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->overlap_buffer_data_size > 0 )
+	{
+		if( libsigscan_internal_scan_state_scan_buffer_by_unbound_scan_tree(
+		     internal_scan_state,
+		     internal_scan_state->overlap_buffer_data_offset,
+		     internal_scan_state->overlap_buffer,
+		     internal_scan_state->overlap_buffer_data_size,
+		     internal_scan_state->overlap_buffer_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan overlap buffer by unbound scan tree.",
+			 function );
+
+			return( -1 );
+		}
+		internal_scan_state->overlap_buffer_data_size = 0;
+	}
+	return( 1 );
+}
+
+/* Scans a block using the header scan tree and updates the scan state
+ * The data in the buffer at the buffer offset is at the block offset
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_block(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     off64_t block_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libcerror_error_t **error )
+{
+	libsigscan_signature_t *signature = NULL;
+	static char *function             = "libsigscan_internal_scan_state_scan_block";
+	int number_of_visited_nodes       = 0;
+	int result                        = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_scan_state->header_scan_tree == NULL )
+	 || ( internal_scan_state->header_scan_tree->arena == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal scan state - missing header scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_offset < 0 )
+	 || ( (size64_t) block_offset >= internal_scan_state->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state->number_of_scan_tree_walks += 1;
+
+	/* The header scan tree is matched as if the data starts at the block offset
+	 */
+	result = libsigscan_scan_tree_arena_scan_buffer(
+	          internal_scan_state->header_scan_tree->arena,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+	          0,
+	          internal_scan_state->data_size - (size64_t) block_offset,
+	          buffer,
+	          buffer_size,
+	          buffer_offset,
+	          &signature,
+	          &number_of_visited_nodes,
+	          error );
+
+	internal_scan_state->number_of_scan_tree_node_visits += number_of_visited_nodes;
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to scan block at offset: %" PRIi64 ".",
+		 function,
+		 block_offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* The match is reported at the offset of the pattern in the data
+		 */
+		if( libsigscan_internal_scan_state_append_signature_scan_result(
+		     internal_scan_state,
+		     signature,
+		     LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+		     block_offset + signature->pattern_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append scan result.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Scans the block boundaries in the buffer using the header scan tree and updates the scan state
+ * The data in the buffer at the buffer offset is at the scan state data offset
+ * A block that continues beyond the end of the buffer is scanned with the next buffer,
+ * the data needed to scan it is retained in the block overlap buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_blocks(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libcerror_error_t **error )
+{
+	static char *function  = "libsigscan_internal_scan_state_scan_blocks";
+	uint64_t block_end     = 0;
+	uint64_t block_number  = 0;
+	uint64_t block_offset  = 0;
+	uint64_t data_end      = 0;
+	uint64_t data_start    = 0;
+	uint64_t overlap_start = 0;
+	uint64_t scan_start    = 0;
+	size_t copy_size       = 0;
+	size_t data_size       = 0;
+	size_t overlap_index   = 0;
+	size_t overlap_size    = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal scan state - missing block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan state - data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset >= buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_size  = buffer_size - buffer_offset;
+	data_start = (uint64_t) internal_scan_state->data_offset;
+	data_end   = data_start + data_size;
+
+	if( data_end > internal_scan_state->data_size )
+	{
+		data_end = internal_scan_state->data_size;
+	}
+	overlap_size = internal_scan_state->block_overlap_size;
+
+	/* The retained data can only be used if the buffer continues where the previous buffer ended
+	 */
+	if( (uint64_t) ( internal_scan_state->block_overlap_buffer_data_offset + internal_scan_state->block_overlap_buffer_data_size ) != data_start )
+	{
+		internal_scan_state->block_overlap_buffer_data_offset = internal_scan_state->data_offset;
+		internal_scan_state->block_overlap_buffer_data_size   = 0;
+	}
+	overlap_start = (uint64_t) internal_scan_state->block_overlap_buffer_data_offset;
+
+	/* The data of the start of the buffer is appended to the retained data
+	 * so that the blocks that straddle the buffers are contiguous
+	 */
+	if( internal_scan_state->block_overlap_buffer_data_size > 0 )
+	{
+		copy_size = data_size;
+
+		if( copy_size > overlap_size )
+		{
+			copy_size = overlap_size;
+		}
+		if( memory_copy(
+		     &( internal_scan_state->block_overlap_buffer[ internal_scan_state->block_overlap_buffer_data_size ] ),
+		     &( buffer[ buffer_offset ] ),
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer to block overlap buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Determine the first block that ends in or after the buffer
+	 */
+	scan_start = overlap_start;
+
+	if( scan_start < (uint64_t) internal_scan_state->block_offset )
+	{
+		scan_start = (uint64_t) internal_scan_state->block_offset;
+	}
+	block_number = ( scan_start - (uint64_t) internal_scan_state->block_offset + internal_scan_state->block_size - 1 ) / internal_scan_state->block_size;
+	block_offset = (uint64_t) internal_scan_state->block_offset + ( block_number * internal_scan_state->block_size );
+
+	while( ( internal_scan_state->stop_scan == 0 )
+	    && ( block_offset < data_end ) )
+	{
+		block_end = block_offset + internal_scan_state->header_range_end;
+
+		if( block_end > internal_scan_state->data_size )
+		{
+			block_end = internal_scan_state->data_size;
+		}
+		/* The block is scanned with the next buffer
+		 */
+		if( block_end > data_end )
+		{
+			break;
+		}
+		if( block_offset >= data_start )
+		{
+			if( libsigscan_internal_scan_state_scan_block(
+			     internal_scan_state,
+			     (off64_t) block_offset,
+			     buffer,
+			     buffer_offset + (size_t) ( block_end - data_start ),
+			     buffer_offset + (size_t) ( block_offset - data_start ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan block at offset: %" PRIu64 ".",
+				 function,
+				 block_offset );
+
+				return( -1 );
+			}
+		}
+		else if( block_end > data_start )
+		{
+			if( libsigscan_internal_scan_state_scan_block(
+			     internal_scan_state,
+			     (off64_t) block_offset,
+			     internal_scan_state->block_overlap_buffer,
+			     (size_t) ( block_end - overlap_start ),
+			     (size_t) ( block_offset - overlap_start ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan block at offset: %" PRIu64 ".",
+				 function,
+				 block_offset );
+
+				return( -1 );
+			}
+		}
+		block_offset += internal_scan_state->block_size;
+	}
+	/* Retain the end of the data for the blocks that straddle the next buffer
+	 */
+	if( overlap_size > 0 )
+	{
+		if( data_size >= overlap_size )
+		{
+			if( memory_copy(
+			     internal_scan_state->block_overlap_buffer,
+			     &( buffer[ buffer_size - overlap_size ] ),
+			     overlap_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy buffer to block overlap buffer.",
+				 function );
+
+				return( -1 );
+			}
+			internal_scan_state->block_overlap_buffer_data_offset = (off64_t) ( data_start + data_size - overlap_size );
+			internal_scan_state->block_overlap_buffer_data_size   = overlap_size;
+		}
+		else
+		{
+			if( internal_scan_state->block_overlap_buffer_data_size == 0 )
+			{
+				if( memory_copy(
+				     internal_scan_state->block_overlap_buffer,
+				     &( buffer[ buffer_offset ] ),
+				     data_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy buffer to block overlap buffer.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			/* The start of the buffer was already appended to the retained data
+			 */
+			internal_scan_state->block_overlap_buffer_data_size += data_size;
+
+			if( internal_scan_state->block_overlap_buffer_data_size > overlap_size )
+			{
+				copy_size = internal_scan_state->block_overlap_buffer_data_size - overlap_size;
+
+				/* The source and destination overlap hence the data is moved byte by byte
+				 */
+				for( overlap_index = 0;
+				     overlap_index < overlap_size;
+				     overlap_index++ )
+				{
+					internal_scan_state->block_overlap_buffer[ overlap_index ] = internal_scan_state->block_overlap_buffer[ copy_size + overlap_index ];
+				}
+				internal_scan_state->block_overlap_buffer_data_offset += (off64_t) copy_size;
+				internal_scan_state->block_overlap_buffer_data_size    = overlap_size;
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Scans the buffer and updates the scan state
+ * The data in the buffer at the buffer offset is at the scan state data offset
+ * A header or footer range that straddles buffers is retained in the range buffer
+ * and scanned once the range is complete
+ * Returns 1 if successful, 0 if data size has been reached or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scan_state_scan_buffer";
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan state - data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset >= buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_scan_state->data_size == 0 )
+	 || ( (size64_t) internal_scan_state->data_offset >= internal_scan_state->data_size ) )
+	{
+		return( 0 );
+	}
+	if( ( internal_scan_state->block_size > 0 )
+	 && ( internal_scan_state->header_range_size > 0 ) )
+	{
+		if( libsigscan_internal_scan_state_scan_blocks(
+		     internal_scan_state,
+		     buffer,
+		     buffer_size,
+		     buffer_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan blocks.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( internal_scan_state->header_range_size > 0 )
+	{
+		if( libsigscan_internal_scan_state_scan_range_in_place(
+		     internal_scan_state,
+		     internal_scan_state->header_scan_tree,
+		     &( internal_scan_state->active_header_node ),
+		     internal_scan_state->header_range_start,
+		     internal_scan_state->header_range_end,
+		     &( internal_scan_state->header_range_buffer ),
+		     &( internal_scan_state->allocated_header_range_buffer_size ),
+		     &( internal_scan_state->header_range_buffer_data_size ),
+		     &( buffer[ buffer_offset ] ),
+		     buffer_size - buffer_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan header range.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_scan_state->stop_scan == 0 )
+	 && ( internal_scan_state->footer_range_size > 0 ) )
+	{
+		if( libsigscan_internal_scan_state_scan_range_in_place(
+		     internal_scan_state,
+		     internal_scan_state->footer_scan_tree,
+		     &( internal_scan_state->active_footer_node ),
+		     internal_scan_state->footer_range_start,
+		     internal_scan_state->footer_range_end,
+		     &( internal_scan_state->footer_range_buffer ),
+		     &( internal_scan_state->allocated_footer_range_buffer_size ),
+		     &( internal_scan_state->footer_range_buffer_data_size ),
+		     &( buffer[ buffer_offset ] ),
+		     buffer_size - buffer_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan footer range.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_scan_state->stop_scan == 0 )
+	 && ( internal_scan_state->scan_tree != NULL )
+	 && ( internal_scan_state->scan_tree->arena != NULL ) )
+	{
+		if( libsigscan_internal_scan_state_scan_unbound_buffer(
+		     internal_scan_state,
+		     buffer,
+		     buffer_size,
+		     buffer_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan buffer by unbound scan tree.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Scans the part of a bound range that is contained in a buffer
+ * The data in the buffer is at the scan state data offset
+ * If the buffer contains the entire range the range is scanned in the buffer, otherwise
+ * the part of the range is retained in the range buffer until the range is complete
+ * The part of the range beyond the end of the data is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_range_in_place(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
+     libsigscan_scan_tree_node_t **active_node,
+     uint64_t range_start,
+     uint64_t range_end,
+     uint8_t **range_buffer,
+     size_t *allocated_range_buffer_size,
+     size_t *range_buffer_data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scan_state_scan_range_in_place";
+	uint64_t copy_end     = 0;
+	uint64_t copy_start   = 0;
+	uint64_t data_end     = 0;
+	uint64_t data_start   = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan state - data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_range_buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated range buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_buffer_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range buffer data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The part of the range beyond the end of the data is never scanned
+	 */
+	if( range_end > internal_scan_state->data_size )
+	{
+		range_end = internal_scan_state->data_size;
+	}
+	data_start = (uint64_t) internal_scan_state->data_offset;
+	data_end   = data_start + buffer_size;
+
+	if( ( range_start >= range_end )
+	 || ( data_start >= range_end )
+	 || ( data_end <= range_start ) )
+	{
+		return( 1 );
+	}
+	if( ( range_end - range_start ) > (uint64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *range_buffer_data_size == 0 )
+	 && ( data_start <= range_start )
+	 && ( data_end >= range_end ) )
+	{
+		/* The buffer contains the entire range
+		 */
+		if( libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
+		     internal_scan_state,
+		     scan_tree,
+		     active_node,
+		     (off64_t) range_start,
+		     internal_scan_state->data_size,
+		     buffer,
+		     (size_t) ( range_end - data_start ),
+		     (size_t) ( range_start - data_start ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan buffer by scan tree.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* The range straddles buffers and only the part of the range in this buffer is retained
+	 * the range buffer of a previous scan is reused if it is large enough
+	 */
+	if( ( *range_buffer != NULL )
+	 && ( *allocated_range_buffer_size < (size_t) ( range_end - range_start ) ) )
+	{
+		memory_free(
+		 *range_buffer );
+
+		*range_buffer                = NULL;
+		*allocated_range_buffer_size = 0;
+	}
+	if( *range_buffer == NULL )
+	{
+		*range_buffer = (uint8_t *) memory_allocate(
+		                             sizeof( uint8_t ) * (size_t) ( range_end - range_start ) );
+
+		if( *range_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create range buffer.",
+			 function );
+
+			return( -1 );
+		}
+		*allocated_range_buffer_size = (size_t) ( range_end - range_start );
+	}
+	copy_start = data_start;
+
+	if( copy_start < range_start )
+	{
+		copy_start = range_start;
+	}
+	copy_end = data_end;
+
+	if( copy_end > range_end )
+	{
+		copy_end = range_end;
+	}
+	if( memory_copy(
+	     &( ( *range_buffer )[ copy_start - range_start ] ),
+	     &( buffer[ copy_start - data_start ] ),
+	     (size_t) ( copy_end - copy_start ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer to range buffer.",
+		 function );
+
+		return( -1 );
+	}
+	*range_buffer_data_size = (size_t) ( copy_end - range_start );
+
+	if( copy_end == range_end )
+	{
+		if( libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
+		     internal_scan_state,
+		     scan_tree,
+		     active_node,
+		     (off64_t) range_start,
+		     internal_scan_state->data_size,
+		     *range_buffer,
+		     *range_buffer_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan range buffer by scan tree.",
+			 function );
+
+			return( -1 );
+		}
+		*range_buffer_data_size = 0;
+	}
+	return( 1 );
+}
+
+/* Scans the buffer and updates the scan state
+ * Returns 1 if successful, 0 if data size has been reached or the scan was stopped or -1 on error
+ */
+int libsigscan_scan_state_scan_buffer(
+     libsigscan_scan_state_t *scan_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_scan_buffer";
+	size_t buffer_offset                                  = 0;
+	size_t read_size                                      = 0;
+	size_t scan_size                                      = 0;
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( internal_scan_state->state != LIBSIGSCAN_SCAN_STATE_STARTED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan state - unsupported state.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_scan_state->stop_scan != 0 )
+	 || ( internal_scan_state->data_size == 0 )
+	 || ( (size64_t) internal_scan_state->data_offset >= internal_scan_state->data_size ) )
+	{
+		return( 0 );
+	}
+	if( ( (size64_t) buffer_size > internal_scan_state->data_size )
+	 || ( (size64_t) internal_scan_state->data_offset > ( internal_scan_state->data_size - buffer_size ) ) )
+	{
+		buffer_size = (size_t) ( internal_scan_state->data_size - internal_scan_state->data_offset );
+	}
+	if( ( internal_scan_state->flags & LIBSIGSCAN_SCAN_STATE_FLAG_SCAN_IN_PLACE ) != 0 )
+	{
+		if( buffer_size > 0 )
+		{
+			if( libsigscan_internal_scan_state_scan_buffer(
+			     internal_scan_state,
+			     buffer,
+			     buffer_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to scan buffer in place.",
+				 function );
+
+				return( -1 );
+			}
+			internal_scan_state->data_offset += buffer_size;
+		}
+		if( internal_scan_state->stop_scan != 0 )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	scan_size = buffer_size;
+
+	if( ( internal_scan_state->buffer_data_size > 0 )
+	 && ( internal_scan_state->buffer_data_size < internal_scan_state->buffer_size ) )
+	{
+		read_size = internal_scan_state->buffer_size - internal_scan_state->buffer_data_size;
+
+		if( read_size > scan_size )
+		{
+			read_size = scan_size;
+		}
+		if( memory_copy(
+		     &( internal_scan_state->buffer[ internal_scan_state->buffer_data_size ] ),
+		     buffer,
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer to scan buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_scan_state->buffer_data_size += read_size;
+		buffer_offset                         += read_size;
+		scan_size                             -= read_size;
+	}
+	if( internal_scan_state->buffer_data_size == internal_scan_state->buffer_size )
+	{
+		if( libsigscan_internal_scan_state_scan_buffer(
+		     internal_scan_state,
+		     internal_scan_state->buffer,
+		     internal_scan_state->buffer_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_scan_state->data_offset     += internal_scan_state->buffer_data_size;
+		internal_scan_state->buffer_data_size = 0;
+	}
+	if( scan_size >= internal_scan_state->buffer_size )
+	{
+		read_size  = ( scan_size / internal_scan_state->buffer_size );
+		read_size *= internal_scan_state->buffer_size;
+
+		if( libsigscan_internal_scan_state_scan_buffer(
+		     internal_scan_state,
+		     buffer,
+		     buffer_offset + read_size,
+		     buffer_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_scan_state->data_offset += read_size;
+		buffer_offset                    += read_size;
+		scan_size                        -= read_size;
+	}
+	if( scan_size > 0 )
+	{
+		if( memory_copy(
+		     internal_scan_state->buffer,
+		     &( buffer[ buffer_offset ] ),
+		     scan_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer to scan buffer.",
+			 function );
 
+			return( -1 );
+		}
+		internal_scan_state->buffer_data_size = scan_size;
+	}
+	if( internal_scan_state->stop_scan != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
 }
 
-/* Scans the buffer and updates the scan state
- * Returns 1 if successful, 0 if data size has been reached or -1 on error
+/* Retrieves the number of scan tree walks
+ * A scan tree walk is the match of the scan tree or Aho-Corasick automaton at a scan position
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_get_number_of_scan_tree_walks(
+     libsigscan_scan_state_t *scan_state,
+     uint64_t *number_of_scan_tree_walks,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_get_number_of_scan_tree_walks";
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( number_of_scan_tree_walks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of scan tree walks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_scan_tree_walks = internal_scan_state->number_of_scan_tree_walks;
+
+	return( 1 );
+}
+
+/* Retrieves the number of scan tree node visits
+ * A scan tree node visit is the comparison of a byte value by a scan tree node during a scan tree walk
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_get_number_of_scan_tree_node_visits(
+     libsigscan_scan_state_t *scan_state,
+     uint64_t *number_of_scan_tree_node_visits,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_get_number_of_scan_tree_node_visits";
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( number_of_scan_tree_node_visits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of scan tree node visits.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_scan_tree_node_visits = internal_scan_state->number_of_scan_tree_node_visits;
+
+	return( 1 );
+}
+
+/* Retrieves the number of skipped bytes
+ * The skipped bytes are the bytes after the end of the match at which the scan stopped
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_get_number_of_skipped_bytes(
+     libsigscan_scan_state_t *scan_state,
+     size64_t *number_of_skipped_bytes,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_get_number_of_skipped_bytes";
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( number_of_skipped_bytes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of skipped bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_scan_state->stop_scan != 0 )
+	 && ( (size64_t) internal_scan_state->stop_data_offset < internal_scan_state->data_size ) )
+	{
+		*number_of_skipped_bytes = internal_scan_state->data_size - (size64_t) internal_scan_state->stop_data_offset;
+	}
+	else
+	{
+		*number_of_skipped_bytes = 0;
+	}
+
+	return( 1 );
+}
+
+/* Retrieves the number of skipped reads
+ * The skipped reads are the reads that the scanner did not perform since the scan stopped
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_get_number_of_skipped_reads(
+     libsigscan_scan_state_t *scan_state,
+     uint64_t *number_of_skipped_reads,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_get_number_of_skipped_reads";
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( number_of_skipped_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of skipped reads.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_skipped_reads = internal_scan_state->number_of_skipped_reads;
+
+	return( 1 );
+}
+
+/* Adds skipped reads
+ * Returns 1 if successful or -1 on error
  */
-int libsigscan_scan_state_scan_buffer(
+int libsigscan_scan_state_add_skipped_reads(
      libsigscan_scan_state_t *scan_state,
-     const uint8_t *buffer,
-     size_t buffer_size,
+     uint64_t number_of_skipped_reads,
      libcerror_error_t **error )
 {
 	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
-	static char *function                                 = "libsigscan_scan_state_scan_buffer";
-	size_t buffer_offset                                  = 0;
-	size_t read_size                                      = 0;
-	size_t scan_size                                      = 0;
+	static char *function                                 = "libsigscan_scan_state_add_skipped_reads";
 
 	if( scan_state == NULL )
 	{
@@ -1260,154 +3676,113 @@ int libsigscan_scan_state_scan_buffer(
 	}
 	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
 
-	if( internal_scan_state->state != LIBSIGSCAN_SCAN_STATE_STARTED )
+	internal_scan_state->number_of_skipped_reads += number_of_skipped_reads;
+
+	return( 1 );
+}
+
+/* Retrieves the number of scan results
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_get_number_of_results(
+     libsigscan_scan_state_t *scan_state,
+     int *number_of_results,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_get_number_of_results";
+
+	if( scan_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid scan state - unsupported state.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer == NULL )
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( libsigscan_scan_result_arena_get_number_of_scan_results(
+	     internal_scan_state->scan_result_arena,
+	     number_of_results,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of scan results.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer_size > (size_t) SSIZE_MAX )
+	return( 1 );
+}
+
+/* Retrieves a specific scan result
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_get_result(
+     libsigscan_scan_state_t *scan_state,
+     int result_index,
+     libsigscan_scan_result_t **scan_result,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_get_result";
+
+	if( scan_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid buffer size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_scan_state->data_size == 0 )
-	 || ( (size64_t) internal_scan_state->data_offset >= internal_scan_state->data_size ) )
-	{
-		return( 0 );
-	}
-	if( ( (size64_t) buffer_size > internal_scan_state->data_size )
-	 || ( (size64_t) internal_scan_state->data_offset > ( internal_scan_state->data_size - buffer_size ) ) )
-	{
-		buffer_size = (size_t) ( internal_scan_state->data_size - internal_scan_state->data_offset );
-	}
-	scan_size = buffer_size;
-
-	if( ( internal_scan_state->buffer_data_size > 0 )
-	 && ( internal_scan_state->buffer_data_size < internal_scan_state->buffer_size ) )
-	{
-		read_size = internal_scan_state->buffer_size - internal_scan_state->buffer_data_size;
-
-		if( read_size > scan_size )
-		{
-			read_size = scan_size;
-		}
-		if( memory_copy(
-		     &( internal_scan_state->buffer[ internal_scan_state->buffer_data_size ] ),
-		     buffer,
-		     read_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy buffer to scan buffer.",
-			 function );
-
-			return( -1 );
-		}
-		internal_scan_state->buffer_data_size += read_size;
-		buffer_offset                         += read_size;
-	}
-	if( internal_scan_state->buffer_data_size == internal_scan_state->buffer_size )
-	{
-		if( libsigscan_internal_scan_state_scan_buffer(
-		     internal_scan_state,
-		     internal_scan_state->buffer,
-		     internal_scan_state->buffer_data_size,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to scan buffer.",
-			 function );
-
-			return( -1 );
-		}
-		internal_scan_state->data_offset     += internal_scan_state->buffer_data_size;
-		internal_scan_state->buffer_data_size = 0;
-	}
-	if( scan_size >= internal_scan_state->buffer_size )
-	{
-		read_size  = ( scan_size / internal_scan_state->buffer_size );
-		read_size *= internal_scan_state->buffer_size;
-
-		if( libsigscan_internal_scan_state_scan_buffer(
-		     internal_scan_state,
-		     buffer,
-		     buffer_offset + read_size,
-		     buffer_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to scan buffer.",
-			 function );
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
 
-			return( -1 );
-		}
-		internal_scan_state->data_offset += read_size;
-		buffer_offset                    += read_size;
-		scan_size                        -= read_size;
-	}
-	if( scan_size > 0 )
+	if( libsigscan_scan_result_arena_get_scan_result_by_index(
+	     internal_scan_state->scan_result_arena,
+	     result_index,
+	     (libsigscan_internal_scan_result_t **) scan_result,
+	     error ) != 1 )
 	{
-		if( memory_copy(
-		     internal_scan_state->buffer,
-		     &( buffer[ buffer_offset ] ),
-		     scan_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy buffer to scan buffer.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan result: %d.",
+		 function,
+		 result_index );
 
-			return( -1 );
-		}
-		internal_scan_state->buffer_data_size = scan_size;
+		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves the number of scan results
+/* Retrieves the signature indexes and offsets of multiple scan results
+ * Up to maximum number of results are copied starting with the first result index,
+ * the signature indexes can be mapped to identifiers using the scanner
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scan_state_get_number_of_results(
+int libsigscan_scan_state_get_results(
      libsigscan_scan_state_t *scan_state,
+     int first_result_index,
+     int *signature_indexes,
+     off64_t *offsets,
+     int maximum_number_of_results,
      int *number_of_results,
      libcerror_error_t **error )
 {
 	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
-	static char *function                                 = "libsigscan_scan_state_get_number_of_results";
+	static char *function                                 = "libsigscan_scan_state_get_results";
+	int number_of_scan_results                            = 0;
 
 	if( scan_state == NULL )
 	{
@@ -1422,9 +3797,31 @@ int libsigscan_scan_state_get_number_of_results(
 	}
 	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_scan_state->scan_results_array,
-	     number_of_results,
+	if( maximum_number_of_results < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of results value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of results.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_result_arena_get_number_of_scan_results(
+	     internal_scan_state->scan_result_arena,
+	     &number_of_scan_results,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1436,20 +3833,59 @@ int libsigscan_scan_state_get_number_of_results(
 
 		return( -1 );
 	}
+	if( ( first_result_index < 0 )
+	 || ( first_result_index > number_of_scan_results ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first result index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_scan_results -= first_result_index;
+
+	if( number_of_scan_results > maximum_number_of_results )
+	{
+		number_of_scan_results = maximum_number_of_results;
+	}
+	if( libsigscan_scan_result_arena_copy_scan_results(
+	     internal_scan_state->scan_result_arena,
+	     first_result_index,
+	     number_of_scan_results,
+	     signature_indexes,
+	     offsets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy scan results.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_results = number_of_scan_results;
+
 	return( 1 );
 }
 
-/* Retrieves a specific scan result
+/* Takes the scan results of a stopped scan state
+ * The scan result arena is replaced by an empty arena and the caller
+ * becomes responsible for freeing the scan result arena that is returned
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scan_state_get_result(
+int libsigscan_scan_state_take_results(
      libsigscan_scan_state_t *scan_state,
-     int result_index,
-     libsigscan_scan_result_t **scan_result,
+     libsigscan_scan_result_arena_t **scan_result_arena,
      libcerror_error_t **error )
 {
-	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
-	static char *function                                 = "libsigscan_scan_state_get_result";
+	libsigscan_internal_scan_state_t *internal_scan_state   = NULL;
+	libsigscan_scan_result_arena_t *empty_scan_result_arena = NULL;
+	static char *function                                   = "libsigscan_scan_state_take_results";
 
 	if( scan_state == NULL )
 	{
@@ -1464,22 +3900,56 @@ int libsigscan_scan_state_get_result(
 	}
 	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_scan_state->scan_results_array,
-	     result_index,
-	     (intptr_t **) scan_result,
+	if( internal_scan_state->state == LIBSIGSCAN_SCAN_STATE_STARTED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan state - unsupported state.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_result_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_result_arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan result arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_result_arena_initialize(
+	     &empty_scan_result_arena,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve scan result: %d.",
-		 function,
-		 result_index );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan result arena.",
+		 function );
 
 		return( -1 );
 	}
+	*scan_result_arena = internal_scan_state->scan_result_arena;
+
+	internal_scan_state->scan_result_arena = empty_scan_result_arena;
+
 	return( 1 );
 }
 
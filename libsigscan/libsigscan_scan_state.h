@@ -28,7 +28,11 @@
 #include "libsigscan_extern.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
+#include "libsigscan_scan_object.h"
+#include "libsigscan_scan_result_arena.h"
 #include "libsigscan_scan_tree.h"
+#include "libsigscan_scan_tree_generation.h"
+#include "libsigscan_signature.h"
 #include "libsigscan_types.h"
 
 #if defined( __cplusplus )
@@ -43,6 +47,10 @@ struct libsigscan_internal_scan_state
 	 */
 	int state;
 
+	/* The flags
+	 */
+	uint8_t flags;
+
 	/* The data offset
 	 */
 	off64_t data_offset;
@@ -71,6 +79,38 @@ struct libsigscan_internal_scan_state
 	 */
 	uint64_t header_range_size;
 
+	/* The block size, which is the distance between the block boundaries at which
+	 * the header scan tree is matched, a value of 0 represents the header scan tree
+	 * is only matched at the start of the data
+	 */
+	size64_t block_size;
+
+	/* The block offset, which is the offset of the first block boundary
+	 */
+	off64_t block_offset;
+
+	/* The block overlap buffer, which contains the data of the previous buffers
+	 * that is needed to match the header scan tree at block boundaries that straddle buffers
+	 */
+	uint8_t *block_overlap_buffer;
+
+	/* The block overlap size, which is the header range end - 1
+	 */
+	size_t block_overlap_size;
+
+	/* The allocated block overlap buffer size
+	 * the block overlap buffer is retained after the scan stops to be reused by the next scan
+	 */
+	size_t allocated_block_overlap_buffer_size;
+
+	/* The block overlap buffer data offset
+	 */
+	off64_t block_overlap_buffer_data_offset;
+
+	/* The block overlap buffer data size
+	 */
+	size_t block_overlap_buffer_data_size;
+
 	/* The footer (offset relative from start) scan tree
 	 */
 	libsigscan_scan_tree_t *footer_scan_tree;
@@ -95,10 +135,42 @@ struct libsigscan_internal_scan_state
 	 */
 	libsigscan_scan_tree_t *scan_tree;
 
+	/* The scan tree generation
+	 * a reference that keeps the scan trees and the signatures of the scan results
+	 * available until the scan state is reset or freed
+	 */
+	libsigscan_scan_tree_generation_t *generation;
+
 	/* The active (unbounded scan tree) node
 	 */
 	libsigscan_scan_tree_node_t *active_node;
 
+	/* The (unbounded scan tree) data offset of the next scan position
+	 */
+	off64_t unbound_data_offset;
+
+	/* The overlap buffer, which contains the data of the previous buffer
+	 * that is needed to match unbound signatures that straddle buffers
+	 */
+	uint8_t *overlap_buffer;
+
+	/* The overlap buffer size
+	 */
+	size_t overlap_buffer_size;
+
+	/* The allocated overlap buffer size
+	 * the overlap buffer is retained after the scan stops to be reused by the next scan
+	 */
+	size_t allocated_overlap_buffer_size;
+
+	/* The overlap buffer data offset
+	 */
+	off64_t overlap_buffer_data_offset;
+
+	/* The overlap buffer data size
+	 */
+	size_t overlap_buffer_data_size;
+
 	/* The (scan) buffer
 	 */
 	uint8_t *buffer;
@@ -107,13 +179,93 @@ struct libsigscan_internal_scan_state
 	 */
 	size_t buffer_size;
 
+	/* The allocated (scan) buffer size
+	 * the scan buffer is retained after the scan stops to be reused by the next scan
+	 */
+	size_t allocated_buffer_size;
+
 	/* The (scan) buffer data size
 	 */
 	size_t buffer_data_size;
 
-	/* The scan results array
+	/* The header range buffer, which contains the data of the header range
+	 * when it straddles buffers that are scanned in place
+	 */
+	uint8_t *header_range_buffer;
+
+	/* The allocated header range buffer size
+	 * the header range buffer is retained after the scan stops to be reused by the next scan
+	 */
+	size_t allocated_header_range_buffer_size;
+
+	/* The header range buffer data size
+	 */
+	size_t header_range_buffer_data_size;
+
+	/* The footer range buffer, which contains the data of the footer range
+	 * when it straddles buffers that are scanned in place
+	 */
+	uint8_t *footer_range_buffer;
+
+	/* The allocated footer range buffer size
+	 * the footer range buffer is retained after the scan stops to be reused by the next scan
+	 */
+	size_t allocated_footer_range_buffer_size;
+
+	/* The footer range buffer data size
 	 */
-	libcdata_array_t *scan_results_array;
+	size_t footer_range_buffer_data_size;
+
+	/* The scan result arena
+	 */
+	libsigscan_scan_result_arena_t *scan_result_arena;
+
+	/* The match callback function
+	 * when set the matches are passed to the callback function instead of stored as scan results
+	 */
+	int (*match_callback)(
+	       const char *identifier,
+	       size_t identifier_size,
+	       off64_t offset,
+	       intptr_t *user_data );
+
+	/* The match callback user data
+	 */
+	intptr_t *match_callback_user_data;
+
+	/* Value to indicate the scan should stop
+	 */
+	uint8_t stop_scan;
+
+	/* The data offset of the end of the match at which the scan stopped
+	 */
+	off64_t stop_data_offset;
+
+	/* The number of matches
+	 */
+	int number_of_matches;
+
+	/* The maximum number of matches after which the scan stops
+	 * a value of 0 represents no maximum
+	 */
+	int maximum_number_of_results;
+
+	/* The number of workers
+	 * a file with unbound signatures is scanned in parallel chunks if more than 1 worker is set
+	 */
+	int number_of_workers;
+
+	/* The number of scan tree walks
+	 */
+	uint64_t number_of_scan_tree_walks;
+
+	/* The number of scan tree nodes visited during the scan tree walks
+	 */
+	uint64_t number_of_scan_tree_node_visits;
+
+	/* The number of reads that were skipped since the scan stopped
+	 */
+	uint64_t number_of_skipped_reads;
 };
 
 LIBSIGSCAN_EXTERN \
@@ -126,6 +278,11 @@ int libsigscan_scan_state_free(
      libsigscan_scan_state_t **scan_state,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_reset(
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error );
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scan_state_set_data_offset(
      libsigscan_scan_state_t *scan_state,
@@ -138,6 +295,61 @@ int libsigscan_scan_state_set_data_size(
      size64_t data_size,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_get_flags(
+     libsigscan_scan_state_t *scan_state,
+     uint8_t *flags,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_set_flags(
+     libsigscan_scan_state_t *scan_state,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_set_match_callback(
+     libsigscan_scan_state_t *scan_state,
+     int (*match_callback)(
+            const char *identifier,
+            size_t identifier_size,
+            off64_t offset,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_set_maximum_number_of_results(
+     libsigscan_scan_state_t *scan_state,
+     int maximum_number_of_results,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_get_number_of_workers(
+     libsigscan_scan_state_t *scan_state,
+     int *number_of_workers,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_set_number_of_workers(
+     libsigscan_scan_state_t *scan_state,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_get_block_alignment(
+     libsigscan_scan_state_t *scan_state,
+     size64_t *block_size,
+     off64_t *block_offset,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_set_block_alignment(
+     libsigscan_scan_state_t *scan_state,
+     size64_t block_size,
+     off64_t block_offset,
+     libcerror_error_t **error );
+
 int libsigscan_scan_state_get_buffer_size(
      libsigscan_scan_state_t *scan_state,
      size_t *buffer_size,
@@ -157,6 +369,11 @@ int libsigscan_scan_state_get_footer_range(
      uint64_t *footer_range_size,
      libcerror_error_t **error );
 
+int libsigscan_scan_state_set_generation(
+     libsigscan_scan_state_t *scan_state,
+     libsigscan_scan_tree_generation_t *generation,
+     libcerror_error_t **error );
+
 int libsigscan_scan_state_start(
      libsigscan_scan_state_t *scan_state,
      libsigscan_scan_tree_t *header_scan_tree,
@@ -184,6 +401,47 @@ int libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
      size_t buffer_offset,
      libcerror_error_t **error );
 
+int libsigscan_internal_scan_state_append_signature_scan_result(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_signature_t *signature,
+     int pattern_offsets_mode,
+     off64_t data_offset,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_scan_buffer_by_unbound_scan_tree(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     off64_t buffer_data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t scan_end_offset,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_scan_unbound_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_flush_overlap_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_scan_block(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     off64_t block_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_scan_blocks(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libcerror_error_t **error );
+
 int libsigscan_internal_scan_state_scan_buffer(
      libsigscan_internal_scan_state_t *internal_scan_state,
      const uint8_t *buffer,
@@ -191,12 +449,54 @@ int libsigscan_internal_scan_state_scan_buffer(
      size_t buffer_offset,
      libcerror_error_t **error );
 
+int libsigscan_internal_scan_state_scan_range_in_place(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
+     libsigscan_scan_tree_node_t **active_node,
+     uint64_t range_start,
+     uint64_t range_end,
+     uint8_t **range_buffer,
+     size_t *allocated_range_buffer_size,
+     size_t *range_buffer_data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
 int libsigscan_scan_state_scan_buffer(
      libsigscan_scan_state_t *scan_state,
      const uint8_t *buffer,
      size_t buffer_size,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_get_number_of_scan_tree_walks(
+     libsigscan_scan_state_t *scan_state,
+     uint64_t *number_of_scan_tree_walks,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_get_number_of_scan_tree_node_visits(
+     libsigscan_scan_state_t *scan_state,
+     uint64_t *number_of_scan_tree_node_visits,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_get_number_of_skipped_bytes(
+     libsigscan_scan_state_t *scan_state,
+     size64_t *number_of_skipped_bytes,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_get_number_of_skipped_reads(
+     libsigscan_scan_state_t *scan_state,
+     uint64_t *number_of_skipped_reads,
+     libcerror_error_t **error );
+
+int libsigscan_scan_state_add_skipped_reads(
+     libsigscan_scan_state_t *scan_state,
+     uint64_t number_of_skipped_reads,
+     libcerror_error_t **error );
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scan_state_get_number_of_results(
      libsigscan_scan_state_t *scan_state,
@@ -210,6 +510,21 @@ int libsigscan_scan_state_get_result(
      libsigscan_scan_result_t **scan_result,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_get_results(
+     libsigscan_scan_state_t *scan_state,
+     int first_result_index,
+     int *signature_indexes,
+     off64_t *offsets,
+     int maximum_number_of_results,
+     int *number_of_results,
+     libcerror_error_t **error );
+
+int libsigscan_scan_state_take_results(
+     libsigscan_scan_state_t *scan_state,
+     libsigscan_scan_result_arena_t **scan_result_arena,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -23,21 +23,26 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libsigscan_aho_corasick.h"
+#include "libsigscan_byte_value_profile.h"
 #include "libsigscan_byte_value_group.h"
 #include "libsigscan_definitions.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_libcnotify.h"
+#include "libsigscan_libcthreads.h"
 #include "libsigscan_offset_group.h"
 #include "libsigscan_offsets_list.h"
 #include "libsigscan_pattern_weights.h"
+#include "libsigscan_prefilter.h"
 #include "libsigscan_scan_object.h"
 #include "libsigscan_scan_tree.h"
+#include "libsigscan_scan_tree_arena.h"
+#include "libsigscan_scan_tree_build_task.h"
 #include "libsigscan_scan_tree_node.h"
 #include "libsigscan_signature.h"
 #include "libsigscan_signature_group.h"
 #include "libsigscan_signature_table.h"
-#include "libsigscan_signatures_list.h"
 #include "libsigscan_skip_table.h"
 
 uint8_t libsigscan_common_byte_values[ 256 ] = {
@@ -131,6 +136,8 @@ int libsigscan_scan_tree_initialize(
 
 		return( -1 );
 	}
+	( *scan_tree )->number_of_build_workers = 1;
+
 	if( libcdata_range_list_initialize(
 	     &( ( *scan_tree )->pattern_range_list ),
 	     error ) != 1 )
@@ -180,7 +187,27 @@ int libsigscan_scan_tree_free(
 	}
 	if( *scan_tree != NULL )
 	{
-		if( ( *scan_tree )->root_node != NULL )
+		if( ( *scan_tree )->exclusive_nodes_list != NULL )
+		{
+			/* The other scan tree nodes are freed by another generation of the scan tree
+			 */
+			if( libcdata_list_free(
+			     &( ( *scan_tree )->exclusive_nodes_list ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_scan_tree_node_free_single,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free exclusive scan tree nodes list.",
+				 function );
+
+				result = -1;
+			}
+			( *scan_tree )->root_node = NULL;
+		}
+		else if( ( *scan_tree )->root_node != NULL )
 		{
 			if( libsigscan_scan_tree_node_free(
 			     &( ( *scan_tree )->root_node ),
@@ -196,6 +223,22 @@ int libsigscan_scan_tree_free(
 				result = -1;
 			}
 		}
+		if( ( *scan_tree )->arena != NULL )
+		{
+			if( libsigscan_scan_tree_arena_free(
+			     &( ( *scan_tree )->arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free scan tree arena.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *scan_tree )->skip_table != NULL )
 		{
 			if( libsigscan_skip_table_free(
@@ -212,6 +255,54 @@ int libsigscan_scan_tree_free(
 				result = -1;
 			}
 		}
+		if( ( *scan_tree )->aho_corasick != NULL )
+		{
+			if( libsigscan_aho_corasick_free(
+			     &( ( *scan_tree )->aho_corasick ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free Aho-Corasick automaton.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_tree )->prefilter != NULL )
+		{
+			if( libsigscan_prefilter_free(
+			     &( ( *scan_tree )->prefilter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free prefilter.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_tree )->byte_value_profile != NULL )
+		{
+			if( libsigscan_byte_value_profile_free(
+			     &( ( *scan_tree )->byte_value_profile ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free byte value profile.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcdata_range_list_free(
 		     &( ( *scan_tree )->pattern_range_list ),
 		     NULL,
@@ -974,6 +1065,7 @@ int libsigscan_scan_tree_get_most_significant_pattern_offset(
 {
 	libsigscan_byte_value_group_t *byte_value_group = NULL;
 	static char *function                           = "libsigscan_scan_tree_get_most_significant_pattern_offset";
+	int number_of_byte_value_groups                 = 0;
 	int number_of_signatures                        = 0;
 	int result                                      = 0;
 
@@ -1011,76 +1103,123 @@ int libsigscan_scan_tree_get_most_significant_pattern_offset(
 		 number_of_signatures );
 	}
 #endif
-	switch( number_of_signatures )
+	/* With a byte value profile the pattern offset least likely to match
+	 * the scanned data is preferred, to reduce the number of node visits
+	 */
+	if( scan_tree->byte_value_profile != NULL )
 	{
-		case 0:
-			return( 0 );
+		result = libsigscan_scan_tree_get_pattern_offset_by_byte_value_weights(
+		          scan_tree,
+		          byte_value_weights,
+		          pattern_offset,
+		          error );
 
-		case 1:
-			result = libsigscan_scan_tree_get_pattern_offset_by_byte_value_weights(
-			          scan_tree,
-			          byte_value_weights,
-			          pattern_offset,
-			          error );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve most significant pattern offset based on byte value weights.",
+			 function );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve most significant pattern offset based on byte value weights.",
-				 function );
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		switch( number_of_signatures )
+		{
+			case 0:
+				return( 0 );
 
-				return( -1 );
-			}
-			break;
+			case 1:
+				result = libsigscan_scan_tree_get_pattern_offset_by_byte_value_weights(
+				          scan_tree,
+				          byte_value_weights,
+				          pattern_offset,
+				          error );
 
-		case 2:
-			result = libsigscan_scan_tree_get_pattern_offset_by_occurrence_weights(
-			          scan_tree,
-			          occurrence_weights,
-			          byte_value_weights,
-			          pattern_offset,
-			          error );
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve most significant pattern offset based on byte value weights.",
+					 function );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve most significant pattern offset based on occurrence weights.",
-				 function );
+					return( -1 );
+				}
+				break;
 
-				return( -1 );
-			}
-			break;
+			case 2:
+				result = libsigscan_scan_tree_get_pattern_offset_by_occurrence_weights(
+				          scan_tree,
+				          occurrence_weights,
+				          byte_value_weights,
+				          pattern_offset,
+				          error );
 
-		default:
-			result = libsigscan_scan_tree_get_pattern_offset_by_similarity_weights(
-			          scan_tree,
-			          similarity_weights,
-			          occurrence_weights,
-			          byte_value_weights,
-			          pattern_offset,
-			          error );
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve most significant pattern offset based on occurrence weights.",
+					 function );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve most significant pattern offset based on similarity weights.",
-				 function );
+					return( -1 );
+				}
+				break;
 
-				return( -1 );
-			}
-			break;
+			default:
+				result = libsigscan_scan_tree_get_pattern_offset_by_similarity_weights(
+				          scan_tree,
+				          similarity_weights,
+				          occurrence_weights,
+				          byte_value_weights,
+				          pattern_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve most significant pattern offset based on similarity weights.",
+					 function );
+
+					return( -1 );
+				}
+				break;
+		}
 	}
 	if( result == 0 )
 	{
+		if( libsigscan_signature_table_get_number_of_byte_value_groups(
+		     signature_table,
+		     &number_of_byte_value_groups,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of byte value groups.",
+			 function );
+
+			return( -1 );
+		}
+		/* If all the pattern offsets are ignored the signatures
+		 * cannot be distinguished by a pattern offset
+		 */
+		if( number_of_byte_value_groups == 0 )
+		{
+			return( 0 );
+		}
 		if( libsigscan_signature_table_get_byte_value_group_by_index(
 		     signature_table,
 		     0,
@@ -1117,6 +1256,7 @@ int libsigscan_scan_tree_get_most_significant_pattern_offset(
 }
 
 /* Retrieves the range spanning the pattern offset and sizes in the scan tree
+ * For a scan tree bound to the end the range start is relative to the end of the data
  * Returns 1 if present, 0 if not present or -1 on error
  */
 int libsigscan_scan_tree_get_spanning_range(
@@ -1156,406 +1296,956 @@ int libsigscan_scan_tree_get_spanning_range(
 
 		return( -1 );
 	}
+	/* The pattern range list of a scan tree bound to the end contains
+	 * ranges that end at the pattern offset relative to the end of the data
+	 */
+	if( ( result != 0 )
+	 && ( scan_tree->pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END ) )
+	{
+		*range_start += *range_size;
+	}
 	return( result );
 }
 
-/* Builds a scan tree node
+/* Fills an array with the signatures of the signature table that are not
+ * covered by the pattern offset of a scan tree node
+ * A signature is covered if its pattern spans the pattern offset
+ * The signatures are appended in the order of the signature table
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scan_tree_build_node(
-     libsigscan_scan_tree_t *scan_tree,
+int libsigscan_scan_tree_fill_remaining_signatures(
      libsigscan_signature_table_t *signature_table,
-     libcdata_list_t *offsets_ignore_list,
+     libcdata_array_t *remaining_signatures_array,
+     int has_pattern_offset,
+     off64_t pattern_offset,
+     libsigscan_signature_t *ignore_signature,
      int pattern_offsets_mode,
      uint64_t pattern_offsets_range_size,
-     libsigscan_scan_tree_node_t **scan_tree_node,
      libcerror_error_t **error )
 {
-	libcdata_list_t *remaining_signatures_list        = NULL;
-	libcdata_list_t *sub_offsets_ignore_list          = NULL;
-	libsigscan_byte_value_group_t *byte_value_group   = NULL;
-	libsigscan_pattern_weights_t *byte_value_weights  = NULL;
-	libsigscan_pattern_weights_t *occurrence_weights  = NULL;
-	libsigscan_pattern_weights_t *similarity_weights  = NULL;
-	libsigscan_scan_object_t *scan_object             = NULL;
-	libsigscan_signature_t *signature                 = NULL;
-	libsigscan_signature_group_t *signature_group     = NULL;
-	libsigscan_signature_table_t *sub_signature_table = NULL;
-	intptr_t *scan_object_value                       = NULL;
-	static char *function                             = "libsigscan_scan_tree_build_node";
-	off64_t pattern_offset                            = 0;
-	uint8_t byte_value                                = 0;
-	uint8_t scan_object_type                          = 0;
-	int byte_value_group_index                        = 0;
-	int number_of_byte_value_groups                   = 0;
-	int number_of_remaining_signatures                = 0;
-	int number_of_signature_groups                    = 0;
-	int number_of_signatures                          = 0;
-	int result                                        = 0;
-	int signature_group_index                         = 0;
-	int signature_index                               = 0;
+	libsigscan_signature_t *signature = NULL;
+	static char *function             = "libsigscan_scan_tree_fill_remaining_signatures";
+	off64_t signature_offset          = 0;
+	int entry_index                   = 0;
+	int number_of_signatures          = 0;
+	int signature_index               = 0;
 
-	if( scan_tree == NULL )
+	if( libsigscan_signature_table_get_number_of_signatures(
+	     signature_table,
+	     &number_of_signatures,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid scan tree.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of signatures.",
 		 function );
 
 		return( -1 );
 	}
-	if( scan_tree_node == NULL )
+	for( signature_index = 0;
+	     signature_index < number_of_signatures;
+	     signature_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid scan tree node.",
-		 function );
+		if( libsigscan_signature_table_get_signature_by_index(
+		     signature_table,
+		     signature_index,
+		     &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature: %d.",
+			 function,
+			 signature_index );
 
-		return( -1 );
-	}
-	if( *scan_tree_node != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid scan tree node value already set.",
-		 function );
+			return( -1 );
+		}
+		if( signature == ignore_signature )
+		{
+			continue;
+		}
+		if( has_pattern_offset != 0 )
+		{
+			if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+			{
+				signature_offset = signature->pattern_offset;
+			}
+			else if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+			{
+				signature_offset = pattern_offsets_range_size - signature->pattern_offset;
+			}
+			else
+			{
+				signature_offset = 0;
+			}
+			if( ( pattern_offset >= signature_offset )
+			 && ( pattern_offset < ( signature_offset + (off64_t) signature->pattern_size ) ) )
+			{
+				continue;
+			}
+		}
+		if( libcdata_array_append_entry(
+		     remaining_signatures_array,
+		     &entry_index,
+		     (intptr_t *) signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append signature: %d to remaining signatures array.",
+			 function,
+			 signature_index );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-	if( libcdata_list_clone(
-	     &sub_offsets_ignore_list,
-	     offsets_ignore_list,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
-	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libsigscan_offset_clone,
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Pushes a build task of a sub node onto the thread pool
+ * The build task takes over the signature table
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_push_build_task(
+     libcthreads_thread_pool_t *thread_pool,
+     libcdata_array_t *build_tasks_array,
+     libsigscan_signature_table_t **signature_table,
+     libcdata_list_t *offsets_ignore_list,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     int number_of_fallback_nodes,
+     uint8_t byte_value,
+     uint8_t is_default_value,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_tree_build_task_t *build_task = NULL;
+	static char *function                         = "libsigscan_scan_tree_push_build_task";
+	int entry_index                               = 0;
+
+	if( libsigscan_scan_tree_build_task_initialize(
+	     &build_task,
+	     pattern_offsets_mode,
+	     pattern_offsets_range_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to clone offsets ignore list.",
+		 "%s: unable to create build task.",
 		 function );
 
 		goto on_error;
 	}
-	if( libsigscan_pattern_weights_initialize(
-	     &occurrence_weights,
+	if( libsigscan_scan_tree_build_task_set_signature_table(
+	     build_task,
+	     signature_table,
+	     offsets_ignore_list,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create occurrence weights.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set build task signature table.",
 		 function );
 
 		goto on_error;
 	}
-	if( libsigscan_pattern_weights_initialize(
-	     &similarity_weights,
+	build_task->number_of_fallback_nodes = number_of_fallback_nodes;
+	build_task->byte_value               = byte_value;
+	build_task->is_default_value         = is_default_value;
+
+	if( libcdata_array_append_entry(
+	     build_tasks_array,
+	     &entry_index,
+	     (intptr_t *) build_task,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create similarity weights.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append build task to array.",
 		 function );
 
 		goto on_error;
 	}
-	if( libsigscan_pattern_weights_initialize(
-	     &byte_value_weights,
+	/* The build tasks array takes over management of the build task
+	 */
+	if( libcthreads_thread_pool_push(
+	     thread_pool,
+	     (intptr_t *) build_task,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create byte value weights.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push build task onto thread pool.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libsigscan_scan_tree_fill_pattern_weights(
+	return( 1 );
+
+on_error:
+	if( build_task != NULL )
+	{
+		libsigscan_scan_tree_build_task_free(
+		 &build_task,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Callback function of the thread pool that builds a sub node
+ * A failure to build the sub node is stored in the build result of the task
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_build_task_callback(
+     libsigscan_scan_tree_build_task_t *build_task,
+     libsigscan_scan_tree_t *scan_tree )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libsigscan_scan_tree_build_task_callback";
+
+	if( build_task == NULL )
+	{
+		return( -1 );
+	}
+	if( libsigscan_scan_tree_build_node(
 	     scan_tree,
-	     signature_table,
-	     similarity_weights,
-	     occurrence_weights,
-	     byte_value_weights,
-	     error ) != 1)
+	     build_task->signature_table,
+	     build_task->offsets_ignore_list,
+	     build_task->pattern_offsets_mode,
+	     build_task->pattern_offsets_range_size,
+	     build_task->number_of_fallback_nodes,
+	     1,
+	     &( build_task->scan_tree_node ),
+	     &error ) != 1 )
 	{
 		libcerror_error_set(
-		 error,
+		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to fill pattern weights.",
+		 "%s: unable to build scan tree node.",
 		 function );
 
 		goto on_error;
 	}
-	result = libsigscan_scan_tree_get_most_significant_pattern_offset(
-	          scan_tree,
-	          signature_table,
-	          similarity_weights,
-	          occurrence_weights,
-	          byte_value_weights,
-	          &pattern_offset,
-	          error );
+	build_task->build_result = 1;
 
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve most significant pattern offset.",
-		 function );
+	return( 1 );
 
-		goto on_error;
-	}
+on_error:
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		if( result == 0 )
-		{
-			libcnotify_printf(
-			 "%s: most significant pattern offset: N/A\n",
-			 function );
-		}
-		else
-		{
-			libcnotify_printf(
-			 "%s: most significant pattern offset: %" PRIi64 "\n",
-			 function,
-			 pattern_offset );
-		}
+		libcnotify_print_error_backtrace(
+		 error );
 	}
 #endif
-	if( libsigscan_pattern_weights_free(
-	     &byte_value_weights,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free value weights.",
-		 function );
+	libcerror_error_free(
+	 &error );
 
-		goto on_error;
-	}
-	if( libsigscan_pattern_weights_free(
-	     &similarity_weights,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free similarity weights.",
-		 function );
+	build_task->build_result = -1;
 
-		goto on_error;
-	}
-	if( libsigscan_pattern_weights_free(
-	     &occurrence_weights,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free occurrence weights.",
-		 function );
+	return( -1 );
+}
 
-		goto on_error;
-	}
-	if( libsigscan_offsets_list_insert_offset(
-	     sub_offsets_ignore_list,
-	     pattern_offset,
+/* Sets the sub nodes built by the build tasks in the scan tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_set_build_task_results(
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     libcdata_array_t *build_tasks_array,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_object_t *scan_object         = NULL;
+	libsigscan_scan_tree_build_task_t *build_task = NULL;
+	static char *function                         = "libsigscan_scan_tree_set_build_task_results";
+	int build_task_index                          = 0;
+	int number_of_build_tasks                     = 0;
+
+	if( libcdata_array_get_number_of_entries(
+	     build_tasks_array,
+	     &number_of_build_tasks,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to insert pattern offset into offsets ignore list.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of build tasks.",
 		 function );
 
 		goto on_error;
 	}
-	if( result != 0 )
+	for( build_task_index = 0;
+	     build_task_index < number_of_build_tasks;
+	     build_task_index++ )
 	{
-		if( libsigscan_signature_table_get_byte_value_group_by_offset(
-		     signature_table,
-		     pattern_offset,
-		     &byte_value_group,
+		if( libcdata_array_get_entry_by_index(
+		     build_tasks_array,
+		     build_task_index,
+		     (intptr_t **) &build_task,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve byte value group for pattern offset: %" PRIi64 ".",
+			 "%s: unable to retrieve build task: %d.",
 			 function,
-			 pattern_offset );
+			 build_task_index );
 
 			goto on_error;
 		}
-		if( libsigscan_byte_value_group_get_number_of_signature_groups(
-		     byte_value_group,
-		     &number_of_signature_groups,
-		     error ) != 1 )
+		if( build_task == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve byte value group for pattern offset: %" PRIi64 ".",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing build task: %d.",
 			 function,
-			 pattern_offset );
+			 build_task_index );
 
 			goto on_error;
 		}
-	}
-	if( libsigscan_scan_tree_node_initialize(
-	     scan_tree_node,
-	     pattern_offset,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create scan tree node for pattern offset: %" PRIi64 ".",
-		 function,
-		 pattern_offset );
-
-		goto on_error;
-	}
-	/* Determine the signatures not covered by the scan node
-	 */
-	if( libsigscan_signature_table_get_signatures_list_clone(
-	     signature_table,
-	     &remaining_signatures_list,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to clone remaining signatures list.",
-		 function );
-
-		goto on_error;
-	}
-	for( signature_group_index = 0;
-	     signature_group_index < number_of_signature_groups;
-	     signature_group_index++ )
-	{
-		if( libsigscan_byte_value_group_get_signature_group_by_index(
-		     byte_value_group,
-		     signature_group_index,
-		     &signature_group,
-		     error ) != 1 )
+		if( ( build_task->build_result != 1 )
+		 || ( build_task->scan_tree_node == NULL ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - unable to retrieve signature group: %d.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to build scan tree node of build task: %d.",
 			 function,
-			 pattern_offset,
-			 signature_group_index );
+			 build_task_index );
 
 			goto on_error;
 		}
-		if( libsigscan_signature_group_get_number_of_signatures(
-		     signature_group,
-		     &number_of_signatures,
+		if( libsigscan_scan_object_initialize(
+		     &scan_object,
+		     LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE,
+		     (intptr_t *) build_task->scan_tree_node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve number of signatures.",
-			 function,
-			 pattern_offset,
-			 signature_group_index );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan object",
+			 function );
 
 			goto on_error;
 		}
-		for( signature_index = 0;
-		     signature_index < number_of_signatures;
-		     signature_index++ )
+		/* The scan object takes over management of the scan tree node
+		 */
+		build_task->scan_tree_node = NULL;
+
+		if( build_task->is_default_value != 0 )
 		{
-			if( libsigscan_signature_group_get_signature_by_index(
-			     signature_group,
-			     signature_index,
-			     &signature,
+			if( libsigscan_scan_tree_node_set_default_value(
+			     scan_tree_node,
+			     scan_object,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 	 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve signature: %d.",
-				 function,
-				 pattern_offset,
-				 signature_group_index,
-				 signature_index );
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set scan tree node default value.",
+				 function );
 
 				goto on_error;
 			}
-			if( libsigscan_signatures_list_remove_signature(
-			     remaining_signatures_list,
-			     signature,
+		}
+		else
+		{
+			if( libsigscan_scan_tree_node_set_byte_value(
+			     scan_tree_node,
+			     build_task->byte_value,
+			     scan_object,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-				 "%s: unable to remove signature: %s.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set scan tree node byte value: 0x%02" PRIx8 ".",
 				 function,
-				 signature->identifier );
+				 build_task->byte_value );
 
 				goto on_error;
 			}
 		}
+		/* The scan tree node takes over management of the scan object
+		 */
+		scan_object = NULL;
 	}
-	/* Determine the scan tree node byte values
-	 */
-	for( signature_group_index = 0;
-	     signature_group_index < number_of_signature_groups;
-	     signature_group_index++ )
+	return( 1 );
+
+on_error:
+	if( scan_object != NULL )
 	{
-		if( libsigscan_byte_value_group_get_signature_group_by_index(
-		     byte_value_group,
-		     signature_group_index,
-		     &signature_group,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - unable to retrieve signature group: %d.",
-			 function,
-			 pattern_offset,
-			 signature_group_index );
+		libsigscan_scan_object_free(
+		 &scan_object,
+		 NULL );
+	}
+	return( -1 );
+}
 
-			goto on_error;
-		}
-		if( libsigscan_signature_group_get_byte_value(
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Builds a scan tree node
+ * The number of fallback nodes is the number of byte value specific scan objects
+ * on the path to the scan tree node, of which the scan can retain the parent
+ * scan tree node to try its default scan object
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_build_node(
+     libsigscan_scan_tree_t *scan_tree,
+     libsigscan_signature_table_t *signature_table,
+     libcdata_list_t *offsets_ignore_list,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     int number_of_fallback_nodes,
+     int number_of_build_workers,
+     libsigscan_scan_tree_node_t **scan_tree_node,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *remaining_signatures_array      = NULL;
+	libsigscan_byte_value_group_t *byte_value_group   = NULL;
+	libsigscan_pattern_weights_t *byte_value_weights  = NULL;
+	libsigscan_pattern_weights_t *occurrence_weights  = NULL;
+	libsigscan_pattern_weights_t *similarity_weights  = NULL;
+	libsigscan_scan_object_t *scan_object             = NULL;
+	libsigscan_signature_t *largest_signature         = NULL;
+	libsigscan_signature_group_t *signature_group     = NULL;
+	libsigscan_signature_table_t *sub_signature_table = NULL;
+	intptr_t *scan_object_value                       = NULL;
+	static char *function                             = "libsigscan_scan_tree_build_node";
+	off64_t pattern_offset                            = 0;
+	uint8_t byte_value                                = 0;
+	uint8_t scan_object_type                          = 0;
+	int add_remaining_signatures                      = 0;
+	int number_of_remaining_signatures                = 0;
+	int number_of_signature_groups                    = 0;
+	int number_of_signatures                          = 0;
+	int number_of_sub_node_fallback_nodes             = 0;
+	int offset_ignored                                = 0;
+	int result                                        = 0;
+	int signature_group_index                         = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcdata_array_t *build_tasks_array               = NULL;
+	libcthreads_thread_pool_t *thread_pool            = NULL;
+#endif
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_tree_node != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan tree node value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_build_workers < 1 )
+	 || ( number_of_build_workers > LIBSIGSCAN_MAXIMUM_NUMBER_OF_BUILD_WORKERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of build workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_fallback_nodes < 0 )
+	 || ( number_of_fallback_nodes > LIBSIGSCAN_SCAN_TREE_NODE_MAXIMUM_NUMBER_OF_FALLBACK_NODES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of fallback nodes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_pattern_weights_initialize(
+	     &occurrence_weights,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create occurrence weights.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_pattern_weights_initialize(
+	     &similarity_weights,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create similarity weights.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_pattern_weights_initialize(
+	     &byte_value_weights,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create byte value weights.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_fill_pattern_weights(
+	     scan_tree,
+	     signature_table,
+	     similarity_weights,
+	     occurrence_weights,
+	     byte_value_weights,
+	     error ) != 1)
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill pattern weights.",
+		 function );
+
+		goto on_error;
+	}
+	result = libsigscan_scan_tree_get_most_significant_pattern_offset(
+	          scan_tree,
+	          signature_table,
+	          similarity_weights,
+	          occurrence_weights,
+	          byte_value_weights,
+	          &pattern_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve most significant pattern offset.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( result == 0 )
+		{
+			libcnotify_printf(
+			 "%s: most significant pattern offset: N/A\n",
+			 function );
+		}
+		else
+		{
+			libcnotify_printf(
+			 "%s: most significant pattern offset: %" PRIi64 "\n",
+			 function,
+			 pattern_offset );
+		}
+	}
+#endif
+	if( result == 0 )
+	{
+		/* If none of the pattern offsets can distinguish the signatures,
+		 * e.g. if a signature is a prefix of another signature, test
+		 * the last byte of the signature with the largest pattern and
+		 * use the other signatures as the default value
+		 */
+		if( libsigscan_signature_table_get_largest_signature(
+		     signature_table,
+		     &largest_signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve largest signature.",
+			 function );
+
+			goto on_error;
+		}
+		if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+		{
+			pattern_offset = largest_signature->pattern_offset;
+		}
+		else if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+		{
+			pattern_offset = pattern_offsets_range_size - largest_signature->pattern_offset;
+		}
+		else
+		{
+			pattern_offset = 0;
+		}
+		pattern_offset += largest_signature->pattern_size - 1;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: largest signature: %s pattern offset: %" PRIi64 "\n",
+			 function,
+			 largest_signature->identifier,
+			 pattern_offset );
+		}
+#endif
+	}
+	if( libsigscan_pattern_weights_free(
+	     &byte_value_weights,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free value weights.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_pattern_weights_free(
+	     &similarity_weights,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free similarity weights.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_pattern_weights_free(
+	     &occurrence_weights,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free occurrence weights.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 0 )
+	{
+		/* The pattern offset is ignored by the sub nodes and removed
+		 * from the offsets ignore list when this node is complete
+		 */
+		if( libsigscan_offsets_list_insert_offset(
+		     offsets_ignore_list,
+		     pattern_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert pattern offset into offsets ignore list.",
+			 function );
+
+			goto on_error;
+		}
+		offset_ignored = 1;
+
+		if( libsigscan_signature_table_get_byte_value_group_by_offset(
+		     signature_table,
+		     pattern_offset,
+		     &byte_value_group,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve byte value group for pattern offset: %" PRIi64 ".",
+			 function,
+			 pattern_offset );
+
+			goto on_error;
+		}
+		if( libsigscan_byte_value_group_get_number_of_signature_groups(
+		     byte_value_group,
+		     &number_of_signature_groups,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve byte value group for pattern offset: %" PRIi64 ".",
+			 function,
+			 pattern_offset );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_scan_tree_node_initialize(
+	     scan_tree_node,
+	     pattern_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan tree node for pattern offset: %" PRIi64 ".",
+		 function,
+		 pattern_offset );
+
+		goto on_error;
+	}
+	/* Determine the signatures not covered by the scan node
+	 */
+	if( libcdata_array_initialize(
+	     &remaining_signatures_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create remaining signatures array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_fill_remaining_signatures(
+	     signature_table,
+	     remaining_signatures_array,
+	     result,
+	     pattern_offset,
+	     largest_signature,
+	     pattern_offsets_mode,
+	     pattern_offsets_range_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill remaining signatures array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     remaining_signatures_array,
+	     &number_of_remaining_signatures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of remaining signatures.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of remaining signatures: %d\n",
+		 function,
+		 number_of_remaining_signatures );
+	}
+#endif
+	/* If a byte value specific scan object does not match the scan falls back
+	 * to the default value, for a maximum number of fallback nodes. Hence the
+	 * remaining signatures only need to be added to the default value, which
+	 * keeps the number of scan tree nodes of signatures bound to an offset
+	 * linear to the number of signatures.
+	 *
+	 * The remaining signatures are added to the byte value specific sub nodes
+	 * of unbound signatures as well, so that the scan at every offset can
+	 * determine a match without falling back.
+	 */
+	if( number_of_remaining_signatures > 0 )
+	{
+		if( ( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+		 || ( number_of_fallback_nodes >= LIBSIGSCAN_SCAN_TREE_NODE_MAXIMUM_NUMBER_OF_FALLBACK_NODES ) )
+		{
+			add_remaining_signatures = 1;
+		}
+	}
+	number_of_sub_node_fallback_nodes = number_of_fallback_nodes;
+
+	if( number_of_sub_node_fallback_nodes < LIBSIGSCAN_SCAN_TREE_NODE_MAXIMUM_NUMBER_OF_FALLBACK_NODES )
+	{
+		number_of_sub_node_fallback_nodes += 1;
+	}
+	if( largest_signature != NULL )
+	{
+		if( libsigscan_scan_object_initialize(
+		     &scan_object,
+		     LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE,
+		     (intptr_t *) largest_signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan object",
+			 function );
+
+			goto on_error;
+		}
+		byte_value = largest_signature->pattern[ largest_signature->pattern_size - 1 ];
+
+		if( libsigscan_scan_tree_node_set_byte_value(
+		     *scan_tree_node,
+		     byte_value,
+		     scan_object,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set scan tree node byte value: 0x%02" PRIx8 ".",
+			 function,
+			 byte_value );
+
+			goto on_error;
+		}
+		/* The scan tree node takes over management of the scan object
+		 */
+		scan_object = NULL;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The sub nodes are independent of each other and can be built in parallel,
+	 * the default value is built as well hence the additional worker
+	 */
+	if( number_of_build_workers > ( number_of_signature_groups + 1 ) )
+	{
+		number_of_build_workers = number_of_signature_groups + 1;
+	}
+	if( number_of_build_workers > 1 )
+	{
+		if( libcdata_array_initialize(
+		     &build_tasks_array,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create build tasks array.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_build_workers,
+		     number_of_build_workers * LIBSIGSCAN_NUMBER_OF_QUEUED_BUILD_TASKS_PER_WORKER,
+		     (int (*)(intptr_t *, void *)) &libsigscan_scan_tree_build_task_callback,
+		     (void *) scan_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	/* Determine the scan tree node byte values
+	 */
+	for( signature_group_index = 0;
+	     signature_group_index < number_of_signature_groups;
+	     signature_group_index++ )
+	{
+		if( libsigscan_byte_value_group_get_signature_group_by_index(
+		     byte_value_group,
+		     signature_group_index,
+		     &signature_group,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - unable to retrieve signature group: %d.",
+			 function,
+			 pattern_offset,
+			 signature_group_index );
+
+			goto on_error;
+		}
+		if( libsigscan_signature_group_get_byte_value(
 		     signature_group,
 		     &byte_value,
 		     error ) != 1 )
@@ -1563,459 +2253,2706 @@ int libsigscan_scan_tree_build_node(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve byte value.",
-			 function,
-			 pattern_offset,
-			 signature_group_index );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve byte value.",
+			 function,
+			 pattern_offset,
+			 signature_group_index );
+
+			goto on_error;
+		}
+		if( libsigscan_signature_group_get_number_of_signatures(
+		     signature_group,
+		     &number_of_signatures,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve number of signatures.",
+			 function,
+			 pattern_offset,
+			 signature_group_index );
+
+			goto on_error;
+		}
+		if( number_of_signatures == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - missing number of signatures.",
+			 function,
+			 pattern_offset,
+			 signature_group_index );
+
+			goto on_error;
+		}
+		if( ( number_of_signatures == 1 )
+		 && ( ( number_of_remaining_signatures == 0 )
+		  ||  ( number_of_fallback_nodes < LIBSIGSCAN_SCAN_TREE_NODE_MAXIMUM_NUMBER_OF_FALLBACK_NODES ) ) )
+		{
+			if( libsigscan_signature_group_get_signature_by_index(
+			     signature_group,
+			     0,
+			     (libsigscan_signature_t **) &scan_object_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 	 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve signature: 0.",
+				 function,
+				 pattern_offset,
+				 signature_group_index );
+
+				goto on_error;
+			}
+			scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE;
+		}
+		else
+		{
+			if( libsigscan_signature_table_initialize(
+			     &sub_signature_table,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create signature table.",
+				 function );
+
+				goto on_error;
+			}
+			if( libsigscan_signature_table_fill_from_array(
+			     sub_signature_table,
+			     signature_group->signatures_array,
+			     offsets_ignore_list,
+			     pattern_offsets_mode,
+			     pattern_offsets_range_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to fill signature table.",
+				 function );
+
+				goto on_error;
+			}
+			if( add_remaining_signatures != 0 )
+			{
+				if( libsigscan_signature_table_fill_from_array(
+				     sub_signature_table,
+				     remaining_signatures_array,
+				     offsets_ignore_list,
+				     pattern_offsets_mode,
+				     pattern_offsets_range_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to fill signature table.",
+					 function );
+
+					goto on_error;
+				}
+			}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( thread_pool != NULL )
+			{
+				if( libsigscan_scan_tree_push_build_task(
+				     thread_pool,
+				     build_tasks_array,
+				     &sub_signature_table,
+				     offsets_ignore_list,
+				     pattern_offsets_mode,
+				     pattern_offsets_range_size,
+				     number_of_sub_node_fallback_nodes,
+				     byte_value,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push build task for byte value: 0x%02" PRIx8 " onto thread pool.",
+					 function,
+					 byte_value );
+
+					goto on_error;
+				}
+				continue;
+			}
+#endif
+			if( libsigscan_scan_tree_build_node(
+			     scan_tree,
+			     sub_signature_table,
+			     offsets_ignore_list,
+			     pattern_offsets_mode,
+			     pattern_offsets_range_size,
+			     number_of_sub_node_fallback_nodes,
+			     1,
+			     (libsigscan_scan_tree_node_t **) &scan_object_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to build scan tree node.",
+				 function );
+
+				goto on_error;
+			}
+			scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE;
+
+			if( libsigscan_signature_table_free(
+			     &sub_signature_table,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free signature table.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libsigscan_scan_object_initialize(
+		     &scan_object,
+		     scan_object_type,
+		     scan_object_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan object",
+			 function );
+
+			goto on_error;
+		}
+		/* The scan object takes over management of the scan object value
+		 */
+		scan_object_value = NULL;
+
+		if( libsigscan_scan_tree_node_set_byte_value(
+		     *scan_tree_node,
+		     byte_value,
+		     scan_object,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set scan tree node byte value: 0x%02" PRIx8 ".",
+			 function,
+			 byte_value );
+
+			goto on_error;
+		}
+		/* The scan tree node takes over management of the scan object
+		 */
+		scan_object = NULL;
+	}
+	/* Determine the scan tree node default value
+	 */
+	if( number_of_remaining_signatures == 1 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     remaining_signatures_array,
+		     0,
+		     &scan_object_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid remaining signatures array - unable to retrieve signature: 0.",
+			 function );
+
+			goto on_error;
+		}
+		scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE;
+	}
+	else if( number_of_remaining_signatures > 1 )
+	{
+		/* The byte value groups are no longer needed, emptying them keeps
+		 * the memory usage linear when the default values form a long chain
+		 */
+		if( libsigscan_signature_table_empty_byte_value_groups(
+		     signature_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to empty byte value groups of signature table.",
+			 function );
+
+			goto on_error;
+		}
+		byte_value_group = NULL;
+
+		if( libsigscan_signature_table_initialize(
+		     &sub_signature_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create signature table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsigscan_signature_table_fill_from_array(
+		     sub_signature_table,
+		     remaining_signatures_array,
+		     offsets_ignore_list,
+		     pattern_offsets_mode,
+		     pattern_offsets_range_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to fill signature table.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( thread_pool != NULL )
+		{
+			if( libsigscan_scan_tree_push_build_task(
+			     thread_pool,
+			     build_tasks_array,
+			     &sub_signature_table,
+			     offsets_ignore_list,
+			     pattern_offsets_mode,
+			     pattern_offsets_range_size,
+			     number_of_fallback_nodes,
+			     0,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push build task for default value onto thread pool.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+#endif
+		{
+			if( libsigscan_scan_tree_build_node(
+			     scan_tree,
+			     sub_signature_table,
+			     offsets_ignore_list,
+			     pattern_offsets_mode,
+			     pattern_offsets_range_size,
+			     number_of_fallback_nodes,
+			     1,
+			     (libsigscan_scan_tree_node_t **) &scan_object_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to build scan tree node.",
+				 function );
+
+				goto on_error;
+			}
+			scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE;
+
+			if( libsigscan_signature_table_free(
+			     &sub_signature_table,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free signature table.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( scan_object_value != NULL )
+	{
+		if( libsigscan_scan_object_initialize(
+		     &scan_object,
+		     scan_object_type,
+		     scan_object_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan object",
+			 function );
+
+			goto on_error;
+		}
+		/* The scan object takes over management of the scan object value
+		 */
+		scan_object_value = NULL;
+
+		if( libsigscan_scan_tree_node_set_default_value(
+		     *scan_tree_node,
+		     scan_object,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set scan tree node default value.",
+			 function );
+
+			goto on_error;
+		}
+		/* The scan tree node takes over management of the scan object
+		 */
+		scan_object = NULL;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsigscan_scan_tree_set_build_task_results(
+		     *scan_tree_node,
+		     build_tasks_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set build task results.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_free(
+		     &build_tasks_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_scan_tree_build_task_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free build tasks array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( offset_ignored != 0 )
+	{
+		offset_ignored = 0;
+
+		if( libsigscan_offsets_list_remove_offset(
+		     offsets_ignore_list,
+		     pattern_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove pattern offset from offsets ignore list.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_free(
+	     &remaining_signatures_array,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free remaining signatures array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( libsigscan_scan_tree_node_printf(
+		     *scan_tree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print scan tree node.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( build_tasks_array != NULL )
+	{
+		libcdata_array_free(
+		 &build_tasks_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_scan_tree_build_task_free,
+		 NULL );
+	}
+#endif
+	if( sub_signature_table != NULL )
+	{
+		libsigscan_signature_table_free(
+		 &sub_signature_table,
+		 NULL );
+	}
+	if( ( scan_object_value != NULL )
+	 && ( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE ) )
+	{
+		libsigscan_scan_tree_node_free(
+		 (libsigscan_scan_tree_node_t **) &scan_object_value,
+		 NULL );
+	}
+	if( scan_object != NULL )
+	{
+		libsigscan_scan_object_free(
+		 &scan_object,
+		 NULL );
+	}
+	if( *scan_tree_node != NULL )
+	{
+		libsigscan_scan_tree_node_free(
+		 scan_tree_node,
+		 NULL );
+	}
+	if( byte_value_weights != NULL )
+	{
+		libsigscan_pattern_weights_free(
+		 &byte_value_weights,
+		 NULL );
+	}
+	if( similarity_weights != NULL )
+	{
+		libsigscan_pattern_weights_free(
+		 &similarity_weights,
+		 NULL );
+	}
+	if( occurrence_weights != NULL )
+	{
+		libsigscan_pattern_weights_free(
+		 &occurrence_weights,
+		 NULL );
+	}
+	if( offset_ignored != 0 )
+	{
+		libsigscan_offsets_list_remove_offset(
+		 offsets_ignore_list,
+		 pattern_offset,
+		 NULL );
+	}
+	if( remaining_signatures_array != NULL )
+	{
+		libcdata_array_free(
+		 &remaining_signatures_array,
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds the scan data of the scan tree
+ * The scan data consists of the scan tree arena, the skip table and the prefilter
+ * that are derived from the scan tree nodes and the signatures in the scan tree
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_build_scan_data(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_array_t *signatures_array,
+     int pattern_offsets_mode,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_build_scan_data";
+	int result            = 0;
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_tree->arena != NULL )
+	 || ( scan_tree->skip_table != NULL )
+	 || ( scan_tree->prefilter != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan tree - scan data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The scan tree arena is used to scan, it contains the scan tree nodes in a single array
+	 * where the scan objects are represented by 32-bit references
+	 */
+	if( libsigscan_scan_tree_arena_initialize(
+	     &( scan_tree->arena ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan tree arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_arena_build(
+	     scan_tree->arena,
+	     scan_tree->root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build scan tree arena.",
+		 function );
+
+		goto on_error;
+	}
+	/* The skip table is determined to provide for the Boyer–Moore–Horspool skip values
+	 * it only contains the signatures that are part of the scan tree
+	 */
+	if( libsigscan_skip_table_initialize(
+	     &( scan_tree->skip_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create skip table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_skip_table_fill(
+	     scan_tree->skip_table,
+	     signatures_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill skip table.",
+		 function );
+
+		goto on_error;
+	}
+	/* The block skip values are only used when scanning for unbound signatures
+	 */
+	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+	{
+		if( libsigscan_skip_table_fill_block_skip_values(
+		     scan_tree->skip_table,
+		     signatures_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to fill block skip values of skip table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The prefilter is determined to skip offsets where no unbound pattern can start
+	 * before walking the scan tree
+	 */
+	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+	{
+		if( libsigscan_prefilter_initialize(
+		     &( scan_tree->prefilter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create prefilter.",
+			 function );
+
+			goto on_error;
+		}
+		result = libsigscan_prefilter_build(
+		          scan_tree->prefilter,
+		          signatures_array,
+		          scan_tree->byte_value_profile,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build prefilter.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			/* The patterns have too many different byte values to benefit from the prefilter
+			 */
+			if( libsigscan_prefilter_free(
+			     &( scan_tree->prefilter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free prefilter.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( scan_tree->arena != NULL )
+	{
+		libsigscan_scan_tree_arena_free(
+		 &( scan_tree->arena ),
+		 NULL );
+	}
+	if( scan_tree->prefilter != NULL )
+	{
+		libsigscan_prefilter_free(
+		 &( scan_tree->prefilter ),
+		 NULL );
+	}
+	if( scan_tree->skip_table != NULL )
+	{
+		libsigscan_skip_table_free(
+		 &( scan_tree->skip_table ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds the scan tree
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libsigscan_scan_tree_build(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     int pattern_offsets_mode,
+     libcerror_error_t **error )
+{
+	libcdata_list_t *offsets_ignore_list          = NULL;
+	libsigscan_signature_table_t *signature_table = NULL;
+	static char *function                         = "libsigscan_scan_tree_build";
+	uint64_t range_size                           = 0;
+	uint64_t range_start                          = 0;
+	int number_of_pattern_ranges                  = 0;
+	int result                                    = 0;
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_tree_fill_range_list(
+	     scan_tree,
+	     signatures_list,
+	     pattern_offsets_mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill range list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_range_list_get_number_of_elements(
+	     scan_tree->pattern_range_list,
+	     &number_of_pattern_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of pattern ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_pattern_ranges == 0 )
+	{
+		return( 0 );
+	}
+	result = libcdata_range_list_get_spanning_range(
+	          scan_tree->pattern_range_list,
+	          &range_start,
+	          &range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve pattern range list spanning range.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_signature_table_initialize(
+	     &signature_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create signature table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_list_initialize(
+	     &offsets_ignore_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create offsets ignore list.",
+		 function );
+
+		goto on_error;
+	}
+	/* The pattern offsets of signatures bound to the end are relative to
+	 * the start of the spanning range, which is the largest pattern offset
+	 */
+	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	{
+		range_size = range_start + range_size;
+	}
+	if( libsigscan_signature_table_fill(
+	     signature_table,
+	     signatures_list,
+	     offsets_ignore_list,
+	     pattern_offsets_mode,
+	     range_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill signature table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_build_node(
+	     scan_tree,
+	     signature_table,
+	     offsets_ignore_list,
+	     pattern_offsets_mode,
+	     range_size,
+	     0,
+	     scan_tree->number_of_build_workers,
+	     &( scan_tree->root_node ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build root scan tree node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_list_free(
+	     &offsets_ignore_list,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free offsets ignore list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_build_scan_data(
+	     scan_tree,
+	     signature_table->signatures_array,
+	     pattern_offsets_mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build scan data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_signature_table_free(
+	     &signature_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free signature table.",
+		 function );
+
+		goto on_error;
+	}
+	scan_tree->pattern_offsets_mode = pattern_offsets_mode;
+
+	return( 1 );
+
+on_error:
+	if( offsets_ignore_list != NULL )
+	{
+		libcdata_list_free(
+		 &offsets_ignore_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
+		 NULL );
+	}
+	if( signature_table != NULL )
+	{
+		libsigscan_signature_table_free(
+		 &signature_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds the Aho-Corasick automaton of an unbound scan tree
+ * The automaton is used instead of the skip table and scan tree nodes to scan for unbound signatures
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_build_aho_corasick(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_build_aho_corasick";
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree->pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported scan tree pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree->aho_corasick != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan tree - Aho-Corasick automaton value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_aho_corasick_initialize(
+	     &( scan_tree->aho_corasick ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create Aho-Corasick automaton.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_aho_corasick_build(
+	     scan_tree->aho_corasick,
+	     signatures_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build Aho-Corasick automaton.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( scan_tree->aho_corasick != NULL )
+	{
+		libsigscan_aho_corasick_free(
+		 &( scan_tree->aho_corasick ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Fills the pattern weights
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_fill_pattern_weights(
+     libsigscan_scan_tree_t *scan_tree,
+     libsigscan_signature_table_t *signature_table,
+     libsigscan_pattern_weights_t *similarity_weights,
+     libsigscan_pattern_weights_t *occurrence_weights,
+     libsigscan_pattern_weights_t *byte_value_weights,
+     libcerror_error_t **error )
+{
+	libsigscan_byte_value_group_t *byte_value_group = NULL;
+	libsigscan_signature_group_t *signature_group   = NULL;
+	static char *function                           = "libsigscan_scan_tree_fill_pattern_weights";
+	int byte_value_frequency                        = 0;
+	int byte_value_group_index                      = 0;
+	int match_frequency                             = 0;
+	int number_of_byte_value_groups                 = 0;
+	int number_of_signature_groups                  = 0;
+	int number_of_signatures                        = 0;
+	int signature_group_index                       = 0;
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_signature_table_get_number_of_byte_value_groups(
+	     signature_table,
+	     &number_of_byte_value_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of byte value groups.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_value_group_index = 0;
+	     byte_value_group_index < number_of_byte_value_groups;
+	     byte_value_group_index++ )
+	{
+		if( libsigscan_signature_table_get_byte_value_group_by_index(
+		     signature_table,
+		     byte_value_group_index,
+		     &byte_value_group,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve byte value group: %d.",
+			 function,
+			 byte_value_group_index );
+
+			return( -1 );
+		}
+		if( byte_value_group == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing byte value group: %d.",
+			 function,
+			 byte_value_group_index );
+
+			return( -1 );
+		}
+		if( libsigscan_byte_value_group_get_number_of_signature_groups(
+		     byte_value_group,
+		     &number_of_signature_groups,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid byte value: %d - unable to retrieve number of signature groups.",
+			 function,
+			 byte_value_group_index );
+
+			return( -1 );
+		}
+		if( number_of_signature_groups > 1 )
+		{
+			if( libsigscan_pattern_weights_set_weight(
+			     occurrence_weights,
+			     byte_value_group->pattern_offset,
+			     number_of_signature_groups,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set occurrence weight.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		match_frequency = 0;
+
+		for( signature_group_index = 0;
+		     signature_group_index < number_of_signature_groups;
+		     signature_group_index++ )
+		{
+			if( libsigscan_byte_value_group_get_signature_group_by_index(
+			     byte_value_group,
+			     signature_group_index,
+			     &signature_group,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: invalid byte value group: %d - unable to retrieve signature group: %d.",
+				 function,
+				 byte_value_group_index,
+				 signature_group_index );
+
+				return( -1 );
+			}
+			if( signature_group == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid byte value group: %d - missing signature group: %d.",
+				 function,
+				 byte_value_group_index,
+				 signature_group_index );
+
+				return( -1 );
+			}
+			if( libsigscan_signature_group_get_number_of_signatures(
+			     signature_group,
+			     &number_of_signatures,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: invalid byte value group: %d - invalid signature group: %d - unable to retrieve number of signatures.",
+				 function,
+				 byte_value_group_index,
+				 signature_group_index );
+
+				return( -1 );
+			}
+			if( number_of_signatures > 1 )
+			{
+				if( libsigscan_pattern_weights_add_weight(
+				     similarity_weights,
+				     byte_value_group->pattern_offset,
+				     number_of_signatures,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to add similarity weight.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( scan_tree->byte_value_profile != NULL )
+			{
+				if( libsigscan_byte_value_profile_get_frequency(
+				     scan_tree->byte_value_profile,
+				     signature_group->byte_value,
+				     &byte_value_frequency,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve byte value: 0x%02" PRIx8 " frequency.",
+					 function,
+					 signature_group->byte_value );
+
+					return( -1 );
+				}
+				match_frequency += byte_value_frequency;
+			}
+			else if( libsigscan_common_byte_values[ signature_group->byte_value ] == 0 )
+			{
+				if( libsigscan_pattern_weights_add_weight(
+				     byte_value_weights,
+				     byte_value_group->pattern_offset,
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to add byte value weight.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		/* With a byte value profile the byte value weight is the frequency
+		 * of the scanned data not matching any of the byte values at the pattern offset,
+		 * hence the pattern offset with the largest weight requires the least node visits
+		 */
+		if( scan_tree->byte_value_profile != NULL )
+		{
+			if( match_frequency < LIBSIGSCAN_BYTE_VALUE_PROFILE_FREQUENCY_SCALE )
+			{
+				if( libsigscan_pattern_weights_set_weight(
+				     byte_value_weights,
+				     byte_value_group->pattern_offset,
+				     LIBSIGSCAN_BYTE_VALUE_PROFILE_FREQUENCY_SCALE - match_frequency,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set byte value weight.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Fills the range list
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_fill_range_list(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     int pattern_offsets_mode,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	static char *function                 = "libsigscan_scan_tree_fill_range_list";
+	size64_t pattern_size                 = 0;
+	off64_t pattern_offset                = 0;
+	int add_signature                     = 0;
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_first_element(
+	     signatures_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first list element.",
+		 function );
+
+		return( -1 );
+	}
+	while( list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature.",
+			 function );
+
+			return( -1 );
+		}
+		switch( pattern_offsets_mode )
+		{
+			case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START:
+				if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START )
+				{
+					add_signature = 1;
+				}
+				else
+				{
+					add_signature = 0;
+				}
+				break;
+
+			case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END:
+				if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END )
+				{
+					add_signature = 1;
+				}
+				else
+				{
+					add_signature = 0;
+				}
+				break;
+
+			case LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND:
+				if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET )
+				{
+					add_signature = 1;
+				}
+				else
+				{
+					add_signature = 0;
+				}
+				break;
+
+			default:
+				add_signature = 0;
+				break;
+		}
+		if( add_signature != 0 )
+		{
+			pattern_size = (size64_t) signature->pattern_size;
+
+			/* Unbound signatures are matched relative to the scan position
+			 */
+			if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+			{
+				pattern_offset = 0;
+			}
+			else if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+			{
+				/* The pattern offsets of signatures bound to the end are relative
+				 * to the end of the data, hence the range ends at the pattern offset.
+				 * The part of a pattern that extends beyond the end of the data is ignored.
+				 */
+				if( signature->pattern_offset >= (off64_t) signature->pattern_size )
+				{
+					pattern_offset = signature->pattern_offset - (off64_t) signature->pattern_size;
+				}
+				else
+				{
+					pattern_offset = 0;
+					pattern_size   = (size64_t) signature->pattern_offset;
+				}
+			}
+			else
+			{
+				pattern_offset = signature->pattern_offset;
+			}
+			if( pattern_size == 0 )
+			{
+				add_signature = 0;
+			}
+		}
+		if( add_signature != 0 )
+		{
+			if( libcdata_range_list_insert_range(
+			     scan_tree->pattern_range_list,
+			     (uint64_t) pattern_offset,
+			     pattern_size,
+			     NULL,
+			     NULL,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert pattern range.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next list element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the byte value of the pattern of a signature at a specific pattern offset
+ * Returns 1 if successful, 0 if the pattern does not span the pattern offset or -1 on error
+ */
+int libsigscan_scan_tree_get_signature_byte_value(
+     libsigscan_signature_t *signature,
+     off64_t pattern_offset,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     uint8_t *byte_value,
+     libcerror_error_t **error )
+{
+	static char *function    = "libsigscan_scan_tree_get_signature_byte_value";
+	off64_t signature_offset = 0;
+
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+	{
+		signature_offset = signature->pattern_offset;
+	}
+	else if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	{
+		signature_offset = pattern_offsets_range_size - signature->pattern_offset;
+	}
+	else
+	{
+		signature_offset = 0;
+	}
+	if( ( pattern_offset < signature_offset )
+	 || ( pattern_offset >= ( signature_offset + (off64_t) signature->pattern_size ) ) )
+	{
+		return( 0 );
+	}
+	*byte_value = signature->pattern[ pattern_offset - signature_offset ];
+
+	return( 1 );
+}
+
+/* Appends a scan tree node and its sub nodes to a list
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_append_nodes(
+     libcdata_list_t *nodes_list,
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_object_t *scan_object = NULL;
+	static char *function                 = "libsigscan_scan_tree_append_nodes";
+	uint16_t byte_value                   = 0;
+
+	if( scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_append_value(
+	     nodes_list,
+	     (intptr_t *) scan_tree_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append scan tree node to list.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_value = 0;
+	     byte_value <= 256;
+	     byte_value++ )
+	{
+		if( byte_value < 256 )
+		{
+			scan_object = scan_tree_node->scan_objects_table[ byte_value ];
+		}
+		else
+		{
+			scan_object = scan_tree_node->default_scan_object;
+		}
+		if( ( scan_object == NULL )
+		 || ( scan_object->type != LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE ) )
+		{
+			continue;
+		}
+		if( libsigscan_scan_tree_append_nodes(
+		     nodes_list,
+		     (libsigscan_scan_tree_node_t *) scan_object->value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sub nodes of byte value: 0x%02" PRIx16 ".",
+			 function,
+			 byte_value );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Builds a scan tree node that distinguishes the signatures in an array
+ * The scan tree node and its sub nodes are appended to the created nodes list
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_build_sub_node(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_array_t *signatures_array,
+     libcdata_list_t *offsets_ignore_list,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     int number_of_fallback_nodes,
+     libcdata_list_t *created_nodes_list,
+     libsigscan_scan_tree_node_t **scan_tree_node,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element         = NULL;
+	libsigscan_signature_table_t *signature_table = NULL;
+	static char *function                         = "libsigscan_scan_tree_build_sub_node";
+	int number_of_created_nodes                   = -1;
+	int number_of_elements                        = 0;
+
+	if( scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_signature_table_initialize(
+	     &signature_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create signature table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_signature_table_fill_from_array(
+	     signature_table,
+	     signatures_array,
+	     offsets_ignore_list,
+	     pattern_offsets_mode,
+	     pattern_offsets_range_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill signature table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_build_node(
+	     scan_tree,
+	     signature_table,
+	     offsets_ignore_list,
+	     pattern_offsets_mode,
+	     pattern_offsets_range_size,
+	     number_of_fallback_nodes,
+	     1,
+	     scan_tree_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build scan tree node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_signature_table_free(
+	     &signature_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free signature table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_list_get_number_of_elements(
+	     created_nodes_list,
+	     &number_of_created_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of created scan tree nodes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_append_nodes(
+	     created_nodes_list,
+	     *scan_tree_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append scan tree nodes to created nodes list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *scan_tree_node != NULL )
+	{
+		/* Remove the scan tree nodes that were appended before freeing them
+		 */
+		if( number_of_created_nodes >= 0 )
+		{
+			while( libcdata_list_get_number_of_elements(
+			        created_nodes_list,
+			        &number_of_elements,
+			        NULL ) == 1 )
+			{
+				if( number_of_elements <= number_of_created_nodes )
+				{
+					break;
+				}
+				if( libcdata_list_get_last_element(
+				     created_nodes_list,
+				     &list_element,
+				     NULL ) != 1 )
+				{
+					break;
+				}
+				if( libcdata_list_remove_element(
+				     created_nodes_list,
+				     list_element,
+				     NULL ) != 1 )
+				{
+					break;
+				}
+				libcdata_list_element_free(
+				 &list_element,
+				 NULL,
+				 NULL );
+			}
+		}
+		libsigscan_scan_tree_node_free(
+		 scan_tree_node,
+		 NULL );
+	}
+	if( signature_table != NULL )
+	{
+		libsigscan_signature_table_free(
+		 &signature_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Inserts a signature into a scan object of a copied scan tree node
+ * A scan tree node referenced by the scan object is copied, a signature
+ * referenced by the scan object is replaced by a scan tree node that
+ * distinguishes both signatures
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_insert_signature_into_scan_object(
+     libsigscan_scan_tree_t *scan_tree,
+     libsigscan_scan_object_t **scan_object,
+     libsigscan_signature_t *signature,
+     libcdata_list_t *offsets_ignore_list,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     int number_of_fallback_nodes,
+     libcdata_list_t *created_nodes_list,
+     libcdata_list_t *replaced_nodes_list,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *signatures_array          = NULL;
+	libsigscan_scan_tree_node_t *scan_tree_node = NULL;
+	static char *function                       = "libsigscan_scan_tree_insert_signature_into_scan_object";
+	int entry_index                             = 0;
+
+	if( scan_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan object.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_object == NULL )
+	{
+		if( libsigscan_scan_object_initialize(
+		     scan_object,
+		     LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE,
+		     (intptr_t *) signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan object.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libsigscan_signature_group_get_number_of_signatures(
-		     signature_group,
-		     &number_of_signatures,
+		return( 1 );
+	}
+	if( ( *scan_object )->type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE )
+	{
+		if( libsigscan_scan_tree_insert_signature_into_node(
+		     scan_tree,
+		     (libsigscan_scan_tree_node_t *) ( *scan_object )->value,
+		     signature,
+		     offsets_ignore_list,
+		     pattern_offsets_mode,
+		     pattern_offsets_range_size,
+		     number_of_fallback_nodes,
+		     created_nodes_list,
+		     replaced_nodes_list,
+		     &scan_tree_node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve number of signatures.",
-			 function,
-			 pattern_offset,
-			 signature_group_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to insert signature into scan tree node.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( number_of_signatures == 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - missing number of signatures.",
-			 function,
-			 pattern_offset,
-			 signature_group_index );
+		( *scan_object )->value = (intptr_t *) scan_tree_node;
 
-			goto on_error;
-		}
-		if( number_of_signatures == 1 )
-		{
-			if( libsigscan_signature_group_get_signature_by_index(
-			     signature_group,
-			     0,
-			     (libsigscan_signature_t **) &scan_object_value,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 	 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve signature: 0.",
-				 function,
-				 pattern_offset,
-				 signature_group_index );
+		return( 1 );
+	}
+	if( ( *scan_object )->value == (intptr_t *) signature )
+	{
+		return( 1 );
+	}
+	if( libcdata_array_initialize(
+	     &signatures_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create signatures array.",
+		 function );
 
-				goto on_error;
-			}
-			scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE;
-		}
-		else
-		{
-			if( libsigscan_signature_table_initialize(
-			     &sub_signature_table,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create signature table.",
-				 function );
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     signatures_array,
+	     &entry_index,
+	     ( *scan_object )->value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append signature of scan object to signatures array.",
+		 function );
 
-				goto on_error;
-			}
-			if( libsigscan_signature_table_fill(
-			     sub_signature_table,
-			     signature_group->signatures_list,
-			     sub_offsets_ignore_list,
-			     pattern_offsets_mode,
-			     pattern_offsets_range_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to fill signature table.",
-				 function );
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     signatures_array,
+	     &entry_index,
+	     (intptr_t *) signature,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append signature to signatures array.",
+		 function );
 
-				goto on_error;
-			}
-			if( libsigscan_signature_table_fill(
-			     sub_signature_table,
-			     remaining_signatures_list,
-			     sub_offsets_ignore_list,
-			     pattern_offsets_mode,
-			     pattern_offsets_range_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to fill signature table.",
-				 function );
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_build_sub_node(
+	     scan_tree,
+	     signatures_array,
+	     offsets_ignore_list,
+	     pattern_offsets_mode,
+	     pattern_offsets_range_size,
+	     number_of_fallback_nodes,
+	     created_nodes_list,
+	     &scan_tree_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build scan tree node.",
+		 function );
 
-				goto on_error;
-			}
-			if( libsigscan_scan_tree_build_node(
-			     scan_tree,
-			     sub_signature_table,
-			     sub_offsets_ignore_list,
-			     pattern_offsets_mode,
-			     pattern_offsets_range_size,
-			     (libsigscan_scan_tree_node_t **) &scan_object_value,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to build scan tree node.",
-				 function );
+		goto on_error;
+	}
+	/* The scan tree node is freed with the created nodes list
+	 */
+	( *scan_object )->type  = LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE;
+	( *scan_object )->value = (intptr_t *) scan_tree_node;
 
-				goto on_error;
-			}
-			scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE;
+	if( libcdata_array_free(
+	     &signatures_array,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free signatures array.",
+		 function );
 
-			if( libsigscan_signature_table_free(
-			     &sub_signature_table,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free signature table.",
-				 function );
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( signatures_array != NULL )
+	{
+		libcdata_array_free(
+		 &signatures_array,
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Inserts a signature into a copy of a scan tree node
+ * A signature that spans the pattern offset of the scan tree node is inserted
+ * in the scan object of its byte value, otherwise it is inserted in the default
+ * scan object, which is tried as well if the byte value specific scan object
+ * does not match. Once the scan can no longer retain the scan tree node, the
+ * signature is inserted in the byte value specific scan objects as well
+ * The scan tree node is appended to the replaced nodes list and its copy to the created nodes list
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_insert_signature_into_node(
+     libsigscan_scan_tree_t *scan_tree,
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     libsigscan_signature_t *signature,
+     libcdata_list_t *offsets_ignore_list,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     int number_of_fallback_nodes,
+     libcdata_list_t *created_nodes_list,
+     libcdata_list_t *replaced_nodes_list,
+     libsigscan_scan_tree_node_t **copied_scan_tree_node,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_object_t **scan_object           = NULL;
+	libsigscan_scan_tree_node_t *safe_scan_tree_node = NULL;
+	static char *function                            = "libsigscan_scan_tree_insert_signature_into_node";
+	uint16_t table_byte_value                        = 0;
+	uint8_t byte_value                               = 0;
+	int number_of_sub_node_fallback_nodes            = 0;
+	int offset_ignored                               = 0;
+	int result                                       = 0;
+
+	if( scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( copied_scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid copied scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_tree_node_copy(
+	     &safe_scan_tree_node,
+	     scan_tree_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to copy scan tree node.",
+		 function );
 
-				goto on_error;
-			}
-		}
-		if( libsigscan_scan_object_initialize(
-		     &scan_object,
-		     scan_object_type,
-		     scan_object_value,
+		goto on_error;
+	}
+	result = libsigscan_offsets_list_has_offset(
+	          offsets_ignore_list,
+	          scan_tree_node->pattern_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if offsets ignore list contains: %" PRIi64 ".",
+		 function,
+		 scan_tree_node->pattern_offset );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		/* The pattern offset is ignored by the sub nodes that are built
+		 */
+		if( libsigscan_offsets_list_insert_offset(
+		     offsets_ignore_list,
+		     scan_tree_node->pattern_offset,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create scan object",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert pattern offset into offsets ignore list.",
 			 function );
 
 			goto on_error;
 		}
-		/* The scan object takes over management of the scan object value
-		 */
-		scan_object_value = NULL;
+		offset_ignored = 1;
+	}
+	result = libsigscan_scan_tree_get_signature_byte_value(
+	          signature,
+	          scan_tree_node->pattern_offset,
+	          pattern_offsets_mode,
+	          pattern_offsets_range_size,
+	          &byte_value,
+	          error );
 
-		if( libsigscan_scan_tree_node_set_byte_value(
-		     *scan_tree_node,
-		     byte_value,
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve signature byte value at pattern offset: %" PRIi64 ".",
+		 function,
+		 scan_tree_node->pattern_offset );
+
+		goto on_error;
+	}
+	number_of_sub_node_fallback_nodes = number_of_fallback_nodes;
+
+	if( number_of_sub_node_fallback_nodes < LIBSIGSCAN_SCAN_TREE_NODE_MAXIMUM_NUMBER_OF_FALLBACK_NODES )
+	{
+		number_of_sub_node_fallback_nodes += 1;
+	}
+	if( result != 0 )
+	{
+		scan_object = &( safe_scan_tree_node->scan_objects_table[ byte_value ] );
+
+		if( libsigscan_scan_tree_insert_signature_into_scan_object(
+		     scan_tree,
 		     scan_object,
+		     signature,
+		     offsets_ignore_list,
+		     pattern_offsets_mode,
+		     pattern_offsets_range_size,
+		     number_of_sub_node_fallback_nodes,
+		     created_nodes_list,
+		     replaced_nodes_list,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set scan tree node byte value: 0x%02" PRIx8 ".",
+			 "%s: unable to insert signature into scan object of byte value: 0x%02" PRIx8 ".",
 			 function,
 			 byte_value );
 
 			goto on_error;
 		}
-		/* The scan tree node takes over management of the scan object
-		 */
-		scan_object = NULL;
 	}
-	/* Determine the scan tree node default value
-	 */
-	if( libcdata_list_get_number_of_elements(
-	     remaining_signatures_list,
-	     &number_of_remaining_signatures,
-	     error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of remaining signatures.",
-		 function );
+		if( number_of_fallback_nodes >= LIBSIGSCAN_SCAN_TREE_NODE_MAXIMUM_NUMBER_OF_FALLBACK_NODES )
+		{
+			for( table_byte_value = 0;
+			     table_byte_value < 256;
+			     table_byte_value++ )
+			{
+				if( safe_scan_tree_node->scan_objects_table[ table_byte_value ] == NULL )
+				{
+					continue;
+				}
+				if( libsigscan_scan_tree_insert_signature_into_scan_object(
+				     scan_tree,
+				     &( safe_scan_tree_node->scan_objects_table[ table_byte_value ] ),
+				     signature,
+				     offsets_ignore_list,
+				     pattern_offsets_mode,
+				     pattern_offsets_range_size,
+				     number_of_sub_node_fallback_nodes,
+				     created_nodes_list,
+				     replaced_nodes_list,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to insert signature into scan object of byte value: 0x%02" PRIx16 ".",
+					 function,
+					 table_byte_value );
 
-		return( -1 );
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: number of remaining signatures: %d\n",
-		 function,
-		 number_of_remaining_signatures );
-	}
-#endif
-	if( number_of_remaining_signatures == 1 )
-	{
-		if( libcdata_list_get_value_by_index(
-		     remaining_signatures_list,
-		     0,
-		     &scan_object_value,
+					goto on_error;
+				}
+			}
+		}
+		scan_object = &( safe_scan_tree_node->default_scan_object );
+
+		if( libsigscan_scan_tree_insert_signature_into_scan_object(
+		     scan_tree,
+		     scan_object,
+		     signature,
+		     offsets_ignore_list,
+		     pattern_offsets_mode,
+		     pattern_offsets_range_size,
+		     number_of_fallback_nodes,
+		     created_nodes_list,
+		     replaced_nodes_list,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: invalid remaining signatures list - unable to retrieve signature: 0.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to insert signature into default scan object.",
 			 function );
 
 			goto on_error;
 		}
-		scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE;
 	}
-	else if( number_of_remaining_signatures > 1 )
+	if( offset_ignored != 0 )
 	{
-		if( libsigscan_signature_table_initialize(
-		     &sub_signature_table,
+		offset_ignored = 0;
+
+		if( libsigscan_offsets_list_remove_offset(
+		     offsets_ignore_list,
+		     scan_tree_node->pattern_offset,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create signature table.",
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove pattern offset from offsets ignore list.",
 			 function );
 
 			goto on_error;
 		}
-		if( libsigscan_signature_table_fill(
-		     sub_signature_table,
-		     remaining_signatures_list,
-		     sub_offsets_ignore_list,
-		     pattern_offsets_mode,
-		     pattern_offsets_range_size,
-		     error ) != 1 )
+	}
+	if( libcdata_list_append_value(
+	     replaced_nodes_list,
+	     (intptr_t *) scan_tree_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append scan tree node to replaced nodes list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_list_append_value(
+	     created_nodes_list,
+	     (intptr_t *) safe_scan_tree_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append copied scan tree node to created nodes list.",
+		 function );
+
+		goto on_error;
+	}
+	*copied_scan_tree_node = safe_scan_tree_node;
+
+	return( 1 );
+
+on_error:
+	if( offset_ignored != 0 )
+	{
+		libsigscan_offsets_list_remove_offset(
+		 offsets_ignore_list,
+		 scan_tree_node->pattern_offset,
+		 NULL );
+	}
+	if( safe_scan_tree_node != NULL )
+	{
+		libsigscan_scan_tree_node_free_single(
+		 &safe_scan_tree_node,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Removes a signature from a scan object
+ * On return the scan object type and value contain the replacement of the scan object,
+ * where a NULL value indicates that the scan object no longer references any signature
+ * Returns 1 if the signature was removed, 0 if not present or -1 on error
+ */
+int libsigscan_scan_tree_remove_signature_from_scan_object(
+     libsigscan_scan_object_t *scan_object,
+     libsigscan_signature_t *signature,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     libcdata_list_t *created_nodes_list,
+     libcdata_list_t *replaced_nodes_list,
+     uint8_t *scan_object_type,
+     intptr_t **scan_object_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_remove_signature_from_scan_object";
+	int result            = 0;
+
+	if( scan_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan object.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_object_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan object type.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_object_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan object value.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_object->type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE )
+	{
+		if( scan_object->value != (intptr_t *) signature )
+		{
+			return( 0 );
+		}
+		*scan_object_type  = 0;
+		*scan_object_value = NULL;
+
+		return( 1 );
+	}
+	result = libsigscan_scan_tree_remove_signature_from_node(
+	          (libsigscan_scan_tree_node_t *) scan_object->value,
+	          signature,
+	          pattern_offsets_mode,
+	          pattern_offsets_range_size,
+	          created_nodes_list,
+	          replaced_nodes_list,
+	          scan_object_type,
+	          scan_object_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove signature from scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Removes a signature from a scan tree node
+ * The scan tree node is only copied if it references the signature, a signature
+ * that spans the pattern offset of the scan tree node can only be referenced by
+ * the scan object of its byte value or the default scan object
+ * If the copied scan tree node no longer distinguishes signatures it is replaced
+ * by the scan object that remains
+ * On return the scan object type and value contain the replacement of the scan tree node
+ * Returns 1 if the signature was removed, 0 if not present or -1 on error
+ */
+int libsigscan_scan_tree_remove_signature_from_node(
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     libsigscan_signature_t *signature,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     libcdata_list_t *created_nodes_list,
+     libcdata_list_t *replaced_nodes_list,
+     uint8_t *scan_object_type,
+     intptr_t **scan_object_value,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_object_t **copied_scan_object    = NULL;
+	libsigscan_scan_object_t *remaining_scan_object  = NULL;
+	libsigscan_scan_object_t *scan_object            = NULL;
+	libsigscan_scan_tree_node_t *safe_scan_tree_node = NULL;
+	intptr_t *remaining_value                        = NULL;
+	intptr_t *value                                  = NULL;
+	static char *function                            = "libsigscan_scan_tree_remove_signature_from_node";
+	uint16_t byte_value_index                        = 0;
+	uint8_t byte_value                               = 0;
+	uint8_t remaining_type                           = 0;
+	uint8_t type                                     = 0;
+	int has_byte_values                              = 0;
+	int has_single_signature                         = 0;
+	int result                                       = 0;
+	int spans_pattern_offset                         = 0;
+
+	if( scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_object_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan object type.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_object_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan object value.",
+		 function );
+
+		return( -1 );
+	}
+	spans_pattern_offset = libsigscan_scan_tree_get_signature_byte_value(
+	                        signature,
+	                        scan_tree_node->pattern_offset,
+	                        pattern_offsets_mode,
+	                        pattern_offsets_range_size,
+	                        &byte_value,
+	                        error );
+
+	if( spans_pattern_offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve signature byte value at pattern offset: %" PRIi64 ".",
+		 function,
+		 scan_tree_node->pattern_offset );
+
+		goto on_error;
+	}
+	/* The byte value index 256 represents the default scan object
+	 */
+	for( byte_value_index = 0;
+	     byte_value_index <= 256;
+	     byte_value_index++ )
+	{
+		if( byte_value_index < 256 )
+		{
+			if( ( spans_pattern_offset != 0 )
+			 && ( byte_value_index != (uint16_t) byte_value ) )
+			{
+				continue;
+			}
+			scan_object = scan_tree_node->scan_objects_table[ byte_value_index ];
+		}
+		else
+		{
+			scan_object = scan_tree_node->default_scan_object;
+		}
+		if( scan_object == NULL )
+		{
+			continue;
+		}
+		result = libsigscan_scan_tree_remove_signature_from_scan_object(
+		          scan_object,
+		          signature,
+		          pattern_offsets_mode,
+		          pattern_offsets_range_size,
+		          created_nodes_list,
+		          replaced_nodes_list,
+		          &type,
+		          &value,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to fill signature table.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove signature from scan object: 0x%02" PRIx16 ".",
+			 function,
+			 byte_value_index );
 
 			goto on_error;
 		}
-		if( libsigscan_scan_tree_build_node(
-		     scan_tree,
-		     sub_signature_table,
-		     sub_offsets_ignore_list,
-		     pattern_offsets_mode,
-		     pattern_offsets_range_size,
-		     (libsigscan_scan_tree_node_t **) &scan_object_value,
-		     error ) != 1 )
+		else if( result == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to build scan tree node.",
-			 function );
-
-			goto on_error;
+			continue;
 		}
-		scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE;
+		if( safe_scan_tree_node == NULL )
+		{
+			if( libsigscan_scan_tree_node_copy(
+			     &safe_scan_tree_node,
+			     scan_tree_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to copy scan tree node.",
+				 function );
 
-		if( libsigscan_signature_table_free(
-		     &sub_signature_table,
-		     error ) != 1 )
+				goto on_error;
+			}
+		}
+		if( byte_value_index < 256 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free signature table.",
-			 function );
+			copied_scan_object = &( safe_scan_tree_node->scan_objects_table[ byte_value_index ] );
+		}
+		else
+		{
+			copied_scan_object = &( safe_scan_tree_node->default_scan_object );
+		}
+		if( value == NULL )
+		{
+			/* The value of the scan object is freed by the generation of the scan tree
+			 * it was replaced in
+			 */
+			memory_free(
+			 *copied_scan_object );
 
-			goto on_error;
+			*copied_scan_object = NULL;
+		}
+		else
+		{
+			( *copied_scan_object )->type  = type;
+			( *copied_scan_object )->value = value;
 		}
 	}
-	if( scan_object_value != NULL )
+	if( safe_scan_tree_node == NULL )
 	{
-		if( libsigscan_scan_object_initialize(
-		     &scan_object,
-		     scan_object_type,
-		     scan_object_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create scan object",
-			 function );
+		return( 0 );
+	}
+	/* Determine if the copied scan tree node still distinguishes signatures
+	 */
+	has_single_signature = 1;
 
-			goto on_error;
+	for( byte_value_index = 0;
+	     byte_value_index <= 256;
+	     byte_value_index++ )
+	{
+		if( byte_value_index < 256 )
+		{
+			scan_object = safe_scan_tree_node->scan_objects_table[ byte_value_index ];
 		}
-		/* The scan object takes over management of the scan object value
-		 */
-		scan_object_value = NULL;
-
-		if( libsigscan_scan_tree_node_set_default_value(
-		     *scan_tree_node,
-		     scan_object,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set scan tree node default value.",
-			 function );
-
-			goto on_error;
+			scan_object = safe_scan_tree_node->default_scan_object;
+		}
+		if( scan_object == NULL )
+		{
+			continue;
+		}
+		if( byte_value_index < 256 )
+		{
+			has_byte_values = 1;
+		}
+		if( scan_object->type != LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE )
+		{
+			has_single_signature = 0;
+		}
+		else if( remaining_scan_object == NULL )
+		{
+			remaining_scan_object = scan_object;
+		}
+		else if( scan_object->value != remaining_scan_object->value )
+		{
+			has_single_signature = 0;
 		}
-		/* The scan tree node takes over management of the scan object
-		 */
-		scan_object = NULL;
 	}
-	if( libcdata_list_free(
-	     &sub_offsets_ignore_list,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
+	if( has_byte_values == 0 )
+	{
+		remaining_scan_object = safe_scan_tree_node->default_scan_object;
+	}
+	else if( has_single_signature == 0 )
+	{
+		remaining_scan_object = NULL;
+	}
+	if( remaining_scan_object != NULL )
+	{
+		remaining_type  = remaining_scan_object->type;
+		remaining_value = remaining_scan_object->value;
+	}
+	else if( has_byte_values != 0 )
+	{
+		remaining_type  = LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE;
+		remaining_value = (intptr_t *) safe_scan_tree_node;
+	}
+	if( libcdata_list_append_value(
+	     replaced_nodes_list,
+	     (intptr_t *) scan_tree_node,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free offsets ignore list.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append scan tree node to replaced nodes list.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_list_free(
-	     &remaining_signatures_list,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free_clone,
-	     error ) != 1 )
+	if( remaining_value == (intptr_t *) safe_scan_tree_node )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free remaining signatures list.",
-		 function );
+		if( libcdata_list_append_value(
+		     created_nodes_list,
+		     (intptr_t *) safe_scan_tree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append copied scan tree node to created nodes list.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		safe_scan_tree_node = NULL;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	else
 	{
-		if( libsigscan_scan_tree_node_printf(
-		     *scan_tree_node,
+		if( libsigscan_scan_tree_node_free_single(
+		     &safe_scan_tree_node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print scan tree node.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free copied scan tree node.",
 			 function );
 
 			goto on_error;
 		}
 	}
-#endif
+	*scan_object_type  = remaining_type;
+	*scan_object_value = remaining_value;
+
 	return( 1 );
 
 on_error:
-	if( sub_signature_table != NULL )
-	{
-		libsigscan_signature_table_free(
-		 &sub_signature_table,
-		 NULL );
-	}
-	if( ( scan_object_value != NULL )
-	 && ( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE ) )
-	{
-		libsigscan_scan_tree_node_free(
-		 (libsigscan_scan_tree_node_t **) &scan_object_value,
-		 NULL );
-	}
-	if( scan_object != NULL )
-	{
-		libsigscan_scan_object_free(
-		 &scan_object,
-		 NULL );
-	}
-	if( *scan_tree_node != NULL )
-	{
-		libsigscan_scan_tree_node_free(
-		 scan_tree_node,
-		 NULL );
-	}
-	if( byte_value_weights != NULL )
-	{
-		libsigscan_pattern_weights_free(
-		 &byte_value_weights,
-		 NULL );
-	}
-	if( similarity_weights != NULL )
-	{
-		libsigscan_pattern_weights_free(
-		 &similarity_weights,
-		 NULL );
-	}
-	if( occurrence_weights != NULL )
-	{
-		libsigscan_pattern_weights_free(
-		 &occurrence_weights,
-		 NULL );
-	}
-	if( sub_offsets_ignore_list != NULL )
-	{
-		libcdata_list_free(
-		 &sub_offsets_ignore_list,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
-		 NULL );
-	}
-	if( remaining_signatures_list != NULL )
+	if( safe_scan_tree_node != NULL )
 	{
-		libcdata_list_free(
-		 &remaining_signatures_list,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free_clone,
+		libsigscan_scan_tree_node_free_single(
+		 &safe_scan_tree_node,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Builds the scan tree
- * Returns 1 if successful, 0 if no such value or -1 on error
+/* Updates a scan tree by inserting or removing a signature
+ * The updated scan tree is a new generation of the source scan tree that shares
+ * the scan tree nodes not affected by the update, only the scan tree nodes on
+ * the path of the signature are copied. The scan data is rebuilt for the new generation.
+ * The signatures list should contain the signatures after the update
+ * The nodes of the source scan tree that were copied are appended to the replaced nodes list
+ * Returns 1 if successful, 0 if the scan tree needs to be rebuilt or -1 on error
  */
-int libsigscan_scan_tree_build(
-     libsigscan_scan_tree_t *scan_tree,
+int libsigscan_scan_tree_update(
+     libsigscan_scan_tree_t **scan_tree,
+     libsigscan_scan_tree_t *source_scan_tree,
      libcdata_list_t *signatures_list,
-     int pattern_offsets_mode,
+     libsigscan_signature_t *signature,
+     int update_type,
+     libcdata_list_t **replaced_nodes_list,
      libcerror_error_t **error )
 {
 	libcdata_list_t *offsets_ignore_list          = NULL;
 	libsigscan_signature_table_t *signature_table = NULL;
-	static char *function                         = "libsigscan_scan_tree_build";
+	intptr_t *scan_object_value                   = NULL;
+	static char *function                         = "libsigscan_scan_tree_update";
 	uint64_t range_size                           = 0;
 	uint64_t range_start                          = 0;
+	uint64_t source_range_size                    = 0;
+	uint64_t source_range_start                   = 0;
+	uint8_t scan_object_type                      = 0;
 	int number_of_pattern_ranges                  = 0;
+	int pattern_offsets_mode                      = 0;
 	int result                                    = 0;
 
 	if( scan_tree == NULL )
@@ -2029,56 +4966,96 @@ int libsigscan_scan_tree_build(
 
 		return( -1 );
 	}
-	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
-	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
-	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND ) )
+	if( *scan_tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_scan_tree == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported pattern offsets mode.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source scan tree.",
 		 function );
 
 		return( -1 );
 	}
-	if( libsigscan_scan_tree_fill_range_list(
-	     scan_tree,
-	     signatures_list,
-	     pattern_offsets_mode,
-	     error ) != 1 )
+	if( source_scan_tree->exclusive_nodes_list != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to fill range list.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid source scan tree - exclusive nodes list value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_range_list_get_number_of_elements(
-	     scan_tree->pattern_range_list,
-	     &number_of_pattern_ranges,
-	     error ) != 1 )
+	if( signature == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of pattern ranges.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( update_type != LIBSIGSCAN_SCAN_TREE_UPDATE_TYPE_INSERT_SIGNATURE )
+	 && ( update_type != LIBSIGSCAN_SCAN_TREE_UPDATE_TYPE_REMOVE_SIGNATURE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported update type.",
+		 function );
+
+		return( -1 );
+	}
+	if( replaced_nodes_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid replaced nodes list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *replaced_nodes_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid replaced nodes list value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( number_of_pattern_ranges == 0 )
+	/* A scan tree without scan tree nodes is rebuilt
+	 */
+	if( source_scan_tree->root_node == NULL )
 	{
 		return( 0 );
 	}
-	result = libcdata_range_list_get_spanning_range(
-	          scan_tree->pattern_range_list,
-	          &range_start,
-	          &range_size,
+	pattern_offsets_mode = source_scan_tree->pattern_offsets_mode;
+
+	result = libsigscan_scan_tree_get_spanning_range(
+	          source_scan_tree,
+	          &source_range_start,
+	          &source_range_size,
 	          error );
 
 	if( result == -1 )
@@ -2087,361 +5064,329 @@ int libsigscan_scan_tree_build(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve pattern range list spanning range.",
+		 "%s: unable to retrieve source pattern spanning range.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libsigscan_signature_table_initialize(
-	     &signature_table,
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libsigscan_scan_tree_initialize(
+	     scan_tree,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create signature table.",
+		 "%s: unable to create scan tree.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_list_initialize(
-	     &offsets_ignore_list,
+	( *scan_tree )->pattern_offsets_mode    = pattern_offsets_mode;
+	( *scan_tree )->number_of_build_workers = source_scan_tree->number_of_build_workers;
+
+	if( libsigscan_byte_value_profile_clone(
+	     &( ( *scan_tree )->byte_value_profile ),
+	     source_scan_tree->byte_value_profile,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create offsets ignore list.",
+		 "%s: unable to clone byte value profile.",
 		 function );
 
 		goto on_error;
 	}
-	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
-	{
-		range_size = range_start;
-	}
-	if( libsigscan_signature_table_fill(
-	     signature_table,
+	if( libsigscan_scan_tree_fill_range_list(
+	     *scan_tree,
 	     signatures_list,
-	     offsets_ignore_list,
 	     pattern_offsets_mode,
-	     range_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to fill signature table.",
+		 "%s: unable to fill range list.",
 		 function );
 
 		goto on_error;
 	}
-	if( libsigscan_scan_tree_build_node(
-	     scan_tree,
-	     signature_table,
-	     offsets_ignore_list,
-	     pattern_offsets_mode,
-	     range_size,
-	     &( scan_tree->root_node ),
+	if( libcdata_range_list_get_number_of_elements(
+	     ( *scan_tree )->pattern_range_list,
+	     &number_of_pattern_ranges,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to build root scan tree node.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of pattern ranges.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_list_free(
-	     &offsets_ignore_list,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
-	     error ) != 1 )
+	if( number_of_pattern_ranges == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free offsets ignore list.",
-		 function );
+		result = 0;
 
-		goto on_error;
+		goto on_rebuild;
 	}
-	if( libsigscan_signature_table_free(
-	     &signature_table,
+	if( libsigscan_scan_tree_get_spanning_range(
+	     *scan_tree,
+	     &range_start,
+	     &range_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free signature table.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve pattern spanning range.",
 		 function );
 
 		goto on_error;
 	}
-	/* The skip table is determined to provide for the Boyer–Moore–Horspool skip values
+	/* The pattern offsets of signatures bound to the end are relative to the start
+	 * of the spanning range, hence the scan tree nodes are only valid if it does not change
 	 */
-	if( libsigscan_skip_table_initialize(
-	     &( scan_tree->skip_table ),
+	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	{
+		if( range_start != source_range_start )
+		{
+			result = 0;
+
+			goto on_rebuild;
+		}
+		range_size = range_start;
+	}
+	if( libcdata_list_initialize(
+	     &( ( *scan_tree )->exclusive_nodes_list ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create skip table.",
+		 "%s: unable to create exclusive nodes list.",
 		 function );
 
 		goto on_error;
 	}
-	if( libsigscan_skip_table_fill(
-	     scan_tree->skip_table,
-	     signatures_list,
+	if( libcdata_list_initialize(
+	     replaced_nodes_list,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to fill skip table.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create replaced nodes list.",
 		 function );
 
 		goto on_error;
 	}
-	scan_tree->pattern_offsets_mode = pattern_offsets_mode;
-
-	return( 1 );
-
-on_error:
-	if( scan_tree->skip_table != NULL )
-	{
-		libsigscan_skip_table_free(
-		 &( scan_tree->skip_table ),
-		 NULL );
-	}
-	if( offsets_ignore_list != NULL )
-	{
-		libcdata_list_free(
-		 &offsets_ignore_list,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
-		 NULL );
-	}
-	if( signature_table != NULL )
-	{
-		libsigscan_signature_table_free(
-		 &signature_table,
-		 NULL );
-	}
-	return( -1 );
-}
-
-/* Fills the pattern weights
- * Returns 1 if successful or -1 on error
- */
-int libsigscan_scan_tree_fill_pattern_weights(
-     libsigscan_scan_tree_t *scan_tree,
-     libsigscan_signature_table_t *signature_table,
-     libsigscan_pattern_weights_t *similarity_weights,
-     libsigscan_pattern_weights_t *occurrence_weights,
-     libsigscan_pattern_weights_t *byte_value_weights,
-     libcerror_error_t **error )
-{
-	libsigscan_byte_value_group_t *byte_value_group = NULL;
-	libsigscan_signature_group_t *signature_group   = NULL;
-	static char *function                           = "libsigscan_scan_tree_fill_pattern_weights";
-	uint8_t byte_value                              = 0;
-	int byte_value_group_index                      = 0;
-	int number_of_byte_value_groups                 = 0;
-	int number_of_signature_groups                  = 0;
-	int number_of_signatures                        = 0;
-	int signature_group_index                       = 0;
-
-	if( scan_tree == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid scan tree.",
-		 function );
-
-		return( -1 );
-	}
-	if( libsigscan_signature_table_get_number_of_byte_value_groups(
-	     signature_table,
-	     &number_of_byte_value_groups,
+	if( libcdata_list_initialize(
+	     &offsets_ignore_list,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of byte value groups.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create offsets ignore list.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	for( byte_value_group_index = 0;
-	     byte_value_group_index < number_of_byte_value_groups;
-	     byte_value_group_index++ )
+	/* Until the update is shared the scan tree only frees the scan tree nodes it created
+	 */
+	if( update_type == LIBSIGSCAN_SCAN_TREE_UPDATE_TYPE_INSERT_SIGNATURE )
 	{
-		if( libsigscan_signature_table_get_byte_value_group_by_index(
-		     signature_table,
-		     byte_value_group_index,
-		     &byte_value_group,
+		if( libsigscan_scan_tree_insert_signature_into_node(
+		     *scan_tree,
+		     source_scan_tree->root_node,
+		     signature,
+		     offsets_ignore_list,
+		     pattern_offsets_mode,
+		     range_size,
+		     0,
+		     ( *scan_tree )->exclusive_nodes_list,
+		     *replaced_nodes_list,
+		     &( ( *scan_tree )->root_node ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve byte value group: %d.",
-			 function,
-			 byte_value_group_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to insert signature into root scan tree node.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( byte_value_group == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing byte value group: %d.",
-			 function,
-			 byte_value_group_index );
+	}
+	else
+	{
+		result = libsigscan_scan_tree_remove_signature_from_node(
+		          source_scan_tree->root_node,
+		          signature,
+		          pattern_offsets_mode,
+		          range_size,
+		          ( *scan_tree )->exclusive_nodes_list,
+		          *replaced_nodes_list,
+		          &scan_object_type,
+		          &scan_object_value,
+		          error );
 
-			return( -1 );
-		}
-		if( libsigscan_byte_value_group_get_number_of_signature_groups(
-		     byte_value_group,
-		     &number_of_signature_groups,
-		     error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: invalid byte value: %d - unable to retrieve number of signature groups.",
-			 function,
-			 byte_value_group_index );
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove signature from root scan tree node.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( number_of_signature_groups > 1 )
+		/* The root (scan tree) node must remain a scan tree node
+		 */
+		if( ( result == 0 )
+		 || ( scan_object_type != LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE ) )
 		{
-			if( libsigscan_pattern_weights_set_weight(
-			     occurrence_weights,
-			     byte_value_group->pattern_offset,
-			     number_of_signature_groups,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set occurrence weight.",
-				 function );
+			result = 0;
 
-				return( -1 );
-			}
+			goto on_rebuild;
 		}
-		for( signature_group_index = 0;
-		     signature_group_index < number_of_signature_groups;
-		     signature_group_index++ )
-		{
-			if( libsigscan_byte_value_group_get_signature_group_by_index(
-			     byte_value_group,
-			     signature_group_index,
-			     &signature_group,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: invalid byte value group: %d - unable to retrieve signature group: %d.",
-				 function,
-				 byte_value_group_index,
-				 signature_group_index );
+		( *scan_tree )->root_node = (libsigscan_scan_tree_node_t *) scan_object_value;
+	}
+	if( libsigscan_signature_table_initialize(
+	     &signature_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create signature table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_signature_table_fill(
+	     signature_table,
+	     signatures_list,
+	     offsets_ignore_list,
+	     pattern_offsets_mode,
+	     range_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill signature table.",
+		 function );
 
-				return( -1 );
-			}
-			if( libsigscan_signature_group_get_number_of_signatures(
-			     signature_group,
-			     &number_of_signatures,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: invalid byte value group: %d - invalid signature group: %d - unable to retrieve number of signatures.",
-				 function,
-				 byte_value_group_index,
-				 signature_group_index );
+		goto on_error;
+	}
+	if( libcdata_list_free(
+	     &offsets_ignore_list,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free offsets ignore list.",
+		 function );
 
-				return( -1 );
-			}
-			if( number_of_signatures > 1 )
-			{
-				if( libsigscan_pattern_weights_add_weight(
-				     similarity_weights,
-				     byte_value_group->pattern_offset,
-				     number_of_signatures,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to add similarity weight.",
-					 function );
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_build_scan_data(
+	     *scan_tree,
+	     signature_table->signatures_array,
+	     pattern_offsets_mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build scan data.",
+		 function );
 
-					return( -1 );
-				}
-			}
-			if( libsigscan_common_byte_values[ byte_value ] == 0 )
-			{
-				if( libsigscan_pattern_weights_add_weight(
-				     byte_value_weights,
-				     byte_value_group->pattern_offset,
-				     1,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to add byte value weight.",
-					 function );
+		goto on_error;
+	}
+	if( libsigscan_signature_table_free(
+	     &signature_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free signature table.",
+		 function );
 
-					return( -1 );
-				}
-			}
-		}
+		goto on_error;
 	}
 	return( 1 );
+
+on_error:
+	result = -1;
+
+on_rebuild:
+	if( signature_table != NULL )
+	{
+		libsigscan_signature_table_free(
+		 &signature_table,
+		 NULL );
+	}
+	if( offsets_ignore_list != NULL )
+	{
+		libcdata_list_free(
+		 &offsets_ignore_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
+		 NULL );
+	}
+	if( *replaced_nodes_list != NULL )
+	{
+		libcdata_list_free(
+		 replaced_nodes_list,
+		 NULL,
+		 NULL );
+	}
+	if( *scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 scan_tree,
+		 NULL );
+	}
+	return( result );
 }
 
-/* Fills the range list
+/* Shares the scan tree nodes of a scan tree with its next generation
+ * The next generation is the result of libsigscan_scan_tree_update and takes over
+ * the scan tree nodes it shares, the scan tree keeps the scan tree nodes that were replaced
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scan_tree_fill_range_list(
+int libsigscan_scan_tree_share_nodes(
      libsigscan_scan_tree_t *scan_tree,
-     libcdata_list_t *signatures_list,
-     int pattern_offsets_mode,
+     libsigscan_scan_tree_t *next_scan_tree,
+     libcdata_list_t **replaced_nodes_list,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element = NULL;
-	libsigscan_signature_t *signature     = NULL;
-	static char *function                 = "libsigscan_scan_tree_fill_range_list";
-	int add_signature                     = 0;
+	libcdata_list_t *created_nodes_list = NULL;
+	static char *function               = "libsigscan_scan_tree_share_nodes";
 
 	if( scan_tree == NULL )
 	{
@@ -2454,127 +5399,71 @@ int libsigscan_scan_tree_fill_range_list(
 
 		return( -1 );
 	}
-	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
-	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
-	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND ) )
+	if( scan_tree->exclusive_nodes_list != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported pattern offsets mode.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan tree - exclusive nodes list value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     signatures_list,
-	     &list_element,
-	     error ) != 1 )
+	if( next_scan_tree == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next scan tree.",
 		 function );
 
 		return( -1 );
 	}
-	while( list_element != NULL )
+	if( replaced_nodes_list == NULL )
 	{
-		if( libcdata_list_element_get_value(
-		     list_element,
-		     (intptr_t **) &signature,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve signature.",
-			 function );
-
-			return( -1 );
-		}
-		if( signature == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing signature.",
-			 function );
-
-			return( -1 );
-		}
-		switch( pattern_offsets_mode )
-		{
-			case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START:
-				if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START )
-				{
-					add_signature = 1;
-				}
-				else
-				{
-					add_signature = 0;
-				}
-				break;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid replaced nodes list.",
+		 function );
 
-			case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END:
-				if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END )
-				{
-					add_signature = 1;
-				}
-				else
-				{
-					add_signature = 0;
-				}
-				break;
+		return( -1 );
+	}
+	if( *replaced_nodes_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing replaced nodes list.",
+		 function );
 
-			case LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND:
-				add_signature = 1;
-				break;
+		return( -1 );
+	}
+	/* The next generation owns all its scan tree nodes
+	 */
+	created_nodes_list = next_scan_tree->exclusive_nodes_list;
 
-			default:
-				add_signature = 0;
-				break;
-		}
-		if( add_signature != 0 )
-		{
-			if( libcdata_range_list_insert_range(
-			     scan_tree->pattern_range_list,
-			     signature->pattern_offset,
-			     (size64_t) signature->pattern_size,
-			     NULL,
-			     NULL,
-			     NULL,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to insert pattern range.",
-				 function );
+	next_scan_tree->exclusive_nodes_list = NULL;
+	scan_tree->exclusive_nodes_list      = *replaced_nodes_list;
+	*replaced_nodes_list                 = NULL;
 
-				return( -1 );
-			}
-		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
+	if( libcdata_list_free(
+	     &created_nodes_list,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free created nodes list.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
 	return( 1 );
 }
@@ -25,10 +25,18 @@
 #include <common.h>
 #include <types.h>
 
+#include "libsigscan_aho_corasick.h"
+#include "libsigscan_byte_value_profile.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
+#include "libsigscan_libcthreads.h"
 #include "libsigscan_pattern_weights.h"
+#include "libsigscan_prefilter.h"
+#include "libsigscan_scan_object.h"
+#include "libsigscan_scan_tree_arena.h"
+#include "libsigscan_scan_tree_build_task.h"
 #include "libsigscan_scan_tree_node.h"
+#include "libsigscan_signature.h"
 #include "libsigscan_signature_table.h"
 #include "libsigscan_skip_table.h"
 
@@ -36,6 +44,8 @@
 extern "C" {
 #endif
 
+extern uint8_t libsigscan_common_byte_values[ 256 ];
+
 typedef struct libsigscan_scan_tree libsigscan_scan_tree_t;
 
 struct libsigscan_scan_tree
@@ -48,13 +58,43 @@ struct libsigscan_scan_tree
 	 */
 	libsigscan_scan_tree_node_t *root_node;
 
+	/* The scan tree arena
+	 * contains the scan tree nodes in a form that is used to scan
+	 */
+	libsigscan_scan_tree_arena_t *arena;
+
 	/* The skip table
 	 */
 	libsigscan_skip_table_t *skip_table;
 
+	/* The Aho-Corasick automaton
+	 * used as an alternative to the skip table and scan tree nodes for unbound signatures
+	 */
+	libsigscan_aho_corasick_t *aho_corasick;
+
+	/* The prefilter
+	 * used to determine candidate offsets for the unbound scan tree
+	 */
+	libsigscan_prefilter_t *prefilter;
+
 	/* The pattern range list
 	 */
 	libcdata_range_list_t *pattern_range_list;
+
+	/* The number of workers that build the sub trees of the root (scan tree) node
+	 */
+	int number_of_build_workers;
+
+	/* The byte value profile
+	 * used to determine the pattern offsets that are least likely to match scanned data
+	 */
+	libsigscan_byte_value_profile_t *byte_value_profile;
+
+	/* The exclusive scan tree nodes list
+	 * set if the scan tree shares scan tree nodes with another generation of the scan tree,
+	 * in which case only the scan tree nodes in the list are freed with the scan tree
+	 */
+	libcdata_list_t *exclusive_nodes_list;
 };
 
 int libsigscan_scan_tree_initialize(
@@ -101,21 +141,69 @@ int libsigscan_scan_tree_get_spanning_range(
      uint64_t *range_size,
      libcerror_error_t **error );
 
+int libsigscan_scan_tree_fill_remaining_signatures(
+     libsigscan_signature_table_t *signature_table,
+     libcdata_array_t *remaining_signatures_array,
+     int has_pattern_offset,
+     off64_t pattern_offset,
+     libsigscan_signature_t *ignore_signature,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libsigscan_scan_tree_push_build_task(
+     libcthreads_thread_pool_t *thread_pool,
+     libcdata_array_t *build_tasks_array,
+     libsigscan_signature_table_t **signature_table,
+     libcdata_list_t *offsets_ignore_list,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     int number_of_fallback_nodes,
+     uint8_t byte_value,
+     uint8_t is_default_value,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_build_task_callback(
+     libsigscan_scan_tree_build_task_t *build_task,
+     libsigscan_scan_tree_t *scan_tree );
+
+int libsigscan_scan_tree_set_build_task_results(
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     libcdata_array_t *build_tasks_array,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int libsigscan_scan_tree_build_node(
      libsigscan_scan_tree_t *scan_tree,
      libsigscan_signature_table_t *signature_table,
      libcdata_list_t *offsets_ignore_list,
      int pattern_offsets_mode,
      uint64_t pattern_offsets_range_size,
+     int number_of_fallback_nodes,
+     int number_of_build_workers,
      libsigscan_scan_tree_node_t **scan_tree_node,
      libcerror_error_t **error );
 
+int libsigscan_scan_tree_build_scan_data(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_array_t *signatures_array,
+     int pattern_offsets_mode,
+     libcerror_error_t **error );
+
 int libsigscan_scan_tree_build(
      libsigscan_scan_tree_t *scan_tree,
      libcdata_list_t *signatures_list,
      int pattern_offsets_mode,
      libcerror_error_t **error );
 
+int libsigscan_scan_tree_build_aho_corasick(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error );
+
 int libsigscan_scan_tree_fill_pattern_weights(
      libsigscan_scan_tree_t *scan_tree,
      libsigscan_signature_table_t *signature_table,
@@ -130,6 +218,92 @@ int libsigscan_scan_tree_fill_range_list(
      int pattern_offsets_mode,
      libcerror_error_t **error );
 
+int libsigscan_scan_tree_get_signature_byte_value(
+     libsigscan_signature_t *signature,
+     off64_t pattern_offset,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     uint8_t *byte_value,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_append_nodes(
+     libcdata_list_t *nodes_list,
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_build_sub_node(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_array_t *signatures_array,
+     libcdata_list_t *offsets_ignore_list,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     int number_of_fallback_nodes,
+     libcdata_list_t *created_nodes_list,
+     libsigscan_scan_tree_node_t **scan_tree_node,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_insert_signature_into_scan_object(
+     libsigscan_scan_tree_t *scan_tree,
+     libsigscan_scan_object_t **scan_object,
+     libsigscan_signature_t *signature,
+     libcdata_list_t *offsets_ignore_list,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     int number_of_fallback_nodes,
+     libcdata_list_t *created_nodes_list,
+     libcdata_list_t *replaced_nodes_list,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_insert_signature_into_node(
+     libsigscan_scan_tree_t *scan_tree,
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     libsigscan_signature_t *signature,
+     libcdata_list_t *offsets_ignore_list,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     int number_of_fallback_nodes,
+     libcdata_list_t *created_nodes_list,
+     libcdata_list_t *replaced_nodes_list,
+     libsigscan_scan_tree_node_t **copied_scan_tree_node,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_remove_signature_from_scan_object(
+     libsigscan_scan_object_t *scan_object,
+     libsigscan_signature_t *signature,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     libcdata_list_t *created_nodes_list,
+     libcdata_list_t *replaced_nodes_list,
+     uint8_t *scan_object_type,
+     intptr_t **scan_object_value,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_remove_signature_from_node(
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     libsigscan_signature_t *signature,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     libcdata_list_t *created_nodes_list,
+     libcdata_list_t *replaced_nodes_list,
+     uint8_t *scan_object_type,
+     intptr_t **scan_object_value,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_update(
+     libsigscan_scan_tree_t **scan_tree,
+     libsigscan_scan_tree_t *source_scan_tree,
+     libcdata_list_t *signatures_list,
+     libsigscan_signature_t *signature,
+     int update_type,
+     libcdata_list_t **replaced_nodes_list,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_share_nodes(
+     libsigscan_scan_tree_t *scan_tree,
+     libsigscan_scan_tree_t *next_scan_tree,
+     libcdata_list_t **replaced_nodes_list,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
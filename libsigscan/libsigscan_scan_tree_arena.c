@@ -0,0 +1,2077 @@
+/*
+ * Scan tree arena functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcnotify.h"
+#include "libsigscan_scan_object.h"
+#include "libsigscan_scan_tree_arena.h"
+#include "libsigscan_scan_tree_node.h"
+#include "libsigscan_signature.h"
+
+/* Creates a scan tree arena
+ * Make sure the value scan_tree_arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_arena_initialize(
+     libsigscan_scan_tree_arena_t **scan_tree_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_arena_initialize";
+
+	if( scan_tree_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_tree_arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan tree arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_tree_arena = memory_allocate_structure(
+	                    libsigscan_scan_tree_arena_t );
+
+	if( *scan_tree_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan tree arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_tree_arena,
+	     0,
+	     sizeof( libsigscan_scan_tree_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan tree arena.",
+		 function );
+
+		memory_free(
+		 *scan_tree_arena );
+
+		*scan_tree_arena = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *scan_tree_arena != NULL )
+	{
+		memory_free(
+		 *scan_tree_arena );
+
+		*scan_tree_arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scan tree arena
+ * The signatures are references and freed elsewhere
+ * The nodes and references are only freed if not referenced
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_arena_free(
+     libsigscan_scan_tree_arena_t **scan_tree_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_arena_free";
+
+	if( scan_tree_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_tree_arena != NULL )
+	{
+		if( ( *scan_tree_arena )->leaves != NULL )
+		{
+			memory_free(
+			 ( *scan_tree_arena )->leaves );
+		}
+		if( ( *scan_tree_arena )->signatures != NULL )
+		{
+			memory_free(
+			 ( *scan_tree_arena )->signatures );
+		}
+		if( ( ( *scan_tree_arena )->data_flags & LIBSIGSCAN_SCAN_DATA_FLAG_REFERENCED ) == 0 )
+		{
+			if( ( *scan_tree_arena )->references != NULL )
+			{
+				memory_free(
+				 ( *scan_tree_arena )->references );
+			}
+			if( ( *scan_tree_arena )->nodes != NULL )
+			{
+				memory_free(
+				 ( *scan_tree_arena )->nodes );
+			}
+		}
+		memory_free(
+		 *scan_tree_arena );
+
+		*scan_tree_arena = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines the layout of a scan tree node in the scan tree arena
+ * Nodes with few byte values use a sorted list, nodes with a moderate number
+ * of byte values a bitmap and nodes with a wide fan-out a dense table
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_arena_get_node_layout(
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     uint8_t *layout,
+     uint16_t *number_of_byte_values,
+     uint32_t *number_of_references,
+     libcerror_error_t **error )
+{
+	static char *function          = "libsigscan_scan_tree_arena_get_node_layout";
+	uint16_t byte_value            = 0;
+	uint16_t safe_number_of_values = 0;
+
+	if( scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_byte_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of byte values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_references == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of references.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		if( scan_tree_node->scan_objects_table[ byte_value ] != NULL )
+		{
+			safe_number_of_values++;
+		}
+	}
+	if( safe_number_of_values <= LIBSIGSCAN_SCAN_TREE_ARENA_MAXIMUM_NUMBER_OF_LIST_BYTE_VALUES )
+	{
+		/* The byte values are packed 4 per references value
+		 */
+		*layout               = LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_LIST;
+		*number_of_references = ( ( safe_number_of_values + 3 ) / 4 ) + safe_number_of_values;
+	}
+	else if( safe_number_of_values <= LIBSIGSCAN_SCAN_TREE_ARENA_MAXIMUM_NUMBER_OF_BITMAP_BYTE_VALUES )
+	{
+		/* The bitmap consists of 8 references values and the number of bits set of 2
+		 */
+		*layout               = LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_BITMAP;
+		*number_of_references = 10 + safe_number_of_values;
+	}
+	else
+	{
+		*layout               = LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_DENSE;
+		*number_of_references = 256;
+	}
+	*number_of_byte_values = safe_number_of_values;
+
+	return( 1 );
+}
+
+/* Determines the number of scan tree nodes, references and signatures of a scan object
+ * The scan object and the scan objects it refers to are counted
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_arena_get_number_of_scan_objects(
+     libsigscan_scan_object_t *scan_object,
+     uint32_t *number_of_nodes,
+     uint32_t *number_of_references,
+     uint32_t *number_of_signatures,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_tree_node_t *scan_tree_node = NULL;
+	static char *function                       = "libsigscan_scan_tree_arena_get_number_of_scan_objects";
+	uint32_t number_of_node_references          = 0;
+	uint16_t byte_value                         = 0;
+	uint16_t number_of_byte_values              = 0;
+	uint8_t layout                              = 0;
+
+	if( scan_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan object.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_references == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of references.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_signatures == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of signatures.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_object->type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE )
+	{
+		if( *number_of_signatures >= (uint32_t) LIBSIGSCAN_SCAN_TREE_ARENA_MAXIMUM_INDEX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of signatures value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_signatures += 1;
+
+		return( 1 );
+	}
+	if( scan_object->type != LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported scan object type.",
+		 function );
+
+		return( -1 );
+	}
+	scan_tree_node = (libsigscan_scan_tree_node_t *) scan_object->value;
+
+	if( scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( *number_of_nodes >= (uint32_t) LIBSIGSCAN_SCAN_TREE_ARENA_MAXIMUM_INDEX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of nodes value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_tree_arena_get_node_layout(
+	     scan_tree_node,
+	     &layout,
+	     &number_of_byte_values,
+	     &number_of_node_references,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine node layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_node_references > ( (uint32_t) LIBSIGSCAN_SCAN_TREE_ARENA_MAXIMUM_INDEX - *number_of_references ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of references value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_nodes      += 1;
+	*number_of_references += number_of_node_references;
+
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		if( scan_tree_node->scan_objects_table[ byte_value ] == NULL )
+		{
+			continue;
+		}
+		if( libsigscan_scan_tree_arena_get_number_of_scan_objects(
+		     scan_tree_node->scan_objects_table[ byte_value ],
+		     number_of_nodes,
+		     number_of_references,
+		     number_of_signatures,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of scan objects of byte value: 0x%02" PRIx16 ".",
+			 function,
+			 byte_value );
+
+			return( -1 );
+		}
+	}
+	if( scan_tree_node->default_scan_object != NULL )
+	{
+		if( libsigscan_scan_tree_arena_get_number_of_scan_objects(
+		     scan_tree_node->default_scan_object,
+		     number_of_nodes,
+		     number_of_references,
+		     number_of_signatures,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of scan objects of default scan object.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a scan object to the scan tree arena
+ * The scan tree nodes the scan object refers to are appended recursively
+ * The nodes, references and signatures must have been allocated beforehand
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_arena_append_scan_object(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     libsigscan_scan_object_t *scan_object,
+     uint32_t *reference,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_tree_node_t *scan_tree_node = NULL;
+	uint8_t *header_data                        = NULL;
+	static char *function                       = "libsigscan_scan_tree_arena_append_scan_object";
+	uint32_t *node_references                   = NULL;
+	uint32_t *value_references                  = NULL;
+	uint32_t default_reference                  = 0;
+	uint32_t node_index                         = 0;
+	uint32_t number_of_node_references          = 0;
+	uint32_t references_index                   = 0;
+	uint32_t signature_index                    = 0;
+	uint16_t byte_value                         = 0;
+	uint16_t number_of_byte_values              = 0;
+	uint16_t value_index                        = 0;
+	uint8_t layout                              = 0;
+
+	if( scan_tree_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan object.",
+		 function );
+
+		return( -1 );
+	}
+	if( reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_object->type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE )
+	{
+		signature_index = scan_tree_arena->number_of_signatures;
+
+		if( scan_tree_arena->signatures == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid scan tree arena - missing signatures.",
+			 function );
+
+			return( -1 );
+		}
+		if( scan_object->value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature.",
+			 function );
+
+			return( -1 );
+		}
+		scan_tree_arena->signatures[ signature_index ] = (libsigscan_signature_t *) scan_object->value;
+
+		scan_tree_arena->number_of_signatures += 1;
+
+		*reference = ( signature_index << LIBSIGSCAN_SCAN_TREE_ARENA_REFERENCE_INDEX_SHIFT )
+		           | LIBSIGSCAN_SCAN_TREE_ARENA_REFERENCE_TYPE_SIGNATURE;
+
+		return( 1 );
+	}
+	if( scan_object->type != LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported scan object type.",
+		 function );
+
+		return( -1 );
+	}
+	scan_tree_node = (libsigscan_scan_tree_node_t *) scan_object->value;
+
+	if( scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_tree_arena->nodes == NULL )
+	 || ( scan_tree_arena->references == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan tree arena - missing nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_tree_arena_get_node_layout(
+	     scan_tree_node,
+	     &layout,
+	     &number_of_byte_values,
+	     &number_of_node_references,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine node layout.",
+		 function );
+
+		return( -1 );
+	}
+	/* The node is appended before the scan objects it refers to
+	 * the references of the node are cleared when the references are allocated
+	 */
+	node_index       = scan_tree_arena->number_of_nodes;
+	references_index = scan_tree_arena->number_of_references;
+	node_references  = &( scan_tree_arena->references[ references_index ] );
+
+	scan_tree_arena->nodes[ node_index ].pattern_offset        = scan_tree_node->pattern_offset;
+	scan_tree_arena->nodes[ node_index ].references_index      = references_index;
+	scan_tree_arena->nodes[ node_index ].number_of_byte_values = number_of_byte_values;
+	scan_tree_arena->nodes[ node_index ].layout                = layout;
+
+	scan_tree_arena->number_of_nodes      += 1;
+	scan_tree_arena->number_of_references += number_of_node_references;
+
+	if( layout == LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_LIST )
+	{
+		header_data      = (uint8_t *) node_references;
+		value_references = &( node_references[ ( number_of_byte_values + 3 ) / 4 ] );
+	}
+	else if( layout == LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_BITMAP )
+	{
+		header_data      = (uint8_t *) &( node_references[ 8 ] );
+		value_references = &( node_references[ 10 ] );
+	}
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		/* The number of bits set preceding a bitmap value
+		 * is the index of its first byte value reference
+		 */
+		if( ( layout == LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_BITMAP )
+		 && ( ( byte_value & 0x1f ) == 0 ) )
+		{
+			header_data[ byte_value >> 5 ] = (uint8_t) value_index;
+		}
+		if( scan_tree_node->scan_objects_table[ byte_value ] == NULL )
+		{
+			continue;
+		}
+		if( layout == LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_LIST )
+		{
+			header_data[ value_index ] = (uint8_t) byte_value;
+		}
+		else if( layout == LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_BITMAP )
+		{
+			node_references[ byte_value >> 5 ] |= (uint32_t) 1 << ( byte_value & 0x1f );
+		}
+		else
+		{
+			value_references = &( node_references[ byte_value ] );
+			value_index      = 0;
+		}
+		if( libsigscan_scan_tree_arena_append_scan_object(
+		     scan_tree_arena,
+		     scan_tree_node->scan_objects_table[ byte_value ],
+		     &( value_references[ value_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append scan object of byte value: 0x%02" PRIx16 ".",
+			 function,
+			 byte_value );
+
+			return( -1 );
+		}
+		if( layout != LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_DENSE )
+		{
+			value_index++;
+		}
+	}
+	if( scan_tree_node->default_scan_object != NULL )
+	{
+		if( libsigscan_scan_tree_arena_append_scan_object(
+		     scan_tree_arena,
+		     scan_tree_node->default_scan_object,
+		     &default_reference,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append default scan object.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	scan_tree_arena->nodes[ node_index ].default_reference = default_reference;
+
+	*reference = ( node_index << LIBSIGSCAN_SCAN_TREE_ARENA_REFERENCE_INDEX_SHIFT )
+	           | LIBSIGSCAN_SCAN_TREE_ARENA_REFERENCE_TYPE_NODE;
+
+	return( 1 );
+}
+
+/* Builds the scan tree arena from the scan tree nodes
+ * The nodes are stored in a single array and refer to each other by index
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_arena_build(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     libsigscan_scan_tree_node_t *root_node,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_object_t root_scan_object;
+
+	static char *function         = "libsigscan_scan_tree_arena_build";
+	size_t references_size        = 0;
+	uint32_t number_of_nodes      = 0;
+	uint32_t number_of_references = 0;
+	uint32_t number_of_signatures = 0;
+
+	if( scan_tree_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree_arena->nodes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan tree arena - nodes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( root_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid root node.",
+		 function );
+
+		return( -1 );
+	}
+	root_scan_object.type  = LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE;
+	root_scan_object.value = (intptr_t *) root_node;
+
+	if( libsigscan_scan_tree_arena_get_number_of_scan_objects(
+	     &root_scan_object,
+	     &number_of_nodes,
+	     &number_of_references,
+	     &number_of_signatures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of scan objects.",
+		 function );
+
+		goto on_error;
+	}
+	scan_tree_arena->nodes = (libsigscan_scan_tree_arena_node_t *) memory_allocate(
+	                                                                sizeof( libsigscan_scan_tree_arena_node_t ) * number_of_nodes );
+
+	if( scan_tree_arena->nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create nodes.",
+		 function );
+
+		goto on_error;
+	}
+	/* The nodes are cleared so that their padding is defined when written to a scanner image
+	 */
+	if( memory_set(
+	     scan_tree_arena->nodes,
+	     0,
+	     sizeof( libsigscan_scan_tree_arena_node_t ) * number_of_nodes ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear nodes.",
+		 function );
+
+		goto on_error;
+	}
+	references_size = sizeof( uint32_t ) * number_of_references;
+
+	scan_tree_arena->references = (uint32_t *) memory_allocate(
+	                                            references_size );
+
+	if( scan_tree_arena->references == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create references.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     scan_tree_arena->references,
+	     0,
+	     references_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear references.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_signatures > 0 )
+	{
+		scan_tree_arena->signatures = (libsigscan_signature_t **) memory_allocate(
+		                                                           sizeof( libsigscan_signature_t * ) * number_of_signatures );
+
+		if( scan_tree_arena->signatures == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create signatures.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	scan_tree_arena->number_of_nodes      = 0;
+	scan_tree_arena->number_of_references = 0;
+	scan_tree_arena->number_of_signatures = 0;
+
+	if( libsigscan_scan_tree_arena_append_scan_object(
+	     scan_tree_arena,
+	     &root_scan_object,
+	     &( scan_tree_arena->root_reference ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append root node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_arena_compile(
+	     scan_tree_arena,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to compile scan tree arena.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( libsigscan_scan_tree_arena_printf(
+		     scan_tree_arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print scan tree arena.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( scan_tree_arena->signatures != NULL )
+	{
+		memory_free(
+		 scan_tree_arena->signatures );
+
+		scan_tree_arena->signatures = NULL;
+	}
+	if( scan_tree_arena->references != NULL )
+	{
+		memory_free(
+		 scan_tree_arena->references );
+
+		scan_tree_arena->references = NULL;
+	}
+	if( scan_tree_arena->nodes != NULL )
+	{
+		memory_free(
+		 scan_tree_arena->nodes );
+
+		scan_tree_arena->nodes = NULL;
+	}
+	scan_tree_arena->number_of_nodes      = 0;
+	scan_tree_arena->number_of_references = 0;
+	scan_tree_arena->number_of_signatures = 0;
+	scan_tree_arena->root_reference       = 0;
+
+	return( -1 );
+}
+
+/* Compiles the scan tree arena
+ * This determines the leaves, which allow a signature to be matched using word
+ * compares, and the nodes extent, which allows the node bounds checks to be
+ * done once per scan instead of once per node
+ * Returns 1 if successful, 0 if the scan tree arena cannot be compiled or -1 on error
+ */
+int libsigscan_scan_tree_arena_compile(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     libcerror_error_t **error )
+{
+	uint8_t pattern_word_mask_data[ 8 ];
+
+	libsigscan_scan_tree_arena_leaf_t *leaf = NULL;
+	libsigscan_signature_t *signature       = NULL;
+	static char *function                   = "libsigscan_scan_tree_arena_compile";
+	size_t pattern_word_size                = 0;
+	size64_t nodes_extent                   = 0;
+	uint32_t node_index                     = 0;
+	uint32_t signature_index                = 0;
+
+	if( scan_tree_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree_arena->leaves != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan tree arena - leaves value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_tree_arena->nodes == NULL )
+	 || ( scan_tree_arena->number_of_nodes == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan tree arena - missing nodes.",
+		 function );
+
+		return( -1 );
+	}
+	for( node_index = 0;
+	     node_index < scan_tree_arena->number_of_nodes;
+	     node_index++ )
+	{
+		/* A node with a negative pattern offset always continues with its default
+		 * reference, which is not supported by the compiled scan tree arena
+		 */
+		if( scan_tree_arena->nodes[ node_index ].pattern_offset < 0 )
+		{
+			return( 0 );
+		}
+		if( (size64_t) scan_tree_arena->nodes[ node_index ].pattern_offset >= nodes_extent )
+		{
+			nodes_extent = (size64_t) scan_tree_arena->nodes[ node_index ].pattern_offset + 1;
+		}
+	}
+	/* The leaves are allocated for an arena without signatures as well
+	 * so that it is marked as compiled
+	 */
+	scan_tree_arena->leaves = (libsigscan_scan_tree_arena_leaf_t *) memory_allocate(
+	                                                                 sizeof( libsigscan_scan_tree_arena_leaf_t ) * ( scan_tree_arena->number_of_signatures + 1 ) );
+
+	if( scan_tree_arena->leaves == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create leaves.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     scan_tree_arena->leaves,
+	     0,
+	     sizeof( libsigscan_scan_tree_arena_leaf_t ) * ( scan_tree_arena->number_of_signatures + 1 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear leaves.",
+		 function );
+
+		goto on_error;
+	}
+	for( signature_index = 0;
+	     signature_index < scan_tree_arena->number_of_signatures;
+	     signature_index++ )
+	{
+		signature = scan_tree_arena->signatures[ signature_index ];
+
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid signature: %" PRIu32 ".",
+			 function,
+			 signature_index );
+
+			goto on_error;
+		}
+		leaf = &( scan_tree_arena->leaves[ signature_index ] );
+
+		pattern_word_size = 0;
+
+		if( signature->pattern != NULL )
+		{
+			pattern_word_size = signature->pattern_size;
+		}
+		if( pattern_word_size > 8 )
+		{
+			pattern_word_size = 8;
+		}
+		/* The pattern word and mask are stored in native byte order
+		 * so that they can be compared with a word read from the buffer
+		 */
+		if( memory_set(
+		     pattern_word_mask_data,
+		     0,
+		     8 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear pattern word mask data.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( pattern_word_size > 0 )
+		 && ( memory_set(
+		       pattern_word_mask_data,
+		       0xff,
+		       pattern_word_size ) == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to set pattern word mask data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( leaf->pattern_word_mask ),
+		     pattern_word_mask_data,
+		     8 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy pattern word mask.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( pattern_word_size > 0 )
+		 && ( memory_copy(
+		       &( leaf->pattern_word ),
+		       signature->pattern,
+		       pattern_word_size ) == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy pattern word.",
+			 function );
+
+			goto on_error;
+		}
+		leaf->pattern_offset = signature->pattern_offset;
+		leaf->pattern_size   = signature->pattern_size;
+		leaf->signature      = signature;
+	}
+	scan_tree_arena->nodes_extent = nodes_extent;
+
+	return( 1 );
+
+on_error:
+	if( scan_tree_arena->leaves != NULL )
+	{
+		memory_free(
+		 scan_tree_arena->leaves );
+
+		scan_tree_arena->leaves = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_arena_get_number_of_nodes(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     uint32_t *number_of_nodes,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_arena_get_number_of_nodes";
+
+	if( scan_tree_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nodes.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_nodes = scan_tree_arena->number_of_nodes;
+
+	return( 1 );
+}
+
+/* Determines the number of bits set in a 32-bit value
+ * Returns the number of bits set
+ */
+uint8_t libsigscan_scan_tree_arena_get_number_of_bits_set(
+         uint32_t value )
+{
+#if defined( __GNUC__ )
+	return( (uint8_t) __builtin_popcount( value ) );
+#else
+	value = value - ( ( value >> 1 ) & 0x55555555UL );
+	value = ( value & 0x33333333UL ) + ( ( value >> 2 ) & 0x33333333UL );
+	value = ( value + ( value >> 4 ) ) & 0x0f0f0f0fUL;
+
+	return( (uint8_t) ( ( value * 0x01010101UL ) >> 24 ) );
+#endif
+}
+
+/* Retrieves the reference of a specific byte value of a scan tree arena node
+ * Returns the reference or 0 if the node has no reference for the byte value
+ */
+uint32_t libsigscan_scan_tree_arena_get_byte_value_reference(
+          libsigscan_scan_tree_arena_t *scan_tree_arena,
+          libsigscan_scan_tree_arena_node_t *node,
+          uint8_t byte_value )
+{
+	const uint32_t *node_references = NULL;
+	const uint8_t *header_data      = NULL;
+	uint64_t byte_values            = 0;
+	uint64_t matching_byte_values   = 0;
+	uint32_t bitmap_value           = 0;
+	uint32_t bitmap_value_bit       = 0;
+	uint16_t value_index            = 0;
+
+	node_references = &( scan_tree_arena->references[ node->references_index ] );
+
+	if( node->layout == LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_DENSE )
+	{
+		return( node_references[ byte_value ] );
+	}
+	if( node->layout == LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_LIST )
+	{
+		if( node->number_of_byte_values == 0 )
+		{
+			return( 0 );
+		}
+		header_data = (const uint8_t *) node_references;
+
+		/* The byte values are compared all at once, which requires 8 bytes of
+		 * references values. A list node with 1 to 4 byte values has 1 header
+		 * value and at least 1 reference and with 5 to 8 byte values 2 header values.
+		 * A byte in the byte values is 0 where it matches the byte value.
+		 */
+		byte_stream_copy_to_uint64_little_endian(
+		 header_data,
+		 byte_values );
+
+		byte_values ^= (uint64_t) byte_value * 0x0101010101010101ULL;
+
+		matching_byte_values = ( byte_values - 0x0101010101010101ULL )
+		                     & ~byte_values
+		                     & 0x8080808080808080ULL;
+
+		if( node->number_of_byte_values < 8 )
+		{
+			matching_byte_values &= ( (uint64_t) 1 << ( node->number_of_byte_values * 8 ) ) - 1;
+		}
+		if( matching_byte_values == 0 )
+		{
+			return( 0 );
+		}
+		/* The lowest matching byte is the index of the byte value
+		 */
+#if defined( __GNUC__ )
+		value_index = (uint16_t) ( __builtin_ctzll( matching_byte_values ) / 8 );
+#else
+		for( value_index = 0;
+		     ( matching_byte_values & 0x80 ) == 0;
+		     value_index++ )
+		{
+			matching_byte_values >>= 8;
+		}
+#endif
+
+		return( node_references[ ( ( node->number_of_byte_values + 3 ) / 4 ) + value_index ] );
+	}
+	bitmap_value     = node_references[ byte_value >> 5 ];
+	bitmap_value_bit = (uint32_t) 1 << ( byte_value & 0x1f );
+
+	if( ( bitmap_value & bitmap_value_bit ) == 0 )
+	{
+		return( 0 );
+	}
+	header_data = (const uint8_t *) &( node_references[ 8 ] );
+	value_index = header_data[ byte_value >> 5 ]
+	            + libsigscan_scan_tree_arena_get_number_of_bits_set(
+	               bitmap_value & ( bitmap_value_bit - 1 ) );
+
+	return( node_references[ 10 + value_index ] );
+}
+
+/* Determines if a reference of a node is valid
+ * Node references must refer to a node that follows the node, which prevents cycles
+ * Returns 1 if valid or 0 if not
+ */
+int libsigscan_scan_tree_arena_reference_is_valid(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     uint32_t node_index,
+     uint32_t reference )
+{
+	uint32_t reference_index = 0;
+	int reference_type       = 0;
+
+	reference_type  = libsigscan_scan_tree_arena_reference_get_type(
+	                   reference );
+	reference_index = libsigscan_scan_tree_arena_reference_get_index(
+	                   reference );
+
+	switch( reference_type )
+	{
+		case LIBSIGSCAN_SCAN_TREE_ARENA_REFERENCE_TYPE_NONE:
+			if( reference_index != 0 )
+			{
+				return( 0 );
+			}
+			break;
+
+		case LIBSIGSCAN_SCAN_TREE_ARENA_REFERENCE_TYPE_NODE:
+			if( ( reference_index <= node_index )
+			 || ( reference_index >= scan_tree_arena->number_of_nodes ) )
+			{
+				return( 0 );
+			}
+			break;
+
+		case LIBSIGSCAN_SCAN_TREE_ARENA_REFERENCE_TYPE_SIGNATURE:
+			if( reference_index >= scan_tree_arena->number_of_signatures )
+			{
+				return( 0 );
+			}
+			break;
+
+		default:
+			return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if the scan tree arena is valid
+ * This is used to check a scan tree arena that was not built by libsigscan_scan_tree_arena_build
+ * Returns 1 if valid, 0 if not or -1 on error
+ */
+int libsigscan_scan_tree_arena_validate(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_tree_arena_node_t *node = NULL;
+	const uint32_t *node_references         = NULL;
+	const uint8_t *header_data              = NULL;
+	static char *function                   = "libsigscan_scan_tree_arena_validate";
+	uint64_t references_end_index           = 0;
+	uint32_t node_index                     = 0;
+	uint32_t number_of_header_values        = 0;
+	uint32_t number_of_node_references      = 0;
+	uint32_t value_index                    = 0;
+	uint16_t number_of_bits_set             = 0;
+
+	if( scan_tree_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_tree_arena->nodes == NULL )
+	 || ( scan_tree_arena->number_of_nodes == 0 )
+	 || ( scan_tree_arena->number_of_nodes > LIBSIGSCAN_SCAN_TREE_ARENA_MAXIMUM_INDEX ) )
+	{
+		return( 0 );
+	}
+	if( ( scan_tree_arena->references == NULL )
+	 && ( scan_tree_arena->number_of_references != 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( scan_tree_arena->signatures == NULL )
+	 && ( scan_tree_arena->number_of_signatures != 0 ) )
+	{
+		return( 0 );
+	}
+	/* The root reference is the only node reference that refers to the first node
+	 */
+	if( ( libsigscan_scan_tree_arena_reference_get_type(
+	       scan_tree_arena->root_reference ) != LIBSIGSCAN_SCAN_TREE_ARENA_REFERENCE_TYPE_NODE )
+	 || ( libsigscan_scan_tree_arena_reference_get_index(
+	       scan_tree_arena->root_reference ) != 0 ) )
+	{
+		return( 0 );
+	}
+	for( node_index = 0;
+	     node_index < scan_tree_arena->number_of_nodes;
+	     node_index++ )
+	{
+		node = &( scan_tree_arena->nodes[ node_index ] );
+
+		/* A negative pattern offset is valid, the node then always continues
+		 * with its default reference, see libsigscan_scan_tree_arena_scan_buffer
+		 */
+		if( node->number_of_byte_values > 256 )
+		{
+			return( 0 );
+		}
+		switch( node->layout )
+		{
+			case LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_DENSE:
+				number_of_header_values   = 0;
+				number_of_node_references = 256;
+				break;
+
+			case LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_LIST:
+				if( node->number_of_byte_values > LIBSIGSCAN_SCAN_TREE_ARENA_MAXIMUM_NUMBER_OF_LIST_BYTE_VALUES )
+				{
+					return( 0 );
+				}
+				number_of_header_values   = ( node->number_of_byte_values + 3 ) / 4;
+				number_of_node_references = node->number_of_byte_values;
+				break;
+
+			case LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_BITMAP:
+				if( node->number_of_byte_values > LIBSIGSCAN_SCAN_TREE_ARENA_MAXIMUM_NUMBER_OF_BITMAP_BYTE_VALUES )
+				{
+					return( 0 );
+				}
+				number_of_header_values   = 10;
+				number_of_node_references = node->number_of_byte_values;
+				break;
+
+			default:
+				return( 0 );
+		}
+		references_end_index = (uint64_t) node->references_index
+		                     + number_of_header_values
+		                     + number_of_node_references;
+
+		if( references_end_index > (uint64_t) scan_tree_arena->number_of_references )
+		{
+			return( 0 );
+		}
+		node_references = &( scan_tree_arena->references[ node->references_index ] );
+
+		if( node->layout == LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_BITMAP )
+		{
+			/* The number of bits set preceding every bitmap value must match the bitmap
+			 */
+			header_data        = (const uint8_t *) &( node_references[ 8 ] );
+			number_of_bits_set = 0;
+
+			for( value_index = 0;
+			     value_index < 8;
+			     value_index++ )
+			{
+				if( header_data[ value_index ] != number_of_bits_set )
+				{
+					return( 0 );
+				}
+				number_of_bits_set += libsigscan_scan_tree_arena_get_number_of_bits_set(
+				                       node_references[ value_index ] );
+			}
+			if( number_of_bits_set != node->number_of_byte_values )
+			{
+				return( 0 );
+			}
+		}
+		for( value_index = number_of_header_values;
+		     value_index < ( number_of_header_values + number_of_node_references );
+		     value_index++ )
+		{
+			if( libsigscan_scan_tree_arena_reference_is_valid(
+			     scan_tree_arena,
+			     node_index,
+			     node_references[ value_index ] ) == 0 )
+			{
+				return( 0 );
+			}
+		}
+		if( libsigscan_scan_tree_arena_reference_is_valid(
+		     scan_tree_arena,
+		     node_index,
+		     node->default_reference ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Scans the buffer for a signature that matches using the compiled scan tree arena
+ * This is used by libsigscan_scan_tree_arena_scan_buffer when the nodes extent
+ * fits in both the remaining data and the buffer, so that the nodes can be
+ * walked without bounds checks and the pattern offsets mode only needs to be
+ * determined once. The arguments are validated by libsigscan_scan_tree_arena_scan_buffer
+ * The number of visited nodes is set to the number of scan tree nodes visited during the scan
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libsigscan_scan_tree_arena_scan_buffer_compiled(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     int pattern_offsets_mode,
+     off64_t data_offset,
+     size64_t data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libsigscan_signature_t **signature,
+     int *number_of_visited_nodes,
+     libcerror_error_t **error )
+{
+	uint32_t fallback_references[ LIBSIGSCAN_SCAN_TREE_NODE_MAXIMUM_NUMBER_OF_FALLBACK_NODES ];
+
+	libsigscan_scan_tree_arena_leaf_t *leaf = NULL;
+	libsigscan_scan_tree_arena_node_t *node = NULL;
+	const uint32_t *node_references         = NULL;
+	const uint8_t *match_data               = NULL;
+	const uint8_t *scan_data                = NULL;
+	static char *function                   = "libsigscan_scan_tree_arena_scan_buffer_compiled";
+	off64_t leaf_offset_base                = 0;
+	off64_t leaf_offset_factor              = 0;
+	off64_t relative_offset                 = 0;
+	size64_t remaining_data_size            = 0;
+	size_t available_buffer_size            = 0;
+	uint64_t byte_values                    = 0;
+	uint64_t match_word                     = 0;
+	uint64_t matching_byte_values           = 0;
+	uint32_t reference                      = 0;
+	uint16_t value_index                    = 0;
+	uint8_t byte_value                      = 0;
+	int number_of_fallback_references       = 0;
+	int reference_type                      = 0;
+
+	remaining_data_size   = data_size - data_offset;
+	available_buffer_size = buffer_size - buffer_offset;
+	scan_data             = &( buffer[ buffer_offset ] );
+
+	/* The offset of a leaf relative to the data offset is:
+	 * bound to start: the pattern offset - the data offset
+	 * bound to end:   the remaining data size - the pattern offset
+	 * unbound:        0
+	 */
+	switch( pattern_offsets_mode )
+	{
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START:
+			leaf_offset_base   = -data_offset;
+			leaf_offset_factor = 1;
+			break;
+
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END:
+			leaf_offset_base   = (off64_t) remaining_data_size;
+			leaf_offset_factor = -1;
+			break;
+
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND:
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported pattern offsets mode.",
+			 function );
+
+			return( -1 );
+	}
+	*number_of_visited_nodes = 0;
+
+	reference = scan_tree_arena->root_reference;
+
+	while( reference != 0 )
+	{
+		reference_type = libsigscan_scan_tree_arena_reference_get_type(
+		                  reference );
+
+		if( reference_type == LIBSIGSCAN_SCAN_TREE_ARENA_REFERENCE_TYPE_NODE )
+		{
+			node = &( scan_tree_arena->nodes[ libsigscan_scan_tree_arena_reference_get_index( reference ) ] );
+
+			*number_of_visited_nodes += 1;
+
+			/* The nodes extent guarantees that the pattern offset is within the buffer
+			 */
+			byte_value      = scan_data[ node->pattern_offset ];
+			node_references = &( scan_tree_arena->references[ node->references_index ] );
+
+			/* The dense and list layouts are looked up in place, see
+			 * libsigscan_scan_tree_arena_get_byte_value_reference
+			 */
+			if( node->layout == LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_DENSE )
+			{
+				reference = node_references[ byte_value ];
+			}
+			else if( ( node->layout == LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_LIST )
+			      && ( node->number_of_byte_values > 0 ) )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 (const uint8_t *) node_references,
+				 byte_values );
+
+				byte_values ^= (uint64_t) byte_value * 0x0101010101010101ULL;
+
+				matching_byte_values = ( byte_values - 0x0101010101010101ULL )
+				                     & ~byte_values
+				                     & 0x8080808080808080ULL;
+
+				if( node->number_of_byte_values < 8 )
+				{
+					matching_byte_values &= ( (uint64_t) 1 << ( node->number_of_byte_values * 8 ) ) - 1;
+				}
+				reference = 0;
+
+				if( matching_byte_values != 0 )
+				{
+#if defined( __GNUC__ )
+					value_index = (uint16_t) ( __builtin_ctzll( matching_byte_values ) / 8 );
+#else
+					for( value_index = 0;
+					     ( matching_byte_values & 0x80 ) == 0;
+					     value_index++ )
+					{
+						matching_byte_values >>= 8;
+					}
+#endif
+					reference = node_references[ ( ( node->number_of_byte_values + 3 ) / 4 ) + value_index ];
+				}
+			}
+			else
+			{
+				reference = libsigscan_scan_tree_arena_get_byte_value_reference(
+				             scan_tree_arena,
+				             node,
+				             byte_value );
+			}
+
+			if( reference == 0 )
+			{
+				reference = node->default_reference;
+			}
+			else if( ( node->default_reference != 0 )
+			      && ( number_of_fallback_references < LIBSIGSCAN_SCAN_TREE_NODE_MAXIMUM_NUMBER_OF_FALLBACK_NODES ) )
+			{
+				fallback_references[ number_of_fallback_references++ ] = node->default_reference;
+			}
+			if( reference != 0 )
+			{
+				continue;
+			}
+		}
+		else if( reference_type == LIBSIGSCAN_SCAN_TREE_ARENA_REFERENCE_TYPE_SIGNATURE )
+		{
+			leaf = &( scan_tree_arena->leaves[ libsigscan_scan_tree_arena_reference_get_index( reference ) ] );
+
+			relative_offset = leaf_offset_base + ( leaf->pattern_offset * leaf_offset_factor );
+
+			/* If the pattern size exceeds the data size the signature cannot match.
+			 * If the pattern lies outside the buffered data the signature cannot
+			 * match in this buffer, see libsigscan_scan_tree_arena_scan_buffer
+			 */
+			if( ( (size64_t) leaf->pattern_size <= remaining_data_size )
+			 && ( (size64_t) relative_offset <= ( remaining_data_size - leaf->pattern_size ) )
+			 && ( leaf->pattern_size <= available_buffer_size )
+			 && ( (size64_t) relative_offset <= ( available_buffer_size - leaf->pattern_size ) ) )
+			{
+				match_data = &( scan_data[ relative_offset ] );
+
+				/* Compare the first 8 bytes as a word if the buffer contains them
+				 */
+				if( ( available_buffer_size - (size_t) relative_offset ) >= 8 )
+				{
+					memory_copy(
+					 &match_word,
+					 match_data,
+					 8 );
+
+					if( ( ( match_word & leaf->pattern_word_mask ) == leaf->pattern_word )
+					 && ( ( leaf->pattern_size <= 8 )
+					  ||  ( memory_compare(
+					         &( match_data[ 8 ] ),
+					         &( leaf->signature->pattern[ 8 ] ),
+					         leaf->pattern_size - 8 ) == 0 ) ) )
+					{
+						*signature = leaf->signature;
+
+						return( 1 );
+					}
+				}
+				else if( memory_compare(
+				          match_data,
+				          leaf->signature->pattern,
+				          leaf->pattern_size ) == 0 )
+				{
+					*signature = leaf->signature;
+
+					return( 1 );
+				}
+			}
+		}
+		/* If the byte value specific reference did not match
+		 * continue with the default reference of the deepest retained node.
+		 */
+		reference = 0;
+
+		if( number_of_fallback_references > 0 )
+		{
+			reference = fallback_references[ --number_of_fallback_references ];
+		}
+	}
+	return( 0 );
+}
+
+/* Scans the buffer for a signature that matches
+ * This is the equivalent of libsigscan_scan_tree_node_scan_buffer for the scan tree arena
+ * The compiled scan tree arena is used if all the nodes are within the buffer
+ * The number of visited nodes is set to the number of scan tree nodes visited during the scan
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libsigscan_scan_tree_arena_scan_buffer(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     int pattern_offsets_mode,
+     off64_t data_offset,
+     size64_t data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libsigscan_signature_t **signature,
+     int *number_of_visited_nodes,
+     libcerror_error_t **error )
+{
+	uint32_t fallback_references[ LIBSIGSCAN_SCAN_TREE_NODE_MAXIMUM_NUMBER_OF_FALLBACK_NODES ];
+
+	libsigscan_scan_tree_arena_node_t *node    = NULL;
+	libsigscan_signature_t *matching_signature = NULL;
+	static char *function                      = "libsigscan_scan_tree_arena_scan_buffer";
+	off64_t pattern_offset                     = 0;
+	off64_t scan_offset                        = 0;
+	size64_t remaining_data_size               = 0;
+	uint32_t reference                         = 0;
+	int number_of_fallback_references          = 0;
+	int reference_type                         = 0;
+	int result                                 = 0;
+
+	if( scan_tree_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset < 0 )
+	 || ( (size64_t) data_offset >= data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset >= buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_visited_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of visited nodes.",
+		 function );
+
+		return( -1 );
+	}
+	remaining_data_size = data_size - data_offset;
+
+	/* Use the compiled scan tree arena if all the nodes are within the buffer
+	 */
+	if( ( scan_tree_arena->leaves != NULL )
+	 && ( scan_tree_arena->nodes_extent <= remaining_data_size )
+	 && ( scan_tree_arena->nodes_extent <= (size64_t) ( buffer_size - buffer_offset ) ) )
+	{
+		result = libsigscan_scan_tree_arena_scan_buffer_compiled(
+		          scan_tree_arena,
+		          pattern_offsets_mode,
+		          data_offset,
+		          data_size,
+		          buffer,
+		          buffer_size,
+		          buffer_offset,
+		          signature,
+		          number_of_visited_nodes,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan buffer with compiled scan tree arena.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
+	}
+	*number_of_visited_nodes = 0;
+
+	reference = scan_tree_arena->root_reference;
+
+	while( reference != 0 )
+	{
+		reference_type = libsigscan_scan_tree_arena_reference_get_type(
+		                  reference );
+
+		if( reference_type == LIBSIGSCAN_SCAN_TREE_ARENA_REFERENCE_TYPE_NODE )
+		{
+			node        = &( scan_tree_arena->nodes[ libsigscan_scan_tree_arena_reference_get_index( reference ) ] );
+			scan_offset = (off64_t) ( buffer_offset + node->pattern_offset );
+
+			*number_of_visited_nodes += 1;
+
+			if( ( (size64_t) node->pattern_offset >= remaining_data_size )
+			 || ( ( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+			  &&  ( scan_offset >= (off64_t) buffer_size ) ) )
+			{
+				/* If the pattern offset exceeds the data size
+				 * continue with the default reference if available.
+				 * For unbound signatures the buffer can end before
+				 * the data size if no more data is available.
+				 */
+				reference = node->default_reference;
+			}
+			else if( scan_offset >= (off64_t) buffer_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid scan offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			else
+			{
+				reference = libsigscan_scan_tree_arena_get_byte_value_reference(
+				             scan_tree_arena,
+				             node,
+				             buffer[ scan_offset ] );
+
+				if( reference == 0 )
+				{
+					reference = node->default_reference;
+				}
+				else if( ( node->default_reference != 0 )
+				      && ( number_of_fallback_references < LIBSIGSCAN_SCAN_TREE_NODE_MAXIMUM_NUMBER_OF_FALLBACK_NODES ) )
+				{
+					/* Retain the default reference so that it can be tried
+					 * if the byte value specific reference does not match
+					 */
+					fallback_references[ number_of_fallback_references++ ] = node->default_reference;
+				}
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: offset: %" PRIi64 " byte value: 0x%02" PRIx8 " reference: 0x%08" PRIx32 ".\n",
+					 function,
+					 scan_offset,
+					 buffer[ scan_offset ],
+					 reference );
+				}
+#endif
+			}
+			if( reference != 0 )
+			{
+				continue;
+			}
+		}
+		else if( reference_type == LIBSIGSCAN_SCAN_TREE_ARENA_REFERENCE_TYPE_SIGNATURE )
+		{
+			matching_signature = scan_tree_arena->signatures[ libsigscan_scan_tree_arena_reference_get_index( reference ) ];
+
+			if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+			{
+				pattern_offset = matching_signature->pattern_offset;
+			}
+			else if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+			{
+				pattern_offset = data_size - matching_signature->pattern_offset;
+			}
+			else
+			{
+				/* Unbound signatures are matched at the data offset
+				 */
+				pattern_offset = data_offset;
+			}
+			/* The scan offset is relative to the start of the buffer
+			 */
+			scan_offset = buffer_offset + ( pattern_offset - data_offset );
+
+			/* If the pattern size exceeds the data size the signature cannot match.
+			 * If the pattern lies outside the buffered data the signature cannot
+			 * match in this buffer, for unbound signatures no more data is available
+			 * and for bound signatures the pattern is not within the scanned range.
+			 */
+			if( ( (size64_t) matching_signature->pattern_size <= remaining_data_size )
+			 && ( (size64_t) ( pattern_offset - data_offset ) <= ( remaining_data_size - matching_signature->pattern_size ) )
+			 && ( matching_signature->pattern_size <= buffer_size )
+			 && ( (size64_t) scan_offset <= ( buffer_size - matching_signature->pattern_size ) ) )
+			{
+				if( memory_compare(
+				     &( buffer[ scan_offset ] ),
+				     matching_signature->pattern,
+				     matching_signature->pattern_size ) == 0 )
+				{
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: offset: %" PRIi64 " signature: %s.\n",
+						 function,
+						 pattern_offset,
+						 matching_signature->identifier );
+					}
+#endif
+					*signature = matching_signature;
+
+					return( 1 );
+				}
+			}
+		}
+		/* If the byte value specific reference did not match
+		 * continue with the default reference of the deepest retained node.
+		 */
+		reference = 0;
+
+		if( number_of_fallback_references > 0 )
+		{
+			reference = fallback_references[ --number_of_fallback_references ];
+		}
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_DEBUG_OUTPUT )
+
+/* Prints the scan tree arena
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_arena_printf(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_arena_printf";
+	uint32_t node_index   = 0;
+	uint32_t reference    = 0;
+	uint16_t byte_value   = 0;
+
+	if( scan_tree_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree arena.",
+		 function );
+
+		return( -1 );
+	}
+	libcnotify_printf(
+	 "Scan tree arena:\n" );
+
+	libcnotify_printf(
+	 "\tNumber of nodes\t\t: %" PRIu32 "\n",
+	 scan_tree_arena->number_of_nodes );
+
+	libcnotify_printf(
+	 "\tNumber of references\t: %" PRIu32 "\n",
+	 scan_tree_arena->number_of_references );
+
+	libcnotify_printf(
+	 "\tNumber of signatures\t: %" PRIu32 "\n",
+	 scan_tree_arena->number_of_signatures );
+
+	libcnotify_printf(
+	 "\tRoot reference\t\t: 0x%08" PRIx32 "\n",
+	 scan_tree_arena->root_reference );
+
+	for( node_index = 0;
+	     node_index < scan_tree_arena->number_of_nodes;
+	     node_index++ )
+	{
+		libcnotify_printf(
+		 "\tNode: %" PRIu32 " pattern offset: %" PRIi64 " layout: %" PRIu8 " number of byte values: %" PRIu16 "\n",
+		 node_index,
+		 scan_tree_arena->nodes[ node_index ].pattern_offset,
+		 scan_tree_arena->nodes[ node_index ].layout,
+		 scan_tree_arena->nodes[ node_index ].number_of_byte_values );
+
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			reference = libsigscan_scan_tree_arena_get_byte_value_reference(
+			             scan_tree_arena,
+			             &( scan_tree_arena->nodes[ node_index ] ),
+			             (uint8_t) byte_value );
+
+			if( reference != 0 )
+			{
+				libcnotify_printf(
+				 "\t\tByte value: 0x%02" PRIx16 "\t: 0x%08" PRIx32 "\n",
+				 byte_value,
+				 reference );
+			}
+		}
+		if( scan_tree_arena->nodes[ node_index ].default_reference != 0 )
+		{
+			libcnotify_printf(
+			 "\t\tDefault\t\t: 0x%08" PRIx32 "\n",
+			 scan_tree_arena->nodes[ node_index ].default_reference );
+		}
+	}
+	libcnotify_printf(
+	 "\n" );
+
+	return( 1 );
+}
+
+#endif
+
@@ -0,0 +1,254 @@
+/*
+ * Scan tree arena functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_SCAN_TREE_ARENA_H )
+#define _LIBSIGSCAN_SCAN_TREE_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_scan_object.h"
+#include "libsigscan_scan_tree_node.h"
+#include "libsigscan_signature.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Retrieves the type of a scan tree arena reference
+ */
+#define libsigscan_scan_tree_arena_reference_get_type( reference ) \
+	(int) ( ( reference ) & LIBSIGSCAN_SCAN_TREE_ARENA_REFERENCE_TYPE_MASK )
+
+/* Retrieves the (node or signature) index of a scan tree arena reference
+ */
+#define libsigscan_scan_tree_arena_reference_get_index( reference ) \
+	(uint32_t) ( ( reference ) >> LIBSIGSCAN_SCAN_TREE_ARENA_REFERENCE_INDEX_SHIFT )
+
+typedef struct libsigscan_scan_tree_arena_node libsigscan_scan_tree_arena_node_t;
+
+struct libsigscan_scan_tree_arena_node
+{
+	/* The pattern offset
+	 */
+	off64_t pattern_offset;
+
+	/* The references index
+	 * the index of the first references value of the node
+	 */
+	uint32_t references_index;
+
+	/* The default reference
+	 */
+	uint32_t default_reference;
+
+	/* The number of byte values
+	 * the number of byte values that have a reference
+	 */
+	uint16_t number_of_byte_values;
+
+	/* The layout
+	 * the layout of the references values of the node
+	 */
+	uint8_t layout;
+};
+
+typedef struct libsigscan_scan_tree_arena_leaf libsigscan_scan_tree_arena_leaf_t;
+
+struct libsigscan_scan_tree_arena_leaf
+{
+	/* The pattern word
+	 * contains the first 8 bytes of the pattern in native byte order
+	 */
+	uint64_t pattern_word;
+
+	/* The pattern word mask
+	 * masks the bytes of the pattern word beyond the pattern size
+	 */
+	uint64_t pattern_word_mask;
+
+	/* The pattern offset
+	 */
+	off64_t pattern_offset;
+
+	/* The pattern size
+	 */
+	size_t pattern_size;
+
+	/* The signature
+	 */
+	libsigscan_signature_t *signature;
+};
+
+typedef struct libsigscan_scan_tree_arena libsigscan_scan_tree_arena_t;
+
+struct libsigscan_scan_tree_arena
+{
+	/* The nodes
+	 */
+	libsigscan_scan_tree_arena_node_t *nodes;
+
+	/* The number of nodes
+	 */
+	uint32_t number_of_nodes;
+
+	/* The references
+	 * contains the references values of the nodes, depending on the node layout:
+	 * dense:  256 byte value references
+	 * list:   the sorted byte values, packed 4 per 32-bit value, followed by their references
+	 * bitmap: a 256-bit byte value bitmap, 8 bytes with the number of bits set
+	 *         preceding every 32-bit bitmap value, followed by the references
+	 */
+	uint32_t *references;
+
+	/* The number of references
+	 */
+	uint32_t number_of_references;
+
+	/* The signatures
+	 * contains the signatures of the signature references
+	 */
+	libsigscan_signature_t **signatures;
+
+	/* The number of signatures
+	 */
+	uint32_t number_of_signatures;
+
+	/* The leaves
+	 * contains the compiled match values of the signatures
+	 * or NULL if the scan tree arena was not compiled
+	 */
+	libsigscan_scan_tree_arena_leaf_t *leaves;
+
+	/* The nodes extent
+	 * the largest pattern offset of the nodes + 1
+	 */
+	size64_t nodes_extent;
+
+	/* The root reference
+	 */
+	uint32_t root_reference;
+
+	/* The data flags
+	 * the nodes and references are not freed if referenced
+	 */
+	uint8_t data_flags;
+};
+
+int libsigscan_scan_tree_arena_initialize(
+     libsigscan_scan_tree_arena_t **scan_tree_arena,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_arena_free(
+     libsigscan_scan_tree_arena_t **scan_tree_arena,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_arena_get_node_layout(
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     uint8_t *layout,
+     uint16_t *number_of_byte_values,
+     uint32_t *number_of_references,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_arena_get_number_of_scan_objects(
+     libsigscan_scan_object_t *scan_object,
+     uint32_t *number_of_nodes,
+     uint32_t *number_of_references,
+     uint32_t *number_of_signatures,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_arena_append_scan_object(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     libsigscan_scan_object_t *scan_object,
+     uint32_t *reference,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_arena_build(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     libsigscan_scan_tree_node_t *root_node,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_arena_compile(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_arena_get_number_of_nodes(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     uint32_t *number_of_nodes,
+     libcerror_error_t **error );
+
+uint8_t libsigscan_scan_tree_arena_get_number_of_bits_set(
+         uint32_t value );
+
+uint32_t libsigscan_scan_tree_arena_get_byte_value_reference(
+          libsigscan_scan_tree_arena_t *scan_tree_arena,
+          libsigscan_scan_tree_arena_node_t *node,
+          uint8_t byte_value );
+
+int libsigscan_scan_tree_arena_reference_is_valid(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     uint32_t node_index,
+     uint32_t reference );
+
+int libsigscan_scan_tree_arena_validate(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_arena_scan_buffer_compiled(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     int pattern_offsets_mode,
+     off64_t data_offset,
+     size64_t data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libsigscan_signature_t **signature,
+     int *number_of_visited_nodes,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_arena_scan_buffer(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     int pattern_offsets_mode,
+     off64_t data_offset,
+     size64_t data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libsigscan_signature_t **signature,
+     int *number_of_visited_nodes,
+     libcerror_error_t **error );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+
+int libsigscan_scan_tree_arena_printf(
+     libsigscan_scan_tree_arena_t *scan_tree_arena,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_SCAN_TREE_ARENA_H ) */
+
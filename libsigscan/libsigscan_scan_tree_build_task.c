@@ -0,0 +1,285 @@
+/*
+ * Scan tree build task functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_offsets_list.h"
+#include "libsigscan_scan_tree_build_task.h"
+#include "libsigscan_scan_tree_node.h"
+#include "libsigscan_signature_table.h"
+
+/* Creates a scan tree build task
+ * Make sure the value build_task is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_build_task_initialize(
+     libsigscan_scan_tree_build_task_t **build_task,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_build_task_initialize";
+
+	if( build_task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid build task.",
+		 function );
+
+		return( -1 );
+	}
+	if( *build_task != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid build task value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	*build_task = memory_allocate_structure(
+	               libsigscan_scan_tree_build_task_t );
+
+	if( *build_task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create build task.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *build_task,
+	     0,
+	     sizeof( libsigscan_scan_tree_build_task_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear build task.",
+		 function );
+
+		goto on_error;
+	}
+	( *build_task )->pattern_offsets_mode       = pattern_offsets_mode;
+	( *build_task )->pattern_offsets_range_size = pattern_offsets_range_size;
+	( *build_task )->build_result               = -1;
+
+	return( 1 );
+
+on_error:
+	if( *build_task != NULL )
+	{
+		memory_free(
+		 *build_task );
+
+		*build_task = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scan tree build task
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_build_task_free(
+     libsigscan_scan_tree_build_task_t **build_task,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_build_task_free";
+	int result            = 1;
+
+	if( build_task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid build task.",
+		 function );
+
+		return( -1 );
+	}
+	if( *build_task != NULL )
+	{
+		if( ( *build_task )->scan_tree_node != NULL )
+		{
+			if( libsigscan_scan_tree_node_free(
+			     &( ( *build_task )->scan_tree_node ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free scan tree node.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *build_task )->offsets_ignore_list != NULL )
+		{
+			if( libcdata_list_free(
+			     &( ( *build_task )->offsets_ignore_list ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free offsets ignore list.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *build_task )->signature_table != NULL )
+		{
+			if( libsigscan_signature_table_free(
+			     &( ( *build_task )->signature_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free signature table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *build_task );
+
+		*build_task = NULL;
+	}
+	return( result );
+}
+
+/* Sets the signature table of a scan tree build task
+ * The build task takes over the signature table and uses a copy of the offsets ignore list
+ * so that it can be built independent of the other build tasks
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_build_task_set_signature_table(
+     libsigscan_scan_tree_build_task_t *build_task,
+     libsigscan_signature_table_t **signature_table,
+     libcdata_list_t *offsets_ignore_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_build_task_set_signature_table";
+
+	if( build_task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid build task.",
+		 function );
+
+		return( -1 );
+	}
+	if( build_task->signature_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid build task - signature table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *signature_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing signature table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_clone(
+	     &( build_task->offsets_ignore_list ),
+	     offsets_ignore_list,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libsigscan_offset_clone,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clone offsets ignore list.",
+		 function );
+
+		return( -1 );
+	}
+	build_task->signature_table = *signature_table;
+
+	*signature_table = NULL;
+
+	return( 1 );
+}
+
@@ -0,0 +1,102 @@
+/*
+ * Scan tree build task functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_SCAN_TREE_BUILD_TASK_H )
+#define _LIBSIGSCAN_SCAN_TREE_BUILD_TASK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_scan_tree_node.h"
+#include "libsigscan_signature_table.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_scan_tree_build_task libsigscan_scan_tree_build_task_t;
+
+struct libsigscan_scan_tree_build_task
+{
+	/* The signature table
+	 * not set for a task that builds an entire scan tree
+	 */
+	libsigscan_signature_table_t *signature_table;
+
+	/* The offsets ignore list
+	 * a copy that is only used by the task
+	 */
+	libcdata_list_t *offsets_ignore_list;
+
+	/* The pattern offsets mode
+	 */
+	int pattern_offsets_mode;
+
+	/* The pattern offsets range size
+	 */
+	uint64_t pattern_offsets_range_size;
+
+	/* The number of fallback nodes on the path to the scan tree node
+	 */
+	int number_of_fallback_nodes;
+
+	/* The byte value in the parent scan tree node
+	 */
+	uint8_t byte_value;
+
+	/* Value to indicate the task builds the default value of the parent scan tree node
+	 */
+	uint8_t is_default_value;
+
+	/* The scan tree node that was built
+	 */
+	libsigscan_scan_tree_node_t *scan_tree_node;
+
+	/* The build result
+	 * 1 if built, 0 if there was nothing to build or -1 if not built or the build failed
+	 */
+	int build_result;
+};
+
+int libsigscan_scan_tree_build_task_initialize(
+     libsigscan_scan_tree_build_task_t **build_task,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_build_task_free(
+     libsigscan_scan_tree_build_task_t **build_task,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_build_task_set_signature_table(
+     libsigscan_scan_tree_build_task_t *build_task,
+     libsigscan_signature_table_t **signature_table,
+     libcdata_list_t *offsets_ignore_list,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_SCAN_TREE_BUILD_TASK_H ) */
+
@@ -0,0 +1,508 @@
+/*
+ * Scan tree generation functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcthreads.h"
+#include "libsigscan_scan_tree.h"
+#include "libsigscan_scan_tree_generation.h"
+#include "libsigscan_signature.h"
+
+/* Creates a scan tree generation
+ * Make sure the value generation is referencing, is set to NULL
+ * The generation is created with a single reference
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_generation_initialize(
+     libsigscan_scan_tree_generation_t **generation,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_generation_initialize";
+
+	if( generation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generation.",
+		 function );
+
+		return( -1 );
+	}
+	if( *generation != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid generation value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*generation = memory_allocate_structure(
+	               libsigscan_scan_tree_generation_t );
+
+	if( *generation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create generation.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *generation,
+	     0,
+	     sizeof( libsigscan_scan_tree_generation_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear generation.",
+		 function );
+
+		memory_free(
+		 *generation );
+
+		*generation = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_list_initialize(
+	     &( ( *generation )->retired_signatures_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create retired signatures list.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *generation )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *generation )->number_of_references = 1;
+
+	return( 1 );
+
+on_error:
+	if( *generation != NULL )
+	{
+		if( ( *generation )->retired_signatures_list != NULL )
+		{
+			libcdata_list_free(
+			 &( ( *generation )->retired_signatures_list ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 *generation );
+
+		*generation = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scan tree generation
+ * The scan trees and the retired signatures are freed but not the next generation
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_generation_free(
+     libsigscan_scan_tree_generation_t **generation,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_generation_free";
+	int result            = 1;
+
+	if( generation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generation.",
+		 function );
+
+		return( -1 );
+	}
+	if( *generation != NULL )
+	{
+		if( ( *generation )->header_scan_tree != NULL )
+		{
+			if( libsigscan_scan_tree_free(
+			     &( ( *generation )->header_scan_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free header scan tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *generation )->footer_scan_tree != NULL )
+		{
+			if( libsigscan_scan_tree_free(
+			     &( ( *generation )->footer_scan_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free footer scan tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *generation )->scan_tree != NULL )
+		{
+			if( libsigscan_scan_tree_free(
+			     &( ( *generation )->scan_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free scan tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcdata_list_free(
+		     &( ( *generation )->retired_signatures_list ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free retired signatures list.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *generation )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		/* The next generation is released by libsigscan_scan_tree_generation_release
+		 */
+		memory_free(
+		 *generation );
+
+		*generation = NULL;
+	}
+	return( result );
+}
+
+/* Grabs a reference to a scan tree generation
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_generation_grab(
+     libsigscan_scan_tree_generation_t *generation,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_generation_grab";
+
+	if( generation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generation.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     generation->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	generation->number_of_references += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     generation->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases a reference to a scan tree generation
+ * The generation is freed when its last reference is released, which
+ * releases the reference it holds to the next generation
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_generation_release(
+     libsigscan_scan_tree_generation_t **generation,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_tree_generation_t *next_generation = NULL;
+	libsigscan_scan_tree_generation_t *safe_generation = NULL;
+	static char *function                              = "libsigscan_scan_tree_generation_release";
+	int number_of_references                           = 0;
+	int result                                         = 1;
+
+	if( generation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generation.",
+		 function );
+
+		return( -1 );
+	}
+	safe_generation = *generation;
+
+	*generation = NULL;
+
+	/* The generations are released in a loop instead of recursively
+	 * since the chain of generations can be long
+	 */
+	while( safe_generation != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     safe_generation->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		safe_generation->number_of_references -= 1;
+
+		number_of_references = safe_generation->number_of_references;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     safe_generation->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( number_of_references > 0 )
+		{
+			break;
+		}
+		next_generation = safe_generation->next_generation;
+
+		if( libsigscan_scan_tree_generation_free(
+		     &safe_generation,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free generation.",
+			 function );
+
+			result = -1;
+		}
+		safe_generation = next_generation;
+	}
+	return( result );
+}
+
+/* Sets the next generation of a scan tree generation
+ * The generation holds a reference to the next generation until it is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_generation_set_next_generation(
+     libsigscan_scan_tree_generation_t *generation,
+     libsigscan_scan_tree_generation_t *next_generation,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_generation_set_next_generation";
+
+	if( generation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generation.",
+		 function );
+
+		return( -1 );
+	}
+	if( generation->next_generation != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid generation - next generation value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_tree_generation_grab(
+	     next_generation,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab next generation.",
+		 function );
+
+		return( -1 );
+	}
+	generation->next_generation = next_generation;
+
+	return( 1 );
+}
+
+/* Appends a retired signature to a scan tree generation
+ * The generation takes over management of the signature
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_generation_append_retired_signature(
+     libsigscan_scan_tree_generation_t *generation,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_generation_append_retired_signature";
+
+	if( generation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generation.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_append_value(
+	     generation->retired_signatures_list,
+	     (intptr_t *) signature,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append signature to retired signatures list.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,108 @@
+/*
+ * Scan tree generation functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_SCAN_TREE_GENERATION_H )
+#define _LIBSIGSCAN_SCAN_TREE_GENERATION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcthreads.h"
+#include "libsigscan_scan_tree.h"
+#include "libsigscan_signature.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_scan_tree_generation libsigscan_scan_tree_generation_t;
+
+struct libsigscan_scan_tree_generation
+{
+	/* The header (offset relative from start) scan tree
+	 */
+	libsigscan_scan_tree_t *header_scan_tree;
+
+	/* The footer (offset relative from start) scan tree
+	 */
+	libsigscan_scan_tree_t *footer_scan_tree;
+
+	/* The (unbounded) scan tree
+	 */
+	libsigscan_scan_tree_t *scan_tree;
+
+	/* The retired signatures list
+	 * contains the signatures that were removed from the next generation
+	 * and are freed with this generation
+	 */
+	libcdata_list_t *retired_signatures_list;
+
+	/* The next generation
+	 * a generation holds a reference to the next generation so that
+	 * the generations are freed in order
+	 */
+	libsigscan_scan_tree_generation_t *next_generation;
+
+	/* The number of references
+	 */
+	int number_of_references;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the number of references
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libsigscan_scan_tree_generation_initialize(
+     libsigscan_scan_tree_generation_t **generation,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_generation_free(
+     libsigscan_scan_tree_generation_t **generation,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_generation_grab(
+     libsigscan_scan_tree_generation_t *generation,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_generation_release(
+     libsigscan_scan_tree_generation_t **generation,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_generation_set_next_generation(
+     libsigscan_scan_tree_generation_t *generation,
+     libsigscan_scan_tree_generation_t *next_generation,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_generation_append_retired_signature(
+     libsigscan_scan_tree_generation_t *generation,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_SCAN_TREE_GENERATION_H ) */
+
@@ -179,6 +179,173 @@ int libsigscan_scan_tree_node_free(
 	return( result );
 }
 
+/* Frees a scan tree node without its sub nodes
+ * The scan objects of the scan tree node are freed but not their values
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_node_free_single(
+     libsigscan_scan_tree_node_t **scan_tree_node,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_node_free_single";
+	uint16_t byte_value   = 0;
+
+	if( scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_tree_node != NULL )
+	{
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			if( ( *scan_tree_node )->scan_objects_table[ byte_value ] != NULL )
+			{
+				memory_free(
+				 ( *scan_tree_node )->scan_objects_table[ byte_value ] );
+			}
+		}
+		if( ( *scan_tree_node )->default_scan_object != NULL )
+		{
+			memory_free(
+			 ( *scan_tree_node )->default_scan_object );
+		}
+		memory_free(
+		 *scan_tree_node );
+
+		*scan_tree_node = NULL;
+	}
+	return( 1 );
+}
+
+/* Copies a scan tree node
+ * The copy has its own scan objects that reference the same values as the scan objects
+ * of the source scan tree node, hence the sub nodes are shared
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_node_copy(
+     libsigscan_scan_tree_node_t **destination_scan_tree_node,
+     libsigscan_scan_tree_node_t *source_scan_tree_node,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_object_t *source_scan_object = NULL;
+	static char *function                        = "libsigscan_scan_tree_node_copy";
+	uint16_t byte_value                          = 0;
+
+	if( destination_scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_scan_tree_node != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination scan tree node value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_tree_node_initialize(
+	     destination_scan_tree_node,
+	     source_scan_tree_node->pattern_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination scan tree node.",
+		 function );
+
+		goto on_error;
+	}
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		source_scan_object = source_scan_tree_node->scan_objects_table[ byte_value ];
+
+		if( source_scan_object == NULL )
+		{
+			continue;
+		}
+		if( libsigscan_scan_object_initialize(
+		     &( ( *destination_scan_tree_node )->scan_objects_table[ byte_value ] ),
+		     source_scan_object->type,
+		     source_scan_object->value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan object for byte value: 0x%02" PRIx16 ".",
+			 function,
+			 byte_value );
+
+			goto on_error;
+		}
+	}
+	source_scan_object = source_scan_tree_node->default_scan_object;
+
+	if( source_scan_object != NULL )
+	{
+		if( libsigscan_scan_object_initialize(
+		     &( ( *destination_scan_tree_node )->default_scan_object ),
+		     source_scan_object->type,
+		     source_scan_object->value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create default scan object.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_scan_tree_node != NULL )
+	{
+		libsigscan_scan_tree_node_free_single(
+		 destination_scan_tree_node,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Sets a scan object for a specific byte value
  * Returns 1 if successful or -1 on error
  */
@@ -339,6 +506,8 @@ int libsigscan_scan_tree_node_scan_buffer(
      libsigscan_scan_object_t **scan_object,
      libcerror_error_t **error )
 {
+	libsigscan_scan_tree_node_t *fallback_scan_tree_nodes[ LIBSIGSCAN_SCAN_TREE_NODE_MAXIMUM_NUMBER_OF_FALLBACK_NODES ];
+
 	libsigscan_signature_t *signature = NULL;
 	static char *function             = "libsigscan_scan_tree_node_scan_buffer";
 	off64_t pattern_offset            = 0;
@@ -346,7 +515,9 @@ int libsigscan_scan_tree_node_scan_buffer(
 	size64_t remaining_data_size      = 0;
 	uint8_t byte_value                = 0;
 	uint8_t scan_object_type          = 0;
+	int number_of_fallback_nodes      = 0;
 	int result                        = 0;
+	int use_default_scan_object       = 0;
 
 	if( scan_tree_node == NULL )
 	{
@@ -434,10 +605,23 @@ int libsigscan_scan_tree_node_scan_buffer(
 		}
 		scan_offset = (off64_t) ( buffer_offset + scan_tree_node->pattern_offset );
 
-		if( (size64_t) scan_offset >= remaining_data_size )
+		if( use_default_scan_object != 0 )
+		{
+			/* Fall back to the default scan object of a previously visited node
+			 */
+			*scan_object = scan_tree_node->default_scan_object;
+			result       = 1;
+
+			use_default_scan_object = 0;
+		}
+		else if( ( (size64_t) scan_tree_node->pattern_offset >= remaining_data_size )
+		 || ( ( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+		  &&  ( scan_offset >= (off64_t) buffer_size ) ) )
 		{
 			/* If the pattern offset exceeds the data size
 			 * continue with the default scan object if available.
+			 * For unbound signatures the buffer can end before
+			 * the data size if no more data is available.
 			 */
 			*scan_object = scan_tree_node->default_scan_object;
 			result       = ( *scan_object != NULL );
@@ -463,6 +647,16 @@ int libsigscan_scan_tree_node_scan_buffer(
 			          scan_object,
 			          error );
 
+			if( ( result == 1 )
+			 && ( scan_tree_node->scan_objects_table[ byte_value ] != NULL )
+			 && ( scan_tree_node->default_scan_object != NULL )
+			 && ( number_of_fallback_nodes < LIBSIGSCAN_SCAN_TREE_NODE_MAXIMUM_NUMBER_OF_FALLBACK_NODES ) )
+			{
+				/* Retain the node so that its default scan object can be tried
+				 * if the byte value specific scan object does not match
+				 */
+				fallback_scan_tree_nodes[ number_of_fallback_nodes++ ] = scan_tree_node;
+			}
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -574,56 +768,77 @@ int libsigscan_scan_tree_node_scan_buffer(
 				{
 					pattern_offset = data_size - signature->pattern_offset;
 				}
-				scan_offset = buffer_offset + ( pattern_offset - data_offset );
-
-				if( ( (size64_t) signature->pattern_size > remaining_data_size )
-				 || ( (size64_t) scan_offset > ( remaining_data_size - signature->pattern_size ) ) )
+				else
 				{
-					/* If the pattern size exceeds the data size were are done scanning.
+					/* Unbound signatures are matched at the data offset
 					 */
-					result = 0;
-
-					break;
-				}
-				if( ( signature->pattern_size > buffer_size )
-				 || ( (size64_t) scan_offset > ( buffer_size - signature->pattern_size ) ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid pattern size value out of bounds.",
-					 function );
-
-					return( -1 );
+					pattern_offset = data_offset;
 				}
-				if( memory_compare(
-				     &( buffer[ scan_offset ] ),
-				     signature->pattern,
-				     signature->pattern_size ) != 0 )
+				if( ( (size64_t) signature->pattern_size > remaining_data_size )
+				 || ( (size64_t) ( pattern_offset - data_offset ) > ( remaining_data_size - signature->pattern_size ) ) )
 				{
+					/* If the pattern size exceeds the data size the signature cannot match.
+					 */
 					result = 0;
-
-					break;
 				}
-				scan_offset += data_offset;
+				else
+				{
+					scan_offset = buffer_offset + ( pattern_offset - data_offset );
 
+					if( ( signature->pattern_size > buffer_size )
+					 || ( (size64_t) scan_offset > ( buffer_size - signature->pattern_size ) ) )
+					{
+						if( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid pattern size value out of bounds.",
+							 function );
+
+							return( -1 );
+						}
+						/* If no more data is available the unbound signature cannot match.
+						 */
+						result = 0;
+					}
+					else if( memory_compare(
+					          &( buffer[ scan_offset ] ),
+					          signature->pattern,
+					          signature->pattern_size ) != 0 )
+					{
+						result = 0;
+					}
+					else
+					{
 #if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: offset: %" PRIi64 " signature: %s.\n",
-					 function,
-					 scan_offset,
-					 signature->identifier );
-				}
+						if( libcnotify_verbose != 0 )
+						{
+							libcnotify_printf(
+							 "%s: offset: %" PRIi64 " signature: %s.\n",
+							 function,
+							 pattern_offset,
+							 signature->identifier );
+						}
 #endif
-/* TODO add support for unbounded signatures */
-				result = ( scan_offset == pattern_offset );
+						result = 1;
 
-				break;
+						break;
+					}
+				}
 			}
 		}
+		if( ( result == 0 )
+		 && ( number_of_fallback_nodes > 0 ) )
+		{
+			/* If the byte value specific scan object did not match
+			 * continue with the default scan object of the deepest retained node.
+			 */
+			scan_tree_node          = fallback_scan_tree_nodes[ --number_of_fallback_nodes ];
+			use_default_scan_object = 1;
+			result                  = 1;
+		}
 	}
 	while( result != 0 );
 
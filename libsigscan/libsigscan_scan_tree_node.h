@@ -32,6 +32,11 @@
 extern "C" {
 #endif
 
+/* The maximum number of scan tree nodes of which the default scan object
+ * is retained to fall back to when a more specific scan object does not match
+ */
+#define LIBSIGSCAN_SCAN_TREE_NODE_MAXIMUM_NUMBER_OF_FALLBACK_NODES	32
+
 typedef struct libsigscan_scan_tree_node libsigscan_scan_tree_node_t;
 
 struct libsigscan_scan_tree_node
@@ -58,6 +63,15 @@ int libsigscan_scan_tree_node_free(
      libsigscan_scan_tree_node_t **scan_tree_node,
      libcerror_error_t **error );
 
+int libsigscan_scan_tree_node_free_single(
+     libsigscan_scan_tree_node_t **scan_tree_node,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_node_copy(
+     libsigscan_scan_tree_node_t **destination_scan_tree_node,
+     libsigscan_scan_tree_node_t *source_scan_tree_node,
+     libcerror_error_t **error );
+
 int libsigscan_scan_tree_node_set_byte_value(
      libsigscan_scan_tree_node_t *scan_tree_node,
      uint8_t byte_value,
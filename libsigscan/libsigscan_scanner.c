@@ -25,22 +25,29 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libsigscan_byte_value_profile.h"
+#include "libsigscan_chunked_scan.h"
 #include "libsigscan_definitions.h"
 #include "libsigscan_libbfio.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_libcnotify.h"
+#include "libsigscan_libcthreads.h"
+#include "libsigscan_mapped_file.h"
+#include "libsigscan_read_request.h"
 #include "libsigscan_scanner.h"
 #include "libsigscan_scan_state.h"
 #include "libsigscan_scan_tree.h"
+#include "libsigscan_scanner_image.h"
 #include "libsigscan_signature.h"
+#include "libsigscan_skip_table.h"
 #include "libsigscan_types.h"
 
 /* Creates a scanner
  * Make sure the value scanner is referencing, is set to NULL
  *
- * Currently only supports "bounded" sigatures (signatures with a fixed offset).
- * Unbounded signatures can be set but will be ignored.
+ * Supports both "bounded" signatures (signatures with a fixed offset)
+ * and "unbounded" signatures (signatures without an offset).
  *
  * Returns 1 if successful or -1 on error
  */
@@ -117,7 +124,24 @@ int libsigscan_scanner_initialize(
 
 		goto on_error;
 	}
-	internal_scanner->buffer_size = LIBSIGSCAN_DEFAULT_SCAN_BUFFER_SIZE;
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_scanner->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_scanner->buffer_size             = LIBSIGSCAN_DEFAULT_SCAN_BUFFER_SIZE;
+	internal_scanner->unbound_scan_engine     = LIBSIGSCAN_UNBOUND_SCAN_ENGINE_AUTOMATIC;
+	internal_scanner->number_of_build_workers = LIBSIGSCAN_DEFAULT_NUMBER_OF_BUILD_WORKERS;
 
 	*scanner = (libsigscan_scanner_t *) internal_scanner;
 
@@ -166,6 +190,44 @@ int libsigscan_scanner_free(
 		internal_scanner = (libsigscan_internal_scanner_t *) *scanner;
 		*scanner         = NULL;
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_scanner->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		/* The scan trees of a compiled scanner are owned by its generation
+		 * and are freed when the last scan state that uses them is released
+		 */
+		if( internal_scanner->generation != NULL )
+		{
+			internal_scanner->header_scan_tree = NULL;
+			internal_scanner->footer_scan_tree = NULL;
+			internal_scanner->scan_tree        = NULL;
+
+			if( libsigscan_scan_tree_generation_release(
+			     &( internal_scanner->generation ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release scan tree generation.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( internal_scanner->header_scan_tree != NULL )
 		{
 			if( libsigscan_scan_tree_free(
@@ -214,6 +276,40 @@ int libsigscan_scanner_free(
 				result = -1;
 			}
 		}
+		/* The scanner image is freed after the scan trees since they reference its data
+		 */
+		if( internal_scanner->scanner_image != NULL )
+		{
+			if( libsigscan_scanner_image_free(
+			     &( internal_scanner->scanner_image ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free scanner image.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_scanner->byte_value_profile != NULL )
+		{
+			if( libsigscan_byte_value_profile_free(
+			     &( internal_scanner->byte_value_profile ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free byte value profile.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcdata_list_free(
 		     &( internal_scanner->signatures_list ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
@@ -263,6 +359,7 @@ int libsigscan_scanner_signal_abort(
 }
 
 /* Sets the scan buffer size
+ * The scan buffer size cannot be changed after the scanner is compiled
  * Returns 1 if successful or -1 on error
  */
 int libsigscan_scanner_set_scan_buffer_size(
@@ -286,6 +383,17 @@ int libsigscan_scanner_set_scan_buffer_size(
 	}
 	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
 
+	if( internal_scanner->is_compiled != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scanner is compiled.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( scan_buffer_size == 0 )
 	 || ( scan_buffer_size > (size_t) SSIZE_MAX ) )
 	{
@@ -303,22 +411,18 @@ int libsigscan_scanner_set_scan_buffer_size(
 	return( 1 );
 }
 
-/* Adds a signature
- * Returns 1 if successful, 0 if signature already exists or -1 on error
+/* Sets the unbound scan engine
+ * The scan engine is used to scan for signatures without an offset
+ * and must be set before the first scan is started
+ * Returns 1 if successful or -1 on error
  */
-int libsigscan_scanner_add_signature(
+int libsigscan_scanner_set_unbound_scan_engine(
      libsigscan_scanner_t *scanner,
-     const char *identifier,
-     size_t identifier_length,
-     off64_t pattern_offset,
-     const uint8_t *pattern,
-     size_t pattern_size,
-     uint32_t signature_flags,
+     int unbound_scan_engine,
      libcerror_error_t **error )
 {
 	libsigscan_internal_scanner_t *internal_scanner = NULL;
-	libsigscan_signature_t *signature               = NULL;
-	static char *function                           = "libsigscan_scanner_add_signature";
+	static char *function                           = "libsigscan_scanner_set_unbound_scan_engine";
 
 	if( scanner == NULL )
 	{
@@ -333,125 +437,158 @@ int libsigscan_scanner_add_signature(
 	}
 	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
 
-	if( internal_scanner->header_scan_tree != NULL )
+	if( internal_scanner->is_compiled != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid scanner - header scan tree already set.",
+		 "%s: invalid scanner - scanner is compiled.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_scanner->footer_scan_tree != NULL )
+	if( internal_scanner->scan_tree != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid scanner - footer scan tree already set.",
+		 "%s: invalid scanner - scan tree value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_scanner->scan_tree != NULL )
+	if( ( unbound_scan_engine != LIBSIGSCAN_UNBOUND_SCAN_ENGINE_AUTOMATIC )
+	 && ( unbound_scan_engine != LIBSIGSCAN_UNBOUND_SCAN_ENGINE_SCAN_TREE )
+	 && ( unbound_scan_engine != LIBSIGSCAN_UNBOUND_SCAN_ENGINE_AHO_CORASICK ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid scanner - scan tree already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported unbound scan engine.",
 		 function );
 
 		return( -1 );
 	}
-	/* For now unbound signatures should not be be smaller than 4 bytes
-	 * otherwise the skip value has little to no effect
-	 */
-	if( ( ( signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET )
-	 && ( pattern_size < 4 ) )
+	internal_scanner->unbound_scan_engine = unbound_scan_engine;
+
+	return( 1 );
+}
+
+/* Retrieves the skip table type of the unbound scan tree
+ * The skip table is determined when the first scan is started
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libsigscan_scanner_get_unbound_skip_table_type(
+     libsigscan_scanner_t *scanner,
+     int *skip_table_type,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_get_unbound_skip_table_type";
+
+	if( scanner == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid pattern value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
 		 function );
 
 		return( -1 );
 	}
-	if( libsigscan_signature_initialize(
-	     &signature,
-	     error ) != 1 )
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( skip_table_type == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create signature.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table type.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libsigscan_signature_set(
-	     signature,
-	     identifier,
-	     identifier_length,
-	     pattern_offset,
-	     pattern,
-	     pattern_size,
-	     signature_flags,
+	if( ( internal_scanner->scan_tree == NULL )
+	 || ( internal_scanner->scan_tree->skip_table == NULL )
+	 || ( internal_scanner->scan_tree->aho_corasick != NULL ) )
+	{
+		return( 0 );
+	}
+	if( libsigscan_skip_table_get_table_type(
+	     internal_scanner->scan_tree->skip_table,
+	     skip_table_type,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set signature values.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve skip table type.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_list_append_value(
-	     internal_scanner->signatures_list,
-	     (intptr_t *) signature,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Retrieves the number of build workers
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_get_number_of_build_workers(
+     libsigscan_scanner_t *scanner,
+     int *number_of_build_workers,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_get_number_of_build_workers";
+
+	if( scanner == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append signature to signatures list.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	signature = NULL;
-
-	return( 1 );
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
 
-on_error:
-	if( signature != NULL )
+	if( number_of_build_workers == NULL )
 	{
-		libsigscan_signature_initialize(
-		 &signature,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of build workers.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	*number_of_build_workers = internal_scanner->number_of_build_workers;
+
+	return( 1 );
 }
 
-/* Starts the scan
+/* Sets the number of build workers
+ * When more than 1 worker is set the header, footer and unbound scan trees
+ * and the sub trees of their root nodes are built in parallel
+ * The number of build workers cannot be changed after the scanner is compiled
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scanner_scan_start(
+int libsigscan_scanner_set_number_of_build_workers(
      libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
+     int number_of_build_workers,
      libcerror_error_t **error )
 {
 	libsigscan_internal_scanner_t *internal_scanner = NULL;
-	static char *function                           = "libsigscan_scanner_scan_start";
-	int result                                      = 0;
+	static char *function                           = "libsigscan_scanner_set_number_of_build_workers";
 
 	if( scanner == NULL )
 	{
@@ -466,149 +603,46 @@ int libsigscan_scanner_scan_start(
 	}
 	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
 
-	if( internal_scanner->header_scan_tree == NULL )
+	if( internal_scanner->is_compiled != 0 )
 	{
-		if( libsigscan_scan_tree_initialize(
-		     &( internal_scanner->header_scan_tree ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create header scan tree.",
-			 function );
-
-			return( -1 );
-		}
-		result = libsigscan_scan_tree_build(
-		          internal_scanner->header_scan_tree,
-		          internal_scanner->signatures_list,
-		          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to build header scan tree.",
-			 function );
-
-			libsigscan_scan_tree_free(
-			 &( internal_scanner->header_scan_tree ),
-			 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scanner is compiled.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	if( internal_scanner->footer_scan_tree == NULL )
+	if( ( number_of_build_workers < 1 )
+	 || ( number_of_build_workers > LIBSIGSCAN_MAXIMUM_NUMBER_OF_BUILD_WORKERS ) )
 	{
-		if( libsigscan_scan_tree_initialize(
-		     &( internal_scanner->footer_scan_tree ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create footer scan tree.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of build workers value out of bounds.",
+		 function );
 
-			return( -1 );
-		}
-		result = libsigscan_scan_tree_build(
-		          internal_scanner->footer_scan_tree,
-		          internal_scanner->signatures_list,
-		          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END,
-		          error );
+		return( -1 );
+	}
+	internal_scanner->number_of_build_workers = number_of_build_workers;
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to build footer scan tree.",
-			 function );
+	return( 1 );
+}
 
-			libsigscan_scan_tree_free(
-			 &( internal_scanner->footer_scan_tree ),
-			 NULL );
-
-			return( -1 );
-		}
-	}
-#ifdef TODO_UNBOUND_SUPPORT
-	if( internal_scanner->scan_tree == NULL )
-	{
-		if( libsigscan_scan_tree_initialize(
-		     &( internal_scanner->scan_tree ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create scan tree.",
-			 function );
-
-			return( -1 );
-		}
-		result = libsigscan_scan_tree_build(
-		          internal_scanner->scan_tree,
-		          internal_scanner->signatures_list,
-		          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to build scan tree.",
-			 function );
-
-			libsigscan_scan_tree_free(
-			 &( internal_scanner->scan_tree ),
-			 NULL );
-
-			return( -1 );
-		}
-	}
-#endif /* TODO_UNBOUND_SUPPORT */
-
-	if( libsigscan_scan_state_start(
-	     scan_state,
-	     internal_scanner->header_scan_tree,
-	     internal_scanner->footer_scan_tree,
-	     internal_scanner->scan_tree,
-	     internal_scanner->buffer_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set scan state.",
-		 function );
-
-		return( -1 );
-	}
-	return( 1 );
-}
-
-/* Stops the scan
- * Returns 1 if successful or -1 on error
+/* Retrieves the byte value profile
+ * The byte value profile consists of the number of occurrences of each of the 256 byte values
+ * Returns 1 if successful, 0 if no byte value profile is set or -1 on error
  */
-int libsigscan_scanner_scan_stop(
+int libsigscan_scanner_get_byte_value_profile(
      libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
+     uint64_t *byte_value_counts,
+     int number_of_byte_values,
      libcerror_error_t **error )
 {
-	static char *function = "libsigscan_scanner_scan_stop";
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_get_byte_value_profile";
 
 	if( scanner == NULL )
 	{
@@ -621,56 +655,23 @@ int libsigscan_scanner_scan_stop(
 
 		return( -1 );
 	}
-	if( libsigscan_scan_state_stop(
-	     scan_state,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set scan state.",
-		 function );
-
-		return( -1 );
-	}
-	return( 1 );
-}
-
-/* Scans a buffer
- * Returns 1 if successful or -1 on error
- */
-int libsigscan_scanner_scan_buffer(
-     libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
-     const uint8_t *buffer,
-     size_t buffer_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libsigscan_scanner_scan_buffer";
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
 
-	if( scanner == NULL )
+	if( internal_scanner->byte_value_profile == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid scanner.",
-		 function );
-
-		return( -1 );
+		return( 0 );
 	}
-	if( libsigscan_scan_state_scan_buffer(
-	     scan_state,
-	     buffer,
-	     buffer_size,
+	if( libsigscan_byte_value_profile_get_byte_value_counts(
+	     internal_scanner->byte_value_profile,
+	     byte_value_counts,
+	     number_of_byte_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to scan buffer.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve byte value counts.",
 		 function );
 
 		return( -1 );
@@ -678,18 +679,23 @@ int libsigscan_scanner_scan_buffer(
 	return( 1 );
 }
 
-/* Scans a file
+/* Sets the byte value profile
+ * The byte value profile consists of the number of occurrences of each of the 256 byte values
+ * in data that is representative of the scanned data. When set, the scan trees are shaped
+ * to first test the pattern offsets that are least likely to match the scanned data
+ * Byte value counts that are all 0 remove the byte value profile
+ * The byte value profile cannot be changed after the scanner is compiled
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scanner_scan_file(
+int libsigscan_scanner_set_byte_value_profile(
      libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
-     const char *filename,
+     const uint64_t *byte_value_counts,
+     int number_of_byte_values,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libsigscan_scanner_scan_file";
-	size_t filename_length           = 0;
+	libsigscan_byte_value_profile_t *byte_value_profile = NULL;
+	libsigscan_internal_scanner_t *internal_scanner     = NULL;
+	static char *function                               = "libsigscan_scanner_set_byte_value_profile";
 
 	if( scanner == NULL )
 	{
@@ -702,119 +708,106 @@ int libsigscan_scanner_scan_file(
 
 		return( -1 );
 	}
-	if( filename == NULL )
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( internal_scanner->is_compiled != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scanner is compiled.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
+	if( libsigscan_byte_value_profile_initialize(
+	     &byte_value_profile,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 "%s: unable to create byte value profile.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
+	if( libsigscan_byte_value_profile_set_byte_value_counts(
+	     byte_value_profile,
+	     byte_value_counts,
+	     number_of_byte_values,
 	     error ) != 1 )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set byte value counts.",
+		 function );
 
 		goto on_error;
 	}
-#endif
-	filename_length = narrow_string_length(
-	                   filename );
-
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
+	if( byte_value_profile->number_of_bytes == 0 )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+		if( libsigscan_byte_value_profile_free(
+		     &byte_value_profile,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free byte value profile.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	if( libsigscan_scanner_scan_file_io_handle(
-	     scanner,
-	     scan_state,
-	     file_io_handle,
-	     error ) != 1 )
+	if( internal_scanner->byte_value_profile != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %s.",
-		 function,
-		 filename );
+		if( libsigscan_byte_value_profile_free(
+		     &( internal_scanner->byte_value_profile ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free byte value profile.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	if( libbfio_handle_free(
-	     &file_io_handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file IO handle.",
-		 function );
+	internal_scanner->byte_value_profile = byte_value_profile;
 
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
-	if( file_io_handle != NULL )
+	if( byte_value_profile != NULL )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
+		libsigscan_byte_value_profile_free(
+		 &byte_value_profile,
 		 NULL );
 	}
 	return( -1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Scans a file
+/* Adds data to the byte value profile
+ * The byte value profile is created if it does not exist
+ * The byte value profile cannot be changed after the scanner is compiled
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scanner_scan_file_wide(
+int libsigscan_scanner_add_byte_value_profile_data(
      libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
-     const wchar_t *filename,
+     const uint8_t *buffer,
+     size_t buffer_size,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libsigscan_scanner_scan_file_wide";
-	size_t filename_length           = 0;
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_add_byte_value_profile_data";
 
 	if( scanner == NULL )
 	{
@@ -827,133 +820,100 @@ int libsigscan_scanner_scan_file_wide(
 
 		return( -1 );
 	}
-	if( filename == NULL )
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( internal_scanner->is_compiled != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scanner is compiled.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	if( buffer_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
+	if( buffer_size == 0 )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
-
-		goto on_error;
+		return( 1 );
 	}
-#endif
-	filename_length = wide_string_length(
-	                   filename );
-
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
-
-		goto on_error;
-	}
-	if( libsigscan_scanner_scan_file_io_handle(
-	     scanner,
-	     scan_state,
-	     file_io_handle,
-	     error ) != 1 )
+	if( internal_scanner->byte_value_profile == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %ls.",
-		 function,
-		 filename );
+		if( libsigscan_byte_value_profile_initialize(
+		     &( internal_scanner->byte_value_profile ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create byte value profile.",
+			 function );
 
-		goto on_error;
+			return( -1 );
+		}
 	}
-	if( libbfio_handle_free(
-	     &file_io_handle,
+	if( libsigscan_byte_value_profile_add_data(
+	     internal_scanner->byte_value_profile,
+	     buffer,
+	     buffer_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add data to byte value profile.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( -1 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Scans a file using a Basic File IO (bfio) handle
- * Returns 1 if successful or -1 on error
+/* Adds a signature
+ * A signature added after the scanner was compiled results in the same scan
+ * results as a compile with the signature, except that if several header or
+ * several footer signatures match, another one of them can be reported
+ * Returns 1 if successful, 0 if signature already exists or -1 on error
  */
-int libsigscan_scanner_scan_file_io_handle(
+int libsigscan_scanner_add_signature(
      libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
-     libbfio_handle_t *file_io_handle,
+     const char *identifier,
+     size_t identifier_length,
+     off64_t pattern_offset,
+     const uint8_t *pattern,
+     size_t pattern_size,
+     uint32_t signature_flags,
      libcerror_error_t **error )
 {
+	libcdata_list_element_t *list_element           = NULL;
 	libsigscan_internal_scanner_t *internal_scanner = NULL;
-	uint8_t *buffer                                 = NULL;
-	static char *function                           = "libsigscan_scanner_scan_file_io_handle";
-	size64_t file_size                              = 0;
-	uint64_t footer_range_end                       = 0;
-	uint64_t footer_range_size                      = 0;
-	uint64_t footer_range_start                     = 0;
-	uint64_t header_range_end                       = 0;
-	uint64_t header_range_size                      = 0;
-	uint64_t header_range_start                     = 0;
-	size_t buffer_size                              = 0;
-	size_t read_size                                = 0;
-	ssize_t read_count                              = 0;
-	int file_io_handle_is_open                      = 0;
-	int has_footer_range                            = 0;
-	int has_header_range                            = 0;
-	int result                                      = 0;
+	libsigscan_signature_t *signature               = NULL;
+	static char *function                           = "libsigscan_scanner_add_signature";
+	int result                                      = 1;
 
 	if( scanner == NULL )
 	{
@@ -968,414 +928,4984 @@ int libsigscan_scanner_scan_file_io_handle(
 	}
 	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
 
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
-
-	if( file_io_handle_is_open == -1 )
+	if( internal_scanner->scanner_image != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to determine if file IO handle is open.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scanner image already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( file_io_handle_is_open == 0 )
+	/* Scan trees that were built by a failed compilation are not updated
+	 */
+	if( ( internal_scanner->is_compiled == 0 )
+	 && ( ( internal_scanner->header_scan_tree != NULL )
+	  || ( internal_scanner->footer_scan_tree != NULL )
+	  || ( internal_scanner->scan_tree != NULL ) ) )
 	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     LIBBFIO_ACCESS_FLAG_READ,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scan tree already set.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &file_size,
-	     error ) != 1 )
+	/* For now unbound signatures should not be be smaller than 4 bytes
+	 * otherwise the skip value has little to no effect
+	 */
+	if( ( ( signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET )
+	 && ( pattern_size < 4 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid pattern value too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libsigscan_scan_state_set_data_size(
-	     scan_state,
-	     file_size,
+	if( libsigscan_signature_initialize(
+	     &signature,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set data size.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create signature.",
 		 function );
 
 		goto on_error;
 	}
-	if( libsigscan_scanner_scan_start(
-	     scanner,
-	     scan_state,
+	if( libsigscan_signature_set(
+	     signature,
+	     identifier,
+	     identifier_length,
+	     pattern_offset,
+	     pattern,
+	     pattern_size,
+	     signature_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set scan state.",
+		 "%s: unable to set signature values.",
 		 function );
 
 		goto on_error;
 	}
-	if( internal_scanner->header_scan_tree == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid sacnner - missing header scan tree.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		goto on_error;
 	}
-	if( internal_scanner->footer_scan_tree == NULL )
+#endif
+	signature->signature_index = internal_scanner->next_signature_index;
+
+	if( libcdata_list_append_value(
+	     internal_scanner->signatures_list,
+	     (intptr_t *) signature,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid sacnner - missing footer scan tree.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append signature to signatures list.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	if( libsigscan_scan_state_get_buffer_size(
-	     scan_state,
-	     &buffer_size,
+	else if( internal_scanner->is_compiled != 0 )
+	{
+		/* A signature that is added after compilation is inserted into
+		 * a next generation of the scan trees
+		 */
+		if( libsigscan_internal_scanner_update_scan_trees(
+		     internal_scanner,
+		     signature,
+		     LIBSIGSCAN_SCAN_TREE_UPDATE_TYPE_INSERT_SIGNATURE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update scan trees.",
+			 function );
+
+			result = -1;
+		}
+		if( result != 1 )
+		{
+			/* The signature was appended as the last element of the signatures list
+			 * and cannot be freed when it remains in the signatures list
+			 */
+			if( libcdata_list_get_last_element(
+			     internal_scanner->signatures_list,
+			     &list_element,
+			     NULL ) != 1 )
+			{
+				signature = NULL;
+			}
+			else if( libcdata_list_remove_element(
+			          internal_scanner->signatures_list,
+			          list_element,
+			          NULL ) != 1 )
+			{
+				signature = NULL;
+			}
+			else
+			{
+				libcdata_list_element_free(
+				 &list_element,
+				 NULL,
+				 NULL );
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		internal_scanner->next_signature_index += 1;
+
+		signature = NULL;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_scanner->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to retrieve scan buffer size.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		goto on_error;
 	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * buffer_size );
-
-	if( buffer == NULL )
+#endif
+	if( result != 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create scan buffer.",
-		 function );
-
 		goto on_error;
 	}
-	result = libsigscan_scan_state_get_header_range(
-	          scan_state,
-	          &header_range_start,
-	          &header_range_end,
-	          &header_range_size,
-	          error );
+	return( 1 );
 
-	if( result == -1 )
+on_error:
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Removes a signature
+ * The signature remains available to scans that already started
+ * Returns 1 if successful, 0 if no such signature or -1 on error
+ */
+int libsigscan_scanner_remove_signature(
+     libsigscan_scanner_t *scanner,
+     const char *identifier,
+     size_t identifier_length,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element           = NULL;
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	libsigscan_signature_t *signature               = NULL;
+	static char *function                           = "libsigscan_scanner_remove_signature";
+	int result                                      = 0;
+
+	if( scanner == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve header range.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	has_header_range = result;
-
-	result = libsigscan_scan_state_get_footer_range(
-	          scan_state,
-	          &footer_range_start,
-	          &footer_range_end,
-	          &footer_range_size,
-	          error );
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
 
-	if( result == -1 )
+	if( internal_scanner->scanner_image != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve footer range.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scanner image already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	has_footer_range = result;
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( identifier_length == 0 )
+	 || ( identifier_length > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid identifier length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier[ identifier_length - 1 ] == 0 )
+	{
+		identifier_length -= 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_list_get_first_element(
+	     internal_scanner->signatures_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first signature list element.",
+		 function );
+
+		result = -1;
+	}
+	while( ( result == 0 )
+	    && ( list_element != NULL ) )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature from list element.",
+			 function );
+
+			result = -1;
+		}
+		else if( ( signature != NULL )
+		      && ( signature->identifier_size == ( identifier_length + 1 ) )
+		      && ( memory_compare(
+		            signature->identifier,
+		            identifier,
+		            identifier_length ) == 0 ) )
+		{
+			result = 1;
+		}
+		else if( libcdata_list_element_get_next_element(
+		          list_element,
+		          &list_element,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next signature list element.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libcdata_list_remove_element(
+		     internal_scanner->signatures_list,
+		     list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove signature list element.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			libcdata_list_element_free(
+			 &list_element,
+			 NULL,
+			 NULL );
+		}
+	}
+	if( ( result == 1 )
+	 && ( internal_scanner->is_compiled != 0 ) )
+	{
+		/* The signature is retired with the current generation of the scan trees
+		 */
+		if( libsigscan_internal_scanner_update_scan_trees(
+		     internal_scanner,
+		     signature,
+		     LIBSIGSCAN_SCAN_TREE_UPDATE_TYPE_REMOVE_SIGNATURE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update scan trees.",
+			 function );
+
+			/* The signature is restored at the end of the signatures list
+			 * since the signatures are identified by their signature index
+			 */
+			libcdata_list_append_value(
+			 internal_scanner->signatures_list,
+			 (intptr_t *) signature,
+			 NULL );
+
+			result = -1;
+		}
+		signature = NULL;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	/* A signature that is removed before compilation is not referenced
+	 */
+	if( ( result == 1 )
+	 && ( signature != NULL ) )
+	{
+		if( libsigscan_signature_free(
+		     &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free signature.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the number of signatures
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_get_number_of_signatures(
+     libsigscan_scanner_t *scanner,
+     int *number_of_signatures,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_get_number_of_signatures";
+	int result                                      = 1;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( number_of_signatures == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of signatures.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scanner->scanner_image != NULL )
+	{
+		*number_of_signatures = (int) internal_scanner->scanner_image->number_of_signatures;
+
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_list_get_number_of_elements(
+	     internal_scanner->signatures_list,
+	     number_of_signatures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of signatures.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific signature
+ * The signature index is the index that is used in the scan results
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_get_signature_by_index(
+     libsigscan_internal_scanner_t *internal_scanner,
+     int signature_index,
+     libsigscan_signature_t **signature,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element  = NULL;
+	libsigscan_signature_t *safe_signature = NULL;
+	static char *function                  = "libsigscan_internal_scanner_get_signature_by_index";
+	int number_of_signatures               = 0;
+	int result                             = 1;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scanner->scanner_image != NULL )
+	{
+		if( ( signature_index < 0 )
+		 || ( (uint32_t) signature_index >= internal_scanner->scanner_image->number_of_signatures ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid signature index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		*signature = &( internal_scanner->scanner_image->signatures[ signature_index ] );
+
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The signatures list caches the last element that was retrieved
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_list_get_number_of_elements(
+	     internal_scanner->signatures_list,
+	     &number_of_signatures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of signatures.",
+		 function );
+
+		result = -1;
+	}
+	/* Signature indexes are not reused when a signature is removed, the signature
+	 * is stored at the position of its index if no preceding signature was removed
+	 */
+	if( ( result == 1 )
+	 && ( signature_index >= 0 )
+	 && ( signature_index < number_of_signatures ) )
+	{
+		if( libcdata_list_get_value_by_index(
+		     internal_scanner->signatures_list,
+		     signature_index,
+		     (intptr_t **) &safe_signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature: %d.",
+			 function,
+			 signature_index );
+
+			result = -1;
+		}
+		else if( ( safe_signature == NULL )
+		      || ( safe_signature->signature_index != signature_index ) )
+		{
+			safe_signature = NULL;
+		}
+	}
+	if( ( result == 1 )
+	 && ( safe_signature == NULL ) )
+	{
+		if( libcdata_list_get_first_element(
+		     internal_scanner->signatures_list,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first signature list element.",
+			 function );
+
+			result = -1;
+		}
+		while( ( result == 1 )
+		    && ( list_element != NULL ) )
+		{
+			if( libcdata_list_element_get_value(
+			     list_element,
+			     (intptr_t **) &safe_signature,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve signature from list element.",
+				 function );
+
+				result = -1;
+			}
+			else if( ( safe_signature != NULL )
+			      && ( safe_signature->signature_index == signature_index ) )
+			{
+				break;
+			}
+			else if( libcdata_list_element_get_next_element(
+			          list_element,
+			          &list_element,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next signature list element.",
+				 function );
+
+				result = -1;
+			}
+			safe_signature = NULL;
+		}
+		if( ( result == 1 )
+		 && ( safe_signature == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid signature index value out of bounds.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		*signature = safe_signature;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the identifier of a specific signature
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_get_signature_identifier_size(
+     libsigscan_scanner_t *scanner,
+     int signature_index,
+     size_t *identifier_size,
+     libcerror_error_t **error )
+{
+	libsigscan_signature_t *signature = NULL;
+	static char *function             = "libsigscan_scanner_get_signature_identifier_size";
+
+	if( libsigscan_internal_scanner_get_signature_by_index(
+	     (libsigscan_internal_scanner_t *) scanner,
+	     signature_index,
+	     &signature,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve signature: %d.",
+		 function,
+		 signature_index );
+
+		return( -1 );
+	}
+	if( libsigscan_signature_get_identifier_size(
+	     signature,
+	     identifier_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve signature: %d identifier size.",
+		 function,
+		 signature_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the identifier of a specific signature
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_get_signature_identifier(
+     libsigscan_scanner_t *scanner,
+     int signature_index,
+     char *identifier,
+     size_t identifier_size,
+     libcerror_error_t **error )
+{
+	libsigscan_signature_t *signature = NULL;
+	static char *function             = "libsigscan_scanner_get_signature_identifier";
+
+	if( libsigscan_internal_scanner_get_signature_by_index(
+	     (libsigscan_internal_scanner_t *) scanner,
+	     signature_index,
+	     &signature,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve signature: %d.",
+		 function,
+		 signature_index );
+
+		return( -1 );
+	}
+	if( libsigscan_signature_get_identifier(
+	     signature,
+	     identifier,
+	     identifier_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve signature: %d identifier.",
+		 function,
+		 signature_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Builds the unbound scan engine
+ * If the automatic unbound scan engine is set the Aho-Corasick automaton is used
+ * when the average skip value of the scan tree is too small for the scan tree to be efficient
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_build_unbound_scan_engine(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_tree_t *scan_tree,
+     libcerror_error_t **error )
+{
+	static char *function     = "libsigscan_internal_scanner_build_unbound_scan_engine";
+	size_t average_skip_value = 0;
+	int unbound_scan_engine   = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	unbound_scan_engine = internal_scanner->unbound_scan_engine;
+
+	if( unbound_scan_engine == LIBSIGSCAN_UNBOUND_SCAN_ENGINE_AUTOMATIC )
+	{
+		if( libsigscan_skip_table_get_average_skip_value(
+		     scan_tree->skip_table,
+		     &average_skip_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve average skip value.",
+			 function );
+
+			return( -1 );
+		}
+		if( average_skip_value < LIBSIGSCAN_AHO_CORASICK_AVERAGE_SKIP_VALUE_THRESHOLD )
+		{
+			unbound_scan_engine = LIBSIGSCAN_UNBOUND_SCAN_ENGINE_AHO_CORASICK;
+		}
+		else
+		{
+			unbound_scan_engine = LIBSIGSCAN_UNBOUND_SCAN_ENGINE_SCAN_TREE;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: average skip value: %" PRIzd ", using: %s.\n",
+			 function,
+			 average_skip_value,
+			 ( unbound_scan_engine == LIBSIGSCAN_UNBOUND_SCAN_ENGINE_AHO_CORASICK ) ? "Aho-Corasick automaton" : "scan tree" );
+		}
+#endif
+	}
+	if( unbound_scan_engine == LIBSIGSCAN_UNBOUND_SCAN_ENGINE_AHO_CORASICK )
+	{
+		if( libsigscan_scan_tree_build_aho_corasick(
+		     scan_tree,
+		     internal_scanner->signatures_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build Aho-Corasick automaton.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function of the thread pool that builds a scan tree
+ * The pattern offsets mode of the build task determines which scan tree is built
+ * A failure to build the scan tree is stored in the build result of the task
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_build_scan_tree_callback(
+     libsigscan_scan_tree_build_task_t *build_task,
+     libsigscan_internal_scanner_t *internal_scanner )
+{
+	libcerror_error_t *error          = NULL;
+	libsigscan_scan_tree_t *scan_tree = NULL;
+	static char *function             = "libsigscan_internal_scanner_build_scan_tree_callback";
+	int result                        = 0;
+
+	if( build_task == NULL )
+	{
+		return( -1 );
+	}
+	if( internal_scanner == NULL )
+	{
+		build_task->build_result = -1;
+
+		return( -1 );
+	}
+	switch( build_task->pattern_offsets_mode )
+	{
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START:
+			scan_tree = internal_scanner->header_scan_tree;
+			break;
+
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END:
+			scan_tree = internal_scanner->footer_scan_tree;
+			break;
+
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND:
+			scan_tree = internal_scanner->scan_tree;
+			break;
+	}
+	result = libsigscan_scan_tree_build(
+	          scan_tree,
+	          internal_scanner->signatures_list,
+	          build_task->pattern_offsets_mode,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	build_task->build_result = result;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	build_task->build_result = -1;
+
+	return( -1 );
+}
+
+/* Builds the scan trees in parallel
+ * Scan trees that are already set are not rebuilt
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_build_scan_trees_in_parallel(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_tree_build_task_t *build_tasks[ 3 ] = { NULL, NULL, NULL };
+	libsigscan_scan_tree_t **scan_trees[ 3 ];
+	libcthreads_thread_pool_t *thread_pool              = NULL;
+	static char *function                               = "libsigscan_internal_scanner_build_scan_trees_in_parallel";
+	int pattern_offsets_modes[ 3 ];
+	int number_of_scan_trees                            = 0;
+	int number_of_workers                               = 0;
+	int scan_tree_index                                 = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	scan_trees[ 0 ] = &( internal_scanner->header_scan_tree );
+	scan_trees[ 1 ] = &( internal_scanner->footer_scan_tree );
+	scan_trees[ 2 ] = &( internal_scanner->scan_tree );
+
+	pattern_offsets_modes[ 0 ] = LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START;
+	pattern_offsets_modes[ 1 ] = LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END;
+	pattern_offsets_modes[ 2 ] = LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND;
+
+	/* The scan trees are created before the build tasks are pushed
+	 * so that the callback only needs to build them
+	 */
+	for( scan_tree_index = 0;
+	     scan_tree_index < 3;
+	     scan_tree_index++ )
+	{
+		if( *( scan_trees[ scan_tree_index ] ) != NULL )
+		{
+			continue;
+		}
+		if( libsigscan_scan_tree_initialize(
+		     scan_trees[ scan_tree_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan tree: %d.",
+			 function,
+			 scan_tree_index );
+
+			goto on_error;
+		}
+		( *( scan_trees[ scan_tree_index ] ) )->number_of_build_workers = internal_scanner->number_of_build_workers;
+
+		if( libsigscan_byte_value_profile_clone(
+		     &( ( *( scan_trees[ scan_tree_index ] ) )->byte_value_profile ),
+		     internal_scanner->byte_value_profile,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone byte value profile.",
+			 function );
+
+			libsigscan_scan_tree_free(
+			 scan_trees[ scan_tree_index ],
+			 NULL );
+
+			goto on_error;
+		}
+
+		if( libsigscan_scan_tree_build_task_initialize(
+		     &( build_tasks[ scan_tree_index ] ),
+		     pattern_offsets_modes[ scan_tree_index ],
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create build task: %d.",
+			 function,
+			 scan_tree_index );
+
+			libsigscan_scan_tree_free(
+			 scan_trees[ scan_tree_index ],
+			 NULL );
+
+			goto on_error;
+		}
+		number_of_scan_trees++;
+	}
+	if( number_of_scan_trees == 0 )
+	{
+		return( 1 );
+	}
+	number_of_workers = internal_scanner->number_of_build_workers;
+
+	if( number_of_workers > number_of_scan_trees )
+	{
+		number_of_workers = number_of_scan_trees;
+	}
+	if( libcthreads_thread_pool_create(
+	     &thread_pool,
+	     NULL,
+	     number_of_workers,
+	     number_of_scan_trees,
+	     (int (*)(intptr_t *, void *)) &libsigscan_internal_scanner_build_scan_tree_callback,
+	     (void *) internal_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( scan_tree_index = 0;
+	     scan_tree_index < 3;
+	     scan_tree_index++ )
+	{
+		if( build_tasks[ scan_tree_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_pool_push(
+		     thread_pool,
+		     (intptr_t *) build_tasks[ scan_tree_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push build task: %d onto thread pool.",
+			 function,
+			 scan_tree_index );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_thread_pool_join(
+	     &thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( scan_tree_index = 0;
+	     scan_tree_index < 3;
+	     scan_tree_index++ )
+	{
+		if( build_tasks[ scan_tree_index ] == NULL )
+		{
+			continue;
+		}
+		if( build_tasks[ scan_tree_index ]->build_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build scan tree: %d.",
+			 function,
+			 scan_tree_index );
+
+			goto on_error;
+		}
+	}
+	if( ( build_tasks[ 2 ] != NULL )
+	 && ( build_tasks[ 2 ]->build_result != 0 ) )
+	{
+		if( libsigscan_internal_scanner_build_unbound_scan_engine(
+		     internal_scanner,
+		     internal_scanner->scan_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build unbound scan engine.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( scan_tree_index = 0;
+	     scan_tree_index < 3;
+	     scan_tree_index++ )
+	{
+		if( build_tasks[ scan_tree_index ] == NULL )
+		{
+			continue;
+		}
+		if( libsigscan_scan_tree_build_task_free(
+		     &( build_tasks[ scan_tree_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free build task: %d.",
+			 function,
+			 scan_tree_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	/* The scan trees that were created by this function are freed
+	 * so that a subsequent build starts from scratch
+	 */
+	for( scan_tree_index = 0;
+	     scan_tree_index < 3;
+	     scan_tree_index++ )
+	{
+		if( build_tasks[ scan_tree_index ] != NULL )
+		{
+			libsigscan_scan_tree_build_task_free(
+			 &( build_tasks[ scan_tree_index ] ),
+			 NULL );
+
+			libsigscan_scan_tree_free(
+			 scan_trees[ scan_tree_index ],
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Builds the scan trees
+ * Scan trees that are already set are not rebuilt
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_build_scan_trees(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scanner_build_scan_trees";
+	int result            = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( internal_scanner->number_of_build_workers > 1 )
+	{
+		if( libsigscan_internal_scanner_build_scan_trees_in_parallel(
+		     internal_scanner,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build scan trees in parallel.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( internal_scanner->header_scan_tree == NULL )
+	{
+		if( libsigscan_scan_tree_initialize(
+		     &( internal_scanner->header_scan_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create header scan tree.",
+			 function );
+
+			return( -1 );
+		}
+		internal_scanner->header_scan_tree->number_of_build_workers = internal_scanner->number_of_build_workers;
+
+		if( libsigscan_byte_value_profile_clone(
+		     &( internal_scanner->header_scan_tree->byte_value_profile ),
+		     internal_scanner->byte_value_profile,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone byte value profile.",
+			 function );
+
+			libsigscan_scan_tree_free(
+			 &( internal_scanner->header_scan_tree ),
+			 NULL );
+
+			return( -1 );
+		}
+
+		result = libsigscan_scan_tree_build(
+		          internal_scanner->header_scan_tree,
+		          internal_scanner->signatures_list,
+		          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build header scan tree.",
+			 function );
+
+			libsigscan_scan_tree_free(
+			 &( internal_scanner->header_scan_tree ),
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( internal_scanner->footer_scan_tree == NULL )
+	{
+		if( libsigscan_scan_tree_initialize(
+		     &( internal_scanner->footer_scan_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create footer scan tree.",
+			 function );
+
+			return( -1 );
+		}
+		internal_scanner->footer_scan_tree->number_of_build_workers = internal_scanner->number_of_build_workers;
+
+		if( libsigscan_byte_value_profile_clone(
+		     &( internal_scanner->footer_scan_tree->byte_value_profile ),
+		     internal_scanner->byte_value_profile,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone byte value profile.",
+			 function );
+
+			libsigscan_scan_tree_free(
+			 &( internal_scanner->footer_scan_tree ),
+			 NULL );
+
+			return( -1 );
+		}
+
+		result = libsigscan_scan_tree_build(
+		          internal_scanner->footer_scan_tree,
+		          internal_scanner->signatures_list,
+		          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build footer scan tree.",
+			 function );
+
+			libsigscan_scan_tree_free(
+			 &( internal_scanner->footer_scan_tree ),
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( internal_scanner->scan_tree == NULL )
+	{
+		if( libsigscan_scan_tree_initialize(
+		     &( internal_scanner->scan_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan tree.",
+			 function );
+
+			return( -1 );
+		}
+		internal_scanner->scan_tree->number_of_build_workers = internal_scanner->number_of_build_workers;
+
+		if( libsigscan_byte_value_profile_clone(
+		     &( internal_scanner->scan_tree->byte_value_profile ),
+		     internal_scanner->byte_value_profile,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone byte value profile.",
+			 function );
+
+			libsigscan_scan_tree_free(
+			 &( internal_scanner->scan_tree ),
+			 NULL );
+
+			return( -1 );
+		}
+
+		result = libsigscan_scan_tree_build(
+		          internal_scanner->scan_tree,
+		          internal_scanner->signatures_list,
+		          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build scan tree.",
+			 function );
+
+			libsigscan_scan_tree_free(
+			 &( internal_scanner->scan_tree ),
+			 NULL );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libsigscan_internal_scanner_build_unbound_scan_engine(
+			     internal_scanner,
+			     internal_scanner->scan_tree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to build unbound scan engine.",
+				 function );
+
+				libsigscan_scan_tree_free(
+				 &( internal_scanner->scan_tree ),
+				 NULL );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Updates the scan trees after a signature was inserted or removed
+ * Only the scan tree of the pattern offsets mode of the signature is updated,
+ * the other scan trees are shared with the next generation. The next generation
+ * replaces the current generation of the scanner, scans that already started
+ * continue to use the scan trees of the previous generation
+ * Make sure to hold the read/write lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_update_scan_trees(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_signature_t *signature,
+     int update_type,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element              = NULL;
+	libcdata_list_t *replaced_nodes_list               = NULL;
+	libsigscan_scan_tree_generation_t *generation      = NULL;
+	libsigscan_scan_tree_generation_t *next_generation = NULL;
+	libsigscan_scan_tree_t *scan_tree                  = NULL;
+	libsigscan_scan_tree_t *source_scan_tree           = NULL;
+	static char *function                              = "libsigscan_internal_scanner_update_scan_trees";
+	int pattern_offsets_mode                           = 0;
+	int result                                         = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scanner->generation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scanner - missing scan tree generation.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( update_type != LIBSIGSCAN_SCAN_TREE_UPDATE_TYPE_INSERT_SIGNATURE )
+	 && ( update_type != LIBSIGSCAN_SCAN_TREE_UPDATE_TYPE_REMOVE_SIGNATURE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported update type.",
+		 function );
+
+		return( -1 );
+	}
+	generation = internal_scanner->generation;
+
+	switch( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK )
+	{
+		case LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START:
+			pattern_offsets_mode = LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START;
+			source_scan_tree     = generation->header_scan_tree;
+			break;
+
+		case LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END:
+			pattern_offsets_mode = LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END;
+			source_scan_tree     = generation->footer_scan_tree;
+			break;
+
+		case LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET:
+			pattern_offsets_mode = LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND;
+			source_scan_tree     = generation->scan_tree;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported signature flags.",
+			 function );
+
+			return( -1 );
+	}
+	result = 0;
+
+	if( source_scan_tree != NULL )
+	{
+		result = libsigscan_scan_tree_update(
+		          &scan_tree,
+		          source_scan_tree,
+		          internal_scanner->signatures_list,
+		          signature,
+		          update_type,
+		          &replaced_nodes_list,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update scan tree.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The scan tree is rebuilt if the update would change the shape
+	 * of the scan tree beyond the path of the signature
+	 */
+	if( result == 0 )
+	{
+		if( libsigscan_scan_tree_initialize(
+		     &scan_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan tree.",
+			 function );
+
+			goto on_error;
+		}
+		scan_tree->number_of_build_workers = internal_scanner->number_of_build_workers;
+
+		if( libsigscan_byte_value_profile_clone(
+		     &( scan_tree->byte_value_profile ),
+		     internal_scanner->byte_value_profile,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone byte value profile.",
+			 function );
+
+			goto on_error;
+		}
+
+		result = libsigscan_scan_tree_build(
+		          scan_tree,
+		          internal_scanner->signatures_list,
+		          pattern_offsets_mode,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build scan tree.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+	 && ( result != 0 ) )
+	{
+		if( libsigscan_internal_scanner_build_unbound_scan_engine(
+		     internal_scanner,
+		     scan_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build unbound scan engine.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_scan_tree_generation_initialize(
+	     &next_generation,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create next scan tree generation.",
+		 function );
+
+		goto on_error;
+	}
+	if( update_type == LIBSIGSCAN_SCAN_TREE_UPDATE_TYPE_REMOVE_SIGNATURE )
+	{
+		if( libsigscan_scan_tree_generation_append_retired_signature(
+		     generation,
+		     signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append retired signature.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_scan_tree_generation_set_next_generation(
+	     generation,
+	     next_generation,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set next scan tree generation.",
+		 function );
+
+		if( update_type == LIBSIGSCAN_SCAN_TREE_UPDATE_TYPE_REMOVE_SIGNATURE )
+		{
+			/* The retired signature is the last element of the retired signatures list
+			 */
+			if( libcdata_list_get_last_element(
+			     generation->retired_signatures_list,
+			     &list_element,
+			     NULL ) == 1 )
+			{
+				if( libcdata_list_remove_element(
+				     generation->retired_signatures_list,
+				     list_element,
+				     NULL ) == 1 )
+				{
+					libcdata_list_element_free(
+					 &list_element,
+					 NULL,
+					 NULL );
+				}
+			}
+		}
+		goto on_error;
+	}
+	/* From here on the next generation is published
+	 */
+	if( replaced_nodes_list != NULL )
+	{
+		if( libsigscan_scan_tree_share_nodes(
+		     source_scan_tree,
+		     scan_tree,
+		     &replaced_nodes_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to share scan tree nodes.",
+			 function );
+
+			result = -1;
+		}
+	}
+	next_generation->header_scan_tree = generation->header_scan_tree;
+	next_generation->footer_scan_tree = generation->footer_scan_tree;
+	next_generation->scan_tree        = generation->scan_tree;
+
+	/* The next generation takes over the scan trees that are not updated
+	 * and the current generation retains the scan tree that was updated
+	 */
+	switch( pattern_offsets_mode )
+	{
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START:
+			next_generation->header_scan_tree = scan_tree;
+			generation->footer_scan_tree      = NULL;
+			generation->scan_tree             = NULL;
+			break;
+
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END:
+			next_generation->footer_scan_tree = scan_tree;
+			generation->header_scan_tree      = NULL;
+			generation->scan_tree             = NULL;
+			break;
+
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND:
+			next_generation->scan_tree   = scan_tree;
+			generation->header_scan_tree = NULL;
+			generation->footer_scan_tree = NULL;
+			break;
+	}
+	scan_tree = NULL;
+
+	internal_scanner->generation       = next_generation;
+	internal_scanner->header_scan_tree = next_generation->header_scan_tree;
+	internal_scanner->footer_scan_tree = next_generation->footer_scan_tree;
+	internal_scanner->scan_tree        = next_generation->scan_tree;
+
+	next_generation = NULL;
+
+	/* The current generation is freed when the last scan state that uses it is reset or freed
+	 */
+	if( libsigscan_scan_tree_generation_release(
+	     &generation,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release scan tree generation.",
+		 function );
+
+		result = -1;
+	}
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( next_generation != NULL )
+	{
+		libsigscan_scan_tree_generation_free(
+		 &next_generation,
+		 NULL );
+	}
+	if( scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 &scan_tree,
+		 NULL );
+	}
+	if( replaced_nodes_list != NULL )
+	{
+		libcdata_list_free(
+		 &replaced_nodes_list,
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compiles the scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_compile(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scanner_compile";
+	int result            = 1;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have compiled the scanner while waiting for the lock
+	 */
+	if( internal_scanner->is_compiled == 0 )
+	{
+		if( libsigscan_internal_scanner_build_scan_trees(
+		     internal_scanner,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build scan trees.",
+			 function );
+
+			result = -1;
+		}
+		else if( libsigscan_scan_tree_generation_initialize(
+		          &( internal_scanner->generation ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan tree generation.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			/* The first generation takes over the scan trees
+			 */
+			internal_scanner->generation->header_scan_tree = internal_scanner->header_scan_tree;
+			internal_scanner->generation->footer_scan_tree = internal_scanner->footer_scan_tree;
+			internal_scanner->generation->scan_tree        = internal_scanner->scan_tree;
+
+			internal_scanner->is_compiled = 1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Compiles the scanner
+ * The scan trees are built and the settings cannot be changed afterwards.
+ * A compiled scanner can be shared by multiple threads that each scan
+ * with their own scan state. Signatures that are added or removed after
+ * compilation are published as a next generation of the scan trees,
+ * scans that already started continue with the previous generation
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_compile(
+     libsigscan_scanner_t *scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_compile";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_internal_scanner_compile(
+	     (libsigscan_internal_scanner_t *) scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to compile scanner.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Starts the scan
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_start(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_scan_start";
+	int result                                      = 1;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( internal_scanner->is_compiled == 0 )
+	{
+		if( libsigscan_internal_scanner_compile(
+		     internal_scanner,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to compile scanner.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The scan state holds a reference to the current generation
+	 * so that its scan trees remain available when a next generation is published
+	 */
+	if( libsigscan_scan_state_set_generation(
+	     scan_state,
+	     internal_scanner->generation,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan tree generation.",
+		 function );
+
+		result = -1;
+	}
+	else if( libsigscan_scan_state_start(
+	          scan_state,
+	          internal_scanner->header_scan_tree,
+	          internal_scanner->footer_scan_tree,
+	          internal_scanner->scan_tree,
+	          internal_scanner->buffer_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Stops the scan
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_stop(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_scan_stop";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_stop(
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Scans a buffer
+ * Returns 1 if successful, 0 if no more data needs to be scanned or -1 on error
+ */
+int libsigscan_scanner_scan_buffer(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_scan_buffer";
+	int result            = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsigscan_scan_state_scan_buffer(
+	          scan_state,
+	          buffer,
+	          buffer_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Determines the ranges of the data that need to be scanned
+ * The ranges are limited to the data size
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_get_scan_ranges(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     size64_t data_size,
+     uint64_t *header_range_start,
+     uint64_t *header_range_end,
+     uint64_t *header_range_size,
+     int *has_header_range,
+     uint64_t *footer_range_start,
+     uint64_t *footer_range_end,
+     uint64_t *footer_range_size,
+     int *has_footer_range,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_internal_scanner_get_scan_ranges";
+	int result                                            = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( has_header_range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid has header range.",
+		 function );
+
+		return( -1 );
+	}
+	if( has_footer_range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid has footer range.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsigscan_scan_state_get_header_range(
+	          scan_state,
+	          header_range_start,
+	          header_range_end,
+	          header_range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve header range.",
+		 function );
+
+		return( -1 );
+	}
+	*has_header_range = result;
+
+	result = libsigscan_scan_state_get_footer_range(
+	          scan_state,
+	          footer_range_start,
+	          footer_range_end,
+	          footer_range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve footer range.",
+		 function );
+
+		return( -1 );
+	}
+	*has_footer_range = result;
+
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( ( internal_scan_state->scan_tree != NULL )
+	 && ( internal_scan_state->scan_tree->arena != NULL ) )
+	{
+		/* Unbound signatures require all the data to be scanned
+		 * the header and footer ranges are scanned as part of the data
+		 */
+		*header_range_start = 0;
+		*header_range_end   = data_size;
+		*header_range_size  = data_size;
+		*has_header_range   = 1;
+		*has_footer_range   = 0;
+	}
+	/* Without a header range the footer range is scanned separately
+	 */
+	else if( ( *has_header_range != 0 )
+	      && ( *has_footer_range != 0 ) )
+	{
+		if( *footer_range_start < *header_range_start )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid footer range value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( *footer_range_start >= *header_range_start )
+		 && ( *footer_range_start <= *header_range_end ) )
+		{
+			/* The footer range is encapsulated in the header range
+			 */
+			if( *footer_range_end <= *header_range_end )
+			{
+				*has_footer_range = 0;
+			}
+			/* The footer range overlaps the header range at the end
+			 */
+			else if( *footer_range_end > *header_range_end )
+			{
+				*header_range_end  = *footer_range_end;
+				*header_range_size = *header_range_end - *header_range_start;
+				*has_footer_range  = 0;
+			}
+		}
+		/* The footer range is close to the header range, scan both
+		 * as a single range to reduce the number of reads
+		 */
+		else if( ( *footer_range_start - *header_range_end ) <= LIBSIGSCAN_MAXIMUM_RANGE_GAP_SIZE )
+		{
+			*header_range_end  = *footer_range_end;
+			*header_range_size = *header_range_end - *header_range_start;
+			*has_footer_range  = 0;
+		}
+	}
+	if( ( *has_header_range != 0 )
+	 && ( *header_range_end > data_size ) )
+	{
+		*header_range_size -= (size64_t) *header_range_end - data_size;
+		*header_range_end   = (uint64_t) data_size;
+	}
+	if( ( *has_footer_range != 0 )
+	 && ( *footer_range_end > data_size ) )
+	{
+		*footer_range_size -= (size64_t) *footer_range_end - data_size;
+		*footer_range_end   = (uint64_t) data_size;
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBSIGSCAN_MAPPED_FILE )
+
+/* Scans a range of a memory mapped file
+ * Returns 1 if successful, 0 if no more data needs to be scanned or -1 on error
+ */
+int libsigscan_internal_scanner_scan_mapped_file_range(
+     libsigscan_scan_state_t *scan_state,
+     libsigscan_mapped_file_t *mapped_file,
+     uint64_t range_start,
+     uint64_t range_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *data   = NULL;
+	static char *function = "libsigscan_internal_scanner_scan_mapped_file_range";
+	size_t data_size      = 0;
+	int result            = 1;
+
+	while( range_size > 0 )
+	{
+		if( libsigscan_mapped_file_get_data(
+		     mapped_file,
+		     (off64_t) range_start,
+		     (size64_t) range_size,
+		     &data,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to retrieve data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+			 function,
+			 range_start,
+			 range_start );
+
+			return( -1 );
+		}
+		result = libsigscan_scan_state_scan_buffer(
+		          scan_state,
+		          data,
+		          data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		range_start += data_size;
+		range_size  -= data_size;
+	}
+	return( result );
+}
+
+/* Scans a memory mapped file
+ * The mapped data is scanned in place, without copying it into the scan buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_scan_mapped_file(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libsigscan_mapped_file_t *mapped_file,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_internal_scanner_scan_mapped_file";
+	size64_t file_size                              = 0;
+	uint64_t footer_range_end                       = 0;
+	uint64_t footer_range_size                      = 0;
+	uint64_t footer_range_start                     = 0;
+	uint64_t header_range_end                       = 0;
+	uint64_t header_range_size                      = 0;
+	uint64_t header_range_start                     = 0;
+	uint8_t scan_state_flags                        = 0;
+	int has_footer_range                            = 0;
+	int has_header_range                            = 0;
+	int result                                      = 1;
+	int scan_state_flags_set                        = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( libsigscan_mapped_file_get_size(
+	     mapped_file,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_set_data_size(
+	     scan_state,
+	     file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The mapped data remains available while it is scanned hence there
+	 * is no need to copy it into the scan buffer
+	 */
+	if( libsigscan_scan_state_get_flags(
+	     scan_state,
+	     &scan_state_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan state flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_set_flags(
+	     scan_state,
+	     scan_state_flags | LIBSIGSCAN_SCAN_STATE_FLAG_SCAN_IN_PLACE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state flags.",
+		 function );
+
+		goto on_error;
+	}
+	scan_state_flags_set = 1;
+
+	if( libsigscan_scanner_scan_start(
+	     scanner,
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_internal_scanner_get_scan_ranges(
+	     internal_scanner,
+	     scan_state,
+	     file_size,
+	     &header_range_start,
+	     &header_range_end,
+	     &header_range_size,
+	     &has_header_range,
+	     &footer_range_start,
+	     &footer_range_end,
+	     &footer_range_size,
+	     &has_footer_range,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( has_header_range != 0 )
+	 && ( header_range_size > 0 ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: scanning range: %" PRIu64 " - %" PRIu64 " for signatures.\n",
+			 function,
+			 header_range_start,
+			 header_range_end );
+		}
+#endif
+		result = libsigscan_internal_scanner_scan_mapped_file_range(
+		          scan_state,
+		          mapped_file,
+		          header_range_start,
+		          header_range_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan header range.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( result != 0 )
+	 && ( has_footer_range != 0 )
+	 && ( footer_range_size > 0 ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: scanning range: %" PRIu64 " - %" PRIu64 " for signatures.\n",
+			 function,
+			 footer_range_start,
+			 footer_range_end );
+		}
+#endif
+		if( libsigscan_scan_state_set_data_offset(
+		     scan_state,
+		     (off64_t) footer_range_start,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data offset.",
+			 function );
+
+			goto on_error;
+		}
+		result = libsigscan_internal_scanner_scan_mapped_file_range(
+		          scan_state,
+		          mapped_file,
+		          footer_range_start,
+		          footer_range_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan footer range.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_scanner_scan_stop(
+	     scanner,
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state.",
+		 function );
+
+		goto on_error;
+	}
+	scan_state_flags_set = 0;
+
+	if( libsigscan_scan_state_set_flags(
+	     scan_state,
+	     scan_state_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state flags.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( scan_state_flags_set != 0 )
+	{
+		libsigscan_scan_state_set_flags(
+		 scan_state,
+		 scan_state_flags,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBSIGSCAN_MAPPED_FILE ) */
+
+/* Scans a file
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_file(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libsigscan_scanner_scan_file";
+	size_t filename_length           = 0;
+
+#if defined( HAVE_LIBSIGSCAN_MAPPED_FILE )
+	libsigscan_mapped_file_t *mapped_file = NULL;
+	int number_of_workers                 = 0;
+	int result                            = 0;
+#endif
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSIGSCAN_MAPPED_FILE )
+	/* Regular files are memory mapped to scan the data directly from the page cache
+	 */
+	if( libsigscan_mapped_file_initialize(
+	     &mapped_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_get_number_of_workers(
+	     scan_state,
+	     &number_of_workers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of workers.",
+		 function );
+
+		goto on_error;
+	}
+	/* The mapped file has a single mapped window, hence a scan with multiple
+	 * workers reads the file using a file IO handle per worker instead
+	 */
+	if( number_of_workers <= 1 )
+	{
+		result = libsigscan_mapped_file_open(
+		          mapped_file,
+		          filename,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libsigscan_internal_scanner_scan_mapped_file(
+		     scanner,
+		     scan_state,
+		     mapped_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_mapped_file_free(
+	     &mapped_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 0 )
+	{
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBSIGSCAN_MAPPED_FILE ) */
+
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_scan_file_io_handle(
+	     scanner,
+	     scan_state,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBSIGSCAN_MAPPED_FILE )
+	if( mapped_file != NULL )
+	{
+		libsigscan_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+#endif
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Scans a file
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_file_wide(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libsigscan_scanner_scan_file_wide";
+	size_t filename_length           = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_scan_file_io_handle(
+	     scanner,
+	     scan_state,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Scans a file using a Basic File IO (bfio) handle
+ * The data is read using positional reads, the footer range is read concurrently
+ * with the header range if multi-threading support is available
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_file_io_handle(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libsigscan_chunked_scan_t *chunked_scan               = NULL;
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	libsigscan_internal_scanner_t *internal_scanner       = NULL;
+	libsigscan_read_request_t *footer_read_request        = NULL;
+	uint8_t *buffer                                       = NULL;
+	static char *function                                 = "libsigscan_scanner_scan_file_io_handle";
+	size64_t block_size                                   = 0;
+	size64_t file_size                                    = 0;
+	off64_t block_offset                                  = 0;
+	uint64_t footer_range_end                             = 0;
+	uint64_t footer_range_size                            = 0;
+	uint64_t footer_range_start                           = 0;
+	uint64_t header_range_end                             = 0;
+	uint64_t header_range_size                            = 0;
+	uint64_t header_range_start                           = 0;
+	uint64_t number_of_skipped_reads                      = 0;
+	uint64_t read_offset                                  = 0;
+	size_t buffer_size                                    = 0;
+	size_t read_buffer_size                               = 0;
+	size_t read_size                                      = 0;
+	ssize_t read_count                                    = 0;
+	uint8_t scan_state_flags                              = 0;
+	int file_io_handle_is_open                            = 0;
+	int has_footer_range                                  = 0;
+	int has_header_range                                  = 0;
+	int number_of_workers                                 = 0;
+	int result                                            = 0;
+	int scan_state_flags_set                              = 0;
+	int scan_stopped                                      = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_ACCESS_FLAG_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_set_data_size(
+	     scan_state,
+	     file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The ranges are read into a buffer that is scanned in place
+	 * hence the scan state does not need a separate scan buffer
+	 */
+	if( libsigscan_scan_state_get_flags(
+	     scan_state,
+	     &scan_state_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan state flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_set_flags(
+	     scan_state,
+	     scan_state_flags | LIBSIGSCAN_SCAN_STATE_FLAG_SCAN_IN_PLACE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state flags.",
+		 function );
+
+		goto on_error;
+	}
+	scan_state_flags_set = 1;
+
+	if( libsigscan_scanner_scan_start(
+	     scanner,
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state.",
+		 function );
+
+		goto on_error;
+	}
+	/* The scan uses the scan trees that were set when the scan state was started
+	 */
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( internal_scan_state->header_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan state - missing header scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_scan_state->footer_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan state - missing footer scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_get_buffer_size(
+	     scan_state,
+	     &buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to retrieve scan buffer size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_get_number_of_workers(
+	     scan_state,
+	     &number_of_workers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of workers.",
+		 function );
+
+		goto on_error;
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	number_of_workers = 1;
+#endif
+	if( libsigscan_scan_state_get_block_alignment(
+	     scan_state,
+	     &block_size,
+	     &block_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block alignment.",
+		 function );
+
+		goto on_error;
+	}
+	/* If multiple workers are available the data is divided into chunks
+	 * that are scanned in parallel for unbound signatures, the header signatures
+	 * are matched at every block boundary by the scan state hence blocks are
+	 * always scanned by a single worker
+	 */
+	if( ( number_of_workers > 1 )
+	 && ( block_size == 0 )
+	 && ( internal_scan_state->scan_tree != NULL )
+	 && ( internal_scan_state->scan_tree->arena != NULL ) )
+	{
+		if( libsigscan_chunked_scan_initialize(
+		     &chunked_scan,
+		     internal_scanner,
+		     scan_state,
+		     file_io_handle,
+		     file_size,
+		     number_of_workers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunked scan.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsigscan_chunked_scan_scan(
+		     chunked_scan,
+		     scan_state,
+		     number_of_workers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan chunks.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsigscan_chunked_scan_free(
+		     &chunked_scan,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunked scan.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( libsigscan_internal_scanner_get_scan_ranges(
+	          internal_scanner,
+	          scan_state,
+	          file_size,
+	          &header_range_start,
+	          &header_range_end,
+	          &header_range_size,
+	          &has_header_range,
+	          &footer_range_start,
+	          &footer_range_end,
+	          &footer_range_size,
+	          &has_footer_range,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan ranges.",
+		 function );
+
+		goto on_error;
+	}
+	/* If the footer range fits in the read of the header range both ranges
+	 * are read and scanned as a single range
+	 */
+	if( ( has_header_range != 0 )
+	 && ( has_footer_range != 0 )
+	 && ( footer_range_end > header_range_start )
+	 && ( ( footer_range_end - header_range_start ) <= (uint64_t) buffer_size ) )
+	{
+		header_range_end  = footer_range_end;
+		header_range_size = header_range_end - header_range_start;
+		has_footer_range  = 0;
+	}
+	/* If both the header and footer range can be read at once the footer range
+	 * is read while the header range is read and scanned. The footer read uses
+	 * a separate thread and file IO handle, hence it is only done if the header
+	 * read is large enough to outweigh their cost.
+	 */
+	if( ( has_header_range != 0 )
+	 && ( header_range_size >= LIBSIGSCAN_MINIMUM_CONCURRENT_READ_SIZE )
+	 && ( header_range_size <= (uint64_t) buffer_size )
+	 && ( has_footer_range != 0 )
+	 && ( footer_range_size > 0 )
+	 && ( footer_range_size <= (uint64_t) buffer_size ) )
+	{
+		if( libsigscan_read_request_initialize(
+		     &footer_read_request,
+		     (size_t) footer_range_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create footer read request.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsigscan_read_request_submit(
+		     footer_read_request,
+		     file_io_handle,
+		     (off64_t) footer_range_start,
+		     (size_t) footer_range_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to submit footer read request.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The read buffer is sized to the largest range that is read into it
+	 * with a maximum of the scan buffer size
+	 */
+	if( has_header_range != 0 )
+	{
+		read_buffer_size = (size_t) header_range_size;
+	}
+	if( ( has_footer_range != 0 )
+	 && ( footer_read_request == NULL )
+	 && ( footer_range_size > (uint64_t) read_buffer_size ) )
+	{
+		read_buffer_size = (size_t) footer_range_size;
+	}
+	if( read_buffer_size > buffer_size )
+	{
+		read_buffer_size = buffer_size;
+	}
+	if( read_buffer_size > 0 )
+	{
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * read_buffer_size );
+
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( has_header_range != 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: scanning range: %" PRIu64 " - %" PRIu64 " for signatures.\n",
+			 function,
+			 header_range_start,
+			 header_range_end );
+		}
+#endif
+		read_offset = header_range_start;
+
+		if( header_range_size > 0 )
+		{
+			if( libsigscan_scan_state_set_data_offset(
+			     scan_state,
+			     (off64_t) header_range_start,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set data offset.",
+				 function );
+
+				goto on_error;
+			}
+			while( header_range_size > 0 )
+			{
+				if( header_range_size > read_buffer_size )
+				{
+					read_size = read_buffer_size;
+				}
+				else
+				{
+					read_size = (size_t) header_range_size;
+				}
+				read_count = libbfio_handle_read_buffer_at_offset(
+					      file_io_handle,
+					      buffer,
+					      read_size,
+					      (off64_t) read_offset,
+					      error );
+
+				if( read_count != (ssize_t) read_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read buffer.",
+					 function );
+
+					goto on_error;
+				}
+				result = libsigscan_scan_state_scan_buffer(
+				          scan_state,
+				          buffer,
+				          read_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to scan buffer.",
+					 function );
+
+					goto on_error;
+				}
+				header_range_size -= read_size;
+				read_offset       += read_size;
+
+				if( result == 0 )
+				{
+					/* No more data needs to be scanned, for example when
+					 * the scan was stopped after a match
+					 */
+					scan_stopped = 1;
+
+					break;
+				}
+			}
+		}
+	}
+	if( footer_read_request != NULL )
+	{
+		if( libsigscan_read_request_wait(
+		     footer_read_request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read footer range.",
+			 function );
+
+			goto on_error;
+		}
+		if( scan_stopped != 0 )
+		{
+			/* The footer range was already read and is not counted as a skipped read
+			 */
+			footer_range_size = 0;
+		}
+	}
+	if( ( scan_stopped == 0 )
+	 && ( has_footer_range != 0 ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: scanning range: %" PRIu64 " - %" PRIu64 " for signatures.\n",
+			 function,
+			 footer_range_start,
+			 footer_range_end );
+		}
+#endif
+		read_offset = footer_range_start;
+
+		if( footer_range_size > 0 )
+		{
+			if( libsigscan_scan_state_set_data_offset(
+			     scan_state,
+			     (off64_t) footer_range_start,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set data offset.",
+				 function );
+
+				goto on_error;
+			}
+			if( footer_read_request != NULL )
+			{
+				result = libsigscan_scan_state_scan_buffer(
+				          scan_state,
+				          footer_read_request->buffer,
+				          (size_t) footer_range_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to scan footer buffer.",
+					 function );
+
+					goto on_error;
+				}
+				footer_range_size = 0;
+			}
+			while( footer_range_size > 0 )
+			{
+				if( footer_range_size > read_buffer_size )
+				{
+					read_size = read_buffer_size;
+				}
+				else
+				{
+					read_size = (size_t) footer_range_size;
+				}
+				read_count = libbfio_handle_read_buffer_at_offset(
+					      file_io_handle,
+					      buffer,
+					      read_size,
+					      (off64_t) read_offset,
+					      error );
+
+				if( read_count != (ssize_t) read_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read buffer.",
+					 function );
+
+					goto on_error;
+				}
+				result = libsigscan_scan_state_scan_buffer(
+				          scan_state,
+				          buffer,
+				          read_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to scan buffer.",
+					 function );
+
+					goto on_error;
+				}
+				footer_range_size -= read_size;
+				read_offset       += read_size;
+
+				if( result == 0 )
+				{
+					/* No more data needs to be scanned, for example when
+					 * the scan was stopped after a match
+					 */
+					scan_stopped = 1;
+
+					break;
+				}
+			}
+		}
+	}
+	if( footer_read_request != NULL )
+	{
+		if( libsigscan_read_request_free(
+		     &footer_read_request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free footer read request.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( scan_stopped != 0 )
+	 && ( read_buffer_size > 0 ) )
+	{
+		/* Keep track of the reads of the remaining ranges that are skipped
+		 */
+		number_of_skipped_reads = ( header_range_size + read_buffer_size - 1 ) / read_buffer_size;
+
+		if( has_footer_range != 0 )
+		{
+			number_of_skipped_reads += ( footer_range_size + read_buffer_size - 1 ) / read_buffer_size;
+		}
+		if( libsigscan_scan_state_add_skipped_reads(
+		     scan_state,
+		     number_of_skipped_reads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add skipped reads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_scanner_scan_stop(
+	     scanner,
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state.",
+		 function );
+
+		goto on_error;
+	}
+	scan_state_flags_set = 0;
+
+	if( libsigscan_scan_state_set_flags(
+	     scan_state,
+	     scan_state_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+
+		buffer = NULL;
+	}
+
+	if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+/* TODO set scan state to error ? */
+	if( chunked_scan != NULL )
+	{
+		libsigscan_chunked_scan_free(
+		 &chunked_scan,
+		 NULL );
+	}
+	if( footer_read_request != NULL )
+	{
+		libsigscan_read_request_free(
+		 &footer_read_request,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( scan_state_flags_set != 0 )
+	{
+		libsigscan_scan_state_set_flags(
+		 scan_state,
+		 scan_state_flags,
+		 NULL );
+	}
+	if( file_io_handle_is_open == 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the scanner image
+ * If image data is NULL only the image size is determined
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_write_image(
+     libsigscan_internal_scanner_t *internal_scanner,
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_size,
+     libcerror_error_t **error )
+{
+	libsigscan_scanner_image_t *scanner_image = NULL;
+	static char *function                     = "libsigscan_internal_scanner_write_image";
+	int result                                = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image size.",
+		 function );
+
+		return( -1 );
+	}
+	/* A scanner that was read from a scanner image writes a copy of that image
+	 */
+	if( internal_scanner->scanner_image != NULL )
+	{
+		if( image_data != NULL )
+		{
+			if( image_data_size < internal_scanner->scanner_image->image_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid image data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     image_data,
+			     internal_scanner->scanner_image->image_data,
+			     internal_scanner->scanner_image->image_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy image data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		*image_size = internal_scanner->scanner_image->image_data_size;
+
+		return( 1 );
+	}
+	if( internal_scanner->is_compiled == 0 )
+	{
+		if( libsigscan_internal_scanner_compile(
+		     internal_scanner,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to compile scanner.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_scanner_image_initialize(
+	     &scanner_image,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scanner image.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The signatures and scan trees cannot change while the image is written
+	 */
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libsigscan_scanner_image_write(
+	          scanner_image,
+	          internal_scanner->signatures_list,
+	          internal_scanner->header_scan_tree,
+	          internal_scanner->footer_scan_tree,
+	          internal_scanner->scan_tree,
+	          image_data,
+	          image_data_size,
+	          image_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write scanner image.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	if( libsigscan_scanner_image_free(
+	     &scanner_image,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scanner image.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( scanner_image != NULL )
+	{
+		libsigscan_scanner_image_free(
+		 &scanner_image,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of the scanner image
+ * The scan trees are built if not already set
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_get_image_size(
+     libsigscan_scanner_t *scanner,
+     size_t *image_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_get_image_size";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_internal_scanner_write_image(
+	     (libsigscan_internal_scanner_t *) scanner,
+	     NULL,
+	     0,
+	     image_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine image size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the scanner image
+ * The scanner image contains the signatures and the scan trees
+ * The scan trees are built if not already set
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_write_image(
+     libsigscan_scanner_t *scanner,
+     uint8_t *image_data,
+     size_t image_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_write_image";
+	size_t image_size     = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_internal_scanner_write_image(
+	     (libsigscan_internal_scanner_t *) scanner,
+	     image_data,
+	     image_data_size,
+	     &image_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write image.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the scanner image
+ * Returns 1 if successful, 0 if the image is not compatible or -1 on error
+ */
+int libsigscan_internal_scanner_set_image(
+     libsigscan_internal_scanner_t *internal_scanner,
+     const uint8_t *image_data,
+     size_t image_data_size,
+     uint8_t data_flags,
+     libcerror_error_t **error )
+{
+	libsigscan_scanner_image_t *scanner_image = NULL;
+	static char *function                     = "libsigscan_internal_scanner_set_image";
+	int number_of_signatures                  = 0;
+	int result                                = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_scanner->header_scan_tree != NULL )
+	 || ( internal_scanner->footer_scan_tree != NULL )
+	 || ( internal_scanner->scan_tree != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scan trees already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_number_of_elements(
+	     internal_scanner->signatures_list,
+	     &number_of_signatures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of signatures.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_signatures != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - signatures already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scanner_image_initialize(
+	     &scanner_image,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scanner image.",
+		 function );
+
+		goto on_error;
+	}
+	result = libsigscan_scanner_image_read(
+	          scanner_image,
+	          image_data,
+	          image_data_size,
+	          data_flags,
+	          &( internal_scanner->header_scan_tree ),
+	          &( internal_scanner->footer_scan_tree ),
+	          &( internal_scanner->scan_tree ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read scanner image.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libsigscan_scanner_image_free(
+		     &scanner_image,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scanner image.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	internal_scanner->scanner_image = scanner_image;
+	internal_scanner->is_compiled   = 1;
+
+	return( 1 );
+
+on_error:
+	if( scanner_image != NULL )
+	{
+		libsigscan_scanner_image_free(
+		 &scanner_image,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the scanner image
+ * The image data is referenced and must remain available, unmodified and 8-byte aligned
+ * while the scanner is in use, e.g. a memory mapped scanner image file
+ * Signatures cannot be added to a scanner that has a scanner image set
+ * Returns 1 if successful, 0 if the image is not compatible or -1 on error
+ */
+int libsigscan_scanner_set_image(
+     libsigscan_scanner_t *scanner,
+     const uint8_t *image_data,
+     size_t image_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_set_image";
+	int result            = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsigscan_internal_scanner_set_image(
+	          (libsigscan_internal_scanner_t *) scanner,
+	          image_data,
+	          image_data_size,
+	          LIBSIGSCAN_SCAN_DATA_FLAG_REFERENCED,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set image.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads a scanner image file
+ * Returns 1 if successful, 0 if the image is not compatible or -1 on error
+ */
+int libsigscan_scanner_read_image_file(
+     libsigscan_scanner_t *scanner,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libsigscan_scanner_read_image_file";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	result = libsigscan_scanner_read_image_file_io_handle(
+	          scanner,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read image file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Reads a scanner image file
+ * Returns 1 if successful, 0 if the image is not compatible or -1 on error
+ */
+int libsigscan_scanner_read_image_file_wide(
+     libsigscan_scanner_t *scanner,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libsigscan_scanner_read_image_file_wide";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	result = libsigscan_scanner_read_image_file_io_handle(
+	          scanner,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read image file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Reads a scanner image file using a Basic File IO (bfio) handle
+ * The image data is read into a buffer that is owned by the scanner
+ * Returns 1 if successful, 0 if the image is not compatible or -1 on error
+ */
+int libsigscan_scanner_read_image_file_io_handle(
+     libsigscan_scanner_t *scanner,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *image_data        = NULL;
+	static char *function      = "libsigscan_scanner_read_image_file_io_handle";
+	size64_t file_size         = 0;
+	ssize_t read_count         = 0;
+	int file_io_handle_is_open = 0;
+	int result                 = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_ACCESS_FLAG_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size == 0 )
+	 || ( file_size > (size64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The memory allocation is aligned to at least 8 bytes as required by the scanner image
+	 */
+	image_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * (size_t) file_size );
+
+	if( image_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create image data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              image_data,
+	              (size_t) file_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read image data.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_is_open == 0 )
+	{
+		file_io_handle_is_open = 1;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libsigscan_internal_scanner_set_image(
+	          (libsigscan_internal_scanner_t *) scanner,
+	          image_data,
+	          (size_t) file_size,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set image.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		memory_free(
+		 image_data );
+	}
+	return( result );
+
+on_error:
+	if( image_data != NULL )
+	{
+		memory_free(
+		 image_data );
+	}
+	if( file_io_handle_is_open == 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes a scanner image file
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_write_image_file(
+     libsigscan_scanner_t *scanner,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libsigscan_scanner_write_image_file";
+	size_t filename_length           = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_write_image_file_io_handle(
+	     scanner,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write image file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Writes a scanner image file
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_write_image_file_wide(
+     libsigscan_scanner_t *scanner,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libsigscan_scanner_write_image_file_wide";
+	size_t filename_length           = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
 
-	if( has_footer_range != 0 )
+		goto on_error;
+	}
+	if( libsigscan_scanner_write_image_file_io_handle(
+	     scanner,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write image file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
-		if( footer_range_start < header_range_start )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid footer range value out of bounds.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
 
-			goto on_error;
-		}
-		if( ( footer_range_start >= header_range_start )
-		 && ( footer_range_start <= header_range_end ) )
-		{
-			/* The footer range is encapsulated in the header range
-			 */
-			if( footer_range_end <= header_range_end )
-			{
-				has_footer_range = 0;
-			}
-			/* The footer range overlaps the header range at the end
-			 */
-			else if( footer_range_end > header_range_end )
-			{
-				header_range_end = footer_range_end;
-				has_footer_range = 0;
-			}
-		}
+		goto on_error;
 	}
-	if( has_header_range != 0 )
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
 	{
-		if( header_range_end > file_size )
-		{
-			header_range_size -= (size64_t) header_range_end - file_size;
-			header_range_end   = (off64_t) file_size;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: scanning range: %" PRIu64 " - %" PRIu64 " for signatures.\n",
-			 function,
-			 header_range_start,
-			 header_range_end );
-		}
-#endif
-		if( header_range_size > 0 )
-		{
-			if( libbfio_handle_seek_offset(
-			     file_io_handle,
-			     (off64_t) header_range_start,
-			     SEEK_SET,
-			     error ) == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_SEEK_FAILED,
-				 "%s: unable to seek file header offset: 0x%08" PRIx64 ".",
-				 function,
-				 header_range_start );
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
 
-				goto on_error;
-			}
-			while( header_range_size > 0 )
-			{
-				if( header_range_size > buffer_size )
-				{
-					read_size = buffer_size;
-				}
-				else
-				{
-					read_size = (size_t) header_range_size;
-				}
-				read_count = libbfio_handle_read_buffer(
-					      file_io_handle,
-					      buffer,
-					      read_size,
-					      error );
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-				if( read_count != (ssize_t) read_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read buffer.",
-					 function );
+/* Writes a scanner image file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_write_image_file_io_handle(
+     libsigscan_scanner_t *scanner,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *image_data        = NULL;
+	static char *function      = "libsigscan_scanner_write_image_file_io_handle";
+	size_t image_size          = 0;
+	ssize_t write_count        = 0;
+	int file_io_handle_is_open = 0;
 
-					goto on_error;
-				}
-				if( libsigscan_scan_state_scan_buffer(
-				     scan_state,
-				     buffer,
-				     read_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GENERIC,
-					 "%s: unable to scan buffer.",
-					 function );
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
 
-					goto on_error;
-				}
-				header_range_size -= read_size;
-			}
-		}
+		return( -1 );
 	}
-/* TODO scan unbound */
-	if( has_footer_range != 0 )
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
 	{
-		if( footer_range_end > file_size )
-		{
-			footer_range_size -= (size64_t) footer_range_end - file_size;
-			footer_range_end   = (off64_t) file_size;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: scanning range: %" PRIu64 " - %" PRIu64 " for signatures.\n",
-			 function,
-			 footer_range_start,
-			 footer_range_end );
-		}
-#endif
-		if( footer_range_size > 0 )
-		{
-			if( libbfio_handle_seek_offset(
-			     file_io_handle,
-			     (off64_t) footer_range_start,
-			     SEEK_SET,
-			     error ) == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_SEEK_FAILED,
-				 "%s: unable to seek file header offset: 0x%08" PRIx64 ".",
-				 function,
-				 footer_range_start );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
 
-				goto on_error;
-			}
-/* TODO handle unbound */
-			if( libsigscan_scan_state_flush(
-			     scan_state,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to flush scan state.",
-				 function );
+		return( -1 );
+	}
+	if( libsigscan_internal_scanner_write_image(
+	     (libsigscan_internal_scanner_t *) scanner,
+	     NULL,
+	     0,
+	     &image_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine image size.",
+		 function );
 
-				goto on_error;
-			}
-			if( libsigscan_scan_state_set_data_offset(
-			     scan_state,
-			     (off64_t) footer_range_start,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set data offset.",
-				 function );
+		goto on_error;
+	}
+	if( ( image_size == 0 )
+	 || ( image_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid image size value out of bounds.",
+		 function );
 
-				goto on_error;
-			}
-/* TODO handle unbound */
-			while( footer_range_size > 0 )
-			{
-				if( footer_range_size > buffer_size )
-				{
-					read_size = buffer_size;
-				}
-				else
-				{
-					read_size = (size_t) footer_range_size;
-				}
-				read_count = libbfio_handle_read_buffer(
-					      file_io_handle,
-					      buffer,
-					      read_size,
-					      error );
+		goto on_error;
+	}
+	image_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * image_size );
 
-				if( read_count != (ssize_t) read_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read buffer.",
-					 function );
+	if( image_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create image data.",
+		 function );
 
-					goto on_error;
-				}
-				if( libsigscan_scan_state_scan_buffer(
-				     scan_state,
-				     buffer,
-				     read_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GENERIC,
-					 "%s: unable to scan buffer.",
-					 function );
+		goto on_error;
+	}
+	if( libsigscan_internal_scanner_write_image(
+	     (libsigscan_internal_scanner_t *) scanner,
+	     image_data,
+	     image_size,
+	     &image_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write image.",
+		 function );
 
-					goto on_error;
-				}
-				footer_range_size -= read_size;
-			}
+		goto on_error;
+	}
+	if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_WRITE_TRUNCATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
 		}
 	}
-	if( libsigscan_scanner_scan_stop(
-	     scanner,
-	     scan_state,
-	     error ) != 1 )
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               image_data,
+	               image_size,
+	               error );
+
+	if( write_count != (ssize_t) image_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set scan state.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write image data.",
 		 function );
 
 		goto on_error;
 	}
 	memory_free(
-	 buffer );
+	 image_data );
 
-	buffer = NULL;
+	image_data = NULL;
 
 	if( file_io_handle_is_open == 0 )
 	{
+		file_io_handle_is_open = 1;
+
 		if( libbfio_handle_close(
 		     file_io_handle,
 		     error ) != 0 )
@@ -1393,11 +5923,10 @@ int libsigscan_scanner_scan_file_io_handle(
 	return( 1 );
 
 on_error:
-/* TODO set scan state to error ? */
-	if( buffer != NULL )
+	if( image_data != NULL )
 	{
 		memory_free(
-		 buffer );
+		 image_data );
 	}
 	if( file_io_handle_is_open == 0 )
 	{
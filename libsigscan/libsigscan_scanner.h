@@ -25,11 +25,18 @@
 #include <common.h>
 #include <types.h>
 
+#include "libsigscan_byte_value_profile.h"
 #include "libsigscan_extern.h"
 #include "libsigscan_libbfio.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
+#include "libsigscan_libcthreads.h"
+#include "libsigscan_mapped_file.h"
 #include "libsigscan_scan_tree.h"
+#include "libsigscan_scan_tree_build_task.h"
+#include "libsigscan_scan_tree_generation.h"
+#include "libsigscan_scanner_image.h"
+#include "libsigscan_signature.h"
 #include "libsigscan_types.h"
 
 #if defined( __cplusplus )
@@ -60,9 +67,50 @@ struct libsigscan_internal_scanner
 	 */
 	libsigscan_scan_tree_t *scan_tree;
 
+	/* The scan tree generation
+	 * owns the scan trees of a compiled scanner, signatures that are added or removed
+	 * after compilation publish a next generation
+	 */
+	libsigscan_scan_tree_generation_t *generation;
+
+	/* The index of the next signature that is added
+	 * signature indexes are not reused when a signature is removed
+	 */
+	int next_signature_index;
+
+	/* The scanner image
+	 * set if the scan trees were read from a scanner image
+	 */
+	libsigscan_scanner_image_t *scanner_image;
+
+	/* The unbound scan engine
+	 */
+	int unbound_scan_engine;
+
+	/* The number of workers that build the scan trees
+	 */
+	int number_of_build_workers;
+
+	/* The byte value profile
+	 * used to shape the scan trees for the byte value distribution of the scanned data
+	 */
+	libsigscan_byte_value_profile_t *byte_value_profile;
+
+	/* Value to indicate the scanner is compiled
+	 * a compiled scanner can be shared by multiple threads
+	 */
+	uint8_t is_compiled;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock that protects the compilation of the scanner
+	 * and the publication of the scan tree generations
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 LIBSIGSCAN_EXTERN \
@@ -86,6 +134,51 @@ int libsigscan_scanner_set_scan_buffer_size(
      size_t scan_buffer_size,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_set_unbound_scan_engine(
+     libsigscan_scanner_t *scanner,
+     int unbound_scan_engine,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_get_unbound_skip_table_type(
+     libsigscan_scanner_t *scanner,
+     int *skip_table_type,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_get_number_of_build_workers(
+     libsigscan_scanner_t *scanner,
+     int *number_of_build_workers,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_set_number_of_build_workers(
+     libsigscan_scanner_t *scanner,
+     int number_of_build_workers,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_get_byte_value_profile(
+     libsigscan_scanner_t *scanner,
+     uint64_t *byte_value_counts,
+     int number_of_byte_values,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_set_byte_value_profile(
+     libsigscan_scanner_t *scanner,
+     const uint64_t *byte_value_counts,
+     int number_of_byte_values,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_add_byte_value_profile_data(
+     libsigscan_scanner_t *scanner,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scanner_add_signature(
      libsigscan_scanner_t *scanner,
@@ -97,6 +190,76 @@ int libsigscan_scanner_add_signature(
      uint32_t signature_flags,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_remove_signature(
+     libsigscan_scanner_t *scanner,
+     const char *identifier,
+     size_t identifier_length,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_get_number_of_signatures(
+     libsigscan_scanner_t *scanner,
+     int *number_of_signatures,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_get_signature_by_index(
+     libsigscan_internal_scanner_t *internal_scanner,
+     int signature_index,
+     libsigscan_signature_t **signature,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_get_signature_identifier_size(
+     libsigscan_scanner_t *scanner,
+     int signature_index,
+     size_t *identifier_size,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_get_signature_identifier(
+     libsigscan_scanner_t *scanner,
+     int signature_index,
+     char *identifier,
+     size_t identifier_size,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_build_unbound_scan_engine(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_tree_t *scan_tree,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libsigscan_internal_scanner_build_scan_tree_callback(
+     libsigscan_scan_tree_build_task_t *build_task,
+     libsigscan_internal_scanner_t *internal_scanner );
+
+int libsigscan_internal_scanner_build_scan_trees_in_parallel(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int libsigscan_internal_scanner_build_scan_trees(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_update_scan_trees(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_signature_t *signature,
+     int update_type,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_compile(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_compile(
+     libsigscan_scanner_t *scanner,
+     libcerror_error_t **error );
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scanner_scan_start(
      libsigscan_scanner_t *scanner,
@@ -117,6 +280,37 @@ int libsigscan_scanner_scan_buffer(
      size_t buffer_size,
      libcerror_error_t **error );
 
+int libsigscan_internal_scanner_get_scan_ranges(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     size64_t data_size,
+     uint64_t *header_range_start,
+     uint64_t *header_range_end,
+     uint64_t *header_range_size,
+     int *has_header_range,
+     uint64_t *footer_range_start,
+     uint64_t *footer_range_end,
+     uint64_t *footer_range_size,
+     int *has_footer_range,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBSIGSCAN_MAPPED_FILE )
+
+int libsigscan_internal_scanner_scan_mapped_file_range(
+     libsigscan_scan_state_t *scan_state,
+     libsigscan_mapped_file_t *mapped_file,
+     uint64_t range_start,
+     uint64_t range_size,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_scan_mapped_file(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libsigscan_mapped_file_t *mapped_file,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBSIGSCAN_MAPPED_FILE ) */
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scanner_scan_file(
      libsigscan_scanner_t *scanner,
@@ -142,6 +336,84 @@ int libsigscan_scanner_scan_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libsigscan_internal_scanner_write_image(
+     libsigscan_internal_scanner_t *internal_scanner,
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_size,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_get_image_size(
+     libsigscan_scanner_t *scanner,
+     size_t *image_size,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_write_image(
+     libsigscan_scanner_t *scanner,
+     uint8_t *image_data,
+     size_t image_data_size,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_set_image(
+     libsigscan_internal_scanner_t *internal_scanner,
+     const uint8_t *image_data,
+     size_t image_data_size,
+     uint8_t data_flags,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_set_image(
+     libsigscan_scanner_t *scanner,
+     const uint8_t *image_data,
+     size_t image_data_size,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_read_image_file(
+     libsigscan_scanner_t *scanner,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_read_image_file_wide(
+     libsigscan_scanner_t *scanner,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_read_image_file_io_handle(
+     libsigscan_scanner_t *scanner,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_write_image_file(
+     libsigscan_scanner_t *scanner,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_write_image_file_wide(
+     libsigscan_scanner_t *scanner,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_write_image_file_io_handle(
+     libsigscan_scanner_t *scanner,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,3543 @@
+/*
+ * Scanner image functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_aho_corasick.h"
+#include "libsigscan_checksum.h"
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcnotify.h"
+#include "libsigscan_prefilter.h"
+#include "libsigscan_scan_tree.h"
+#include "libsigscan_scan_tree_arena.h"
+#include "libsigscan_scanner_image.h"
+#include "libsigscan_signature.h"
+#include "libsigscan_skip_table.h"
+
+#include "sigscan_scanner_image.h"
+
+uint8_t sigscan_scanner_image_signature[ 8 ] = {
+	'S', 'I', 'G', 'S', 'C', 'I', 'M', 'G' };
+
+/* Creates a scanner image
+ * Make sure the value scanner_image is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_initialize(
+     libsigscan_scanner_image_t **scanner_image,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_image_initialize";
+
+	if( scanner_image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner image.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scanner_image != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner image value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*scanner_image = memory_allocate_structure(
+	                  libsigscan_scanner_image_t );
+
+	if( *scanner_image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scanner image.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scanner_image,
+	     0,
+	     sizeof( libsigscan_scanner_image_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scanner image.",
+		 function );
+
+		memory_free(
+		 *scanner_image );
+
+		*scanner_image = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *scanner_image != NULL )
+	{
+		memory_free(
+		 *scanner_image );
+
+		*scanner_image = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scanner image
+ * The image data is only freed if not referenced
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_free(
+     libsigscan_scanner_image_t **scanner_image,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_image_free";
+
+	if( scanner_image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner image.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scanner_image != NULL )
+	{
+		if( ( *scanner_image )->signature_indexes_hash_table != NULL )
+		{
+			memory_free(
+			 ( *scanner_image )->signature_indexes_hash_table );
+		}
+		if( ( *scanner_image )->signatures_hash_table != NULL )
+		{
+			memory_free(
+			 ( *scanner_image )->signatures_hash_table );
+		}
+		if( ( *scanner_image )->signatures != NULL )
+		{
+			memory_free(
+			 ( *scanner_image )->signatures );
+		}
+		if( ( ( ( *scanner_image )->data_flags & LIBSIGSCAN_SCAN_DATA_FLAG_REFERENCED ) == 0 )
+		 && ( ( *scanner_image )->image_data != NULL ) )
+		{
+			memory_free(
+			 ( *scanner_image )->image_data );
+		}
+		memory_free(
+		 *scanner_image );
+
+		*scanner_image = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the signatures hash table
+ * The hash table maps the signatures to their index in the signatures list, which is the image signature index
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_set_signatures_hash_table(
+     libsigscan_scanner_image_t *scanner_image,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	static char *function                 = "libsigscan_scanner_image_set_signatures_hash_table";
+	uint32_t hash_table_index             = 0;
+	uint32_t hash_table_size              = 0;
+	uint32_t signature_index              = 0;
+	int number_of_signatures              = 0;
+
+	if( scanner_image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner image.",
+		 function );
+
+		return( -1 );
+	}
+	if( scanner_image->signatures_hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner image - signatures hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_number_of_elements(
+	     signatures_list,
+	     &number_of_signatures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of signatures.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_signatures < 0 )
+	 || ( number_of_signatures > (int) ( LIBSIGSCAN_SCAN_TREE_ARENA_MAXIMUM_INDEX / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of signatures value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The hash table size is a power of 2 that is at least twice the number of signatures
+	 */
+	hash_table_size = 16;
+
+	while( hash_table_size < ( 2 * (uint32_t) number_of_signatures ) )
+	{
+		hash_table_size *= 2;
+	}
+	scanner_image->signatures_hash_table = (libsigscan_signature_t **) memory_allocate(
+	                                                                    sizeof( libsigscan_signature_t * ) * hash_table_size );
+
+	if( scanner_image->signatures_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create signatures hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     scanner_image->signatures_hash_table,
+	     0,
+	     sizeof( libsigscan_signature_t * ) * hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear signatures hash table.",
+		 function );
+
+		goto on_error;
+	}
+	scanner_image->signature_indexes_hash_table = (uint32_t *) memory_allocate(
+	                                                            sizeof( uint32_t ) * hash_table_size );
+
+	if( scanner_image->signature_indexes_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create signature indexes hash table.",
+		 function );
+
+		goto on_error;
+	}
+	scanner_image->signatures_hash_table_size = hash_table_size;
+
+	if( libcdata_list_get_first_element(
+	     signatures_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first signatures list element.",
+		 function );
+
+		goto on_error;
+	}
+	while( list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature: %" PRIu32 ".",
+			 function,
+			 signature_index );
+
+			goto on_error;
+		}
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature: %" PRIu32 ".",
+			 function,
+			 signature_index );
+
+			goto on_error;
+		}
+		hash_table_index = (uint32_t) ( ( (uint64_t) ( (intptr_t) signature >> 3 ) * 2654435761UL ) & ( hash_table_size - 1 ) );
+
+		while( scanner_image->signatures_hash_table[ hash_table_index ] != NULL )
+		{
+			hash_table_index = ( hash_table_index + 1 ) & ( hash_table_size - 1 );
+		}
+		scanner_image->signatures_hash_table[ hash_table_index ]        = signature;
+		scanner_image->signature_indexes_hash_table[ hash_table_index ] = signature_index;
+
+		signature_index++;
+
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next signatures list element.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	scanner_image->number_of_signatures = signature_index;
+
+	return( 1 );
+
+on_error:
+	if( scanner_image->signature_indexes_hash_table != NULL )
+	{
+		memory_free(
+		 scanner_image->signature_indexes_hash_table );
+
+		scanner_image->signature_indexes_hash_table = NULL;
+	}
+	if( scanner_image->signatures_hash_table != NULL )
+	{
+		memory_free(
+		 scanner_image->signatures_hash_table );
+
+		scanner_image->signatures_hash_table = NULL;
+	}
+	scanner_image->signatures_hash_table_size = 0;
+	scanner_image->number_of_signatures       = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the image signature index of a signature
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_get_signature_index(
+     libsigscan_scanner_image_t *scanner_image,
+     libsigscan_signature_t *signature,
+     uint32_t *signature_index,
+     libcerror_error_t **error )
+{
+	static char *function     = "libsigscan_scanner_image_get_signature_index";
+	uint32_t hash_table_index = 0;
+	uint32_t hash_table_size  = 0;
+
+	if( scanner_image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner image.",
+		 function );
+
+		return( -1 );
+	}
+	if( scanner_image->signatures_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scanner image - missing signatures hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature index.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_size  = scanner_image->signatures_hash_table_size;
+	hash_table_index = (uint32_t) ( ( (uint64_t) ( (intptr_t) signature >> 3 ) * 2654435761UL ) & ( hash_table_size - 1 ) );
+
+	while( scanner_image->signatures_hash_table[ hash_table_index ] != NULL )
+	{
+		if( scanner_image->signatures_hash_table[ hash_table_index ] == signature )
+		{
+			*signature_index = scanner_image->signature_indexes_hash_table[ hash_table_index ];
+
+			return( 1 );
+		}
+		hash_table_index = ( hash_table_index + 1 ) & ( hash_table_size - 1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+	 "%s: missing signature in signatures hash table.",
+	 function );
+
+	return( -1 );
+}
+
+/* Reserves aligned data in the image data
+ * If image data is NULL only the image data offset is updated, which is used to determine the image size
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_reserve_data(
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_data_offset,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error )
+{
+	static char *function     = "libsigscan_scanner_image_reserve_data";
+	size_t aligned_data_offset = 0;
+
+	if( image_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid image data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *image_data_offset > (size_t) ( SSIZE_MAX - LIBSIGSCAN_SCANNER_IMAGE_ALIGNMENT ) )
+	 || ( data_size > (size_t) ( SSIZE_MAX - LIBSIGSCAN_SCANNER_IMAGE_ALIGNMENT - *image_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_data_offset = ( *image_data_offset + ( LIBSIGSCAN_SCANNER_IMAGE_ALIGNMENT - 1 ) )
+	                    & ~( (size_t) LIBSIGSCAN_SCANNER_IMAGE_ALIGNMENT - 1 );
+
+	if( image_data != NULL )
+	{
+		if( ( aligned_data_offset > image_data_size )
+		 || ( data_size > ( image_data_size - aligned_data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid image data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		/* The padding and data are cleared so that the image does not contain undefined values
+		 */
+		if( memory_set(
+		     &( image_data[ *image_data_offset ] ),
+		     0,
+		     ( aligned_data_offset - *image_data_offset ) + data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*data_offset       = aligned_data_offset;
+	*image_data_offset = aligned_data_offset + data_size;
+
+	return( 1 );
+}
+
+/* Writes the signatures to the image data
+ * The signatures are written in the order of the signatures list
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_write_signatures(
+     libsigscan_scanner_image_t *scanner_image,
+     libcdata_list_t *signatures_list,
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_data_offset,
+     size_t *signatures_offset,
+     libcerror_error_t **error )
+{
+	sigscan_scanner_image_signature_t *image_signature = NULL;
+	libcdata_list_element_t *list_element              = NULL;
+	libsigscan_signature_t *signature                  = NULL;
+	static char *function                              = "libsigscan_scanner_image_write_signatures";
+	size_t data_offset                                 = 0;
+	size_t records_offset                              = 0;
+	uint32_t signature_index                           = 0;
+
+	if( scanner_image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner image.",
+		 function );
+
+		return( -1 );
+	}
+	if( signatures_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signatures offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scanner_image_reserve_data(
+	     image_data,
+	     image_data_size,
+	     image_data_offset,
+	     sizeof( sigscan_scanner_image_signature_t ) * scanner_image->number_of_signatures,
+	     &records_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reserve signatures.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_first_element(
+	     signatures_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first signatures list element.",
+		 function );
+
+		return( -1 );
+	}
+	while( list_element != NULL )
+	{
+		if( signature_index >= scanner_image->number_of_signatures )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid signature index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature: %" PRIu32 ".",
+			 function,
+			 signature_index );
+
+			return( -1 );
+		}
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature: %" PRIu32 ".",
+			 function,
+			 signature_index );
+
+			return( -1 );
+		}
+		if( ( signature->identifier_size > (size_t) UINT32_MAX )
+		 || ( signature->pattern_size > (size_t) UINT32_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid signature: %" PRIu32 " size value exceeds maximum.",
+			 function,
+			 signature_index );
+
+			return( -1 );
+		}
+		if( libsigscan_scanner_image_reserve_data(
+		     image_data,
+		     image_data_size,
+		     image_data_offset,
+		     signature->identifier_size + signature->pattern_size,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reserve signature: %" PRIu32 " data.",
+			 function,
+			 signature_index );
+
+			return( -1 );
+		}
+		if( image_data != NULL )
+		{
+			if( memory_copy(
+			     &( image_data[ data_offset ] ),
+			     signature->identifier,
+			     signature->identifier_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy signature: %" PRIu32 " identifier.",
+				 function,
+				 signature_index );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( image_data[ data_offset + signature->identifier_size ] ),
+			     signature->pattern,
+			     signature->pattern_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy signature: %" PRIu32 " pattern.",
+				 function,
+				 signature_index );
+
+				return( -1 );
+			}
+			image_signature = (sigscan_scanner_image_signature_t *) &( image_data[ records_offset ] );
+
+			image_signature = &( image_signature[ signature_index ] );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 image_signature->pattern_offset,
+			 signature->pattern_offset );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 image_signature->data_offset,
+			 data_offset );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 image_signature->identifier_size,
+			 signature->identifier_size );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 image_signature->pattern_size,
+			 signature->pattern_size );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 image_signature->signature_flags,
+			 signature->signature_flags );
+		}
+		signature_index++;
+
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next signatures list element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*signatures_offset = records_offset;
+
+	return( 1 );
+}
+
+/* Writes a skip table to the image data
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_write_skip_table(
+     libsigscan_skip_table_t *skip_table,
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_data_offset,
+     size_t *skip_table_offset,
+     libcerror_error_t **error )
+{
+	sigscan_scanner_image_skip_table_t *image_skip_table = NULL;
+	static char *function                                = "libsigscan_scanner_image_write_skip_table";
+	size_t block_skip_values_offset                      = 0;
+	size_t prefix_hashes_offset                          = 0;
+	size_t record_offset                                 = 0;
+	uint16_t byte_value                                  = 0;
+
+	if( skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( skip_table_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scanner_image_reserve_data(
+	     image_data,
+	     image_data_size,
+	     image_data_offset,
+	     sizeof( sigscan_scanner_image_skip_table_t ),
+	     &record_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reserve skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( skip_table->block_skip_values != NULL )
+	{
+		if( libsigscan_scanner_image_reserve_data(
+		     image_data,
+		     image_data_size,
+		     image_data_offset,
+		     sizeof( uint8_t ) * LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_HASHES,
+		     &block_skip_values_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reserve block skip values.",
+			 function );
+
+			return( -1 );
+		}
+		if( image_data != NULL )
+		{
+			if( memory_copy(
+			     &( image_data[ block_skip_values_offset ] ),
+			     skip_table->block_skip_values,
+			     sizeof( uint8_t ) * LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_HASHES ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy block skip values.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( skip_table->prefix_hashes != NULL )
+	{
+		if( libsigscan_scanner_image_reserve_data(
+		     image_data,
+		     image_data_size,
+		     image_data_offset,
+		     sizeof( uint8_t ) * ( LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_HASHES / 8 ),
+		     &prefix_hashes_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reserve prefix hashes.",
+			 function );
+
+			return( -1 );
+		}
+		if( image_data != NULL )
+		{
+			if( memory_copy(
+			     &( image_data[ prefix_hashes_offset ] ),
+			     skip_table->prefix_hashes,
+			     sizeof( uint8_t ) * ( LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_HASHES / 8 ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy prefix hashes.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( image_data != NULL )
+	{
+		image_skip_table = (sigscan_scanner_image_skip_table_t *) &( image_data[ record_offset ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_skip_table->largest_pattern_size,
+		 skip_table->largest_pattern_size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_skip_table->smallest_pattern_size,
+		 skip_table->smallest_pattern_size );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 image_skip_table->table_type,
+		 skip_table->table_type );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 image_skip_table->block_size,
+		 skip_table->block_size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_skip_table->block_skip_values_offset,
+		 block_skip_values_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_skip_table->prefix_hashes_offset,
+		 prefix_hashes_offset );
+
+		/* The skip values are at most the smallest pattern size
+		 */
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( image_skip_table->skip_values[ byte_value * 4 ] ),
+			 skip_table->skip_values[ byte_value ] );
+		}
+	}
+	*skip_table_offset = record_offset;
+
+	return( 1 );
+}
+
+/* Writes an Aho-Corasick automaton to the image data
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_write_aho_corasick(
+     libsigscan_scanner_image_t *scanner_image,
+     libsigscan_aho_corasick_t *aho_corasick,
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_data_offset,
+     size_t *aho_corasick_offset,
+     libcerror_error_t **error )
+{
+	sigscan_scanner_image_aho_corasick_t *image_aho_corasick = NULL;
+	uint32_t *output_signature_indexes                       = NULL;
+	static char *function                                    = "libsigscan_scanner_image_write_aho_corasick";
+	size_t output_signatures_offset                          = 0;
+	size_t record_offset                                     = 0;
+	size_t transitions_table_offset                          = 0;
+	size_t transitions_table_size                            = 0;
+	uint32_t signature_index                                 = 0;
+	uint32_t state_index                                     = 0;
+
+	if( scanner_image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner image.",
+		 function );
+
+		return( -1 );
+	}
+	if( aho_corasick == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Aho-Corasick automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( aho_corasick->transitions_table == NULL )
+	 || ( aho_corasick->output_signatures == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid Aho-Corasick automaton - missing states.",
+		 function );
+
+		return( -1 );
+	}
+	if( aho_corasick_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Aho-Corasick automaton offset.",
+		 function );
+
+		return( -1 );
+	}
+	transitions_table_size = sizeof( uint32_t ) * 256 * (size_t) aho_corasick->number_of_states;
+
+	if( libsigscan_scanner_image_reserve_data(
+	     image_data,
+	     image_data_size,
+	     image_data_offset,
+	     sizeof( sigscan_scanner_image_aho_corasick_t ),
+	     &record_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reserve Aho-Corasick automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scanner_image_reserve_data(
+	     image_data,
+	     image_data_size,
+	     image_data_offset,
+	     transitions_table_size,
+	     &transitions_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reserve transitions table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scanner_image_reserve_data(
+	     image_data,
+	     image_data_size,
+	     image_data_offset,
+	     sizeof( uint32_t ) * (size_t) aho_corasick->number_of_states,
+	     &output_signatures_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reserve output signatures.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_data != NULL )
+	{
+		if( memory_copy(
+		     &( image_data[ transitions_table_offset ] ),
+		     aho_corasick->transitions_table,
+		     transitions_table_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy transitions table.",
+			 function );
+
+			return( -1 );
+		}
+		/* The output signatures are stored as image signature index + 1 where 0 represents no signature
+		 */
+		output_signature_indexes = (uint32_t *) &( image_data[ output_signatures_offset ] );
+
+		for( state_index = 0;
+		     state_index < aho_corasick->number_of_states;
+		     state_index++ )
+		{
+			if( aho_corasick->output_signatures[ state_index ] == NULL )
+			{
+				continue;
+			}
+			if( libsigscan_scanner_image_get_signature_index(
+			     scanner_image,
+			     aho_corasick->output_signatures[ state_index ],
+			     &signature_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve state: %" PRIu32 " output signature index.",
+				 function,
+				 state_index );
+
+				return( -1 );
+			}
+			output_signature_indexes[ state_index ] = signature_index + 1;
+		}
+		image_aho_corasick = (sigscan_scanner_image_aho_corasick_t *) &( image_data[ record_offset ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 image_aho_corasick->number_of_signatures,
+		 aho_corasick->number_of_signatures );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 image_aho_corasick->number_of_states,
+		 aho_corasick->number_of_states );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_aho_corasick->largest_pattern_size,
+		 aho_corasick->largest_pattern_size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_aho_corasick->transitions_table_offset,
+		 transitions_table_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_aho_corasick->output_signatures_offset,
+		 output_signatures_offset );
+	}
+	*aho_corasick_offset = record_offset;
+
+	return( 1 );
+}
+
+/* Writes a prefilter to the image data
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_write_prefilter(
+     libsigscan_prefilter_t *prefilter,
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_data_offset,
+     size_t *prefilter_offset,
+     libcerror_error_t **error )
+{
+	sigscan_scanner_image_prefilter_t *image_prefilter = NULL;
+	static char *function                              = "libsigscan_scanner_image_write_prefilter";
+	size_t record_offset                               = 0;
+
+	if( prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefilter_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefilter offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scanner_image_reserve_data(
+	     image_data,
+	     image_data_size,
+	     image_data_offset,
+	     sizeof( sigscan_scanner_image_prefilter_t ),
+	     &record_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reserve prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_data != NULL )
+	{
+		image_prefilter = (sigscan_scanner_image_prefilter_t *) &( image_data[ record_offset ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_prefilter->pattern_offset,
+		 prefilter->pattern_offset );
+
+		if( memory_copy(
+		     image_prefilter->byte_values_table,
+		     prefilter->byte_values_table,
+		     256 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy byte values table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*prefilter_offset = record_offset;
+
+	return( 1 );
+}
+
+/* Writes a scan tree to the image data
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_write_scan_tree(
+     libsigscan_scanner_image_t *scanner_image,
+     libsigscan_scan_tree_t *scan_tree,
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_data_offset,
+     size_t *scan_tree_offset,
+     libcerror_error_t **error )
+{
+	sigscan_scanner_image_scan_tree_t *image_scan_tree = NULL;
+	libsigscan_scan_tree_arena_t *scan_tree_arena      = NULL;
+	uint32_t *signature_indexes                        = NULL;
+	static char *function                              = "libsigscan_scanner_image_write_scan_tree";
+	size_t aho_corasick_offset                         = 0;
+	size_t nodes_offset                                = 0;
+	size_t prefilter_offset                            = 0;
+	size_t record_offset                               = 0;
+	size_t references_offset                           = 0;
+	size_t signature_indexes_offset                    = 0;
+	size_t skip_table_offset                           = 0;
+	uint64_t range_size                                = 0;
+	uint64_t range_start                               = 0;
+	uint32_t signature_index                           = 0;
+	int result                                         = 0;
+
+	if( scanner_image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner image.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree->arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan tree - missing arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree offset.",
+		 function );
+
+		return( -1 );
+	}
+	scan_tree_arena = scan_tree->arena;
+
+	result = libsigscan_scan_tree_get_spanning_range(
+	          scan_tree,
+	          &range_start,
+	          &range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve pattern spanning range.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		range_start = 0;
+		range_size  = 0;
+	}
+	if( libsigscan_scanner_image_reserve_data(
+	     image_data,
+	     image_data_size,
+	     image_data_offset,
+	     sizeof( sigscan_scanner_image_scan_tree_t ),
+	     &record_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reserve scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scanner_image_reserve_data(
+	     image_data,
+	     image_data_size,
+	     image_data_offset,
+	     sizeof( libsigscan_scan_tree_arena_node_t ) * (size_t) scan_tree_arena->number_of_nodes,
+	     &nodes_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reserve nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scanner_image_reserve_data(
+	     image_data,
+	     image_data_size,
+	     image_data_offset,
+	     sizeof( uint32_t ) * (size_t) scan_tree_arena->number_of_references,
+	     &references_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reserve references.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scanner_image_reserve_data(
+	     image_data,
+	     image_data_size,
+	     image_data_offset,
+	     sizeof( uint32_t ) * (size_t) scan_tree_arena->number_of_signatures,
+	     &signature_indexes_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reserve signature indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_data != NULL )
+	{
+		if( memory_copy(
+		     &( image_data[ nodes_offset ] ),
+		     scan_tree_arena->nodes,
+		     sizeof( libsigscan_scan_tree_arena_node_t ) * (size_t) scan_tree_arena->number_of_nodes ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy nodes.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( image_data[ references_offset ] ),
+		     scan_tree_arena->references,
+		     sizeof( uint32_t ) * (size_t) scan_tree_arena->number_of_references ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy references.",
+			 function );
+
+			return( -1 );
+		}
+		signature_indexes = (uint32_t *) &( image_data[ signature_indexes_offset ] );
+
+		for( signature_index = 0;
+		     signature_index < scan_tree_arena->number_of_signatures;
+		     signature_index++ )
+		{
+			if( libsigscan_scanner_image_get_signature_index(
+			     scanner_image,
+			     scan_tree_arena->signatures[ signature_index ],
+			     &( signature_indexes[ signature_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve signature: %" PRIu32 " index.",
+				 function,
+				 signature_index );
+
+				return( -1 );
+			}
+		}
+	}
+	if( scan_tree->skip_table != NULL )
+	{
+		if( libsigscan_scanner_image_write_skip_table(
+		     scan_tree->skip_table,
+		     image_data,
+		     image_data_size,
+		     image_data_offset,
+		     &skip_table_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write skip table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( scan_tree->aho_corasick != NULL )
+	{
+		if( libsigscan_scanner_image_write_aho_corasick(
+		     scanner_image,
+		     scan_tree->aho_corasick,
+		     image_data,
+		     image_data_size,
+		     image_data_offset,
+		     &aho_corasick_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write Aho-Corasick automaton.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( scan_tree->prefilter != NULL )
+	{
+		if( libsigscan_scanner_image_write_prefilter(
+		     scan_tree->prefilter,
+		     image_data,
+		     image_data_size,
+		     image_data_offset,
+		     &prefilter_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write prefilter.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( image_data != NULL )
+	{
+		image_scan_tree = (sigscan_scanner_image_scan_tree_t *) &( image_data[ record_offset ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 image_scan_tree->pattern_offsets_mode,
+		 scan_tree->pattern_offsets_mode );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 image_scan_tree->root_reference,
+		 scan_tree_arena->root_reference );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_scan_tree->range_start,
+		 range_start );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_scan_tree->range_size,
+		 range_size );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 image_scan_tree->number_of_nodes,
+		 scan_tree_arena->number_of_nodes );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 image_scan_tree->number_of_references,
+		 scan_tree_arena->number_of_references );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 image_scan_tree->number_of_signatures,
+		 scan_tree_arena->number_of_signatures );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_scan_tree->nodes_offset,
+		 nodes_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_scan_tree->references_offset,
+		 references_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_scan_tree->signature_indexes_offset,
+		 signature_indexes_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_scan_tree->skip_table_offset,
+		 skip_table_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_scan_tree->aho_corasick_offset,
+		 aho_corasick_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 image_scan_tree->prefilter_offset,
+		 prefilter_offset );
+	}
+	*scan_tree_offset = record_offset;
+
+	return( 1 );
+}
+
+/* Writes the signatures and scan trees to the image data
+ * If image data is NULL only the image size is determined
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_write(
+     libsigscan_scanner_image_t *scanner_image,
+     libcdata_list_t *signatures_list,
+     libsigscan_scan_tree_t *header_scan_tree,
+     libsigscan_scan_tree_t *footer_scan_tree,
+     libsigscan_scan_tree_t *scan_tree,
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_size,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_tree_t *scan_trees[ 3 ]           = { NULL, NULL, NULL };
+	sigscan_scanner_image_file_header_t *file_header = NULL;
+	static char *function                            = "libsigscan_scanner_image_write";
+	size_t file_header_offset                        = 0;
+	size_t image_data_offset                         = 0;
+	size_t scan_tree_offsets[ 3 ]                    = { 0, 0, 0 };
+	size_t signatures_offset                         = 0;
+	uint32_t byte_order_marker                       = LIBSIGSCAN_SCANNER_IMAGE_BYTE_ORDER_MARKER;
+	uint32_t checksum                                = 0;
+	int scan_tree_index                              = 0;
+
+	if( scanner_image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner image.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image size.",
+		 function );
+
+		return( -1 );
+	}
+	if( scanner_image->signatures_hash_table == NULL )
+	{
+		if( libsigscan_scanner_image_set_signatures_hash_table(
+		     scanner_image,
+		     signatures_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set signatures hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libsigscan_scanner_image_reserve_data(
+	     image_data,
+	     image_data_size,
+	     &image_data_offset,
+	     sizeof( sigscan_scanner_image_file_header_t ),
+	     &file_header_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reserve file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scanner_image_write_signatures(
+	     scanner_image,
+	     signatures_list,
+	     image_data,
+	     image_data_size,
+	     &image_data_offset,
+	     &signatures_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write signatures.",
+		 function );
+
+		return( -1 );
+	}
+	scan_trees[ 0 ] = header_scan_tree;
+	scan_trees[ 1 ] = footer_scan_tree;
+	scan_trees[ 2 ] = scan_tree;
+
+	/* Scan trees without patterns are not stored in the image
+	 */
+	for( scan_tree_index = 0;
+	     scan_tree_index < 3;
+	     scan_tree_index++ )
+	{
+		if( ( scan_trees[ scan_tree_index ] == NULL )
+		 || ( scan_trees[ scan_tree_index ]->arena == NULL ) )
+		{
+			continue;
+		}
+		if( libsigscan_scanner_image_write_scan_tree(
+		     scanner_image,
+		     scan_trees[ scan_tree_index ],
+		     image_data,
+		     image_data_size,
+		     &image_data_offset,
+		     &( scan_tree_offsets[ scan_tree_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write scan tree: %d.",
+			 function,
+			 scan_tree_index );
+
+			return( -1 );
+		}
+	}
+	if( image_data != NULL )
+	{
+		if( libsigscan_checksum_calculate_adler32(
+		     &checksum,
+		     &( image_data[ sizeof( sigscan_scanner_image_file_header_t ) ] ),
+		     image_data_offset - sizeof( sigscan_scanner_image_file_header_t ),
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			return( -1 );
+		}
+		file_header = (sigscan_scanner_image_file_header_t *) &( image_data[ file_header_offset ] );
+
+		if( memory_copy(
+		     file_header->signature,
+		     sigscan_scanner_image_signature,
+		     8 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy signature.",
+			 function );
+
+			return( -1 );
+		}
+		/* The byte order marker is stored in the byte order of the system
+		 */
+		if( memory_copy(
+		     file_header->byte_order_marker,
+		     &byte_order_marker,
+		     4 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy byte order marker.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header->format_version,
+		 LIBSIGSCAN_SCANNER_IMAGE_FORMAT_VERSION );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 file_header->node_size,
+		 sizeof( libsigscan_scan_tree_arena_node_t ) );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header->checksum,
+		 checksum );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 file_header->image_size,
+		 image_data_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header->number_of_signatures,
+		 scanner_image->number_of_signatures );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 file_header->signatures_offset,
+		 signatures_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 file_header->header_scan_tree_offset,
+		 scan_tree_offsets[ 0 ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 file_header->footer_scan_tree_offset,
+		 scan_tree_offsets[ 1 ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 file_header->scan_tree_offset,
+		 scan_tree_offsets[ 2 ] );
+	}
+	*image_size = image_data_offset;
+
+	return( 1 );
+}
+
+/* Retrieves data from the image data
+ * The data offset must be aligned so that the data can be used without copying
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_get_data(
+     libsigscan_scanner_image_t *scanner_image,
+     uint64_t data_offset,
+     uint64_t data_size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_image_get_data";
+
+	if( scanner_image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner image.",
+		 function );
+
+		return( -1 );
+	}
+	if( scanner_image->image_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scanner image - missing image data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset % LIBSIGSCAN_SCANNER_IMAGE_ALIGNMENT ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported data offset: 0x%08" PRIx64 " alignment.",
+		 function,
+		 data_offset );
+
+		return( -1 );
+	}
+	if( ( data_offset > (uint64_t) scanner_image->image_data_size )
+	 || ( data_size > ( (uint64_t) scanner_image->image_data_size - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset: 0x%08" PRIx64 " or size: %" PRIu64 " value out of bounds.",
+		 function,
+		 data_offset,
+		 data_size );
+
+		return( -1 );
+	}
+	*data = &( scanner_image->image_data[ data_offset ] );
+
+	return( 1 );
+}
+
+/* Reads the file header
+ * Returns 1 if successful, 0 if the image is not compatible or -1 on error
+ */
+int libsigscan_scanner_image_read_file_header(
+     libsigscan_scanner_image_t *scanner_image,
+     uint64_t *signatures_offset,
+     uint64_t *header_scan_tree_offset,
+     uint64_t *footer_scan_tree_offset,
+     uint64_t *scan_tree_offset,
+     libcerror_error_t **error )
+{
+	sigscan_scanner_image_file_header_t *file_header = NULL;
+	const uint8_t *data                              = NULL;
+	static char *function                            = "libsigscan_scanner_image_read_file_header";
+	uint64_t image_size                              = 0;
+	uint32_t byte_order_marker                       = 0;
+	uint32_t calculated_checksum                     = 0;
+	uint32_t format_version                          = 0;
+	uint32_t stored_checksum                         = 0;
+	uint16_t node_size                               = 0;
+
+	if( scanner_image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner image.",
+		 function );
+
+		return( -1 );
+	}
+	if( signatures_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signatures offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( header_scan_tree_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header scan tree offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( footer_scan_tree_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid footer scan tree offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scanner_image_get_data(
+	     scanner_image,
+	     0,
+	     sizeof( sigscan_scanner_image_file_header_t ),
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve file header data.",
+		 function );
+
+		return( -1 );
+	}
+	file_header = (sigscan_scanner_image_file_header_t *) data;
+
+	if( memory_compare(
+	     file_header->signature,
+	     sigscan_scanner_image_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->format_version,
+	 format_version );
+
+	if( memory_copy(
+	     &byte_order_marker,
+	     file_header->byte_order_marker,
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte order marker.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 file_header->node_size,
+	 node_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->checksum,
+	 stored_checksum );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->image_size,
+	 image_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->number_of_signatures,
+	 scanner_image->number_of_signatures );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->signatures_offset,
+	 *signatures_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->header_scan_tree_offset,
+	 *header_scan_tree_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->footer_scan_tree_offset,
+	 *footer_scan_tree_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->scan_tree_offset,
+	 *scan_tree_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: byte order marker\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 byte_order_marker );
+
+		libcnotify_printf(
+		 "%s: node size\t\t\t\t: %" PRIu16 "\n",
+		 function,
+		 node_size );
+
+		libcnotify_printf(
+		 "%s: checksum\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 stored_checksum );
+
+		libcnotify_printf(
+		 "%s: image size\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 image_size );
+
+		libcnotify_printf(
+		 "%s: number of signatures\t\t: %" PRIu32 "\n",
+		 function,
+		 scanner_image->number_of_signatures );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	/* An image written by a different version or on a system with a different
+	 * byte order or structure layout cannot be used without conversion
+	 */
+	if( ( format_version != LIBSIGSCAN_SCANNER_IMAGE_FORMAT_VERSION )
+	 || ( byte_order_marker != LIBSIGSCAN_SCANNER_IMAGE_BYTE_ORDER_MARKER )
+	 || ( node_size != (uint16_t) sizeof( libsigscan_scan_tree_arena_node_t ) ) )
+	{
+		return( 0 );
+	}
+	if( ( image_size < (uint64_t) sizeof( sigscan_scanner_image_file_header_t ) )
+	 || ( image_size > (uint64_t) scanner_image->image_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid image size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Data after the image is ignored
+	 */
+	scanner_image->image_data_size = (size_t) image_size;
+
+	if( libsigscan_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     &( scanner_image->image_data[ sizeof( sigscan_scanner_image_file_header_t ) ] ),
+	     scanner_image->image_data_size - sizeof( sigscan_scanner_image_file_header_t ),
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the signatures
+ * The identifiers and patterns of the signatures reference the image data
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_read_signatures(
+     libsigscan_scanner_image_t *scanner_image,
+     uint64_t signatures_offset,
+     libcerror_error_t **error )
+{
+	sigscan_scanner_image_signature_t *image_signatures = NULL;
+	libsigscan_signature_t *signature                   = NULL;
+	const uint8_t *data                                 = NULL;
+	static char *function                               = "libsigscan_scanner_image_read_signatures";
+	uint64_t data_offset                                = 0;
+	uint64_t pattern_offset                             = 0;
+	uint32_t identifier_size                            = 0;
+	uint32_t pattern_size                               = 0;
+	uint32_t signature_index                            = 0;
+
+	if( scanner_image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner image.",
+		 function );
+
+		return( -1 );
+	}
+	if( scanner_image->signatures != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner image - signatures value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( scanner_image->number_of_signatures == 0 )
+	{
+		return( 1 );
+	}
+	if( libsigscan_scanner_image_get_data(
+	     scanner_image,
+	     signatures_offset,
+	     (uint64_t) sizeof( sigscan_scanner_image_signature_t ) * scanner_image->number_of_signatures,
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve signatures data.",
+		 function );
+
+		goto on_error;
+	}
+	image_signatures = (sigscan_scanner_image_signature_t *) data;
+
+	scanner_image->signatures = (libsigscan_signature_t *) memory_allocate(
+	                                                        sizeof( libsigscan_signature_t ) * scanner_image->number_of_signatures );
+
+	if( scanner_image->signatures == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create signatures.",
+		 function );
+
+		goto on_error;
+	}
+	for( signature_index = 0;
+	     signature_index < scanner_image->number_of_signatures;
+	     signature_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 image_signatures[ signature_index ].pattern_offset,
+		 pattern_offset );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 image_signatures[ signature_index ].data_offset,
+		 data_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 image_signatures[ signature_index ].identifier_size,
+		 identifier_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 image_signatures[ signature_index ].pattern_size,
+		 pattern_size );
+
+		if( ( identifier_size == 0 )
+		 || ( pattern_size == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid signature: %" PRIu32 " size value out of bounds.",
+			 function,
+			 signature_index );
+
+			goto on_error;
+		}
+		if( libsigscan_scanner_image_get_data(
+		     scanner_image,
+		     data_offset,
+		     (uint64_t) identifier_size + pattern_size,
+		     &data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to retrieve signature: %" PRIu32 " data.",
+			 function,
+			 signature_index );
+
+			goto on_error;
+		}
+		if( data[ identifier_size - 1 ] != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported signature: %" PRIu32 " identifier - missing end-of-string character.",
+			 function,
+			 signature_index );
+
+			goto on_error;
+		}
+		signature = &( scanner_image->signatures[ signature_index ] );
+
+		signature->identifier      = (char *) data;
+		signature->identifier_size = (size_t) identifier_size;
+		signature->pattern_offset  = (off64_t) pattern_offset;
+		signature->pattern         = (uint8_t *) &( data[ identifier_size ] );
+		signature->pattern_size    = (size_t) pattern_size;
+		signature->signature_index = (int) signature_index;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 image_signatures[ signature_index ].signature_flags,
+		 signature->signature_flags );
+	}
+	return( 1 );
+
+on_error:
+	if( scanner_image->signatures != NULL )
+	{
+		memory_free(
+		 scanner_image->signatures );
+
+		scanner_image->signatures = NULL;
+	}
+	return( -1 );
+}
+
+/* Reads a skip table
+ * The block skip values and prefix hashes reference the image data
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_read_skip_table(
+     libsigscan_scanner_image_t *scanner_image,
+     uint64_t skip_table_offset,
+     libsigscan_skip_table_t **skip_table,
+     libcerror_error_t **error )
+{
+	sigscan_scanner_image_skip_table_t *image_skip_table = NULL;
+	const uint8_t *data                                  = NULL;
+	static char *function                                = "libsigscan_scanner_image_read_skip_table";
+	uint64_t block_skip_values_offset                    = 0;
+	uint64_t largest_pattern_size                        = 0;
+	uint64_t prefix_hashes_offset                        = 0;
+	uint64_t smallest_pattern_size                       = 0;
+	uint32_t block_size                                  = 0;
+	uint32_t skip_value                                  = 0;
+	uint32_t table_type                                  = 0;
+	uint16_t byte_value                                  = 0;
+
+	if( skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scanner_image_get_data(
+	     scanner_image,
+	     skip_table_offset,
+	     sizeof( sigscan_scanner_image_skip_table_t ),
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve skip table data.",
+		 function );
+
+		goto on_error;
+	}
+	image_skip_table = (sigscan_scanner_image_skip_table_t *) data;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_skip_table->largest_pattern_size,
+	 largest_pattern_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_skip_table->smallest_pattern_size,
+	 smallest_pattern_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 image_skip_table->table_type,
+	 table_type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 image_skip_table->block_size,
+	 block_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_skip_table->block_skip_values_offset,
+	 block_skip_values_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_skip_table->prefix_hashes_offset,
+	 prefix_hashes_offset );
+
+	if( ( smallest_pattern_size == 0 )
+	 || ( smallest_pattern_size > largest_pattern_size )
+	 || ( largest_pattern_size > (uint64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid pattern size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( table_type == LIBSIGSCAN_SKIP_TABLE_TYPE_BLOCK )
+	{
+		if( ( ( block_size != 2 )
+		  &&  ( block_size != 3 ) )
+		 || ( (uint64_t) block_size > smallest_pattern_size )
+		 || ( block_skip_values_offset == 0 )
+		 || ( prefix_hashes_offset == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported block skip table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( table_type != LIBSIGSCAN_SKIP_TABLE_TYPE_BYTE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported table type: %" PRIu32 ".",
+		 function,
+		 table_type );
+
+		goto on_error;
+	}
+	if( libsigscan_skip_table_initialize(
+	     skip_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create skip table.",
+		 function );
+
+		goto on_error;
+	}
+	( *skip_table )->data_flags            = LIBSIGSCAN_SCAN_DATA_FLAG_REFERENCED;
+	( *skip_table )->largest_pattern_size  = (size_t) largest_pattern_size;
+	( *skip_table )->smallest_pattern_size = (size_t) smallest_pattern_size;
+	( *skip_table )->table_type            = (int) table_type;
+
+	/* A skip value of 0 represents the smallest pattern size
+	 */
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( image_skip_table->skip_values[ byte_value * 4 ] ),
+		 skip_value );
+
+		if( (uint64_t) skip_value > smallest_pattern_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid skip value: 0x%02" PRIx16 " value out of bounds.",
+			 function,
+			 byte_value );
+
+			goto on_error;
+		}
+		( *skip_table )->skip_values[ byte_value ] = (size_t) skip_value;
+	}
+	if( table_type == LIBSIGSCAN_SKIP_TABLE_TYPE_BLOCK )
+	{
+		if( libsigscan_scanner_image_get_data(
+		     scanner_image,
+		     block_skip_values_offset,
+		     LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_HASHES,
+		     &data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to retrieve block skip values data.",
+			 function );
+
+			goto on_error;
+		}
+		( *skip_table )->block_skip_values = (uint8_t *) data;
+
+		if( libsigscan_scanner_image_get_data(
+		     scanner_image,
+		     prefix_hashes_offset,
+		     LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_HASHES / 8,
+		     &data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to retrieve prefix hashes data.",
+			 function );
+
+			goto on_error;
+		}
+		( *skip_table )->prefix_hashes = (uint8_t *) data;
+		( *skip_table )->block_size    = (size_t) block_size;
+	}
+	return( 1 );
+
+on_error:
+	if( *skip_table != NULL )
+	{
+		libsigscan_skip_table_free(
+		 skip_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads an Aho-Corasick automaton
+ * The transitions table references the image data
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_read_aho_corasick(
+     libsigscan_scanner_image_t *scanner_image,
+     uint64_t aho_corasick_offset,
+     libsigscan_aho_corasick_t **aho_corasick,
+     libcerror_error_t **error )
+{
+	sigscan_scanner_image_aho_corasick_t *image_aho_corasick = NULL;
+	const uint32_t *output_signature_indexes                 = NULL;
+	const uint32_t *transitions_table                        = NULL;
+	const uint8_t *data                                      = NULL;
+	static char *function                                    = "libsigscan_scanner_image_read_aho_corasick";
+	uint64_t largest_pattern_size                            = 0;
+	uint64_t output_signatures_offset                        = 0;
+	uint64_t transition_index                                = 0;
+	uint64_t transitions_table_offset                        = 0;
+	uint32_t number_of_signatures                            = 0;
+	uint32_t number_of_states                                = 0;
+	uint32_t state_index                                     = 0;
+
+	if( scanner_image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner image.",
+		 function );
+
+		return( -1 );
+	}
+	if( aho_corasick == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Aho-Corasick automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scanner_image_get_data(
+	     scanner_image,
+	     aho_corasick_offset,
+	     sizeof( sigscan_scanner_image_aho_corasick_t ),
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve Aho-Corasick automaton data.",
+		 function );
+
+		goto on_error;
+	}
+	image_aho_corasick = (sigscan_scanner_image_aho_corasick_t *) data;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 image_aho_corasick->number_of_signatures,
+	 number_of_signatures );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 image_aho_corasick->number_of_states,
+	 number_of_states );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_aho_corasick->largest_pattern_size,
+	 largest_pattern_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_aho_corasick->transitions_table_offset,
+	 transitions_table_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_aho_corasick->output_signatures_offset,
+	 output_signatures_offset );
+
+	if( ( number_of_states == 0 )
+	 || ( number_of_states > ( UINT32_MAX / 256 ) )
+	 || ( number_of_signatures > (uint32_t) INT_MAX )
+	 || ( largest_pattern_size > (uint64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid Aho-Corasick automaton value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_image_get_data(
+	     scanner_image,
+	     transitions_table_offset,
+	     (uint64_t) sizeof( uint32_t ) * 256 * number_of_states,
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve transitions table data.",
+		 function );
+
+		goto on_error;
+	}
+	transitions_table = (const uint32_t *) data;
+
+	/* Every transition must refer to an existing state
+	 */
+	for( transition_index = 0;
+	     transition_index < ( (uint64_t) 256 * number_of_states );
+	     transition_index++ )
+	{
+		if( transitions_table[ transition_index ] >= number_of_states )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid transition: %" PRIu64 " value out of bounds.",
+			 function,
+			 transition_index );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_scanner_image_get_data(
+	     scanner_image,
+	     output_signatures_offset,
+	     (uint64_t) sizeof( uint32_t ) * number_of_states,
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve output signatures data.",
+		 function );
+
+		goto on_error;
+	}
+	output_signature_indexes = (const uint32_t *) data;
+
+	if( libsigscan_aho_corasick_initialize(
+	     aho_corasick,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create Aho-Corasick automaton.",
+		 function );
+
+		goto on_error;
+	}
+	( *aho_corasick )->data_flags = LIBSIGSCAN_SCAN_DATA_FLAG_REFERENCED;
+
+	( *aho_corasick )->output_signatures = (libsigscan_signature_t **) memory_allocate(
+	                                                                    sizeof( libsigscan_signature_t * ) * number_of_states );
+
+	if( ( *aho_corasick )->output_signatures == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output signatures.",
+		 function );
+
+		goto on_error;
+	}
+	for( state_index = 0;
+	     state_index < number_of_states;
+	     state_index++ )
+	{
+		if( output_signature_indexes[ state_index ] == 0 )
+		{
+			( *aho_corasick )->output_signatures[ state_index ] = NULL;
+		}
+		else if( output_signature_indexes[ state_index ] <= scanner_image->number_of_signatures )
+		{
+			( *aho_corasick )->output_signatures[ state_index ] = &( scanner_image->signatures[ output_signature_indexes[ state_index ] - 1 ] );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid state: %" PRIu32 " output signature index value out of bounds.",
+			 function,
+			 state_index );
+
+			goto on_error;
+		}
+	}
+	( *aho_corasick )->transitions_table    = (uint32_t *) transitions_table;
+	( *aho_corasick )->number_of_states     = number_of_states;
+	( *aho_corasick )->number_of_signatures = (int) number_of_signatures;
+	( *aho_corasick )->largest_pattern_size = (size_t) largest_pattern_size;
+
+	return( 1 );
+
+on_error:
+	if( ( aho_corasick != NULL )
+	 && ( *aho_corasick != NULL ) )
+	{
+		libsigscan_aho_corasick_free(
+		 aho_corasick,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a prefilter
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_read_prefilter(
+     libsigscan_scanner_image_t *scanner_image,
+     uint64_t prefilter_offset,
+     libsigscan_prefilter_t **prefilter,
+     libcerror_error_t **error )
+{
+	sigscan_scanner_image_prefilter_t *image_prefilter = NULL;
+	const uint8_t *data                                = NULL;
+	static char *function                              = "libsigscan_scanner_image_read_prefilter";
+	uint64_t pattern_offset                            = 0;
+	uint16_t byte_value                                = 0;
+	int number_of_byte_values                          = 0;
+
+	if( prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scanner_image_get_data(
+	     scanner_image,
+	     prefilter_offset,
+	     sizeof( sigscan_scanner_image_prefilter_t ),
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve prefilter data.",
+		 function );
+
+		goto on_error;
+	}
+	image_prefilter = (sigscan_scanner_image_prefilter_t *) data;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_prefilter->pattern_offset,
+	 pattern_offset );
+
+	if( pattern_offset > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid pattern offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_prefilter_initialize(
+	     prefilter,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create prefilter.",
+		 function );
+
+		goto on_error;
+	}
+	( *prefilter )->pattern_offset = (size_t) pattern_offset;
+
+	/* The byte values are derived from the byte values table
+	 */
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		if( image_prefilter->byte_values_table[ byte_value ] == 0 )
+		{
+			continue;
+		}
+		if( number_of_byte_values >= LIBSIGSCAN_PREFILTER_MAXIMUM_NUMBER_OF_BYTE_VALUES )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of byte values value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		( *prefilter )->byte_values_table[ byte_value ]       = 1;
+		( *prefilter )->byte_values[ number_of_byte_values++ ] = (uint8_t) byte_value;
+	}
+	if( number_of_byte_values == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid prefilter - missing byte values.",
+		 function );
+
+		goto on_error;
+	}
+	( *prefilter )->number_of_byte_values = number_of_byte_values;
+
+	if( libsigscan_prefilter_select_instruction_set(
+	     *prefilter,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to select instruction set.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *prefilter != NULL )
+	{
+		libsigscan_prefilter_free(
+		 prefilter,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a scan tree
+ * If the scan tree offset is 0 an empty scan tree is created
+ * The scan tree arena nodes and references reference the image data
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_image_read_scan_tree(
+     libsigscan_scanner_image_t *scanner_image,
+     uint64_t scan_tree_offset,
+     int pattern_offsets_mode,
+     libsigscan_scan_tree_t **scan_tree,
+     libcerror_error_t **error )
+{
+	sigscan_scanner_image_scan_tree_t *image_scan_tree = NULL;
+	libsigscan_scan_tree_arena_t *scan_tree_arena      = NULL;
+	const uint32_t *signature_indexes                  = NULL;
+	const uint8_t *data                                = NULL;
+	static char *function                              = "libsigscan_scanner_image_read_scan_tree";
+	uint64_t aho_corasick_offset                       = 0;
+	uint64_t nodes_offset                              = 0;
+	uint64_t prefilter_offset                          = 0;
+	uint64_t range_size                                = 0;
+	uint64_t range_start                               = 0;
+	uint64_t references_offset                         = 0;
+	uint64_t signature_indexes_offset                  = 0;
+	uint64_t skip_table_offset                         = 0;
+	uint32_t number_of_nodes                           = 0;
+	uint32_t number_of_references                      = 0;
+	uint32_t number_of_signatures                      = 0;
+	uint32_t signature_index                           = 0;
+	uint32_t stored_pattern_offsets_mode               = 0;
+	int result                                         = 0;
+
+	if( scanner_image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner image.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_tree_initialize(
+	     scan_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_tree )->pattern_offsets_mode = pattern_offsets_mode;
+
+	if( scan_tree_offset == 0 )
+	{
+		return( 1 );
+	}
+	if( libsigscan_scanner_image_get_data(
+	     scanner_image,
+	     scan_tree_offset,
+	     sizeof( sigscan_scanner_image_scan_tree_t ),
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve scan tree data.",
+		 function );
+
+		goto on_error;
+	}
+	image_scan_tree = (sigscan_scanner_image_scan_tree_t *) data;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 image_scan_tree->pattern_offsets_mode,
+	 stored_pattern_offsets_mode );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_scan_tree->range_start,
+	 range_start );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_scan_tree->range_size,
+	 range_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 image_scan_tree->number_of_nodes,
+	 number_of_nodes );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 image_scan_tree->number_of_references,
+	 number_of_references );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 image_scan_tree->number_of_signatures,
+	 number_of_signatures );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_scan_tree->nodes_offset,
+	 nodes_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_scan_tree->references_offset,
+	 references_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_scan_tree->signature_indexes_offset,
+	 signature_indexes_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_scan_tree->skip_table_offset,
+	 skip_table_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_scan_tree->aho_corasick_offset,
+	 aho_corasick_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 image_scan_tree->prefilter_offset,
+	 prefilter_offset );
+
+	if( stored_pattern_offsets_mode != (uint32_t) pattern_offsets_mode )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern offsets mode: %" PRIu32 ".",
+		 function,
+		 stored_pattern_offsets_mode );
+
+		goto on_error;
+	}
+	if( ( number_of_nodes > LIBSIGSCAN_SCAN_TREE_ARENA_MAXIMUM_INDEX )
+	 || ( number_of_signatures > LIBSIGSCAN_SCAN_TREE_ARENA_MAXIMUM_INDEX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan tree arena value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The range start of a scan tree bound to the end is relative to the end
+	 * of the data, see libsigscan_scan_tree_get_spanning_range
+	 */
+	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	{
+		if( range_start < range_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid range start value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		range_start -= range_size;
+	}
+	if( range_size > 0 )
+	{
+		if( libcdata_range_list_insert_range(
+		     ( *scan_tree )->pattern_range_list,
+		     range_start,
+		     range_size,
+		     NULL,
+		     NULL,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert pattern range.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_scan_tree_arena_initialize(
+	     &( ( *scan_tree )->arena ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan tree arena.",
+		 function );
+
+		goto on_error;
+	}
+	scan_tree_arena = ( *scan_tree )->arena;
+
+	scan_tree_arena->data_flags = LIBSIGSCAN_SCAN_DATA_FLAG_REFERENCED;
+
+	if( libsigscan_scanner_image_get_data(
+	     scanner_image,
+	     nodes_offset,
+	     (uint64_t) sizeof( libsigscan_scan_tree_arena_node_t ) * number_of_nodes,
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve nodes data.",
+		 function );
+
+		goto on_error;
+	}
+	scan_tree_arena->nodes           = (libsigscan_scan_tree_arena_node_t *) data;
+	scan_tree_arena->number_of_nodes = number_of_nodes;
+
+	if( libsigscan_scanner_image_get_data(
+	     scanner_image,
+	     references_offset,
+	     (uint64_t) sizeof( uint32_t ) * number_of_references,
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve references data.",
+		 function );
+
+		goto on_error;
+	}
+	scan_tree_arena->references           = (uint32_t *) data;
+	scan_tree_arena->number_of_references = number_of_references;
+
+	if( number_of_signatures > 0 )
+	{
+		if( libsigscan_scanner_image_get_data(
+		     scanner_image,
+		     signature_indexes_offset,
+		     (uint64_t) sizeof( uint32_t ) * number_of_signatures,
+		     &data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to retrieve signature indexes data.",
+			 function );
+
+			goto on_error;
+		}
+		signature_indexes = (const uint32_t *) data;
+
+		scan_tree_arena->signatures = (libsigscan_signature_t **) memory_allocate(
+		                                                           sizeof( libsigscan_signature_t * ) * number_of_signatures );
+
+		if( scan_tree_arena->signatures == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create signatures.",
+			 function );
+
+			goto on_error;
+		}
+		for( signature_index = 0;
+		     signature_index < number_of_signatures;
+		     signature_index++ )
+		{
+			if( signature_indexes[ signature_index ] >= scanner_image->number_of_signatures )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid signature: %" PRIu32 " index value out of bounds.",
+				 function,
+				 signature_index );
+
+				goto on_error;
+			}
+			scan_tree_arena->signatures[ signature_index ] = &( scanner_image->signatures[ signature_indexes[ signature_index ] ] );
+		}
+		scan_tree_arena->number_of_signatures = number_of_signatures;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 image_scan_tree->root_reference,
+	 scan_tree_arena->root_reference );
+
+	result = libsigscan_scan_tree_arena_validate(
+	          scan_tree_arena,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to validate scan tree arena.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported scan tree arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_arena_compile(
+	     scan_tree_arena,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to compile scan tree arena.",
+		 function );
+
+		goto on_error;
+	}
+	/* The skip table is used to determine the size of the overlap buffer
+	 */
+	if( skip_table_offset == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing skip table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_image_read_skip_table(
+	     scanner_image,
+	     skip_table_offset,
+	     &( ( *scan_tree )->skip_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read skip table.",
+		 function );
+
+		goto on_error;
+	}
+	if( aho_corasick_offset != 0 )
+	{
+		if( libsigscan_scanner_image_read_aho_corasick(
+		     scanner_image,
+		     aho_corasick_offset,
+		     &( ( *scan_tree )->aho_corasick ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read Aho-Corasick automaton.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( prefilter_offset != 0 )
+	{
+		if( libsigscan_scanner_image_read_prefilter(
+		     scanner_image,
+		     prefilter_offset,
+		     &( ( *scan_tree )->prefilter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read prefilter.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 scan_tree,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the signatures and scan trees from the image data
+ * The scan trees reference the image data, which must be 8-byte aligned
+ * On success the image data is freed by the scanner image unless referenced
+ * Returns 1 if successful, 0 if the image is not compatible or -1 on error
+ */
+int libsigscan_scanner_image_read(
+     libsigscan_scanner_image_t *scanner_image,
+     const uint8_t *image_data,
+     size_t image_data_size,
+     uint8_t data_flags,
+     libsigscan_scan_tree_t **header_scan_tree,
+     libsigscan_scan_tree_t **footer_scan_tree,
+     libsigscan_scan_tree_t **scan_tree,
+     libcerror_error_t **error )
+{
+	static char *function            = "libsigscan_scanner_image_read";
+	uint64_t footer_scan_tree_offset = 0;
+	uint64_t header_scan_tree_offset = 0;
+	uint64_t scan_tree_offset        = 0;
+	uint64_t signatures_offset       = 0;
+	int result                       = 0;
+
+	if( scanner_image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner image.",
+		 function );
+
+		return( -1 );
+	}
+	if( scanner_image->image_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner image - image data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (intptr_t) image_data % LIBSIGSCAN_SCANNER_IMAGE_ALIGNMENT ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported image data alignment.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid image data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( header_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( footer_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid footer scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	/* The image data is only used read-only
+	 */
+	scanner_image->image_data      = (uint8_t *) image_data;
+	scanner_image->image_data_size = image_data_size;
+
+	result = libsigscan_scanner_image_read_file_header(
+	          scanner_image,
+	          &signatures_offset,
+	          &header_scan_tree_offset,
+	          &footer_scan_tree_offset,
+	          &scan_tree_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		scanner_image->image_data           = NULL;
+		scanner_image->image_data_size      = 0;
+		scanner_image->number_of_signatures = 0;
+
+		return( 0 );
+	}
+	if( libsigscan_scanner_image_read_signatures(
+	     scanner_image,
+	     signatures_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read signatures.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_image_read_scan_tree(
+	     scanner_image,
+	     header_scan_tree_offset,
+	     LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+	     header_scan_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_image_read_scan_tree(
+	     scanner_image,
+	     footer_scan_tree_offset,
+	     LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END,
+	     footer_scan_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read footer scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_image_read_scan_tree(
+	     scanner_image,
+	     scan_tree_offset,
+	     LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	     scan_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	scanner_image->data_flags = data_flags;
+
+	return( 1 );
+
+on_error:
+	if( *scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 scan_tree,
+		 NULL );
+	}
+	if( *footer_scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 footer_scan_tree,
+		 NULL );
+	}
+	if( *header_scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 header_scan_tree,
+		 NULL );
+	}
+	if( scanner_image->signatures != NULL )
+	{
+		memory_free(
+		 scanner_image->signatures );
+
+		scanner_image->signatures = NULL;
+	}
+	/* On error the image data remains owned by the caller
+	 */
+	scanner_image->image_data           = NULL;
+	scanner_image->image_data_size      = 0;
+	scanner_image->number_of_signatures = 0;
+
+	return( -1 );
+}
+
@@ -0,0 +1,222 @@
+/*
+ * Scanner image functions
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_SCANNER_IMAGE_H )
+#define _LIBSIGSCAN_SCANNER_IMAGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_aho_corasick.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_prefilter.h"
+#include "libsigscan_scan_tree.h"
+#include "libsigscan_signature.h"
+#include "libsigscan_skip_table.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_scanner_image libsigscan_scanner_image_t;
+
+struct libsigscan_scanner_image
+{
+	/* The image data
+	 */
+	uint8_t *image_data;
+
+	/* The image data size
+	 */
+	size_t image_data_size;
+
+	/* The data flags
+	 * the image data is not freed if referenced
+	 */
+	uint8_t data_flags;
+
+	/* The signatures
+	 * the identifiers and patterns of the signatures reference the image data
+	 */
+	libsigscan_signature_t *signatures;
+
+	/* The number of signatures
+	 */
+	uint32_t number_of_signatures;
+
+	/* The signatures hash table
+	 * used to map a signature to its image signature index when writing an image
+	 */
+	libsigscan_signature_t **signatures_hash_table;
+
+	/* The signature indexes hash table
+	 * contains the image signature index of the signature in the signatures hash table
+	 */
+	uint32_t *signature_indexes_hash_table;
+
+	/* The signatures hash table size
+	 */
+	uint32_t signatures_hash_table_size;
+};
+
+int libsigscan_scanner_image_initialize(
+     libsigscan_scanner_image_t **scanner_image,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_free(
+     libsigscan_scanner_image_t **scanner_image,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_set_signatures_hash_table(
+     libsigscan_scanner_image_t *scanner_image,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_get_signature_index(
+     libsigscan_scanner_image_t *scanner_image,
+     libsigscan_signature_t *signature,
+     uint32_t *signature_index,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_reserve_data(
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_data_offset,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_write_signatures(
+     libsigscan_scanner_image_t *scanner_image,
+     libcdata_list_t *signatures_list,
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_data_offset,
+     size_t *signatures_offset,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_write_skip_table(
+     libsigscan_skip_table_t *skip_table,
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_data_offset,
+     size_t *skip_table_offset,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_write_aho_corasick(
+     libsigscan_scanner_image_t *scanner_image,
+     libsigscan_aho_corasick_t *aho_corasick,
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_data_offset,
+     size_t *aho_corasick_offset,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_write_prefilter(
+     libsigscan_prefilter_t *prefilter,
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_data_offset,
+     size_t *prefilter_offset,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_write_scan_tree(
+     libsigscan_scanner_image_t *scanner_image,
+     libsigscan_scan_tree_t *scan_tree,
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_data_offset,
+     size_t *scan_tree_offset,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_write(
+     libsigscan_scanner_image_t *scanner_image,
+     libcdata_list_t *signatures_list,
+     libsigscan_scan_tree_t *header_scan_tree,
+     libsigscan_scan_tree_t *footer_scan_tree,
+     libsigscan_scan_tree_t *scan_tree,
+     uint8_t *image_data,
+     size_t image_data_size,
+     size_t *image_size,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_get_data(
+     libsigscan_scanner_image_t *scanner_image,
+     uint64_t data_offset,
+     uint64_t data_size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_read_file_header(
+     libsigscan_scanner_image_t *scanner_image,
+     uint64_t *signatures_offset,
+     uint64_t *header_scan_tree_offset,
+     uint64_t *footer_scan_tree_offset,
+     uint64_t *scan_tree_offset,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_read_signatures(
+     libsigscan_scanner_image_t *scanner_image,
+     uint64_t signatures_offset,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_read_skip_table(
+     libsigscan_scanner_image_t *scanner_image,
+     uint64_t skip_table_offset,
+     libsigscan_skip_table_t **skip_table,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_read_aho_corasick(
+     libsigscan_scanner_image_t *scanner_image,
+     uint64_t aho_corasick_offset,
+     libsigscan_aho_corasick_t **aho_corasick,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_read_prefilter(
+     libsigscan_scanner_image_t *scanner_image,
+     uint64_t prefilter_offset,
+     libsigscan_prefilter_t **prefilter,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_read_scan_tree(
+     libsigscan_scanner_image_t *scanner_image,
+     uint64_t scan_tree_offset,
+     int pattern_offsets_mode,
+     libsigscan_scan_tree_t **scan_tree,
+     libcerror_error_t **error );
+
+int libsigscan_scanner_image_read(
+     libsigscan_scanner_image_t *scanner_image,
+     const uint8_t *image_data,
+     size_t image_data_size,
+     uint8_t data_flags,
+     libsigscan_scan_tree_t **header_scan_tree,
+     libsigscan_scan_tree_t **footer_scan_tree,
+     libsigscan_scan_tree_t **scan_tree,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_SCANNER_IMAGE_H ) */
+
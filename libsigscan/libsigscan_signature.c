@@ -287,7 +287,8 @@ int libsigscan_signature_set(
 		return( -1 );
 	}
 	supported_flags = LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START
-	                | LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END;
+	                | LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END
+	                | LIBSIGSCAN_SIGNATURE_FLAG_STOP_ON_MATCH;
 
 	if( ( signature_flags & ~supported_flags ) != 0 )
 	{
@@ -58,6 +58,11 @@ struct libsigscan_signature
 	/* The signature flags
 	 */
 	uint32_t signature_flags;
+
+	/* The signature index
+	 * the index of the signature in the scanner
+	 */
+	int signature_index;
 };
 
 int libsigscan_signature_initialize(
@@ -41,9 +41,9 @@ struct libsigscan_signature_group
 	 */
 	uint8_t byte_value;
 
-	/* The signatures list
+	/* The signatures array
 	 */
-	libcdata_list_t *signatures_list;
+	libcdata_array_t *signatures_array;
 };
 
 int libsigscan_signature_group_initialize(
@@ -25,6 +25,7 @@
 
 #include "libsigscan_byte_value_group.h"
 #include "libsigscan_definitions.h"
+#include "libsigscan_hash_table.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_libcnotify.h"
@@ -110,15 +111,29 @@ int libsigscan_signature_table_initialize(
 
 		goto on_error;
 	}
-	if( libcdata_list_initialize(
-	     &( ( *signature_table )->signatures_list ),
+	if( libsigscan_hash_table_initialize(
+	     &( ( *signature_table )->byte_value_groups_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create byte values groups table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *signature_table )->signatures_array ),
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create signatures list.",
+		 "%s: unable to create signatures array.",
 		 function );
 
 		goto on_error;
@@ -128,6 +143,12 @@ int libsigscan_signature_table_initialize(
 on_error:
 	if( *signature_table != NULL )
 	{
+		if( ( *signature_table )->byte_value_groups_table != NULL )
+		{
+			libsigscan_hash_table_free(
+			 &( ( *signature_table )->byte_value_groups_table ),
+			 NULL );
+		}
 		if( ( *signature_table )->byte_value_groups_list != NULL )
 		{
 			libcdata_list_free(
@@ -180,10 +201,25 @@ int libsigscan_signature_table_free(
 
 			result = -1;
 		}
-		/* The signatures in the list are references and freed elsewhere
+		/* The byte value groups in the table are references to the byte value groups in the list
 		 */
-		if( libcdata_list_free(
-		     &( ( *signature_table )->signatures_list ),
+		if( libsigscan_hash_table_free(
+		     &( ( *signature_table )->byte_value_groups_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free byte value groups table.",
+			 function );
+
+			result = -1;
+		}
+		/* The signatures in the array are references and freed elsewhere
+		 */
+		if( libcdata_array_free(
+		     &( ( *signature_table )->signatures_array ),
 		     NULL,
 		     error ) != 1 )
 		{
@@ -191,7 +227,7 @@ int libsigscan_signature_table_free(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free signatures list.",
+			 "%s: unable to free signatures array.",
 			 function );
 
 			result = -1;
@@ -204,7 +240,7 @@ int libsigscan_signature_table_free(
 	return( result );
 }
 
-/* Fills the signature table
+/* Fills the signature table from a list of signatures
  * Returns 1 if successful or -1 on error
  */
 int libsigscan_signature_table_fill(
@@ -218,10 +254,6 @@ int libsigscan_signature_table_fill(
 	libcdata_list_element_t *list_element = NULL;
 	libsigscan_signature_t *signature     = NULL;
 	static char *function                 = "libsigscan_signature_table_fill";
-	off64_t pattern_offset                = 0;
-	size_t pattern_index                  = 0;
-	int add_signature                     = 0;
-	int result                            = 0;
 
 	if( signature_table == NULL )
 	{
@@ -234,19 +266,6 @@ int libsigscan_signature_table_fill(
 
 		return( -1 );
 	}
-	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
-	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
-	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported pattern offsets mode.",
-		 function );
-
-		return( -1 );
-	}
 	if( libcdata_list_get_first_element(
 	     signatures_list,
 	     &list_element,
@@ -277,145 +296,299 @@ int libsigscan_signature_table_fill(
 
 			return( -1 );
 		}
-		if( signature == NULL )
+		if( libsigscan_signature_table_append_signature(
+		     signature_table,
+		     signature,
+		     offsets_ignore_list,
+		     pattern_offsets_mode,
+		     pattern_offsets_range_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing signature.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append signature.",
 			 function );
 
 			return( -1 );
 		}
-		switch( pattern_offsets_mode )
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
 		{
-			case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START:
-				if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START )
-				{
-					add_signature = 1;
-				}
-				else
-				{
-					add_signature = 0;
-				}
-				break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next list element.",
+			 function );
 
-			case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END:
-				if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END )
-				{
-					add_signature = 1;
-				}
-				else
-				{
-					add_signature = 0;
-				}
-				break;
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
 
-			case LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND:
-				add_signature = 1;
-				break;
+/* Fills the signature table from an array of signatures
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_signature_table_fill_from_array(
+     libsigscan_signature_table_t *signature_table,
+     libcdata_array_t *signatures_array,
+     libcdata_list_t *offsets_ignore_list,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     libcerror_error_t **error )
+{
+	libsigscan_signature_t *signature = NULL;
+	static char *function             = "libsigscan_signature_table_fill_from_array";
+	int number_of_signatures          = 0;
+	int signature_index               = 0;
 
-			default:
-				add_signature = 0;
-				break;
+	if( signature_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     signatures_array,
+	     &number_of_signatures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of signatures.",
+		 function );
+
+		return( -1 );
+	}
+	for( signature_index = 0;
+	     signature_index < number_of_signatures;
+	     signature_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     signatures_array,
+		     signature_index,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature: %d.",
+			 function,
+			 signature_index );
+
+			return( -1 );
 		}
-		if( add_signature != 0 )
+		if( libsigscan_signature_table_append_signature(
+		     signature_table,
+		     signature,
+		     offsets_ignore_list,
+		     pattern_offsets_mode,
+		     pattern_offsets_range_size,
+		     error ) != 1 )
 		{
-			if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append signature: %d.",
+			 function,
+			 signature_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a signature to the signature table
+ * The signature is ignored if it does not match the pattern offsets mode
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_signature_table_append_signature(
+     libsigscan_signature_table_t *signature_table,
+     libsigscan_signature_t *signature,
+     libcdata_list_t *offsets_ignore_list,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libsigscan_signature_table_append_signature";
+	off64_t pattern_offset = 0;
+	size_t pattern_index   = 0;
+	int add_signature      = 0;
+	int entry_index        = 0;
+	int result             = 0;
+
+	if( signature_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature table.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	switch( pattern_offsets_mode )
+	{
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START:
+			if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START )
+			{
+				add_signature = 1;
+			}
+			else
 			{
-				pattern_offset = signature->pattern_offset;
+				add_signature = 0;
 			}
-			else if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+			break;
+
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END:
+			if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END )
 			{
-				pattern_offset = pattern_offsets_range_size - signature->pattern_offset;
+				add_signature = 1;
 			}
-			else if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+			else
 			{
-				pattern_offset = 0;
+				add_signature = 0;
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			break;
+
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND:
+			if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET )
 			{
-				libcnotify_printf(
-				 "%s: signature: %s, pattern offset: %" PRIi64 " (%" PRIi64 "), pattern:\n",
-				 function,
-				 signature->identifier,
-				 pattern_offset,
-				 signature->pattern_offset );
-				libcnotify_print_data(
-				 signature->pattern,
-				 signature->pattern_size,
-				 0 );
+				add_signature = 1;
+			}
+			else
+			{
+				add_signature = 0;
 			}
+			break;
+
+		default:
+			add_signature = 0;
+			break;
+	}
+	if( add_signature != 0 )
+	{
+		if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+		{
+			pattern_offset = signature->pattern_offset;
+		}
+		else if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+		{
+			pattern_offset = pattern_offsets_range_size - signature->pattern_offset;
+		}
+		else if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+		{
+			pattern_offset = 0;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: signature: %s, pattern offset: %" PRIi64 " (%" PRIi64 "), pattern:\n",
+			 function,
+			 signature->identifier,
+			 pattern_offset,
+			 signature->pattern_offset );
+			libcnotify_print_data(
+			 signature->pattern,
+			 signature->pattern_size,
+			 0 );
+		}
 #endif
-			for( pattern_index = 0;
-			     pattern_index < signature->pattern_size;
-			     pattern_index++ )
+		for( pattern_index = 0;
+		     pattern_index < signature->pattern_size;
+		     pattern_index++ )
+		{
+			result = libsigscan_offsets_list_has_offset(
+				  offsets_ignore_list,
+				  pattern_offset,
+				  error );
+
+			if( result == -1 )
 			{
-				result = libsigscan_offsets_list_has_offset(
-					  offsets_ignore_list,
-					  pattern_offset,
-					  error );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if offsets ignore list contains: %" PRIi64 ".",
+				 function,
+				 pattern_offset );
 
-				if( result == -1 )
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				if( libsigscan_signature_table_insert_signature(
+				     signature_table,
+				     pattern_offset,
+				     signature->pattern[ pattern_index ],
+				     signature,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to determine if offsets ignore list contains: %" PRIi64 ".",
-					 function,
-					 pattern_offset );
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to insert signature into signature table.",
+					 function );
 
 					return( -1 );
 				}
-				else if( result == 0 )
-				{
-					if( libsigscan_signature_table_insert_signature(
-					     signature_table,
-					     pattern_offset,
-					     signature->pattern[ pattern_index ],
-					     signature,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to insert signature into signature table.",
-						 function );
-
-						return( -1 );
-					}
-				}
-				pattern_offset++;
-			}
-			if( libcdata_list_append_value(
-			     signature_table->signatures_list,
-			     (intptr_t *) signature,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append signature.",
-				 function );
-
-				return( -1 );
 			}
+			pattern_offset++;
 		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
+		if( libcdata_array_append_entry(
+		     signature_table->signatures_array,
+		     &entry_index,
+		     (intptr_t *) signature,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append signature.",
 			 function );
 
 			return( -1 );
@@ -424,6 +597,72 @@ int libsigscan_signature_table_fill(
 	return( 1 );
 }
 
+/* Empties the byte value groups of the signature table
+ * The signatures array is retained
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_signature_table_empty_byte_value_groups(
+     libsigscan_signature_table_t *signature_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_signature_table_empty_byte_value_groups";
+
+	if( signature_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature table.",
+		 function );
+
+		return( -1 );
+	}
+	/* The byte value groups in the table are references to the byte value groups in the list
+	 */
+	if( libsigscan_hash_table_free(
+	     &( signature_table->byte_value_groups_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free byte value groups table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_hash_table_initialize(
+	     &( signature_table->byte_value_groups_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create byte values groups table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_empty(
+	     signature_table->byte_value_groups_list,
+	     (int (*)(intptr_t **,libcerror_error_t **)) &libsigscan_byte_value_group_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to empty byte value groups list.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the number of byte value groups
  * Returns 1 if successful or -1 on error
  */
@@ -512,9 +751,8 @@ int libsigscan_signature_table_get_byte_value_group_by_offset(
      libsigscan_byte_value_group_t **byte_value_group,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element = NULL;
-	static char *function                 = "libsigscan_signature_table_get_byte_value_group_by_offset";
-	int result                            = 0;
+	static char *function = "libsigscan_signature_table_get_byte_value_group_by_offset";
+	int result            = 0;
 
 	if( signature_table == NULL )
 	{
@@ -538,76 +776,24 @@ int libsigscan_signature_table_get_byte_value_group_by_offset(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     signature_table->byte_value_groups_list,
-	     &list_element,
-	     error ) != 1 )
+	result = libsigscan_hash_table_get_value(
+	          signature_table->byte_value_groups_table,
+	          pattern_offset,
+	          (intptr_t **) byte_value_group,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element.",
-		 function );
+		 "%s: unable to retrieve byte value group for pattern offset: %" PRIi64 " from table.",
+		 function,
+		 pattern_offset );
 
 		return( -1 );
 	}
-	while( list_element != NULL )
-	{
-		if( libcdata_list_element_get_value(
-		     list_element,
-		     (intptr_t **) byte_value_group,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve byte value group.",
-			 function );
-
-			return( -1 );
-		}
-		if( *byte_value_group == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing byte value group.",
-			 function );
-
-			return( -1 );
-		}
-		if( ( *byte_value_group )->pattern_offset == pattern_offset )
-		{
-			result = 1;
-
-			break;
-		}
-		if( ( *byte_value_group )->pattern_offset > pattern_offset )
-		{
-			break;
-		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( result == 0 )
-	{
-		*byte_value_group = NULL;
-	}
 	return( result );
 }
 
@@ -632,8 +818,8 @@ int libsigscan_signature_table_get_number_of_signatures(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_number_of_elements(
-	     signature_table->signatures_list,
+	if( libcdata_array_get_number_of_entries(
+	     signature_table->signatures_array,
 	     number_of_signatures,
 	     error ) != 1 )
 	{
@@ -649,15 +835,16 @@ int libsigscan_signature_table_get_number_of_signatures(
 	return( 1 );
 }
 
-/* Retrieves a clone of the signatures list
- * Returns 1 if successful, 0 if no such value or -1 on error
+/* Retrieves a specific signature
+ * Returns 1 if successful or -1 on error
  */
-int libsigscan_signature_table_get_signatures_list_clone(
+int libsigscan_signature_table_get_signature_by_index(
      libsigscan_signature_table_t *signature_table,
-     libcdata_list_t **signatures_list,
+     int signature_index,
+     libsigscan_signature_t **signature,
      libcerror_error_t **error )
 {
-	static char *function = "libsigscan_signature_table_get_signatures_list_clone";
+	static char *function = "libsigscan_signature_table_get_signature_by_index";
 
 	if( signature_table == NULL )
 	{
@@ -670,22 +857,118 @@ int libsigscan_signature_table_get_signatures_list_clone(
 
 		return( -1 );
 	}
-	if( libcdata_list_clone(
-	     signatures_list,
-	     signature_table->signatures_list,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free_clone,
-	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libsigscan_signature_clone,
+	if( libcdata_array_get_entry_by_index(
+	     signature_table->signatures_array,
+	     signature_index,
+	     (intptr_t **) signature,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to clone remaining signatures list.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve signature: %d.",
+		 function,
+		 signature_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the signature with the largest pattern
+ * Returns 1 if successful, 0 if the signature table contains no signatures or -1 on error
+ */
+int libsigscan_signature_table_get_largest_signature(
+     libsigscan_signature_table_t *signature_table,
+     libsigscan_signature_t **signature,
+     libcerror_error_t **error )
+{
+	libsigscan_signature_t *array_value = NULL;
+	static char *function               = "libsigscan_signature_table_get_largest_signature";
+	int number_of_signatures            = 0;
+	int signature_index                 = 0;
+
+	if( signature_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature table.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	*signature = NULL;
+
+	if( libcdata_array_get_number_of_entries(
+	     signature_table->signatures_array,
+	     &number_of_signatures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of signatures.",
 		 function );
 
 		return( -1 );
 	}
+	for( signature_index = 0;
+	     signature_index < number_of_signatures;
+	     signature_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     signature_table->signatures_array,
+		     signature_index,
+		     (intptr_t **) &array_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature: %d.",
+			 function,
+			 signature_index );
+
+			return( -1 );
+		}
+		if( array_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature: %d.",
+			 function,
+			 signature_index );
+
+			return( -1 );
+		}
+		if( ( *signature == NULL )
+		 || ( array_value->pattern_size > ( *signature )->pattern_size ) )
+		{
+			*signature = array_value;
+		}
+	}
+	if( *signature == NULL )
+	{
+		return( 0 );
+	}
 	return( 1 );
 }
 
@@ -699,9 +982,11 @@ int libsigscan_signature_table_insert_signature(
      libsigscan_signature_t *signature,
      libcerror_error_t **error )
 {
-	libsigscan_byte_value_group_t *byte_value_group = NULL;
-	static char *function                           = "libsigscan_signature_table_insert_signature";
-	int result                                      = 0;
+	libcdata_list_element_t *list_element                = NULL;
+	libsigscan_byte_value_group_t *byte_value_group      = NULL;
+	libsigscan_byte_value_group_t *last_byte_value_group = NULL;
+	static char *function                                = "libsigscan_signature_table_insert_signature";
+	int result                                           = 0;
 
 	if( signature_table == NULL )
 	{
@@ -749,12 +1034,66 @@ int libsigscan_signature_table_insert_signature(
 
 			return( -1 );
 		}
-		if( libcdata_list_insert_value(
+		if( libcdata_list_get_last_element(
 		     signature_table->byte_value_groups_list,
-		     (intptr_t *) byte_value_group,
-		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsigscan_byte_value_group_compare,
-		     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+		     &list_element,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last list element.",
+			 function );
+
+			libsigscan_byte_value_group_free(
+			 &byte_value_group,
+			 NULL );
+
+			return( -1 );
+		}
+		if( list_element != NULL )
+		{
+			if( libcdata_list_element_get_value(
+			     list_element,
+			     (intptr_t **) &last_byte_value_group,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve last byte value group.",
+				 function );
+
+				libsigscan_byte_value_group_free(
+				 &byte_value_group,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		/* The pattern offsets of a signature are increasing, hence most byte value groups
+		 * are appended to the end of the sorted list
+		 */
+		if( ( last_byte_value_group == NULL )
+		 || ( last_byte_value_group->pattern_offset < pattern_offset ) )
+		{
+			result = libcdata_list_append_value(
+			          signature_table->byte_value_groups_list,
+			          (intptr_t *) byte_value_group,
+			          error );
+		}
+		else
+		{
+			result = libcdata_list_insert_value(
+			          signature_table->byte_value_groups_list,
+			          (intptr_t *) byte_value_group,
+			          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsigscan_byte_value_group_compare,
+			          LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -770,6 +1109,22 @@ int libsigscan_signature_table_insert_signature(
 
 			return( -1 );
 		}
+		if( libsigscan_hash_table_set_value(
+		     signature_table->byte_value_groups_table,
+		     pattern_offset,
+		     (intptr_t *) byte_value_group,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set byte value group for pattern offset: %" PRIi64 " in table.",
+			 function,
+			 pattern_offset );
+
+			return( -1 );
+		}
 	}
 	if( libsigscan_byte_value_group_insert_signature(
 	     byte_value_group,
@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libsigscan_byte_value_group.h"
+#include "libsigscan_hash_table.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_signature.h"
@@ -43,9 +44,14 @@ struct libsigscan_signature_table
 	 */
 	libcdata_list_t *byte_value_groups_list;
 
-	/* The list of signatures in the table
+	/* The byte value groups per offset
+	 * contains references to the byte value groups in the list
 	 */
-	libcdata_list_t *signatures_list;
+	libsigscan_hash_table_t *byte_value_groups_table;
+
+	/* The array of signatures in the table
+	 */
+	libcdata_array_t *signatures_array;
 };
 
 int libsigscan_signature_table_initialize(
@@ -64,6 +70,26 @@ int libsigscan_signature_table_fill(
      uint64_t pattern_offsets_range_size,
      libcerror_error_t **error );
 
+int libsigscan_signature_table_fill_from_array(
+     libsigscan_signature_table_t *signature_table,
+     libcdata_array_t *signatures_array,
+     libcdata_list_t *offsets_ignore_list,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     libcerror_error_t **error );
+
+int libsigscan_signature_table_append_signature(
+     libsigscan_signature_table_t *signature_table,
+     libsigscan_signature_t *signature,
+     libcdata_list_t *offsets_ignore_list,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     libcerror_error_t **error );
+
+int libsigscan_signature_table_empty_byte_value_groups(
+     libsigscan_signature_table_t *signature_table,
+     libcerror_error_t **error );
+
 int libsigscan_signature_table_get_number_of_byte_value_groups(
      libsigscan_signature_table_t *signature_table,
      int *number_of_byte_value_groups,
@@ -86,9 +112,15 @@ int libsigscan_signature_table_get_number_of_signatures(
      int *number_of_signatures,
      libcerror_error_t **error );
 
-int libsigscan_signature_table_get_signatures_list_clone(
+int libsigscan_signature_table_get_signature_by_index(
+     libsigscan_signature_table_t *signature_table,
+     int signature_index,
+     libsigscan_signature_t **signature,
+     libcerror_error_t **error );
+
+int libsigscan_signature_table_get_largest_signature(
      libsigscan_signature_table_t *signature_table,
-     libcdata_list_t **signatures_list,
+     libsigscan_signature_t **signature,
      libcerror_error_t **error );
 
 int libsigscan_signature_table_insert_signature(
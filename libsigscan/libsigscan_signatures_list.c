@@ -1,134 +0,0 @@
-/*
- * The signatures list functions
- *
- * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
- *
- * Refer to AUTHORS for acknowledgements.
- *
- * This software is free software: you can redistribute it and/or modify
- * it under the terms of the GNU Lesser General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This software is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU Lesser General Public License
- * along with this software.  If not, see <http://www.gnu.org/licenses/>.
- */
-
-#include <common.h>
-#include <types.h>
-
-#include "libsigscan_libcdata.h"
-#include "libsigscan_libcerror.h"
-#include "libsigscan_signature.h"
-#include "libsigscan_signatures_list.h"
-
-/* Removes a signature from the list
- * Returns 1 if successful or -1 on error
- */
-int libsigscan_signatures_list_remove_signature(
-     libcdata_list_t *signatures_list,
-     libsigscan_signature_t *signature,
-     libcerror_error_t **error )
-{
-	libcdata_list_element_t *list_element = NULL;
-	intptr_t *list_value                  = NULL;
-	static char *function                 = "libsigscan_signatures_list_remove_signature";
-
-	if( libcdata_list_get_first_element(
-	     signatures_list,
-	     &list_element,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element.",
-		 function );
-
-		return( -1 );
-	}
-	while( list_element != NULL )
-	{
-		if( libcdata_list_element_get_value(
-		     list_element,
-		     (intptr_t **) &list_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve signature.",
-			 function );
-
-			return( -1 );
-		}
-		if( list_value == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing signature.",
-			 function );
-
-			return( -1 );
-		}
-		/* Using a pointer comparison here since the signatures are cloned by reference
-		 */
-		if( (intptr_t *) signature == list_value )
-		{
-			if( libcdata_list_remove_element(
-			     signatures_list,
-			     list_element,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-				 "%s: unable to remove list element.",
-				 function );
-
-				return( -1 );
-			}
-			if( libcdata_list_element_free(
-			     &list_element,
-			     NULL,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free list element.",
-				 function );
-
-				return( -1 );
-			}
-			break;
-		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	return( 1 );
-}
-
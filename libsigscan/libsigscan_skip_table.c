@@ -93,6 +93,8 @@ int libsigscan_skip_table_initialize(
 
 		return( -1 );
 	}
+	( *skip_table )->table_type = LIBSIGSCAN_SKIP_TABLE_TYPE_BYTE_VALUE;
+
 	return( 1 );
 
 on_error:
@@ -128,6 +130,19 @@ int libsigscan_skip_table_free(
 	}
 	if( *skip_table != NULL )
 	{
+		if( ( ( *skip_table )->data_flags & LIBSIGSCAN_SCAN_DATA_FLAG_REFERENCED ) == 0 )
+		{
+			if( ( *skip_table )->prefix_hashes != NULL )
+			{
+				memory_free(
+				 ( *skip_table )->prefix_hashes );
+			}
+			if( ( *skip_table )->block_skip_values != NULL )
+			{
+				memory_free(
+				 ( *skip_table )->block_skip_values );
+			}
+		}
 		memory_free(
 		 *skip_table );
 
@@ -141,15 +156,16 @@ int libsigscan_skip_table_free(
  */
 int libsigscan_skip_table_fill(
      libsigscan_skip_table_t *skip_table,
-     libcdata_list_t *signatures_list,
+     libcdata_array_t *signatures_array,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element = NULL;
-	libsigscan_signature_t *signature     = NULL;
-	static char *function                 = "libsigscan_skip_table_fill";
-	size_t pattern_index                  = 0;
-	size_t skip_value                     = 0;
-	uint8_t byte_value                    = 0;
+	libsigscan_signature_t *signature = NULL;
+	static char *function             = "libsigscan_skip_table_fill";
+	size_t pattern_index              = 0;
+	size_t skip_value                 = 0;
+	uint8_t byte_value                = 0;
+	int number_of_signatures          = 0;
+	int signature_index               = 0;
 
 	if( skip_table == NULL )
 	{
@@ -164,24 +180,27 @@ int libsigscan_skip_table_fill(
 	}
 	/* First determine the smallest pattern size
 	 */
-	if( libcdata_list_get_first_element(
-	     signatures_list,
-	     &list_element,
+	if( libcdata_array_get_number_of_entries(
+	     signatures_array,
+	     &number_of_signatures,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element.",
+		 "%s: unable to retrieve number of signatures.",
 		 function );
 
 		return( -1 );
 	}
-	while( list_element != NULL )
+	for( signature_index = 0;
+	     signature_index < number_of_signatures;
+	     signature_index++ )
 	{
-		if( libcdata_list_element_get_value(
-		     list_element,
+		if( libcdata_array_get_entry_by_index(
+		     signatures_array,
+		     signature_index,
 		     (intptr_t **) &signature,
 		     error ) != 1 )
 		{
@@ -215,41 +234,205 @@ int libsigscan_skip_table_fill(
 		{
 			skip_table->smallest_pattern_size = signature->pattern_size;
 		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
+	}
+	/* Next fill the skip table
+	 */
+	for( signature_index = 0;
+	     signature_index < number_of_signatures;
+	     signature_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     signatures_array,
+		     signature_index,
+		     (intptr_t **) &signature,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
+			 "%s: unable to retrieve signature.",
 			 function );
 
 			return( -1 );
 		}
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature.",
+			 function );
+
+			return( -1 );
+		}
+		skip_value = skip_table->smallest_pattern_size;
+
+		/* The last byte of the smallest pattern size is not part of the skip values
+		 * since a skip value of 0 would prevent the scan from progressing
+		 */
+		for( pattern_index = 0;
+		     ( pattern_index + 1 ) < skip_table->smallest_pattern_size;
+		     pattern_index++ )
+		{
+			skip_value -= 1;
+			byte_value  = signature->pattern[ pattern_index ];
+
+			if( ( skip_table->skip_values[ byte_value ] == 0 )
+			 || ( skip_value < skip_table->skip_values[ byte_value ] ) )
+			{
+				skip_table->skip_values[ byte_value ] = skip_value;
+			}
+		}
 	}
-	/* Next fill the skip table
+	return( 1 );
+}
+
+/* Fills the block skip values of the skip table
+ * The block skip values are a Wu-Manber shift table of hashed 2 or 3 byte blocks
+ * that is used instead of the byte value skip values unless the patterns are too small
+ * The skip table must have been filled before
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_skip_table_fill_block_skip_values(
+     libsigscan_skip_table_t *skip_table,
+     libcdata_array_t *signatures_array,
+     libcerror_error_t **error )
+{
+	libsigscan_signature_t *signature = NULL;
+	static char *function             = "libsigscan_skip_table_fill_block_skip_values";
+	uint64_t block_skip_values_sum    = 0;
+	uint64_t skip_values_sum          = 0;
+	size_t default_skip_value         = 0;
+	size_t pattern_index              = 0;
+	size_t skip_value                 = 0;
+	uint16_t block_hash               = 0;
+	uint16_t byte_value               = 0;
+	int block_hash_index              = 0;
+	int number_of_signatures          = 0;
+	int signature_index               = 0;
+
+	if( skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( skip_table->block_skip_values != NULL )
+	 || ( skip_table->prefix_hashes != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid skip table - block skip values already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* A block must fit in the smallest pattern size and leave room for a non-zero skip value
 	 */
-	if( libcdata_list_get_first_element(
-	     signatures_list,
-	     &list_element,
+	if( skip_table->smallest_pattern_size < 3 )
+	{
+		return( 1 );
+	}
+	if( skip_table->smallest_pattern_size >= LIBSIGSCAN_SKIP_TABLE_LARGE_BLOCK_PATTERN_SIZE )
+	{
+		skip_table->block_size = 3;
+	}
+	else
+	{
+		skip_table->block_size = 2;
+	}
+	default_skip_value = skip_table->smallest_pattern_size - skip_table->block_size + 1;
+
+	if( default_skip_value > 255 )
+	{
+		default_skip_value = 255;
+	}
+	skip_table->block_skip_values = (uint8_t *) memory_allocate(
+	                                             sizeof( uint8_t ) * LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_HASHES );
+
+	if( skip_table->block_skip_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block skip values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     skip_table->block_skip_values,
+	     (int) default_skip_value,
+	     sizeof( uint8_t ) * LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_HASHES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block skip values.",
+		 function );
+
+		goto on_error;
+	}
+	skip_table->prefix_hashes = (uint8_t *) memory_allocate(
+	                                         sizeof( uint8_t ) * ( LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_HASHES / 8 ) );
+
+	if( skip_table->prefix_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create prefix hashes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     skip_table->prefix_hashes,
+	     0,
+	     sizeof( uint8_t ) * ( LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_HASHES / 8 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear prefix hashes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     signatures_array,
+	     &number_of_signatures,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element.",
+		 "%s: unable to retrieve number of signatures.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	while( list_element != NULL )
+	for( signature_index = 0;
+	     signature_index < number_of_signatures;
+	     signature_index++ )
 	{
-		if( libcdata_list_element_get_value(
-		     list_element,
+		if( libcdata_array_get_entry_by_index(
+		     signatures_array,
+		     signature_index,
 		     (intptr_t **) &signature,
 		     error ) != 1 )
 		{
@@ -260,7 +443,7 @@ int libsigscan_skip_table_fill(
 			 "%s: unable to retrieve signature.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( signature == NULL )
 		{
@@ -271,38 +454,174 @@ int libsigscan_skip_table_fill(
 			 "%s: missing signature.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		skip_value = skip_table->smallest_pattern_size;
+		block_hash = libsigscan_skip_table_get_block_hash(
+		              skip_table,
+		              signature->pattern );
 
-		for( pattern_index = 0;
+		skip_table->prefix_hashes[ block_hash / 8 ] |= (uint8_t) ( 1 << ( block_hash % 8 ) );
+
+		/* The skip value of a block is determined by the distance between the end of the block
+		 * and the last byte of the smallest pattern size
+		 */
+		for( pattern_index = skip_table->block_size - 1;
 		     pattern_index < skip_table->smallest_pattern_size;
 		     pattern_index++ )
 		{
-			skip_value -= 1;
-			byte_value  = signature->pattern[ pattern_index ];
+			skip_value = skip_table->smallest_pattern_size - pattern_index - 1;
+			block_hash = libsigscan_skip_table_get_block_hash(
+			              skip_table,
+			              &( signature->pattern[ pattern_index + 1 - skip_table->block_size ] ) );
 
-			if( ( skip_table->skip_values[ byte_value ] == 0 )
-			 || ( skip_value < skip_table->skip_values[ byte_value ] ) )
+			if( skip_value < skip_table->block_skip_values[ block_hash ] )
 			{
-				skip_table->skip_values[ byte_value ] = skip_value;
+				skip_table->block_skip_values[ block_hash ] = (uint8_t) skip_value;
 			}
 		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
-		     error ) != 1 )
+	}
+	/* The byte value skip values require the scan tree to be walked at every offset
+	 * the scan stops at, while the block skip values only require this when the prefix hash
+	 * matches. Hence the byte value skip values are kept only if they are more than twice
+	 * as large on average, which can be the case for a single or few small patterns
+	 * A block skip value of 0 still progresses the scan by 1
+	 */
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		if( skip_table->skip_values[ byte_value ] == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			return( -1 );
+			skip_values_sum += skip_table->smallest_pattern_size;
+		}
+		else
+		{
+			skip_values_sum += skip_table->skip_values[ byte_value ];
 		}
 	}
+	for( block_hash_index = 0;
+	     block_hash_index < LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_HASHES;
+	     block_hash_index++ )
+	{
+		if( skip_table->block_skip_values[ block_hash_index ] == 0 )
+		{
+			block_skip_values_sum += 1;
+		}
+		else
+		{
+			block_skip_values_sum += skip_table->block_skip_values[ block_hash_index ];
+		}
+	}
+	if( ( block_skip_values_sum * 256 * 2 ) < ( skip_values_sum * LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_HASHES ) )
+	{
+		memory_free(
+		 skip_table->prefix_hashes );
+
+		skip_table->prefix_hashes = NULL;
+
+		memory_free(
+		 skip_table->block_skip_values );
+
+		skip_table->block_skip_values = NULL;
+		skip_table->block_size        = 0;
+	}
+	else
+	{
+		skip_table->table_type = LIBSIGSCAN_SKIP_TABLE_TYPE_BLOCK;
+	}
+	return( 1 );
+
+on_error:
+	if( skip_table->prefix_hashes != NULL )
+	{
+		memory_free(
+		 skip_table->prefix_hashes );
+
+		skip_table->prefix_hashes = NULL;
+	}
+	if( skip_table->block_skip_values != NULL )
+	{
+		memory_free(
+		 skip_table->block_skip_values );
+
+		skip_table->block_skip_values = NULL;
+	}
+	skip_table->block_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the table type
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_skip_table_get_table_type(
+     libsigscan_skip_table_t *skip_table,
+     int *table_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_skip_table_get_table_type";
+
+	if( skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table type.",
+		 function );
+
+		return( -1 );
+	}
+	*table_type = skip_table->table_type;
+
+	return( 1 );
+}
+
+/* Retrieves the largest pattern size
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_skip_table_get_largest_pattern_size(
+     libsigscan_skip_table_t *skip_table,
+     size_t *largest_pattern_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_skip_table_get_largest_pattern_size";
+
+	if( skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( largest_pattern_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid largest pattern size.",
+		 function );
+
+		return( -1 );
+	}
+	*largest_pattern_size = skip_table->largest_pattern_size;
+
 	return( 1 );
 }
 
@@ -387,6 +706,196 @@ int libsigscan_skip_table_get_skip_value(
 	return( 1 );
 }
 
+/* Determines the hash value of a block
+ * Returns the hash value
+ */
+uint16_t libsigscan_skip_table_get_block_hash(
+          libsigscan_skip_table_t *skip_table,
+          const uint8_t *block )
+{
+	uint16_t block_hash = 0;
+
+	if( skip_table->block_size == 3 )
+	{
+		block_hash = ( (uint16_t) block[ 0 ] << 10 )
+		           ^ ( (uint16_t) block[ 1 ] << 5 )
+		           ^ (uint16_t) block[ 2 ];
+	}
+	else
+	{
+		block_hash = ( (uint16_t) block[ 0 ] << 7 )
+		           ^ (uint16_t) block[ 1 ];
+	}
+	return( block_hash & ( LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_HASHES - 1 ) );
+}
+
+/* Retrieves a specific block skip value
+ * The skip value is determined by the block that ends the smallest pattern size
+ * at the buffer offset, a skip value of 0 indicates that the prefix hash of the block
+ * at the buffer offset matches and that a pattern could start at the buffer offset
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_skip_table_get_block_skip_value(
+     libsigscan_skip_table_t *skip_table,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t *skip_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_skip_table_get_block_skip_value";
+	uint16_t block_hash   = 0;
+
+	if( skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( skip_table->block_skip_values == NULL )
+	 || ( skip_table->prefix_hashes == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid skip table - missing block skip values.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size < skip_table->smallest_pattern_size )
+	 || ( buffer_offset > ( buffer_size - skip_table->smallest_pattern_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( skip_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip value.",
+		 function );
+
+		return( -1 );
+	}
+	block_hash = libsigscan_skip_table_get_block_hash(
+	              skip_table,
+	              &( buffer[ buffer_offset + skip_table->smallest_pattern_size - skip_table->block_size ] ) );
+
+	*skip_value = skip_table->block_skip_values[ block_hash ];
+
+	if( *skip_value == 0 )
+	{
+		block_hash = libsigscan_skip_table_get_block_hash(
+		              skip_table,
+		              &( buffer[ buffer_offset ] ) );
+
+		if( ( skip_table->prefix_hashes[ block_hash / 8 ] & ( 1 << ( block_hash % 8 ) ) ) == 0 )
+		{
+			*skip_value = 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the average skip value
+ * The average is determined over all byte values or block hash values and rounded down
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_skip_table_get_average_skip_value(
+     libsigscan_skip_table_t *skip_table,
+     size_t *average_skip_value,
+     libcerror_error_t **error )
+{
+	static char *function  = "libsigscan_skip_table_get_average_skip_value";
+	size_t skip_values_sum = 0;
+	uint16_t byte_value    = 0;
+	int block_hash_index   = 0;
+
+	if( skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( average_skip_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid average skip value.",
+		 function );
+
+		return( -1 );
+	}
+	if( skip_table->table_type == LIBSIGSCAN_SKIP_TABLE_TYPE_BLOCK )
+	{
+		for( block_hash_index = 0;
+		     block_hash_index < LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_HASHES;
+		     block_hash_index++ )
+		{
+			if( skip_table->block_skip_values[ block_hash_index ] == 0 )
+			{
+				skip_values_sum += 1;
+			}
+			else
+			{
+				skip_values_sum += skip_table->block_skip_values[ block_hash_index ];
+			}
+		}
+		*average_skip_value = skip_values_sum / LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_HASHES;
+
+		return( 1 );
+	}
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		if( skip_table->skip_values[ byte_value ] == 0 )
+		{
+			skip_values_sum += skip_table->smallest_pattern_size;
+		}
+		else
+		{
+			skip_values_sum += skip_table->skip_values[ byte_value ];
+		}
+	}
+	*average_skip_value = skip_values_sum / 256;
+
+	return( 1 );
+}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 
 /* Prints a skip table
@@ -429,6 +938,13 @@ int libsigscan_skip_table_printf(
 	 "\tDefault\t\t: %" PRIzd "\n",
          skip_table->smallest_pattern_size );
 
+	if( skip_table->table_type == LIBSIGSCAN_SKIP_TABLE_TYPE_BLOCK )
+	{
+		libcnotify_printf(
+		 "\tBlock size\t: %" PRIzd "\n",
+		 skip_table->block_size );
+	}
+
 	libcnotify_printf(
 	 "\n" );
 
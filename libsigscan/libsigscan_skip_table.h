@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libsigscan_definitions.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 
@@ -47,6 +48,31 @@ struct libsigscan_skip_table
 	/* The skip values
 	 */
 	size_t skip_values[ 256 ];
+
+	/* The table type
+	 */
+	int table_type;
+
+	/* The block size
+	 * the number of bytes hashed per block skip value
+	 */
+	size_t block_size;
+
+	/* The block skip values
+	 * contains a skip value per block hash value, where 0 represents
+	 * a block that ends the smallest pattern size of a pattern
+	 */
+	uint8_t *block_skip_values;
+
+	/* The prefix hashes
+	 * contains a bit per block hash value of the first block of the patterns
+	 */
+	uint8_t *prefix_hashes;
+
+	/* The data flags
+	 * the block skip values and prefix hashes are not freed if referenced
+	 */
+	uint8_t data_flags;
 };
 
 int libsigscan_skip_table_initialize(
@@ -59,7 +85,22 @@ int libsigscan_skip_table_free(
 
 int libsigscan_skip_table_fill(
      libsigscan_skip_table_t *skip_table,
-     libcdata_list_t *signatures_list,
+     libcdata_array_t *signatures_array,
+     libcerror_error_t **error );
+
+int libsigscan_skip_table_fill_block_skip_values(
+     libsigscan_skip_table_t *skip_table,
+     libcdata_array_t *signatures_array,
+     libcerror_error_t **error );
+
+int libsigscan_skip_table_get_table_type(
+     libsigscan_skip_table_t *skip_table,
+     int *table_type,
+     libcerror_error_t **error );
+
+int libsigscan_skip_table_get_largest_pattern_size(
+     libsigscan_skip_table_t *skip_table,
+     size_t *largest_pattern_size,
      libcerror_error_t **error );
 
 int libsigscan_skip_table_get_smallest_pattern_size(
@@ -73,6 +114,23 @@ int libsigscan_skip_table_get_skip_value(
      size_t *skip_value,
      libcerror_error_t **error );
 
+uint16_t libsigscan_skip_table_get_block_hash(
+          libsigscan_skip_table_t *skip_table,
+          const uint8_t *block );
+
+int libsigscan_skip_table_get_block_skip_value(
+     libsigscan_skip_table_t *skip_table,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t *skip_value,
+     libcerror_error_t **error );
+
+int libsigscan_skip_table_get_average_skip_value(
+     libsigscan_skip_table_t *skip_table,
+     size_t *average_skip_value,
+     libcerror_error_t **error );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 
 int libsigscan_skip_table_printf(
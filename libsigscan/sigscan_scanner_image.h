@@ -0,0 +1,313 @@
+/*
+ * The scanner image definition of a signature scanner
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SIGSCAN_SCANNER_IMAGE_H )
+#define _SIGSCAN_SCANNER_IMAGE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The values in the scanner image structures are stored in little-endian,
+ * the arrays they refer to are stored in the byte order of the system
+ * that wrote the image, so that they can be used without conversion
+ */
+
+typedef struct sigscan_scanner_image_file_header sigscan_scanner_image_file_header_t;
+
+struct sigscan_scanner_image_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * "SIGSCIMG"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The byte order marker
+	 * Consists of 4 bytes
+	 * 0x01020304 in the byte order of the arrays
+	 */
+	uint8_t byte_order_marker[ 4 ];
+
+	/* The scan tree arena node size
+	 * Consists of 2 bytes
+	 */
+	uint8_t node_size[ 2 ];
+
+	/* Padding
+	 * Consists of 2 bytes
+	 */
+	uint8_t padding1[ 2 ];
+
+	/* The checksum
+	 * Consists of 4 bytes
+	 * Adler-32 of the image data after the file header
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* The image size
+	 * Consists of 8 bytes
+	 */
+	uint8_t image_size[ 8 ];
+
+	/* The number of signatures
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_signatures[ 4 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding2[ 4 ];
+
+	/* The signatures offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t signatures_offset[ 8 ];
+
+	/* The header (offset relative from start) scan tree offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t header_scan_tree_offset[ 8 ];
+
+	/* The footer (offset relative from end) scan tree offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t footer_scan_tree_offset[ 8 ];
+
+	/* The (unbound) scan tree offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t scan_tree_offset[ 8 ];
+};
+
+typedef struct sigscan_scanner_image_signature sigscan_scanner_image_signature_t;
+
+struct sigscan_scanner_image_signature
+{
+	/* The pattern offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t pattern_offset[ 8 ];
+
+	/* The data offset
+	 * Consists of 8 bytes
+	 * the identifier, including the end-of-string character, followed by the pattern
+	 */
+	uint8_t data_offset[ 8 ];
+
+	/* The identifier size
+	 * Consists of 4 bytes
+	 */
+	uint8_t identifier_size[ 4 ];
+
+	/* The pattern size
+	 * Consists of 4 bytes
+	 */
+	uint8_t pattern_size[ 4 ];
+
+	/* The signature flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t signature_flags[ 4 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding1[ 4 ];
+};
+
+typedef struct sigscan_scanner_image_scan_tree sigscan_scanner_image_scan_tree_t;
+
+struct sigscan_scanner_image_scan_tree
+{
+	/* The pattern offsets mode
+	 * Consists of 4 bytes
+	 */
+	uint8_t pattern_offsets_mode[ 4 ];
+
+	/* The root reference
+	 * Consists of 4 bytes
+	 */
+	uint8_t root_reference[ 4 ];
+
+	/* The pattern range start
+	 * Consists of 8 bytes
+	 */
+	uint8_t range_start[ 8 ];
+
+	/* The pattern range size
+	 * Consists of 8 bytes
+	 */
+	uint8_t range_size[ 8 ];
+
+	/* The number of nodes
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_nodes[ 4 ];
+
+	/* The number of references
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_references[ 4 ];
+
+	/* The number of signatures
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_signatures[ 4 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding1[ 4 ];
+
+	/* The nodes offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t nodes_offset[ 8 ];
+
+	/* The references offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t references_offset[ 8 ];
+
+	/* The signature indexes offset
+	 * Consists of 8 bytes
+	 * contains a 32-bit image signature index per scan tree arena signature
+	 */
+	uint8_t signature_indexes_offset[ 8 ];
+
+	/* The skip table offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t skip_table_offset[ 8 ];
+
+	/* The Aho-Corasick automaton offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t aho_corasick_offset[ 8 ];
+
+	/* The prefilter offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t prefilter_offset[ 8 ];
+};
+
+typedef struct sigscan_scanner_image_skip_table sigscan_scanner_image_skip_table_t;
+
+struct sigscan_scanner_image_skip_table
+{
+	/* The largest pattern size
+	 * Consists of 8 bytes
+	 */
+	uint8_t largest_pattern_size[ 8 ];
+
+	/* The smallest pattern size
+	 * Consists of 8 bytes
+	 */
+	uint8_t smallest_pattern_size[ 8 ];
+
+	/* The table type
+	 * Consists of 4 bytes
+	 */
+	uint8_t table_type[ 4 ];
+
+	/* The block size
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_size[ 4 ];
+
+	/* The block skip values offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t block_skip_values_offset[ 8 ];
+
+	/* The prefix hashes offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t prefix_hashes_offset[ 8 ];
+
+	/* The skip values
+	 * Consists of 256 x 4 bytes
+	 */
+	uint8_t skip_values[ 256 * 4 ];
+};
+
+typedef struct sigscan_scanner_image_aho_corasick sigscan_scanner_image_aho_corasick_t;
+
+struct sigscan_scanner_image_aho_corasick
+{
+	/* The number of signatures
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_signatures[ 4 ];
+
+	/* The number of states
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_states[ 4 ];
+
+	/* The largest pattern size
+	 * Consists of 8 bytes
+	 */
+	uint8_t largest_pattern_size[ 8 ];
+
+	/* The transitions table offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t transitions_table_offset[ 8 ];
+
+	/* The output signatures offset
+	 * Consists of 8 bytes
+	 * contains a 32-bit image signature index + 1 per state or 0 if not set
+	 */
+	uint8_t output_signatures_offset[ 8 ];
+};
+
+typedef struct sigscan_scanner_image_prefilter sigscan_scanner_image_prefilter_t;
+
+struct sigscan_scanner_image_prefilter
+{
+	/* The pattern offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t pattern_offset[ 8 ];
+
+	/* The byte values table
+	 * Consists of 256 bytes
+	 */
+	uint8_t byte_values_table[ 256 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SIGSCAN_SCANNER_IMAGE_H ) */
+
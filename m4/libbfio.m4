@@ -1,6 +1,6 @@
 dnl Functions for libbfio
 dnl
-dnl Version: 20160108
+dnl Version: 20261017
 
 dnl Function to detect if libbfio is available
 AC_DEFUN([AX_LIBBFIO_CHECK_LIB],
@@ -23,7 +23,7 @@ AC_DEFUN([AX_LIBBFIO_CHECK_LIB],
    [test "x$cross_compiling" != "xyes" && test "x$PKGCONFIG" != "x"],
    [PKG_CHECK_MODULES(
     [libbfio],
-    [libbfio >= 20160108],
+    [libbfio >= 20201125],
     [ac_cv_libbfio=yes],
     [ac_cv_libbfio=no])
    ])
@@ -53,6 +53,11 @@ AC_DEFUN([AX_LIBBFIO_CHECK_LIB],
      libbfio_handle_free,
      [ac_cv_libbfio_dummy=yes],
      [ac_cv_libbfio=no])
+    AC_CHECK_LIB(
+     bfio,
+     libbfio_handle_clone,
+     [ac_cv_libbfio_dummy=yes],
+     [ac_cv_libbfio=no])
     AC_CHECK_LIB(
      bfio,
      libbfio_handle_open,
@@ -73,6 +78,11 @@ AC_DEFUN([AX_LIBBFIO_CHECK_LIB],
      libbfio_handle_read_buffer,
      [ac_cv_libbfio_dummy=yes],
      [ac_cv_libbfio=no])
+    AC_CHECK_LIB(
+     bfio,
+     libbfio_handle_read_buffer_at_offset,
+     [ac_cv_libbfio_dummy=yes],
+     [ac_cv_libbfio=no])
     AC_CHECK_LIB(
      bfio,
      libbfio_handle_write_buffer,
@@ -940,7 +940,7 @@ PyObject *pysigscan_scanner_scan_buffer(
 
 	Py_END_ALLOW_THREADS
 
-	if( result != 1 )
+	if( result == -1 )
 	{
 		pysigscan_error_raise(
 		 error,
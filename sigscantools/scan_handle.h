@@ -80,6 +80,21 @@ int scan_handle_read_signature_definitions(
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int scan_handle_read_byte_value_profile(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int scan_handle_write_byte_value_profile(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int scan_handle_profile_input(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 int scan_handle_scan_input(
      scan_handle_t *scan_handle,
      libsigscan_scan_state_t *scan_state,
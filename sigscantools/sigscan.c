@@ -57,13 +57,17 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use sigscan to scan a file for binary signatures.\n\n" );
 
-	fprintf( stream, "Usage: sigscan [ -c configuration_file ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: sigscan [ -c configuration_file ] [ -p profile_file ] [ -hvV ]\n"
+	                 "               source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-c:     specify the configuration file, defaults\n"
 	                 "\t        to: sigscan.conf\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-p:     specify the byte value profile file, created with\n"
+	                 "\t        sigscanprofile, to shape the scan trees for data\n"
+	                 "\t        with the profiled byte value distribution\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 }
@@ -122,6 +126,7 @@ int main( int argc, char * const argv[] )
 {
 	libcerror_error_t *error                      = NULL;
 	system_character_t *option_configuration_file = _SYSTEM_STRING( "sigscan.conf" );
+	system_character_t *option_profile_file       = NULL;
 	system_character_t *source                    = NULL;
 	libsigscan_scan_state_t *scan_state           = NULL;
 	char *program                                 = "sigscan";
@@ -161,7 +166,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = sigscantools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "c:hvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "c:hp:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -188,6 +193,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'p':
+				option_profile_file = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -255,6 +265,21 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( option_profile_file != NULL )
+	{
+		if( scan_handle_read_byte_value_profile(
+		     sigscan_scan_handle,
+		     option_profile_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read byte value profile from: %" PRIs_SYSTEM ".\n",
+			 option_profile_file );
+
+			goto on_error;
+		}
+	}
 	if( scan_handle_scan_input(
 	     sigscan_scan_handle,
 	     scan_state,
@@ -0,0 +1,593 @@
+/*
+ * Creates a byte value profile of sample files
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scan_handle.h"
+#include "sigscantools_getopt.h"
+#include "sigscantools_libcerror.h"
+#include "sigscantools_libclocale.h"
+#include "sigscantools_libcnotify.h"
+#include "sigscantools_libsigscan.h"
+#include "sigscantools_output.h"
+#include "sigscantools_signal.h"
+#include "sigscantools_unused.h"
+
+scan_handle_t *sigscanprofile_scan_handle = NULL;
+int sigscanprofile_abort                  = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use sigscanprofile to create a byte value profile of sample files.\n\n" );
+
+	fprintf( stream, "Usage: sigscanprofile [ -c configuration_file ] [ -o profile_file ]\n"
+	                 "                      [ -hvV ] source [ source ... ]\n\n" );
+
+	fprintf( stream, "\tsource: a sample file\n\n" );
+
+	fprintf( stream, "\t-c:     specify the configuration file, if set the number of\n"
+	                 "\t        scan tree node visits needed to scan the sample files is\n"
+	                 "\t        printed with and without the byte value profile\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-o:     specify the byte value profile file, defaults\n"
+	                 "\t        to: sigscan.profile\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for sigscanprofile
+ */
+void sigscanprofile_signal_handler(
+      sigscantools_signal_t signal SIGSCANTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "sigscanprofile_signal_handler";
+
+	SIGSCANTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	sigscanprofile_abort = 1;
+
+	if( sigscanprofile_scan_handle != NULL )
+	{
+		if( scan_handle_signal_abort(
+		     sigscanprofile_scan_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal scan handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* Scans the sources and determines the number of scan tree node visits
+ * Returns 1 if successful or -1 on error
+ */
+int sigscanprofile_scan_sources(
+     scan_handle_t *scan_handle,
+     system_character_t * const sources[],
+     int number_of_sources,
+     uint64_t *number_of_scan_tree_node_visits,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_state_t *scan_state = NULL;
+	static char *function               = "sigscanprofile_scan_sources";
+	uint64_t number_of_node_visits      = 0;
+	int source_index                    = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( sources == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sources.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_scan_tree_node_visits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of scan tree node visits.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_scan_tree_node_visits = 0;
+
+	if( libsigscan_scan_state_initialize(
+	     &scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan state.",
+		 function );
+
+		goto on_error;
+	}
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libsigscan_scanner_scan_file_wide(
+		     scan_handle->scanner,
+		     scan_state,
+		     sources[ source_index ],
+		     error ) != 1 )
+#else
+		if( libsigscan_scanner_scan_file(
+		     scan_handle->scanner,
+		     scan_state,
+		     sources[ source_index ],
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan file: %" PRIs_SYSTEM ".",
+			 function,
+			 sources[ source_index ] );
+
+			goto on_error;
+		}
+		if( libsigscan_scan_state_get_number_of_scan_tree_node_visits(
+		     scan_state,
+		     &number_of_node_visits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of scan tree node visits.",
+			 function );
+
+			goto on_error;
+		}
+		*number_of_scan_tree_node_visits += number_of_node_visits;
+	}
+	if( libsigscan_scan_state_free(
+	     &scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scan state.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                      = NULL;
+	scan_handle_t *reference_scan_handle          = NULL;
+	system_character_t *option_configuration_file = NULL;
+	system_character_t *option_profile_file       = _SYSTEM_STRING( "sigscan.profile" );
+	char *program                                 = "sigscanprofile";
+	system_integer_t option                       = 0;
+	uint64_t profile_node_visits                  = 0;
+	uint64_t reference_node_visits                = 0;
+	int result                                    = 0;
+	int source_index                              = 0;
+	int verbose                                   = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "sigscantools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( sigscantools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	sigscanoutput_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = sigscantools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:ho:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				option_configuration_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'o':
+				option_profile_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				sigscanoutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libsigscan_notify_set_stream(
+	 stderr,
+	 NULL );
+	libsigscan_notify_set_verbose(
+	 verbose );
+
+	if( sigscantools_signal_attach(
+	     sigscanprofile_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_handle_initialize(
+	     &sigscanprofile_scan_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create scan handle.\n" );
+
+		goto on_error;
+	}
+	for( source_index = optind;
+	     source_index < argc;
+	     source_index++ )
+	{
+		if( sigscanprofile_abort != 0 )
+		{
+			break;
+		}
+		if( scan_handle_profile_input(
+		     sigscanprofile_scan_handle,
+		     argv[ source_index ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to profile: %" PRIs_SYSTEM ".\n",
+			 argv[ source_index ] );
+
+			goto on_error;
+		}
+	}
+	if( sigscanprofile_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Aborted.\n" );
+
+		goto on_error;
+	}
+	result = scan_handle_write_byte_value_profile(
+	          sigscanprofile_scan_handle,
+	          option_profile_file,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write byte value profile to: %" PRIs_SYSTEM ".\n",
+		 option_profile_file );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write byte value profile - sources contain no data.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Byte value profile written to: %" PRIs_SYSTEM ".\n",
+	 option_profile_file );
+
+	/* Compare the number of scan tree node visits needed to scan the sources
+	 * by scan trees shaped with and without the byte value profile
+	 */
+	if( option_configuration_file != NULL )
+	{
+		if( scan_handle_initialize(
+		     &reference_scan_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create reference scan handle.\n" );
+
+			goto on_error;
+		}
+		if( scan_handle_read_signature_definitions(
+		     reference_scan_handle,
+		     option_configuration_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read signatures from: %" PRIs_SYSTEM ".\n",
+			 option_configuration_file );
+
+			goto on_error;
+		}
+		if( scan_handle_read_signature_definitions(
+		     sigscanprofile_scan_handle,
+		     option_configuration_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read signatures from: %" PRIs_SYSTEM ".\n",
+			 option_configuration_file );
+
+			goto on_error;
+		}
+		if( sigscanprofile_scan_sources(
+		     reference_scan_handle,
+		     &( argv[ optind ] ),
+		     argc - optind,
+		     &reference_node_visits,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to scan sources without byte value profile.\n" );
+
+			goto on_error;
+		}
+		if( sigscanprofile_scan_sources(
+		     sigscanprofile_scan_handle,
+		     &( argv[ optind ] ),
+		     argc - optind,
+		     &profile_node_visits,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to scan sources with byte value profile.\n" );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "\nNumber of scan tree node visits:\n" );
+
+		fprintf(
+		 stdout,
+		 "\twithout byte value profile\t: %" PRIu64 "\n",
+		 reference_node_visits );
+
+		fprintf(
+		 stdout,
+		 "\twith byte value profile\t\t: %" PRIu64 "\n",
+		 profile_node_visits );
+
+		if( reference_node_visits > 0 )
+		{
+			fprintf(
+			 stdout,
+			 "\tratio\t\t\t\t: %.3f\n",
+			 (double) profile_node_visits / (double) reference_node_visits );
+		}
+		fprintf(
+		 stdout,
+		 "\n" );
+
+		if( scan_handle_free(
+		     &reference_scan_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free reference scan handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( scan_handle_free(
+	     &sigscanprofile_scan_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free scan handle.\n" );
+
+		goto on_error;
+	}
+	if( sigscantools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( reference_scan_handle != NULL )
+	{
+		scan_handle_free(
+		 &reference_scan_handle,
+		 NULL );
+	}
+	if( sigscanprofile_scan_handle != NULL )
+	{
+		scan_handle_free(
+		 &sigscanprofile_scan_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1314 @@
+/*
+ * Library batch type test program
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_macros.h"
+#include "sigscan_test_memory.h"
+#include "sigscan_test_unused.h"
+
+/* Tests the libsigscan_batch_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_batch_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libsigscan_batch_t *batch       = NULL;
+	libsigscan_scanner_t *scanner   = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_batch_initialize(
+	          &batch,
+	          scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "batch",
+         batch );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libsigscan_batch_free(
+	          &batch,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "batch",
+         batch );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_batch_initialize(
+	          NULL,
+	          scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	batch = (libsigscan_batch_t *) 0x12345678UL;
+
+	result = libsigscan_batch_initialize(
+	          &batch,
+	          scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	batch = NULL;
+
+	result = libsigscan_batch_initialize(
+	          &batch,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_batch_initialize with malloc failing
+		 */
+		sigscan_test_malloc_attempts_before_fail = test_number;
+
+		result = libsigscan_batch_initialize(
+		          &batch,
+		          scanner,
+		          &error );
+
+		if( sigscan_test_malloc_attempts_before_fail != -1 )
+		{
+			sigscan_test_malloc_attempts_before_fail = -1;
+
+			if( batch != NULL )
+			{
+				libsigscan_batch_free(
+				 &batch,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "batch",
+			 batch );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_batch_initialize with memset failing
+		 */
+		sigscan_test_memset_attempts_before_fail = test_number;
+
+		result = libsigscan_batch_initialize(
+		          &batch,
+		          scanner,
+		          &error );
+
+		if( sigscan_test_memset_attempts_before_fail != -1 )
+		{
+			sigscan_test_memset_attempts_before_fail = -1;
+
+			if( batch != NULL )
+			{
+				libsigscan_batch_free(
+				 &batch,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "batch",
+			 batch );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SIGSCAN_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		libsigscan_batch_free(
+		 &batch,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_batch_free function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_batch_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_batch_free(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_batch_set_number_of_workers function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_batch_set_number_of_workers(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libsigscan_batch_t *batch     = NULL;
+	libsigscan_scanner_t *scanner = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_batch_initialize(
+	          &batch,
+	          scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_batch_set_number_of_workers(
+	          batch,
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_batch_set_number_of_workers(
+	          NULL,
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_batch_set_number_of_workers(
+	          batch,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_batch_free(
+	          &batch,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		libsigscan_batch_free(
+		 &batch,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_batch_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_batch_get_number_of_entries(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libsigscan_batch_t *batch     = NULL;
+	libsigscan_scanner_t *scanner = NULL;
+	int number_of_entries         = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_batch_initialize(
+	          &batch,
+	          scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_batch_get_number_of_entries(
+	          batch,
+	          &number_of_entries,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_batch_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_batch_free(
+	          &batch,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		libsigscan_batch_free(
+		 &batch,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The test files of the batch scan test
+ */
+const char *sigscan_test_batch_filenames[ 5 ] = {
+	"sigscan_test_batch_header.tmp",
+	"sigscan_test_batch_footer.tmp",
+	"sigscan_test_batch_all.tmp",
+	"sigscan_test_batch_none.tmp",
+	"sigscan_test_batch_missing.tmp" };
+
+/* Writes the data to a test file
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_batch_write_test_file(
+     const char *filename,
+     const uint8_t *data,
+     size_t data_size )
+{
+	FILE *file_stream  = NULL;
+	size_t write_count = 0;
+
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( file_stream == NULL )
+	{
+		return( -1 );
+	}
+	write_count = file_stream_write(
+	               file_stream,
+	               data,
+	               data_size );
+
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		return( -1 );
+	}
+	if( write_count != data_size )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the test files of the batch scan test
+ * The last test file is not written so that its scan fails
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_batch_write_test_files(
+     void )
+{
+	uint8_t *buffer = NULL;
+	int result      = 1;
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * 6000 );
+
+	if( buffer == NULL )
+	{
+		return( -1 );
+	}
+	/* A header signature at the start of the file
+	 */
+	memory_set(
+	 buffer,
+	 'x',
+	 6000 );
+
+	memory_copy(
+	 buffer,
+	 "HEAD",
+	 4 );
+
+	if( sigscan_test_batch_write_test_file(
+	     sigscan_test_batch_filenames[ 0 ],
+	     buffer,
+	     200 ) != 1 )
+	{
+		result = -1;
+	}
+	/* A footer signature in a file that is smaller than the maximum range gap size
+	 */
+	memory_set(
+	 buffer,
+	 'x',
+	 6000 );
+
+	memory_copy(
+	 &( buffer[ 92 ] ),
+	 "FOOT",
+	 4 );
+
+	if( sigscan_test_batch_write_test_file(
+	     sigscan_test_batch_filenames[ 1 ],
+	     buffer,
+	     100 ) != 1 )
+	{
+		result = -1;
+	}
+	/* A header, unbound and footer signature
+	 */
+	memory_set(
+	 buffer,
+	 'x',
+	 6000 );
+
+	memory_copy(
+	 buffer,
+	 "HEAD",
+	 4 );
+
+	memory_copy(
+	 &( buffer[ 3000 ] ),
+	 "MIDDLE",
+	 6 );
+
+	memory_copy(
+	 &( buffer[ 5992 ] ),
+	 "FOOT",
+	 4 );
+
+	if( sigscan_test_batch_write_test_file(
+	     sigscan_test_batch_filenames[ 2 ],
+	     buffer,
+	     6000 ) != 1 )
+	{
+		result = -1;
+	}
+	/* No signatures
+	 */
+	memory_set(
+	 buffer,
+	 'x',
+	 6000 );
+
+	if( sigscan_test_batch_write_test_file(
+	     sigscan_test_batch_filenames[ 3 ],
+	     buffer,
+	     64 ) != 1 )
+	{
+		result = -1;
+	}
+	memory_free(
+	 buffer );
+
+	return( result );
+}
+
+/* Removes the test files of the batch scan test
+ */
+void sigscan_test_batch_remove_test_files(
+     void )
+{
+	int file_index = 0;
+
+	for( file_index = 0;
+	     file_index < 4;
+	     file_index++ )
+	{
+		remove(
+		 sigscan_test_batch_filenames[ file_index ] );
+	}
+}
+
+/* Creates a scanner with the signatures of the batch scan test
+ * The signatures are added in the order: footer, header and unbound
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_batch_initialize_test_scanner(
+     libsigscan_scanner_t **scanner,
+     int number_of_signatures,
+     libcerror_error_t **error )
+{
+	if( libsigscan_scanner_initialize(
+	     scanner,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libsigscan_scanner_add_signature(
+	     *scanner,
+	     "footer",
+	     6,
+	     8,
+	     (uint8_t *) "FOOT",
+	     4,
+	     LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( number_of_signatures > 1 )
+	{
+		if( libsigscan_scanner_add_signature(
+		     *scanner,
+		     "header",
+		     6,
+		     0,
+		     (uint8_t *) "HEAD",
+		     4,
+		     LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	if( number_of_signatures > 2 )
+	{
+		if( libsigscan_scanner_add_signature(
+		     *scanner,
+		     "unbound",
+		     7,
+		     0,
+		     (uint8_t *) "MIDDLE",
+		     6,
+		     LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Scans the test files with a batch and checks the scan results of every entry
+ * The expected offsets contain 3 values per entry
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_batch_scan_test_files(
+     libsigscan_scanner_t *scanner,
+     int number_of_workers,
+     const int *expected_number_of_results,
+     const int64_t *expected_offsets )
+{
+	libcerror_error_t *error              = NULL;
+	libsigscan_batch_t *batch             = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	off64_t offset                        = 0;
+	int entry_index                       = 0;
+	int expected_scan_status              = 0;
+	int file_index                        = 0;
+	int number_of_entries                 = 0;
+	int number_of_results                 = 0;
+	int result                            = 0;
+	int result_index                      = 0;
+	int scan_status                       = 0;
+
+	result = libsigscan_batch_initialize(
+	          &batch,
+	          scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_batch_set_number_of_workers(
+	          batch,
+	          number_of_workers,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( file_index = 0;
+	     file_index < 5;
+	     file_index++ )
+	{
+		result = libsigscan_batch_append_file(
+		          batch,
+		          sigscan_test_batch_filenames[ file_index ],
+		          &entry_index,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "entry_index",
+		 entry_index,
+		 file_index );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libsigscan_batch_get_number_of_entries(
+	          batch,
+	          &number_of_entries,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 5 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_batch_get_scan_status(
+	          batch,
+	          0,
+	          &scan_status,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "scan_status",
+	 scan_status,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_batch_scan(
+	          batch,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 5;
+	     entry_index++ )
+	{
+		/* The scan of the missing file fails
+		 */
+		if( entry_index == 4 )
+		{
+			expected_scan_status = -1;
+		}
+		else
+		{
+			expected_scan_status = 1;
+		}
+		result = libsigscan_batch_get_scan_status(
+		          batch,
+		          entry_index,
+		          &scan_status,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "scan_status",
+		 scan_status,
+		 expected_scan_status );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_batch_get_number_of_results(
+		          batch,
+		          entry_index,
+		          &number_of_results,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "number_of_results",
+		 number_of_results,
+		 expected_number_of_results[ entry_index ] );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( result_index = 0;
+		     result_index < number_of_results;
+		     result_index++ )
+		{
+			result = libsigscan_batch_get_result(
+			          batch,
+			          entry_index,
+			          result_index,
+			          &scan_result,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "scan_result",
+			 scan_result );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_result_get_offset(
+			          scan_result,
+			          &offset,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+			 "offset",
+			 (int64_t) offset,
+			 expected_offsets[ ( entry_index * 3 ) + result_index ] );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			/* The scan result is owned by the batch
+			 */
+			scan_result = NULL;
+		}
+	}
+	/* Test error cases
+	 */
+	result = libsigscan_batch_get_scan_status(
+	          batch,
+	          5,
+	          &scan_status,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_batch_get_number_of_results(
+	          batch,
+	          5,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_batch_get_result(
+	          batch,
+	          0,
+	          1,
+	          &scan_result,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_batch_free(
+	          &batch,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		libsigscan_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_batch_append_file, libsigscan_batch_scan, libsigscan_batch_get_scan_status,
+ * libsigscan_batch_get_number_of_results and libsigscan_batch_get_result functions
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_batch_scan(
+     void )
+{
+	/* The expected results of a scanner with only the footer signature,
+	 * with the footer and header signatures and with all signatures
+	 */
+	int expected_number_of_results[ 3 ][ 5 ] = {
+		{ 0, 1, 1, 0, 0 },
+		{ 1, 1, 2, 0, 0 },
+		{ 1, 1, 3, 0, 0 } };
+
+	int64_t expected_offsets[ 3 ][ 15 ] = {
+		{ 0, 0, 0,  92, 0, 0,  5992, 0, 0,     0, 0, 0,  0, 0, 0 },
+		{ 0, 0, 0,  92, 0, 0,  0, 5992, 0,     0, 0, 0,  0, 0, 0 },
+		{ 0, 0, 0,  92, 0, 0,  0, 5992, 3000,  0, 0, 0,  0, 0, 0 } };
+
+	libcerror_error_t *error      = NULL;
+	libsigscan_scanner_t *scanner = NULL;
+	int files_written             = 0;
+	int result                    = 0;
+	int test_index                = 0;
+
+	/* Initialize test
+	 */
+	result = sigscan_test_batch_write_test_files();
+
+	files_written = 1;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test scan with a single and multiple workers
+	 */
+	for( test_index = 0;
+	     test_index < 3;
+	     test_index++ )
+	{
+		result = sigscan_test_batch_initialize_test_scanner(
+		          &scanner,
+		          test_index + 1,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = sigscan_test_batch_scan_test_files(
+		          scanner,
+		          1,
+		          expected_number_of_results[ test_index ],
+		          expected_offsets[ test_index ] );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = sigscan_test_batch_scan_test_files(
+		          scanner,
+		          4,
+		          expected_number_of_results[ test_index ],
+		          expected_offsets[ test_index ] );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libsigscan_scanner_free(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	sigscan_test_batch_remove_test_files();
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	if( files_written != 0 )
+	{
+		sigscan_test_batch_remove_test_files();
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_batch_initialize",
+	 sigscan_test_batch_initialize );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_batch_free",
+	 sigscan_test_batch_free );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_batch_set_number_of_workers",
+	 sigscan_test_batch_set_number_of_workers );
+
+	/* TODO: add tests for libsigscan_batch_append_file_io_handle */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_batch_scan",
+	 sigscan_test_batch_scan );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_batch_get_number_of_entries",
+	 sigscan_test_batch_get_number_of_entries );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,701 @@
+/*
+ * Library prefilter type test program
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_macros.h"
+#include "sigscan_test_memory.h"
+#include "sigscan_test_unused.h"
+
+#include "../libsigscan/libsigscan_prefilter.h"
+
+#if defined( __GNUC__ )
+
+/* Tests the libsigscan_prefilter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_prefilter_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libsigscan_prefilter_t *prefilter = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsigscan_prefilter_initialize(
+	          &prefilter,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "prefilter",
+         prefilter );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libsigscan_prefilter_free(
+	          &prefilter,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "prefilter",
+         prefilter );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_prefilter_initialize(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	prefilter = (libsigscan_prefilter_t *) 0x12345678UL;
+
+	result = libsigscan_prefilter_initialize(
+	          &prefilter,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	prefilter = NULL;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_prefilter_initialize with malloc failing
+		 */
+		sigscan_test_malloc_attempts_before_fail = test_number;
+
+		result = libsigscan_prefilter_initialize(
+		          &prefilter,
+		          &error );
+
+		if( sigscan_test_malloc_attempts_before_fail != -1 )
+		{
+			sigscan_test_malloc_attempts_before_fail = -1;
+
+			if( prefilter != NULL )
+			{
+				libsigscan_prefilter_free(
+				 &prefilter,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "prefilter",
+			 prefilter );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_prefilter_initialize with memset failing
+		 */
+		sigscan_test_memset_attempts_before_fail = test_number;
+
+		result = libsigscan_prefilter_initialize(
+		          &prefilter,
+		          &error );
+
+		if( sigscan_test_memset_attempts_before_fail != -1 )
+		{
+			sigscan_test_memset_attempts_before_fail = -1;
+
+			if( prefilter != NULL )
+			{
+				libsigscan_prefilter_free(
+				 &prefilter,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "prefilter",
+			 prefilter );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SIGSCAN_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( prefilter != NULL )
+	{
+		libsigscan_prefilter_free(
+		 &prefilter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_prefilter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_prefilter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_prefilter_free(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_prefilter_get_instruction_set function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_prefilter_get_instruction_set(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libsigscan_prefilter_t *prefilter = NULL;
+	int instruction_set               = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_prefilter_initialize(
+	          &prefilter,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "prefilter",
+	 prefilter );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_prefilter_get_instruction_set(
+	          prefilter,
+	          &instruction_set,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "instruction_set",
+	 instruction_set,
+	 LIBSIGSCAN_PREFILTER_INSTRUCTION_SET_SCALAR );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_prefilter_get_instruction_set(
+	          NULL,
+	          &instruction_set,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_prefilter_get_instruction_set(
+	          prefilter,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_prefilter_free(
+	          &prefilter,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "prefilter",
+	 prefilter );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( prefilter != NULL )
+	{
+		libsigscan_prefilter_free(
+		 &prefilter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_prefilter_scan_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_prefilter_scan_buffer(
+     void )
+{
+	uint8_t buffer[ 128 ];
+
+	libcerror_error_t *error          = NULL;
+	libsigscan_prefilter_t *prefilter = NULL;
+	size_t candidate_offset           = 0;
+	int instruction_set               = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_prefilter_initialize(
+	          &prefilter,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "prefilter",
+	 prefilter );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Emulate a prefilter for patterns with 'X' or 'Y' as their second byte
+	 */
+	prefilter->pattern_offset        = 1;
+	prefilter->number_of_byte_values = 2;
+	prefilter->byte_values[ 0 ]      = (uint8_t) 'X';
+	prefilter->byte_values[ 1 ]      = (uint8_t) 'Y';
+
+	prefilter->byte_values_table[ 'X' ] = 1;
+	prefilter->byte_values_table[ 'Y' ] = 1;
+
+	result = memory_set(
+	          buffer,
+	          'a',
+	          128 ) != NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	buffer[ 70 ]  = (uint8_t) 'Y';
+	buffer[ 100 ] = (uint8_t) 'X';
+
+	for( instruction_set = LIBSIGSCAN_PREFILTER_INSTRUCTION_SET_SCALAR;
+	     instruction_set <= LIBSIGSCAN_PREFILTER_INSTRUCTION_SET_AVX2;
+	     instruction_set++ )
+	{
+#if defined( HAVE_LIBSIGSCAN_PREFILTER_AVX2 )
+		if( ( instruction_set == LIBSIGSCAN_PREFILTER_INSTRUCTION_SET_AVX2 )
+		 && ( __builtin_cpu_supports( "avx2" ) == 0 ) )
+		{
+			break;
+		}
+#endif
+		/* Instruction sets that are not supported fall back to scalar
+		 */
+		prefilter->instruction_set = instruction_set;
+		/* Test regular cases
+		 */
+		result = libsigscan_prefilter_scan_buffer(
+		          prefilter,
+		          buffer,
+		          128,
+		          0,
+		          128,
+		          &candidate_offset,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+		 "candidate_offset",
+		 candidate_offset,
+		 (size_t) 69 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_prefilter_scan_buffer(
+		          prefilter,
+		          buffer,
+		          128,
+		          70,
+		          128,
+		          &candidate_offset,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+		 "candidate_offset",
+		 candidate_offset,
+		 (size_t) 99 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_prefilter_scan_buffer(
+		          prefilter,
+		          buffer,
+		          128,
+		          70,
+		          99,
+		          &candidate_offset,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libsigscan_prefilter_scan_buffer(
+	          NULL,
+	          buffer,
+	          128,
+	          0,
+	          128,
+	          &candidate_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_prefilter_scan_buffer(
+	          prefilter,
+	          NULL,
+	          128,
+	          0,
+	          128,
+	          &candidate_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_prefilter_scan_buffer(
+	          prefilter,
+	          buffer,
+	          128,
+	          0,
+	          129,
+	          &candidate_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_prefilter_scan_buffer(
+	          prefilter,
+	          buffer,
+	          128,
+	          0,
+	          128,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_prefilter_free(
+	          &prefilter,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "prefilter",
+	 prefilter );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( prefilter != NULL )
+	{
+		libsigscan_prefilter_free(
+		 &prefilter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_prefilter_initialize",
+	 sigscan_test_prefilter_initialize );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_prefilter_free",
+	 sigscan_test_prefilter_free );
+
+	/* TODO: add tests for libsigscan_prefilter_build */
+
+	/* TODO: add tests for libsigscan_prefilter_select_instruction_set */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_prefilter_get_instruction_set",
+	 sigscan_test_prefilter_get_instruction_set );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_prefilter_scan_buffer",
+	 sigscan_test_prefilter_scan_buffer );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,517 @@
+/*
+ * Library Scan chunk type test program
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_macros.h"
+#include "sigscan_test_memory.h"
+#include "sigscan_test_unused.h"
+
+#include "../libsigscan/libsigscan_scan_chunk.h"
+#include "../libsigscan/libsigscan_scan_result_arena.h"
+
+#if defined( __GNUC__ )
+
+/* Tests the libsigscan_scan_chunk_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_chunk_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_chunk_t *scan_chunk = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 1;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_chunk_initialize(
+	          &scan_chunk,
+	          0,
+	          1024,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "scan_chunk",
+         scan_chunk );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libsigscan_scan_chunk_free(
+	          &scan_chunk,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "scan_chunk",
+         scan_chunk );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_chunk_initialize(
+	          NULL,
+	          0,
+	          1024,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan_chunk = (libsigscan_scan_chunk_t *) 0x12345678UL;
+
+	result = libsigscan_scan_chunk_initialize(
+	          &scan_chunk,
+	          0,
+	          1024,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan_chunk = NULL;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_scan_chunk_initialize with malloc failing
+		 */
+		sigscan_test_malloc_attempts_before_fail = test_number;
+
+		result = libsigscan_scan_chunk_initialize(
+		          &scan_chunk,
+		          0,
+		          1024,
+		          &error );
+
+		if( sigscan_test_malloc_attempts_before_fail != -1 )
+		{
+			sigscan_test_malloc_attempts_before_fail = -1;
+
+			if( scan_chunk != NULL )
+			{
+				libsigscan_scan_chunk_free(
+				 &scan_chunk,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "scan_chunk",
+			 scan_chunk );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_scan_chunk_initialize with memset failing
+		 */
+		sigscan_test_memset_attempts_before_fail = test_number;
+
+		result = libsigscan_scan_chunk_initialize(
+		          &scan_chunk,
+		          0,
+		          1024,
+		          &error );
+
+		if( sigscan_test_memset_attempts_before_fail != -1 )
+		{
+			sigscan_test_memset_attempts_before_fail = -1;
+
+			if( scan_chunk != NULL )
+			{
+				libsigscan_scan_chunk_free(
+				 &scan_chunk,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "scan_chunk",
+			 scan_chunk );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SIGSCAN_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_chunk != NULL )
+	{
+		libsigscan_scan_chunk_free(
+		 &scan_chunk,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_chunk_free function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_chunk_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_chunk_free(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_chunk_set_scan_results function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_chunk_set_scan_results(
+     void )
+{
+	libcerror_error_t *error                              = NULL;
+	libsigscan_scan_chunk_t *scan_chunk                   = NULL;
+	libsigscan_scan_result_arena_t *expected_result_arena = NULL;
+	libsigscan_scan_result_arena_t *scan_result_arena     = NULL;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scan_chunk_initialize(
+	          &scan_chunk,
+	          0,
+	          1024,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_chunk",
+	 scan_chunk );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_result_arena_initialize(
+	          &scan_result_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	expected_result_arena = scan_result_arena;
+
+	result = libsigscan_scan_chunk_set_scan_results(
+	          scan_chunk,
+	          &scan_result_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_result_arena",
+	 scan_result_arena );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The scan chunk now manages the scan result arena
+	 */
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "scan_chunk->scan_result_arena",
+	 (int) ( scan_chunk->scan_result_arena == expected_result_arena ),
+	 1 );
+
+	/* Setting the scan results again frees the previous scan result arena
+	 */
+	result = libsigscan_scan_result_arena_initialize(
+	          &scan_result_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_result_arena = scan_result_arena;
+
+	result = libsigscan_scan_chunk_set_scan_results(
+	          scan_chunk,
+	          &scan_result_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_result_arena",
+	 scan_result_arena );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "scan_chunk->scan_result_arena",
+	 (int) ( scan_chunk->scan_result_arena == expected_result_arena ),
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_chunk_set_scan_results(
+	          NULL,
+	          &scan_result_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_chunk_set_scan_results(
+	          scan_chunk,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 * freeing the scan chunk frees the scan result arena
+	 */
+	result = libsigscan_scan_chunk_free(
+	          &scan_chunk,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_chunk",
+	 scan_chunk );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result_arena != NULL )
+	{
+		libsigscan_scan_result_arena_free(
+		 &scan_result_arena,
+		 NULL );
+	}
+	if( scan_chunk != NULL )
+	{
+		libsigscan_scan_chunk_free(
+		 &scan_chunk,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_chunk_initialize",
+	 sigscan_test_scan_chunk_initialize );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_chunk_free",
+	 sigscan_test_scan_chunk_free );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_chunk_set_scan_results",
+	 sigscan_test_scan_chunk_set_scan_results );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
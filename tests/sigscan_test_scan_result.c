@@ -96,6 +96,10 @@ int main(
 
 	/* TODO: add tests for libsigscan_scan_result_get_identifier */
 
+	/* TODO: add tests for libsigscan_scan_result_get_offset */
+
+	/* TODO: add tests for libsigscan_scan_result_get_signature_index */
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,861 @@
+/*
+ * Library scan_result_arena type test program
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_macros.h"
+#include "sigscan_test_memory.h"
+#include "sigscan_test_unused.h"
+
+#include "../libsigscan/libsigscan_definitions.h"
+#include "../libsigscan/libsigscan_scan_result_arena.h"
+#include "../libsigscan/libsigscan_signature.h"
+
+#if defined( __GNUC__ )
+
+/* Tests the libsigscan_scan_result_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_result_arena_initialize(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libsigscan_scan_result_arena_t *scan_result_arena = NULL;
+	int result                                        = 0;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+	int number_of_malloc_fail_tests                   = 1;
+	int number_of_memset_fail_tests                   = 1;
+	int test_number                                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_result_arena_initialize(
+	          &scan_result_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "scan_result_arena",
+         scan_result_arena );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libsigscan_scan_result_arena_free(
+	          &scan_result_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "scan_result_arena",
+         scan_result_arena );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_result_arena_initialize(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan_result_arena = (libsigscan_scan_result_arena_t *) 0x12345678UL;
+
+	result = libsigscan_scan_result_arena_initialize(
+	          &scan_result_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan_result_arena = NULL;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_scan_result_arena_initialize with malloc failing
+		 */
+		sigscan_test_malloc_attempts_before_fail = test_number;
+
+		result = libsigscan_scan_result_arena_initialize(
+		          &scan_result_arena,
+		          &error );
+
+		if( sigscan_test_malloc_attempts_before_fail != -1 )
+		{
+			sigscan_test_malloc_attempts_before_fail = -1;
+
+			if( scan_result_arena != NULL )
+			{
+				libsigscan_scan_result_arena_free(
+				 &scan_result_arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "scan_result_arena",
+			 scan_result_arena );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_scan_result_arena_initialize with memset failing
+		 */
+		sigscan_test_memset_attempts_before_fail = test_number;
+
+		result = libsigscan_scan_result_arena_initialize(
+		          &scan_result_arena,
+		          &error );
+
+		if( sigscan_test_memset_attempts_before_fail != -1 )
+		{
+			sigscan_test_memset_attempts_before_fail = -1;
+
+			if( scan_result_arena != NULL )
+			{
+				libsigscan_scan_result_arena_free(
+				 &scan_result_arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "scan_result_arena",
+			 scan_result_arena );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SIGSCAN_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result_arena != NULL )
+	{
+		libsigscan_scan_result_arena_free(
+		 &scan_result_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_result_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_result_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_result_arena_free(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_result_arena_append_scan_result function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_result_arena_append_scan_result(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libsigscan_internal_scan_result_t *first_result   = NULL;
+	libsigscan_internal_scan_result_t *scan_result    = NULL;
+	libsigscan_scan_result_arena_t *scan_result_arena = NULL;
+	libsigscan_signature_t *signature                 = NULL;
+	int number_of_scan_results                        = 0;
+	int result                                        = 0;
+	int scan_result_index                             = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_signature_initialize(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signature",
+	 signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_result_arena_initialize(
+	          &scan_result_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_result_arena",
+	 scan_result_arena );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * append enough scan results to allocate multiple segments
+	 */
+	for( scan_result_index = 0;
+	     scan_result_index < ( 4 * LIBSIGSCAN_SCAN_RESULT_ARENA_SEGMENT_SIZE );
+	     scan_result_index++ )
+	{
+		result = libsigscan_scan_result_arena_append_scan_result(
+		          scan_result_arena,
+		          (off64_t) scan_result_index,
+		          signature,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( scan_result_index == 0 )
+		{
+			result = libsigscan_scan_result_arena_get_scan_result_by_index(
+			          scan_result_arena,
+			          0,
+			          &first_result,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	result = libsigscan_scan_result_arena_get_number_of_scan_results(
+	          scan_result_arena,
+	          &number_of_scan_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_scan_results",
+	 number_of_scan_results,
+	 4 * LIBSIGSCAN_SCAN_RESULT_ARENA_SEGMENT_SIZE );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( scan_result_index = 0;
+	     scan_result_index < number_of_scan_results;
+	     scan_result_index++ )
+	{
+		result = libsigscan_scan_result_arena_get_scan_result_by_index(
+		          scan_result_arena,
+		          scan_result_index,
+		          &scan_result,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "scan_result",
+		 scan_result );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+		 "scan_result->offset",
+		 (int64_t) scan_result->offset,
+		 (int64_t) scan_result_index );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The first scan result is not moved when segments are added
+	 */
+	result = libsigscan_scan_result_arena_get_scan_result_by_index(
+	          scan_result_arena,
+	          0,
+	          &scan_result,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "scan_result == first_result",
+	 (int) ( scan_result == first_result ),
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_result_arena_append_scan_result(
+	          NULL,
+	          0,
+	          signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_result_arena_append_scan_result(
+	          scan_result_arena,
+	          -1,
+	          signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_result_arena_append_scan_result(
+	          scan_result_arena,
+	          0,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_result_arena_free(
+	          &scan_result_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_result_arena",
+	 scan_result_arena );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_free(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result_arena != NULL )
+	{
+		libsigscan_scan_result_arena_free(
+		 &scan_result_arena,
+		 NULL );
+	}
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_result_arena_copy_scan_results function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_result_arena_copy_scan_results(
+     void )
+{
+	int signature_indexes[ 2 * LIBSIGSCAN_SCAN_RESULT_ARENA_SEGMENT_SIZE ];
+	off64_t offsets[ 2 * LIBSIGSCAN_SCAN_RESULT_ARENA_SEGMENT_SIZE ];
+
+	libcerror_error_t *error                          = NULL;
+	libsigscan_scan_result_arena_t *scan_result_arena = NULL;
+	libsigscan_signature_t *signature                 = NULL;
+	int first_scan_result_index                       = 0;
+	int result                                        = 0;
+	int scan_result_index                             = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_signature_initialize(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signature",
+	 signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	signature->signature_index = 7;
+
+	result = libsigscan_scan_result_arena_initialize(
+	          &scan_result_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_result_arena",
+	 scan_result_arena );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( scan_result_index = 0;
+	     scan_result_index < ( 3 * LIBSIGSCAN_SCAN_RESULT_ARENA_SEGMENT_SIZE );
+	     scan_result_index++ )
+	{
+		result = libsigscan_scan_result_arena_append_scan_result(
+		          scan_result_arena,
+		          (off64_t) scan_result_index,
+		          signature,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 * copy scan results that span the first and the second segment
+	 */
+	first_scan_result_index = LIBSIGSCAN_SCAN_RESULT_ARENA_SEGMENT_SIZE - 2;
+
+	result = libsigscan_scan_result_arena_copy_scan_results(
+	          scan_result_arena,
+	          first_scan_result_index,
+	          2 * LIBSIGSCAN_SCAN_RESULT_ARENA_SEGMENT_SIZE,
+	          signature_indexes,
+	          offsets,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( scan_result_index = 0;
+	     scan_result_index < ( 2 * LIBSIGSCAN_SCAN_RESULT_ARENA_SEGMENT_SIZE );
+	     scan_result_index++ )
+	{
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "signature_indexes[ scan_result_index ]",
+		 signature_indexes[ scan_result_index ],
+		 7 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+		 "offsets[ scan_result_index ]",
+		 (int64_t) offsets[ scan_result_index ],
+		 (int64_t) ( first_scan_result_index + scan_result_index ) );
+	}
+	/* Test error cases
+	 */
+	result = libsigscan_scan_result_arena_copy_scan_results(
+	          NULL,
+	          0,
+	          1,
+	          signature_indexes,
+	          offsets,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_result_arena_copy_scan_results(
+	          scan_result_arena,
+	          -1,
+	          1,
+	          signature_indexes,
+	          offsets,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_result_arena_copy_scan_results(
+	          scan_result_arena,
+	          3 * LIBSIGSCAN_SCAN_RESULT_ARENA_SEGMENT_SIZE,
+	          1,
+	          signature_indexes,
+	          offsets,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_result_arena_copy_scan_results(
+	          scan_result_arena,
+	          0,
+	          1,
+	          NULL,
+	          offsets,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_result_arena_copy_scan_results(
+	          scan_result_arena,
+	          0,
+	          1,
+	          signature_indexes,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_result_arena_free(
+	          &scan_result_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_result_arena",
+	 scan_result_arena );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_free(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result_arena != NULL )
+	{
+		libsigscan_scan_result_arena_free(
+		 &scan_result_arena,
+		 NULL );
+	}
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_result_arena_initialize",
+	 sigscan_test_scan_result_arena_initialize );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_result_arena_free",
+	 sigscan_test_scan_result_arena_free );
+
+	/* TODO: add tests for libsigscan_scan_result_arena_empty */
+
+	/* TODO: add tests for libsigscan_scan_result_arena_get_number_of_scan_results */
+
+	/* TODO: add tests for libsigscan_scan_result_arena_get_scan_result_by_index */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_result_arena_append_scan_result",
+	 sigscan_test_scan_result_arena_append_scan_result );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_result_arena_copy_scan_results",
+	 sigscan_test_scan_result_arena_copy_scan_results );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -266,6 +266,255 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libsigscan_scan_state_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_state_reset(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	int number_of_results               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_reset(
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_state_reset(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_state_set_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_state_set_flags(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_set_flags(
+	          scan_state,
+	          LIBSIGSCAN_SCAN_STATE_FLAG_SCAN_IN_PLACE,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_flags(
+	          scan_state,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_state_set_flags(
+	          NULL,
+	          LIBSIGSCAN_SCAN_STATE_FLAG_SCAN_IN_PLACE,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_state_set_flags(
+	          scan_state,
+	          0xff,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #if defined( __GNUC__ )
 
 /* Tests the libsigscan_scan_state_get_buffer_size function
@@ -539,10 +788,28 @@ int main(
 	 "libsigscan_scan_state_free",
 	 sigscan_test_scan_state_free );
 
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_state_reset",
+	 sigscan_test_scan_state_reset );
+
 	/* TODO: add tests for libsigscan_scan_state_set_data_offset */
 
 	/* TODO: add tests for libsigscan_scan_state_set_data_size */
 
+	/* TODO: add tests for libsigscan_scan_state_get_flags */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_state_set_flags",
+	 sigscan_test_scan_state_set_flags );
+
+	/* TODO: add tests for libsigscan_scan_state_get_number_of_workers */
+
+	/* TODO: add tests for libsigscan_scan_state_set_number_of_workers */
+
+	/* TODO: add tests for libsigscan_scan_state_get_block_alignment */
+
+	/* TODO: add tests for libsigscan_scan_state_set_block_alignment */
+
 #if defined( __GNUC__ )
 
 	SIGSCAN_TEST_RUN(
@@ -561,6 +828,10 @@ int main(
 
 	/* TODO: add tests for libsigscan_scan_state_scan_buffer */
 
+	/* TODO: add tests for libsigscan_internal_scan_state_scan_block */
+
+	/* TODO: add tests for libsigscan_internal_scan_state_scan_blocks */
+
 #endif /* defined( __GNUC__ ) */
 
 	SIGSCAN_TEST_RUN(
@@ -569,6 +840,14 @@ int main(
 
 	/* TODO: add tests for libsigscan_scan_state_get_result */
 
+	/* TODO: add tests for libsigscan_scan_state_get_results */
+
+#if defined( __GNUC__ )
+
+	/* TODO: add tests for libsigscan_scan_state_take_results */
+
+#endif /* defined( __GNUC__ ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -307,6 +307,12 @@ int main(
 
 	/* TODO: add tests for libsigscan_scan_tree_get_spanning_range */
 
+	/* TODO: add tests for libsigscan_scan_tree_push_build_task */
+
+	/* TODO: add tests for libsigscan_scan_tree_build_task_callback */
+
+	/* TODO: add tests for libsigscan_scan_tree_set_build_task_results */
+
 	/* TODO: add tests for libsigscan_scan_tree_build_node */
 
 	/* TODO: add tests for libsigscan_scan_tree_build */
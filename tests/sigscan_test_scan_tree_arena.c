@@ -0,0 +1,1237 @@
+/*
+ * Library scan_tree_arena type test program
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_macros.h"
+#include "sigscan_test_memory.h"
+#include "sigscan_test_unused.h"
+
+#include "../libsigscan/libsigscan_definitions.h"
+#include "../libsigscan/libsigscan_scan_object.h"
+#include "../libsigscan/libsigscan_scan_tree_arena.h"
+#include "../libsigscan/libsigscan_scan_tree_node.h"
+#include "../libsigscan/libsigscan_signature.h"
+
+#if defined( __GNUC__ )
+
+/* Tests the libsigscan_scan_tree_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_tree_arena_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libsigscan_scan_tree_arena_t *scan_tree_arena = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 1;
+	int number_of_memset_fail_tests               = 1;
+	int test_number                               = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_tree_arena_initialize(
+	          &scan_tree_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "scan_tree_arena",
+         scan_tree_arena );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libsigscan_scan_tree_arena_free(
+	          &scan_tree_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "scan_tree_arena",
+         scan_tree_arena );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_tree_arena_initialize(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan_tree_arena = (libsigscan_scan_tree_arena_t *) 0x12345678UL;
+
+	result = libsigscan_scan_tree_arena_initialize(
+	          &scan_tree_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan_tree_arena = NULL;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_scan_tree_arena_initialize with malloc failing
+		 */
+		sigscan_test_malloc_attempts_before_fail = test_number;
+
+		result = libsigscan_scan_tree_arena_initialize(
+		          &scan_tree_arena,
+		          &error );
+
+		if( sigscan_test_malloc_attempts_before_fail != -1 )
+		{
+			sigscan_test_malloc_attempts_before_fail = -1;
+
+			if( scan_tree_arena != NULL )
+			{
+				libsigscan_scan_tree_arena_free(
+				 &scan_tree_arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "scan_tree_arena",
+			 scan_tree_arena );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_scan_tree_arena_initialize with memset failing
+		 */
+		sigscan_test_memset_attempts_before_fail = test_number;
+
+		result = libsigscan_scan_tree_arena_initialize(
+		          &scan_tree_arena,
+		          &error );
+
+		if( sigscan_test_memset_attempts_before_fail != -1 )
+		{
+			sigscan_test_memset_attempts_before_fail = -1;
+
+			if( scan_tree_arena != NULL )
+			{
+				libsigscan_scan_tree_arena_free(
+				 &scan_tree_arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "scan_tree_arena",
+			 scan_tree_arena );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SIGSCAN_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_tree_arena != NULL )
+	{
+		libsigscan_scan_tree_arena_free(
+		 &scan_tree_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_tree_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_tree_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_tree_arena_free(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_tree_arena_build and libsigscan_scan_tree_arena_scan_buffer functions
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_tree_arena_scan_buffer(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error                      = NULL;
+	libsigscan_scan_object_t *scan_object         = NULL;
+	libsigscan_scan_tree_arena_t *scan_tree_arena = NULL;
+	libsigscan_scan_tree_node_t *scan_tree_node   = NULL;
+	libsigscan_signature_t *matching_signature    = NULL;
+	libsigscan_signature_t *signature             = NULL;
+	uint32_t number_of_nodes                      = 0;
+	int number_of_visited_nodes                   = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_signature_initialize(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_set(
+	          signature,
+	          "test",
+	          4,
+	          0,
+	          (uint8_t *) "ABCD",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_node_initialize(
+	          &scan_tree_node,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_object_initialize(
+	          &scan_object,
+	          LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE,
+	          (intptr_t *) signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_node_set_byte_value(
+	          scan_tree_node,
+	          (uint8_t) 'A',
+	          scan_object,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The scan tree node now manages the scan object
+	 */
+	scan_object = NULL;
+
+	result = libsigscan_scan_tree_arena_initialize(
+	          &scan_tree_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_arena_build(
+	          scan_tree_arena,
+	          scan_tree_node,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_arena_get_number_of_nodes(
+	          scan_tree_arena,
+	          &number_of_nodes,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_nodes",
+	 number_of_nodes,
+	 (uint32_t) 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	if( memory_copy(
+	     buffer,
+	     "xxABCDxxABCxABCD",
+	     16 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libsigscan_scan_tree_arena_scan_buffer(
+	          scan_tree_arena,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          2,
+	          16,
+	          buffer,
+	          16,
+	          2,
+	          &matching_signature,
+	          &number_of_visited_nodes,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "matching_signature",
+	 matching_signature );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "matching_signature->pattern_size",
+	 (int) matching_signature->pattern_size,
+	 4 );
+
+	SIGSCAN_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_visited_nodes",
+	 number_of_visited_nodes,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_arena_scan_buffer(
+	          scan_tree_arena,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          8,
+	          16,
+	          buffer,
+	          16,
+	          8,
+	          &matching_signature,
+	          &number_of_visited_nodes,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_arena_scan_buffer(
+	          scan_tree_arena,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          0,
+	          16,
+	          buffer,
+	          16,
+	          0,
+	          &matching_signature,
+	          &number_of_visited_nodes,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The last 4 bytes of the buffer are compared without a word compare
+	 */
+	result = libsigscan_scan_tree_arena_scan_buffer(
+	          scan_tree_arena,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          12,
+	          16,
+	          buffer,
+	          16,
+	          12,
+	          &matching_signature,
+	          &number_of_visited_nodes,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_tree_arena_scan_buffer(
+	          NULL,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          2,
+	          16,
+	          buffer,
+	          16,
+	          2,
+	          &matching_signature,
+	          &number_of_visited_nodes,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_tree_arena_scan_buffer(
+	          scan_tree_arena,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          2,
+	          16,
+	          buffer,
+	          16,
+	          16,
+	          &matching_signature,
+	          &number_of_visited_nodes,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_tree_arena_scan_buffer(
+	          scan_tree_arena,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          2,
+	          16,
+	          buffer,
+	          16,
+	          2,
+	          NULL,
+	          &number_of_visited_nodes,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_tree_arena_scan_buffer(
+	          scan_tree_arena,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          2,
+	          16,
+	          buffer,
+	          16,
+	          2,
+	          &matching_signature,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_tree_arena_free(
+	          &scan_tree_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_tree_arena",
+	 scan_tree_arena );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_node_free(
+	          &scan_tree_node,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_free(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_tree_arena != NULL )
+	{
+		libsigscan_scan_tree_arena_free(
+		 &scan_tree_arena,
+		 NULL );
+	}
+	if( scan_object != NULL )
+	{
+		libsigscan_scan_object_free(
+		 &scan_object,
+		 NULL );
+	}
+	if( scan_tree_node != NULL )
+	{
+		libsigscan_scan_tree_node_free(
+		 &scan_tree_node,
+		 NULL );
+	}
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_tree_arena_compile function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_tree_arena_compile(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libsigscan_scan_object_t *scan_object         = NULL;
+	libsigscan_scan_tree_arena_t *scan_tree_arena = NULL;
+	libsigscan_scan_tree_node_t *scan_tree_node   = NULL;
+	libsigscan_signature_t *signature             = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_signature_initialize(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_set(
+	          signature,
+	          "test",
+	          4,
+	          0,
+	          (uint8_t *) "ABCD",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_node_initialize(
+	          &scan_tree_node,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_object_initialize(
+	          &scan_object,
+	          LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE,
+	          (intptr_t *) signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_node_set_byte_value(
+	          scan_tree_node,
+	          (uint8_t) 'A',
+	          scan_object,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The scan tree node now manages the scan object
+	 */
+	scan_object = NULL;
+
+	result = libsigscan_scan_tree_arena_initialize(
+	          &scan_tree_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_tree_arena_build(
+	          scan_tree_arena,
+	          scan_tree_node,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The scan tree arena is compiled when built
+	 */
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_tree_arena->leaves",
+	 scan_tree_arena->leaves );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT64(
+	 "scan_tree_arena->nodes_extent",
+	 (uint64_t) scan_tree_arena->nodes_extent,
+	 (uint64_t) 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "scan_tree_arena->leaves[ 0 ].pattern_size",
+	 (int) scan_tree_arena->leaves[ 0 ].pattern_size,
+	 4 );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_tree_arena_compile(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_tree_arena_compile(
+	          scan_tree_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_tree_arena_free(
+	          &scan_tree_arena,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_tree_arena",
+	 scan_tree_arena );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_node_free(
+	          &scan_tree_node,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_free(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_tree_arena != NULL )
+	{
+		libsigscan_scan_tree_arena_free(
+		 &scan_tree_arena,
+		 NULL );
+	}
+	if( scan_object != NULL )
+	{
+		libsigscan_scan_object_free(
+		 &scan_object,
+		 NULL );
+	}
+	if( scan_tree_node != NULL )
+	{
+		libsigscan_scan_tree_node_free(
+		 &scan_tree_node,
+		 NULL );
+	}
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_tree_arena_get_byte_value_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_tree_arena_get_byte_value_reference(
+     void )
+{
+	uint8_t expected_layouts[ 3 ] = {
+		LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_LIST,
+		LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_BITMAP,
+		LIBSIGSCAN_SCAN_TREE_ARENA_NODE_LAYOUT_DENSE };
+
+	uint16_t byte_value_steps[ 3 ] = { 85, 5, 1 };
+
+	libcerror_error_t *error                      = NULL;
+	libsigscan_scan_object_t *scan_object         = NULL;
+	libsigscan_scan_tree_arena_t *scan_tree_arena = NULL;
+	libsigscan_scan_tree_node_t *scan_tree_node   = NULL;
+	libsigscan_signature_t *signature             = NULL;
+	uint32_t reference                            = 0;
+	uint16_t byte_value                           = 0;
+	int result                                    = 0;
+	int test_index                                = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_signature_initialize(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 3;
+	     test_index++ )
+	{
+		result = libsigscan_scan_tree_node_initialize(
+		          &scan_tree_node,
+		          0,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value += byte_value_steps[ test_index ] )
+		{
+			result = libsigscan_scan_object_initialize(
+			          &scan_object,
+			          LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE,
+			          (intptr_t *) signature,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = libsigscan_scan_tree_node_set_byte_value(
+			          scan_tree_node,
+			          (uint8_t) byte_value,
+			          scan_object,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			scan_object = NULL;
+		}
+		result = libsigscan_scan_tree_arena_initialize(
+		          &scan_tree_arena,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libsigscan_scan_tree_arena_build(
+		          scan_tree_arena,
+		          scan_tree_node,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "layout",
+		 (int) scan_tree_arena->nodes[ 0 ].layout,
+		 (int) expected_layouts[ test_index ] );
+
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			reference = libsigscan_scan_tree_arena_get_byte_value_reference(
+			             scan_tree_arena,
+			             &( scan_tree_arena->nodes[ 0 ] ),
+			             (uint8_t) byte_value );
+
+			if( ( byte_value % byte_value_steps[ test_index ] ) == 0 )
+			{
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "reference type",
+				 libsigscan_scan_tree_arena_reference_get_type( reference ),
+				 LIBSIGSCAN_SCAN_TREE_ARENA_REFERENCE_TYPE_SIGNATURE );
+			}
+			else
+			{
+				SIGSCAN_TEST_ASSERT_EQUAL_UINT32(
+				 "reference",
+				 reference,
+				 (uint32_t) 0 );
+			}
+		}
+		result = libsigscan_scan_tree_arena_free(
+		          &scan_tree_arena,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libsigscan_scan_tree_node_free(
+		          &scan_tree_node,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libsigscan_signature_free(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_tree_arena != NULL )
+	{
+		libsigscan_scan_tree_arena_free(
+		 &scan_tree_arena,
+		 NULL );
+	}
+	if( scan_object != NULL )
+	{
+		libsigscan_scan_object_free(
+		 &scan_object,
+		 NULL );
+	}
+	if( scan_tree_node != NULL )
+	{
+		libsigscan_scan_tree_node_free(
+		 &scan_tree_node,
+		 NULL );
+	}
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_tree_arena_initialize",
+	 sigscan_test_scan_tree_arena_initialize );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_tree_arena_free",
+	 sigscan_test_scan_tree_arena_free );
+
+	/* TODO: add tests for libsigscan_scan_tree_arena_get_node_layout */
+
+	/* TODO: add tests for libsigscan_scan_tree_arena_get_number_of_scan_objects */
+
+	/* TODO: add tests for libsigscan_scan_tree_arena_append_scan_object */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_tree_arena_compile",
+	 sigscan_test_scan_tree_arena_compile );
+
+	/* TODO: add tests for libsigscan_scan_tree_arena_get_number_of_bits_set */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_tree_arena_get_byte_value_reference",
+	 sigscan_test_scan_tree_arena_get_byte_value_reference );
+
+	/* TODO: add tests for libsigscan_scan_tree_arena_scan_buffer_compiled */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_tree_arena_scan_buffer",
+	 sigscan_test_scan_tree_arena_scan_buffer );
+
+	/* TODO: add tests for libsigscan_scan_tree_arena_printf */
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,530 @@
+/*
+ * Library Scan tree build task type test program
+ *
+ * Copyright (C) 2014-2017, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_macros.h"
+#include "sigscan_test_memory.h"
+#include "sigscan_test_unused.h"
+
+#include "../libsigscan/libsigscan_definitions.h"
+#include "../libsigscan/libsigscan_scan_tree_build_task.h"
+
+#if defined( __GNUC__ )
+
+/* Tests the libsigscan_scan_tree_build_task_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_tree_build_task_initialize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libsigscan_scan_tree_build_task_t *build_task = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 1;
+	int number_of_memset_fail_tests               = 1;
+	int test_number                               = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_tree_build_task_initialize(
+	          &build_task,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "build_task",
+         build_task );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libsigscan_scan_tree_build_task_free(
+	          &build_task,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "build_task",
+         build_task );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_tree_build_task_initialize(
+	          NULL,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	build_task = (libsigscan_scan_tree_build_task_t *) 0x12345678UL;
+
+	result = libsigscan_scan_tree_build_task_initialize(
+	          &build_task,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	build_task = NULL;
+
+	result = libsigscan_scan_tree_build_task_initialize(
+	          &build_task,
+	          -1,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_scan_tree_build_task_initialize with malloc failing
+		 */
+		sigscan_test_malloc_attempts_before_fail = test_number;
+
+		result = libsigscan_scan_tree_build_task_initialize(
+		          &build_task,
+		          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+		          0,
+		          &error );
+
+		if( sigscan_test_malloc_attempts_before_fail != -1 )
+		{
+			sigscan_test_malloc_attempts_before_fail = -1;
+
+			if( build_task != NULL )
+			{
+				libsigscan_scan_tree_build_task_free(
+				 &build_task,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "build_task",
+			 build_task );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_scan_tree_build_task_initialize with memset failing
+		 */
+		sigscan_test_memset_attempts_before_fail = test_number;
+
+		result = libsigscan_scan_tree_build_task_initialize(
+		          &build_task,
+		          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+		          0,
+		          &error );
+
+		if( sigscan_test_memset_attempts_before_fail != -1 )
+		{
+			sigscan_test_memset_attempts_before_fail = -1;
+
+			if( build_task != NULL )
+			{
+				libsigscan_scan_tree_build_task_free(
+				 &build_task,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "build_task",
+			 build_task );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SIGSCAN_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( build_task != NULL )
+	{
+		libsigscan_scan_tree_build_task_free(
+		 &build_task,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_tree_build_task_free function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_tree_build_task_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_tree_build_task_free(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_tree_build_task_set_signature_table function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_tree_build_task_set_signature_table(
+     void )
+{
+	libcdata_list_t *offsets_ignore_list          = NULL;
+	libcerror_error_t *error                      = NULL;
+	libsigscan_scan_tree_build_task_t *build_task = NULL;
+	libsigscan_signature_table_t *signature_table = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scan_tree_build_task_initialize(
+	          &build_task,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "build_task",
+         build_task );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libcdata_list_initialize(
+	          &offsets_ignore_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libsigscan_signature_table_initialize(
+	          &signature_table,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_tree_build_task_set_signature_table(
+	          build_task,
+	          &signature_table,
+	          offsets_ignore_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "signature_table",
+         signature_table );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "build_task->signature_table",
+         build_task->signature_table );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "build_task->offsets_ignore_list",
+         build_task->offsets_ignore_list );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_tree_build_task_set_signature_table(
+	          NULL,
+	          &signature_table,
+	          offsets_ignore_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_tree_build_task_set_signature_table(
+	          build_task,
+	          NULL,
+	          offsets_ignore_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_list_free(
+	          &offsets_ignore_list,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libsigscan_scan_tree_build_task_free(
+	          &build_task,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "build_task",
+         build_task );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( signature_table != NULL )
+	{
+		libsigscan_signature_table_free(
+		 &signature_table,
+		 NULL );
+	}
+	if( offsets_ignore_list != NULL )
+	{
+		libcdata_list_free(
+		 &offsets_ignore_list,
+		 NULL,
+		 NULL );
+	}
+	if( build_task != NULL )
+	{
+		libsigscan_scan_tree_build_task_free(
+		 &build_task,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_tree_build_task_initialize",
+	 sigscan_test_scan_tree_build_task_initialize );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_tree_build_task_free",
+	 sigscan_test_scan_tree_build_task_free );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_tree_build_task_set_signature_table",
+	 sigscan_test_scan_tree_build_task_set_signature_table );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,8 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -319,6 +321,4985 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libsigscan_scanner_set_number_of_build_workers function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_set_number_of_build_workers(
+     void )
+{
+	uint8_t buffer[ 128 ];
+
+	const char *patterns[ 5 ]           = { "ABCD", "ABXY", "QRST", "QRUV", "MNOP" };
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	int number_of_build_workers         = 0;
+	int number_of_results               = 0;
+	int pattern_index                   = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_set_number_of_build_workers(
+	          scanner,
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_get_number_of_build_workers(
+	          scanner,
+	          &number_of_build_workers,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_build_workers",
+	 number_of_build_workers,
+	 4 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The signatures share prefixes so that the root scan tree node has sub trees
+	 */
+	for( pattern_index = 0;
+	     pattern_index < 5;
+	     pattern_index++ )
+	{
+		result = libsigscan_scanner_add_signature(
+		          scanner,
+		          patterns[ pattern_index ],
+		          4,
+		          0,
+		          (uint8_t *) patterns[ pattern_index ],
+		          4,
+		          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "header",
+	          6,
+	          0,
+	          (uint8_t *) "HEAD",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_compile(
+	          scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 buffer,
+	 'x',
+	 128 );
+
+	memory_copy(
+	 &( buffer[ 0 ] ),
+	 "HEAD",
+	 4 );
+
+	memory_copy(
+	 &( buffer[ 20 ] ),
+	 "ABXY",
+	 4 );
+
+	memory_copy(
+	 &( buffer[ 40 ] ),
+	 "QRUV",
+	 4 );
+
+	memory_copy(
+	 &( buffer[ 60 ] ),
+	 "MNOP",
+	 4 );
+
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          buffer,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 4 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_set_number_of_build_workers(
+	          scanner,
+	          2,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_set_number_of_build_workers(
+	          NULL,
+	          2,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_get_number_of_build_workers(
+	          scanner,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an out of bounds number of build workers
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_set_number_of_build_workers(
+	          scanner,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_buffer function with unbound signatures
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_buffer_unbound(
+     void )
+{
+	uint8_t buffer[ 128 ];
+	char identifier[ 16 ];
+
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state   = NULL;
+	libsigscan_scanner_t *scanner         = NULL;
+	size_t buffer_offset                  = 0;
+	int number_of_results                 = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Use a small scan buffer so that patterns straddle buffer boundaries
+	 */
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "short",
+	          5,
+	          0,
+	          (uint8_t *) "ABCD",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "long",
+	          4,
+	          0,
+	          (uint8_t *) "ABCDEF",
+	          6,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The "ABCD" pattern at offset 94 spans the boundary of two scan buffers
+	 */
+	memory_set(
+	 buffer,
+	 'x',
+	 128 );
+
+	memory_copy(
+	 &( buffer[ 10 ] ),
+	 "ABCDEF",
+	 6 );
+
+	memory_copy(
+	 &( buffer[ 50 ] ),
+	 "ABCDEx",
+	 6 );
+
+	memory_copy(
+	 &( buffer[ 94 ] ),
+	 "ABCD",
+	 4 );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_offset = 0;
+	     buffer_offset < 128;
+	     buffer_offset += 16 )
+	{
+		result = libsigscan_scanner_scan_buffer(
+		          scanner,
+		          scan_state,
+		          &( buffer[ buffer_offset ] ),
+		          16,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 3 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_result(
+	          scan_state,
+	          0,
+	          &scan_result,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_result",
+	 scan_result );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_result_get_identifier(
+	          scan_result,
+	          identifier,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          identifier,
+	          "long",
+	          5 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libsigscan_scan_result_free(
+	          &scan_result,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The "ABCDEx" data should fall back to the shorter signature
+	 */
+	result = libsigscan_scan_state_get_result(
+	          scan_state,
+	          1,
+	          &scan_result,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_result",
+	 scan_result );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_result_get_identifier(
+	          scan_result,
+	          identifier,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          identifier,
+	          "short",
+	          6 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libsigscan_scan_result_free(
+	          &scan_result,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_buffer function with footer signatures
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_buffer_footer(
+     void )
+{
+	char identifier[ 16 ];
+
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state   = NULL;
+	libsigscan_scanner_t *scanner         = NULL;
+	uint8_t *buffer                       = NULL;
+	int number_of_results                 = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Use a small scan buffer so that the footer range straddles
+	 * the boundary of the last scan buffer
+	 */
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          691,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "long",
+	          4,
+	          63,
+	          (uint8_t *) "bbaabaab",
+	          8,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "short",
+	          5,
+	          61,
+	          (uint8_t *) "bb",
+	          2,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * 16644 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	memory_set(
+	 buffer,
+	 'a',
+	 16644 );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          16644,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan where the footer signatures lie outside the buffered data
+	 * of the first part of the scan
+	 */
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          buffer,
+	          16644,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan where the footer signature lies within the last scan buffer
+	 */
+	memory_copy(
+	 &( buffer[ 1000 - 63 ] ),
+	 "bbaabaab",
+	 8 );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          1000,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          buffer,
+	          1000,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_result(
+	          scan_state,
+	          0,
+	          &scan_result,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_result",
+	 scan_result );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_result_get_identifier(
+	          scan_result,
+	          identifier,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          identifier,
+	          "long",
+	          5 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libsigscan_scan_result_free(
+	          &scan_result,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_buffer function with footer signatures and small scan buffer sizes
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_buffer_footer_chunked(
+     void )
+{
+	uint8_t buffer[ 230 ];
+
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state   = NULL;
+	libsigscan_scanner_t *scanner         = NULL;
+	off64_t expected_offset               = 0;
+	off64_t offset                        = 0;
+	size_t scan_buffer_size               = 0;
+	int number_of_results                 = 0;
+	int result                            = 0;
+	int test_index                        = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan where the footer range straddles the boundaries of the scan buffers
+	 * and either footer signature matches, the scan buffer size is set before the
+	 * scanner is compiled
+	 */
+	for( scan_buffer_size = 16;
+	     scan_buffer_size <= 96;
+	     scan_buffer_size++ )
+	{
+		result = libsigscan_scanner_initialize(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "scanner",
+		 scanner );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_set_scan_buffer_size(
+		          scanner,
+		          scan_buffer_size,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_add_signature(
+		          scanner,
+		          "long",
+		          4,
+		          40,
+		          (uint8_t *) "FOOTERAB",
+		          8,
+		          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_add_signature(
+		          scanner,
+		          "short",
+		          5,
+		          8,
+		          (uint8_t *) "TAIL",
+		          4,
+		          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( test_index = 0;
+		     test_index < 2;
+		     test_index++ )
+		{
+			memory_set(
+			 buffer,
+			 'a',
+			 230 );
+
+			if( test_index == 0 )
+			{
+				memory_copy(
+				 &( buffer[ 230 - 40 ] ),
+				 "FOOTERAB",
+				 8 );
+
+				expected_offset = 230 - 40;
+			}
+			else
+			{
+				memory_copy(
+				 &( buffer[ 230 - 8 ] ),
+				 "TAIL",
+				 4 );
+
+				expected_offset = 230 - 8;
+			}
+			result = libsigscan_scan_state_reset(
+			          scan_state,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_state_set_data_size(
+			          scan_state,
+			          230,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scanner_scan_start(
+			          scanner,
+			          scan_state,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scanner_scan_buffer(
+			          scanner,
+			          scan_state,
+			          buffer,
+			          230,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scanner_scan_stop(
+			          scanner,
+			          scan_state,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_state_get_number_of_results(
+			          scan_state,
+			          &number_of_results,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "number_of_results",
+			 number_of_results,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_state_get_result(
+			          scan_state,
+			          0,
+			          &scan_result,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "scan_result",
+			 scan_result );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_result_get_offset(
+			          scan_result,
+			          &offset,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+			 "offset",
+			 (int64_t) offset,
+			 (int64_t) expected_offset );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_result_free(
+			          &scan_result,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libsigscan_scanner_free(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_buffer function with header signatures at many offsets
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_buffer_header(
+     void )
+{
+	char identifier[ 16 ];
+	uint8_t buffer[ 128 ];
+	uint8_t pattern[ 4 ];
+
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state   = NULL;
+	libsigscan_scanner_t *scanner         = NULL;
+	int byte_index                        = 0;
+	int number_of_results                 = 0;
+	int result                            = 0;
+	int signature_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Add overlapping signatures with a pattern of 2 distinct byte values
+	 * at every offset from 0 to 63
+	 */
+	identifier[ 0 ] = 'h';
+	identifier[ 3 ] = 0;
+
+	for( signature_index = 0;
+	     signature_index < 64;
+	     signature_index++ )
+	{
+		for( byte_index = 0;
+		     byte_index < 4;
+		     byte_index++ )
+		{
+			pattern[ byte_index ] = (uint8_t) ( 'a' + ( ( signature_index >> byte_index ) & 1 ) );
+		}
+		identifier[ 1 ] = (char) ( '0' + ( signature_index / 10 ) );
+		identifier[ 2 ] = (char) ( '0' + ( signature_index % 10 ) );
+
+		result = libsigscan_scanner_add_signature(
+		          scanner,
+		          identifier,
+		          3,
+		          (off64_t) signature_index,
+		          pattern,
+		          4,
+		          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libsigscan_scanner_compile(
+	          scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Only the pattern of the signature at offset 37 is in the data
+	 */
+	memory_set(
+	 buffer,
+	 'c',
+	 128 );
+
+	for( byte_index = 0;
+	     byte_index < 4;
+	     byte_index++ )
+	{
+		buffer[ 37 + byte_index ] = (uint8_t) ( 'a' + ( ( 37 >> byte_index ) & 1 ) );
+	}
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan
+	 */
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          buffer,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_result(
+	          scan_state,
+	          0,
+	          &scan_result,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_result",
+	 scan_result );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_result_get_identifier(
+	          scan_result,
+	          identifier,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          identifier,
+	          "h37",
+	          4 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libsigscan_scan_result_free(
+	          &scan_result,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_buffer function with a scan state that scans in place
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_buffer_in_place(
+     void )
+{
+	uint8_t buffer[ 64 ];
+	char identifier[ 16 ];
+
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state   = NULL;
+	libsigscan_scanner_t *scanner         = NULL;
+	size_t buffer_offset                  = 0;
+	size_t read_size                      = 0;
+	int number_of_results                 = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "header",
+	          6,
+	          12,
+	          (uint8_t *) "HDR",
+	          3,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "unbound",
+	          7,
+	          0,
+	          (uint8_t *) "ABCD",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_flags(
+	          scan_state,
+	          LIBSIGSCAN_SCAN_STATE_FLAG_SCAN_IN_PLACE,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The buffers are scanned in chunks of 7 bytes so that both the "HDR" pattern
+	 * at offset 12 and the "ABCD" pattern at offset 33 straddle chunks
+	 */
+	memory_set(
+	 buffer,
+	 'x',
+	 64 );
+
+	memory_copy(
+	 &( buffer[ 12 ] ),
+	 "HDR",
+	 3 );
+
+	memory_copy(
+	 &( buffer[ 33 ] ),
+	 "ABCD",
+	 4 );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_offset = 0;
+	     buffer_offset < 64;
+	     buffer_offset += read_size )
+	{
+		read_size = 64 - buffer_offset;
+
+		if( read_size > 7 )
+		{
+			read_size = 7;
+		}
+		result = libsigscan_scanner_scan_buffer(
+		          scanner,
+		          scan_state,
+		          &( buffer[ buffer_offset ] ),
+		          read_size,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 2 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_result(
+	          scan_state,
+	          0,
+	          &scan_result,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_result",
+	 scan_result );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_result_get_identifier(
+	          scan_result,
+	          identifier,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          identifier,
+	          "header",
+	          7 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libsigscan_scan_result_free(
+	          &scan_result,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Match callback function that stops the scan at the first match
+ * Returns 0 to stop the scan
+ */
+int sigscan_test_scanner_match_callback(
+     const char *identifier SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     size_t identifier_size SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     off64_t offset,
+     intptr_t *user_data )
+{
+	off64_t *match_offsets = (off64_t *) user_data;
+
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( identifier )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( identifier_size )
+
+	match_offsets[ 0 ] += 1;
+	match_offsets[ 1 ]  = offset;
+
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_buffer function with a match callback function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_buffer_match_callback(
+     void )
+{
+	uint8_t buffer[ 128 ];
+	off64_t match_offsets[ 2 ] = { 0, 0 };
+
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	int number_of_results               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "unbound",
+	          7,
+	          0,
+	          (uint8_t *) "ABCD",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_match_callback(
+	          scan_state,
+	          &sigscan_test_scanner_match_callback,
+	          (intptr_t *) match_offsets,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 buffer,
+	 'x',
+	 128 );
+
+	memory_copy(
+	 &( buffer[ 20 ] ),
+	 "ABCD",
+	 4 );
+
+	memory_copy(
+	 &( buffer[ 80 ] ),
+	 "ABCD",
+	 4 );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The callback stops the scan at the first match
+	 */
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          buffer,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_matches",
+	 (int64_t) match_offsets[ 0 ],
+	 (int64_t) 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+	 "match_offset",
+	 (int64_t) match_offsets[ 1 ],
+	 (int64_t) 20 );
+
+	/* Matches passed to the callback are not stored as scan results
+	 */
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_buffer function with a scan that stops early
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_buffer_stop(
+     void )
+{
+	uint8_t buffer[ 128 ];
+
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	size64_t number_of_skipped_bytes    = 0;
+	int number_of_results               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "unbound",
+	          7,
+	          0,
+	          (uint8_t *) "ABCD",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "stop",
+	          4,
+	          0,
+	          (uint8_t *) "WXYZ",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_STOP_ON_MATCH,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 buffer,
+	 'x',
+	 128 );
+
+	memory_copy(
+	 &( buffer[ 20 ] ),
+	 "ABCD",
+	 4 );
+
+	memory_copy(
+	 &( buffer[ 60 ] ),
+	 "WXYZ",
+	 4 );
+
+	memory_copy(
+	 &( buffer[ 100 ] ),
+	 "ABCD",
+	 4 );
+
+	/* Test a scan that stops after the first result
+	 */
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_maximum_number_of_results(
+	          scan_state,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          buffer,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The scan stops after the end of the match at offset 20
+	 */
+	result = libsigscan_scan_state_get_number_of_skipped_bytes(
+	          scan_state,
+	          &number_of_skipped_bytes,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_skipped_bytes",
+	 (uint64_t) number_of_skipped_bytes,
+	 (uint64_t) 104 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a scan that stops at the first match of a signature with the stop on match flag
+	 */
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_flags(
+	          scan_state,
+	          LIBSIGSCAN_SCAN_STATE_FLAG_STOP_ON_SIGNATURE_MATCH,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          buffer,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 2 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The scan stops after the end of the match at offset 60
+	 */
+	result = libsigscan_scan_state_get_number_of_skipped_bytes(
+	          scan_state,
+	          &number_of_skipped_bytes,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_skipped_bytes",
+	 (uint64_t) number_of_skipped_bytes,
+	 (uint64_t) 64 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_compile function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_compile(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libsigscan_scanner_t *scanner = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "unbound",
+	          7,
+	          0,
+	          (uint8_t *) "ABCD",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_compile(
+	          scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test compiling a compiled scanner
+	 */
+	result = libsigscan_scanner_compile(
+	          scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_compile(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test changing a compiled scanner
+	 */
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "compiled",
+	          8,
+	          0,
+	          (uint8_t *) "WXYZ",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_remove_signature(
+	          scanner,
+	          "compiled",
+	          8,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Scans the buffer for the remove signature test
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_scanner_scan_test_buffer(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const uint8_t *buffer,
+     int *number_of_results,
+     libcerror_error_t **error )
+{
+	if( libsigscan_scan_state_reset(
+	     scan_state,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libsigscan_scanner_scan_start(
+	     scanner,
+	     scan_state,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libsigscan_scanner_scan_buffer(
+	     scanner,
+	     scan_state,
+	     buffer,
+	     128,
+	     error ) == -1 )
+	{
+		return( -1 );
+	}
+	if( libsigscan_scanner_scan_stop(
+	     scanner,
+	     scan_state,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libsigscan_scan_state_get_number_of_results(
+	     scan_state,
+	     number_of_results,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Scans the buffer and retrieves the identifier of the first scan result for the add signature test
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_scanner_scan_test_buffer_identifier(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const uint8_t *buffer,
+     int *number_of_results,
+     char *identifier,
+     size_t identifier_size,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_result_t *scan_result = NULL;
+	int result                            = 0;
+
+	if( sigscan_test_scanner_scan_test_buffer(
+	     scanner,
+	     scan_state,
+	     buffer,
+	     number_of_results,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	identifier[ 0 ] = 0;
+
+	if( *number_of_results > 0 )
+	{
+		if( libsigscan_scan_state_get_result(
+		     scan_state,
+		     0,
+		     &scan_result,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		result = libsigscan_scan_result_get_identifier(
+		          scan_result,
+		          identifier,
+		          identifier_size,
+		          error );
+
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the libsigscan_scanner_add_signature function on a compiled scanner
+ * A scanner to which bound signatures are added after the compile reports the
+ * same results as a scanner compiled with all the signatures, except that if
+ * several header or several footer signatures match, either one of them can
+ * be reported
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_add_signature(
+     void )
+{
+	const char *identifiers[ 5 ] = {
+		"riff", "ri", "wave", "trailer", "tr" };
+
+	const char *patterns[ 5 ] = {
+		"RIFF", "RI", "WAVE", "TRLR", "TR" };
+
+	off64_t pattern_offsets[ 5 ] = {
+		0, 0, 8, 4, 4 };
+
+	uint32_t signature_flags[ 5 ] = {
+		LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+		LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+		LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+		LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
+		LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END };
+
+	uint8_t buffer[ 128 ];
+	char compiled_identifier[ 16 ];
+	char identifier[ 16 ];
+
+	libcerror_error_t *error               = NULL;
+	libsigscan_scan_state_t *scan_state    = NULL;
+	libsigscan_scanner_t *compiled_scanner = NULL;
+	libsigscan_scanner_t *scanner          = NULL;
+	size_t identifier_length               = 0;
+	int compiled_number_of_results         = 0;
+	int number_of_results                  = 0;
+	int result                             = 0;
+	int signature_index                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_initialize(
+	          &compiled_scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "compiled_scanner",
+	 compiled_scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The scanner is compiled with all the signatures, the compiled scanner
+	 * is compiled with the "riff" and "trailer" signatures and the other
+	 * signatures are added afterwards
+	 */
+	for( signature_index = 0;
+	     signature_index < 5;
+	     signature_index++ )
+	{
+		identifier_length = narrow_string_length(
+		                     identifiers[ signature_index ] );
+
+		result = libsigscan_scanner_add_signature(
+		          scanner,
+		          identifiers[ signature_index ],
+		          identifier_length,
+		          pattern_offsets[ signature_index ],
+		          (uint8_t *) patterns[ signature_index ],
+		          narrow_string_length(
+		           patterns[ signature_index ] ),
+		          signature_flags[ signature_index ],
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( signature_index == 0 )
+		 || ( signature_index == 3 ) )
+		{
+			result = libsigscan_scanner_add_signature(
+			          compiled_scanner,
+			          identifiers[ signature_index ],
+			          identifier_length,
+			          pattern_offsets[ signature_index ],
+			          (uint8_t *) patterns[ signature_index ],
+			          narrow_string_length(
+			           patterns[ signature_index ] ),
+			          signature_flags[ signature_index ],
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	result = libsigscan_scanner_compile(
+	          scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_compile(
+	          compiled_scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( signature_index = 0;
+	     signature_index < 5;
+	     signature_index++ )
+	{
+		if( ( signature_index == 0 )
+		 || ( signature_index == 3 ) )
+		{
+			continue;
+		}
+		result = libsigscan_scanner_add_signature(
+		          compiled_scanner,
+		          identifiers[ signature_index ],
+		          narrow_string_length(
+		           identifiers[ signature_index ] ),
+		          pattern_offsets[ signature_index ],
+		          (uint8_t *) patterns[ signature_index ],
+		          narrow_string_length(
+		           patterns[ signature_index ] ),
+		          signature_flags[ signature_index ],
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan where a single header signature matches
+	 */
+	memory_set(
+	 buffer,
+	 'x',
+	 128 );
+
+	memory_copy(
+	 &( buffer[ 8 ] ),
+	 "WAVE",
+	 4 );
+
+	result = sigscan_test_scanner_scan_test_buffer_identifier(
+	          scanner,
+	          scan_state,
+	          buffer,
+	          &number_of_results,
+	          identifier,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = sigscan_test_scanner_scan_test_buffer_identifier(
+	          compiled_scanner,
+	          scan_state,
+	          buffer,
+	          &compiled_number_of_results,
+	          compiled_identifier,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "compiled_number_of_results",
+	 compiled_number_of_results,
+	 1 );
+
+	result = narrow_string_compare(
+	          identifier,
+	          "wave",
+	          5 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = narrow_string_compare(
+	          compiled_identifier,
+	          "wave",
+	          5 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test scan where a single footer signature matches
+	 */
+	memory_set(
+	 buffer,
+	 'x',
+	 128 );
+
+	memory_copy(
+	 &( buffer[ 124 ] ),
+	 "TRxx",
+	 4 );
+
+	result = sigscan_test_scanner_scan_test_buffer_identifier(
+	          scanner,
+	          scan_state,
+	          buffer,
+	          &number_of_results,
+	          identifier,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = sigscan_test_scanner_scan_test_buffer_identifier(
+	          compiled_scanner,
+	          scan_state,
+	          buffer,
+	          &compiled_number_of_results,
+	          compiled_identifier,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "compiled_number_of_results",
+	 compiled_number_of_results,
+	 1 );
+
+	result = narrow_string_compare(
+	          identifier,
+	          "tr",
+	          3 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = narrow_string_compare(
+	          compiled_identifier,
+	          "tr",
+	          3 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test scan where several header and several footer signatures match,
+	 * one header and one footer signature is reported but which one
+	 * can differ between the scanners
+	 */
+	memory_copy(
+	 buffer,
+	 "RIFFxxxxWAVE",
+	 12 );
+
+	memory_copy(
+	 &( buffer[ 124 ] ),
+	 "TRLR",
+	 4 );
+
+	result = sigscan_test_scanner_scan_test_buffer_identifier(
+	          scanner,
+	          scan_state,
+	          buffer,
+	          &number_of_results,
+	          identifier,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = sigscan_test_scanner_scan_test_buffer_identifier(
+	          compiled_scanner,
+	          scan_state,
+	          buffer,
+	          &compiled_number_of_results,
+	          compiled_identifier,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 2 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "compiled_number_of_results",
+	 compiled_number_of_results,
+	 2 );
+
+	/* The header signature is reported first
+	 */
+	result = 0;
+
+	if( ( narrow_string_compare(
+	       compiled_identifier,
+	       "riff",
+	       5 ) == 0 )
+	 || ( narrow_string_compare(
+	       compiled_identifier,
+	       "ri",
+	       3 ) == 0 )
+	 || ( narrow_string_compare(
+	       compiled_identifier,
+	       "wave",
+	       5 ) == 0 ) )
+	{
+		result = 1;
+	}
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test scan where no signature matches
+	 */
+	memory_set(
+	 buffer,
+	 'x',
+	 128 );
+
+	result = sigscan_test_scanner_scan_test_buffer(
+	          compiled_scanner,
+	          scan_state,
+	          buffer,
+	          &compiled_number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "compiled_number_of_results",
+	 compiled_number_of_results,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &compiled_scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "compiled_scanner",
+	 compiled_scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( compiled_scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &compiled_scanner,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_remove_signature function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_remove_signature(
+     void )
+{
+	uint8_t buffer[ 128 ];
+	char identifier[ 16 ];
+
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state   = NULL;
+	libsigscan_scanner_t *scanner         = NULL;
+	int number_of_results                 = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "first",
+	          5,
+	          0,
+	          (uint8_t *) "ABCD",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_compile(
+	          scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 buffer,
+	 'x',
+	 128 );
+
+	memory_copy(
+	 &( buffer[ 10 ] ),
+	 "ABCD",
+	 4 );
+
+	memory_copy(
+	 &( buffer[ 50 ] ),
+	 "WXYZ",
+	 4 );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "second",
+	          6,
+	          0,
+	          (uint8_t *) "WXYZ",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = sigscan_test_scanner_scan_test_buffer(
+	          scanner,
+	          scan_state,
+	          buffer,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 2 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_remove_signature(
+	          scanner,
+	          "first",
+	          5,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The scan results of the previous scan remain available
+	 */
+	result = libsigscan_scan_state_get_result(
+	          scan_state,
+	          0,
+	          &scan_result,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_result_get_identifier(
+	          scan_result,
+	          identifier,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          identifier,
+	          "first",
+	          6 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libsigscan_scan_result_free(
+	          &scan_result,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = sigscan_test_scanner_scan_test_buffer(
+	          scanner,
+	          scan_state,
+	          buffer,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_remove_signature(
+	          scanner,
+	          "first",
+	          5,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_remove_signature(
+	          NULL,
+	          "second",
+	          6,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_remove_signature(
+	          scanner,
+	          NULL,
+	          6,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Writes the data to a test file
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_scanner_write_test_file(
+     const char *filename,
+     const uint8_t *data,
+     size_t data_size )
+{
+	FILE *file_stream  = NULL;
+	size_t write_count = 0;
+
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( file_stream == NULL )
+	{
+		return( -1 );
+	}
+	write_count = file_stream_write(
+	               file_stream,
+	               data,
+	               data_size );
+
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		return( -1 );
+	}
+	if( write_count != data_size )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libsigscan_scanner_scan_file function with only footer signatures
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_file_footer(
+     void )
+{
+	char identifier[ 16 ];
+
+	size_t data_sizes[ 3 ]                = { 100, 1000, 5000 };
+	const char *filename                  = "sigscan_test_scanner_footer.tmp";
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state   = NULL;
+	libsigscan_scanner_t *scanner         = NULL;
+	uint8_t *buffer                       = NULL;
+	off64_t offset                        = 0;
+	size_t data_size                      = 0;
+	int data_size_index                   = 0;
+	int file_written                      = 0;
+	int number_of_results                 = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "footer",
+	          6,
+	          12,
+	          (uint8_t *) "FOOTER",
+	          6,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * 5000 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan without header signatures of files that are smaller
+	 * and larger than the maximum range gap size
+	 */
+	for( data_size_index = 0;
+	     data_size_index < 3;
+	     data_size_index++ )
+	{
+		data_size = data_sizes[ data_size_index ];
+
+		memory_set(
+		 buffer,
+		 'x',
+		 data_size );
+
+		memory_copy(
+		 &( buffer[ data_size - 12 ] ),
+		 "FOOTER",
+		 6 );
+
+		result = sigscan_test_scanner_write_test_file(
+		          filename,
+		          buffer,
+		          data_size );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		file_written = 1;
+
+		result = libsigscan_scan_state_reset(
+		          scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_file(
+		          scanner,
+		          scan_state,
+		          filename,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_get_number_of_results(
+		          scan_state,
+		          &number_of_results,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "number_of_results",
+		 number_of_results,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_get_result(
+		          scan_state,
+		          0,
+		          &scan_result,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "scan_result",
+		 scan_result );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_result_get_offset(
+		          scan_result,
+		          &offset,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) data_size - 12 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_result_get_identifier(
+		          scan_result,
+		          identifier,
+		          16,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = narrow_string_compare(
+		          identifier,
+		          "footer",
+		          7 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libsigscan_scan_result_free(
+		          &scan_result,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	remove(
+	 filename );
+
+	file_written = 0;
+
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_written != 0 )
+	{
+		remove(
+		 filename );
+	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_write_image and libsigscan_scanner_set_image functions
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_write_image(
+     void )
+{
+	uint8_t buffer[ 128 ];
+
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *image_scanner = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	uint8_t *image_data                 = NULL;
+	size_t image_size                   = 0;
+	int number_of_results               = 0;
+	int result                          = 0;
+	int scanner_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "header",
+	          6,
+	          0,
+	          (uint8_t *) "HDR",
+	          3,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "short",
+	          5,
+	          0,
+	          (uint8_t *) "ABCD",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "long",
+	          4,
+	          0,
+	          (uint8_t *) "ABCDEF",
+	          6,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 buffer,
+	 'x',
+	 128 );
+
+	memory_copy(
+	 buffer,
+	 "HDR",
+	 3 );
+
+	memory_copy(
+	 &( buffer[ 10 ] ),
+	 "ABCDEF",
+	 6 );
+
+	memory_copy(
+	 &( buffer[ 94 ] ),
+	 "ABCD",
+	 4 );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_get_image_size(
+	          scanner,
+	          &image_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "image_size",
+	 (int64_t) image_size,
+	 (int64_t) 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The memory allocation is sufficiently aligned for the scanner image
+	 */
+	image_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * image_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "image_data",
+	 image_data );
+
+	result = libsigscan_scanner_write_image(
+	          scanner,
+	          image_data,
+	          image_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_initialize(
+	          &image_scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_set_image(
+	          image_scanner,
+	          image_data,
+	          image_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The scanner that was read from the image should find the same results
+	 */
+	for( scanner_index = 0;
+	     scanner_index < 2;
+	     scanner_index++ )
+	{
+		result = libsigscan_scan_state_initialize(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_set_data_size(
+		          scan_state,
+		          128,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_start(
+		          ( scanner_index == 0 ) ? scanner : image_scanner,
+		          scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_buffer(
+		          ( scanner_index == 0 ) ? scanner : image_scanner,
+		          scan_state,
+		          buffer,
+		          128,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_stop(
+		          ( scanner_index == 0 ) ? scanner : image_scanner,
+		          scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_get_number_of_results(
+		          scan_state,
+		          &number_of_results,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "number_of_results",
+		 number_of_results,
+		 3 );
+
+		result = libsigscan_scan_state_free(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_add_signature(
+	          image_scanner,
+	          "short",
+	          5,
+	          0,
+	          (uint8_t *) "ABCD",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_free(
+	          &image_scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_write_image(
+	          scanner,
+	          image_data,
+	          image_size - 1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test set image with a corrupted image
+	 */
+	image_data[ image_size - 1 ] ^= 0xff;
+
+	result = libsigscan_scanner_initialize(
+	          &image_scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_set_image(
+	          image_scanner,
+	          image_data,
+	          image_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scanner_free(
+	          &image_scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 image_data );
+
+	image_data = NULL;
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( image_scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &image_scanner,
+		 NULL );
+	}
+	if( image_data != NULL )
+	{
+		memory_free(
+		 image_data );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -346,20 +5327,88 @@ int main(
 
 	/* TODO: add tests for libsigscan_scanner_set_scan_buffer_size */
 
-	/* TODO: add tests for libsigscan_scanner_add_signature */
+	/* TODO: add tests for libsigscan_scanner_get_unbound_skip_table_type */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_set_number_of_build_workers",
+	 sigscan_test_scanner_set_number_of_build_workers );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_add_signature",
+	 sigscan_test_scanner_add_signature );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_remove_signature",
+	 sigscan_test_scanner_remove_signature );
+
+	/* TODO: add tests for libsigscan_scanner_get_number_of_signatures */
+
+	/* TODO: add tests for libsigscan_scanner_get_signature_identifier_size */
+
+	/* TODO: add tests for libsigscan_scanner_get_signature_identifier */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_compile",
+	 sigscan_test_scanner_compile );
 
 	/* TODO: add tests for libsigscan_scanner_scan_start */
 
 	/* TODO: add tests for libsigscan_scanner_scan_stop */
 
-	/* TODO: add tests for libsigscan_scanner_scan_buffer */
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_scan_buffer",
+	 sigscan_test_scanner_scan_buffer_unbound );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_scan_buffer",
+	 sigscan_test_scanner_scan_buffer_header );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_scan_buffer",
+	 sigscan_test_scanner_scan_buffer_footer );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_scan_buffer",
+	 sigscan_test_scanner_scan_buffer_footer_chunked );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_scan_buffer",
+	 sigscan_test_scanner_scan_buffer_in_place );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_scan_buffer",
+	 sigscan_test_scanner_scan_buffer_match_callback );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_scan_buffer",
+	 sigscan_test_scanner_scan_buffer_stop );
 
-	/* TODO: add tests for libsigscan_scanner_scan_file */
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_scan_file",
+	 sigscan_test_scanner_scan_file_footer );
 
 	/* TODO: add tests for libsigscan_scanner_scan_file_wide */
 
 	/* TODO: add tests for libsigscan_scanner_scan_file_io_handle */
 
+	/* TODO: add tests for libsigscan_scanner_get_image_size */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_write_image",
+	 sigscan_test_scanner_write_image );
+
+	/* TODO: add tests for libsigscan_scanner_read_image_file */
+
+	/* TODO: add tests for libsigscan_scanner_read_image_file_wide */
+
+	/* TODO: add tests for libsigscan_scanner_read_image_file_io_handle */
+
+	/* TODO: add tests for libsigscan_scanner_write_image_file */
+
+	/* TODO: add tests for libsigscan_scanner_write_image_file_wide */
+
+	/* TODO: add tests for libsigscan_scanner_write_image_file_io_handle */
+
 	return( EXIT_SUCCESS );
 
 on_error:
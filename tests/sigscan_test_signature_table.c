@@ -516,17 +516,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libsigscan_signature_table_get_signatures_list_clone function
+/* Tests the libsigscan_signature_table_get_largest_signature function
  * Returns 1 if successful or 0 if not
  */
-int sigscan_test_signature_table_get_signatures_list_clone(
+int sigscan_test_signature_table_get_largest_signature(
      void )
 {
 	libcerror_error_t *error                      = NULL;
+	libsigscan_signature_t *largest_signature     = NULL;
 	libsigscan_signature_table_t *signature_table = NULL;
-	libcdata_list_t *signatures_list_clone        = 0;
 	int result                                    = 0;
-	int signatures_list_clone_is_set              = 0;
 
 	/* Initialize test
 	 */
@@ -549,27 +548,29 @@ int sigscan_test_signature_table_get_signatures_list_clone(
 
 	/* Test regular cases
 	 */
-	result = libsigscan_signature_table_get_signatures_list_clone(
+	result = libsigscan_signature_table_get_largest_signature(
 	          signature_table,
-	          &signatures_list_clone,
+	          &largest_signature,
 	          &error );
 
-	SIGSCAN_TEST_ASSERT_NOT_EQUAL_INT(
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "largest_signature",
+	 largest_signature );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	signatures_list_clone_is_set = result;
-
 	/* Test error cases
 	 */
-	result = libsigscan_signature_table_get_signatures_list_clone(
+	result = libsigscan_signature_table_get_largest_signature(
 	          NULL,
-	          &signatures_list_clone,
+	          &largest_signature,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -584,25 +585,23 @@ int sigscan_test_signature_table_get_signatures_list_clone(
 	libcerror_error_free(
 	 &error );
 
-	if( signatures_list_clone_is_set != 0 )
-	{
-		result = libsigscan_signature_table_get_signatures_list_clone(
-		          signature_table,
-		          NULL,
-		          &error );
+	result = libsigscan_signature_table_get_largest_signature(
+	          signature_table,
+	          NULL,
+	          &error );
 
-		SIGSCAN_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libsigscan_signature_table_free(
@@ -668,6 +667,10 @@ int main(
 
 	/* TODO: add tests for libsigscan_signature_table_fill */
 
+	/* TODO: add tests for libsigscan_signature_table_fill_from_array */
+
+	/* TODO: add tests for libsigscan_signature_table_append_signature */
+
 	SIGSCAN_TEST_RUN(
 	 "libsigscan_signature_table_get_number_of_byte_value_groups",
 	 sigscan_test_signature_table_get_number_of_byte_value_groups );
@@ -680,9 +683,11 @@ int main(
 	 "libsigscan_signature_table_get_number_of_signatures",
 	 sigscan_test_signature_table_get_number_of_signatures );
 
+	/* TODO: add tests for libsigscan_signature_table_get_signature_by_index */
+
 	SIGSCAN_TEST_RUN(
-	 "libsigscan_signature_table_get_signatures_list_clone",
-	 sigscan_test_signature_table_get_signatures_list_clone );
+	 "libsigscan_signature_table_get_largest_signature",
+	 sigscan_test_signature_table_get_largest_signature );
 
 	/* TODO: add tests for libsigscan_signature_table_insert_signature */
 
@@ -270,6 +270,257 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libsigscan_skip_table_get_table_type function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_skip_table_get_table_type(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_skip_table_t *skip_table = NULL;
+	int result                          = 0;
+	int table_type                      = 0;
+	int table_type_is_set               = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_skip_table_initialize(
+	          &skip_table,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "skip_table",
+	 skip_table );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_skip_table_get_table_type(
+	          skip_table,
+	          &table_type,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "table_type",
+	 table_type,
+	 LIBSIGSCAN_SKIP_TABLE_TYPE_BYTE_VALUE );
+
+	table_type_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libsigscan_skip_table_get_table_type(
+	          NULL,
+	          &table_type,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( table_type_is_set != 0 )
+	{
+		result = libsigscan_skip_table_get_table_type(
+		          skip_table,
+		          NULL,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libsigscan_skip_table_free(
+	          &skip_table,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "skip_table",
+	 skip_table );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( skip_table != NULL )
+	{
+		libsigscan_skip_table_free(
+		 &skip_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_skip_table_get_largest_pattern_size function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_skip_table_get_largest_pattern_size(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_skip_table_t *skip_table = NULL;
+	size_t largest_pattern_size         = 0;
+	int result                          = 0;
+	int largest_pattern_size_is_set     = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_skip_table_initialize(
+	          &skip_table,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "skip_table",
+	 skip_table );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_skip_table_get_largest_pattern_size(
+	          skip_table,
+	          &largest_pattern_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	largest_pattern_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libsigscan_skip_table_get_largest_pattern_size(
+	          NULL,
+	          &largest_pattern_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( largest_pattern_size_is_set != 0 )
+	{
+		result = libsigscan_skip_table_get_largest_pattern_size(
+		          skip_table,
+		          NULL,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libsigscan_skip_table_free(
+	          &skip_table,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "skip_table",
+	 skip_table );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( skip_table != NULL )
+	{
+		libsigscan_skip_table_free(
+		 &skip_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libsigscan_skip_table_get_smallest_pattern_size function
  * Returns 1 if successful or 0 if not
  */
@@ -422,12 +673,28 @@ int main(
 
 	/* TODO: add tests for libsigscan_skip_table_fill */
 
+	/* TODO: add tests for libsigscan_skip_table_fill_block_skip_values */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_skip_table_get_table_type",
+	 sigscan_test_skip_table_get_table_type );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_skip_table_get_largest_pattern_size",
+	 sigscan_test_skip_table_get_largest_pattern_size );
+
 	SIGSCAN_TEST_RUN(
 	 "libsigscan_skip_table_get_smallest_pattern_size",
 	 sigscan_test_skip_table_get_smallest_pattern_size );
 
 	/* TODO: add tests for libsigscan_skip_table_get_skip_value */
 
+	/* TODO: add tests for libsigscan_skip_table_get_block_hash */
+
+	/* TODO: add tests for libsigscan_skip_table_get_block_skip_value */
+
+	/* TODO: add tests for libsigscan_skip_table_get_average_skip_value */
+
 	/* TODO: add tests for libsigscan_skip_table_printf */
 
 #endif /* defined( __GNUC__ ) */
@@ -10,7 +10,7 @@ $TestPrefix = Split-Path -path ${Pwd}.Path -parent
 $TestPrefix = Split-Path -path ${TestPrefix} -leaf
 $TestPrefix = ${TestPrefix}.Substring(3)
 
-$LibraryTests = "byte_value_group error notify offset_group pattern_weights scan_object scan_result scan_state scan_tree scan_tree_node scanner signature signature_group signature_table skip_table support weight_group"
+$LibraryTests = "aho_corasick batch batch_entry byte_value_group byte_value_profile checksum error hash_table mapped_file notify offset_group pattern_weights prefilter read_request scan_chunk scan_object scan_result scan_result_arena scan_state scan_tree scan_tree_arena scan_tree_build_task scan_tree_generation scan_tree_node scanner scanner_image signature signature_group signature_table skip_table support weight_group"
 $LibraryTestsWithInput = ""
 
 $TestToolDirectory = "..\msvscpp\Release"
@@ -11,7 +11,7 @@ TEST_PREFIX=`dirname ${PWD}`;
 TEST_PREFIX=`basename ${TEST_PREFIX} | sed 's/^lib\([^-]*\).*$/\1/'`;
 
 TEST_PROFILE="lib${TEST_PREFIX}";
-LIBRARY_TESTS="byte_value_group error notify offset_group pattern_weights scan_object scan_result scan_state scan_tree scan_tree_node scanner signature signature_group signature_table skip_table support weight_group";
+LIBRARY_TESTS="aho_corasick batch batch_entry byte_value_group byte_value_profile checksum error hash_table mapped_file notify offset_group pattern_weights prefilter read_request scan_chunk scan_object scan_result scan_result_arena scan_state scan_tree scan_tree_arena scan_tree_build_task scan_tree_generation scan_tree_node scanner scanner_image signature signature_group signature_table skip_table support weight_group";
 LIBRARY_TESTS_WITH_INPUT="";
 OPTION_SETS="";
 